@@ -9,6 +9,16 @@
 #endif
 #include "gfxfont.h"
 
+/// Layout of PROGMEM images for drawRGBBitmap(): with 8 each uint16_t entry
+/// holds one byte, two per pixel; with 16 each entry is a whole pixel.
+#ifndef bmp_data_bits
+#define bmp_data_bits 8
+#endif
+/// With 8-bit image data, whether a pixel's high byte comes first
+#ifndef MSB_first
+#define MSB_first 0
+#endif
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -6,9 +6,15 @@
 
 #include "RGBmatrixPanel.h"
 #include "Adafruit_GFX.h"
+#include "PanelDriver.h"
+#include "GlyphText.h"
+#include "Marquee.h"
+#include "Sprites.h"
 
 
-#include "bit_bmp.h"
+#include "pack_bmp.h" // bit_bmp.h packed by tools/pack_image.py
+#include "planes_bmp.h" // The same frames in back buffer layout
+#include "mascot.h"     // Pikachu at half size, as a two-frame sprite
 #include <string.h>
 #include <stdlib.h>
 
@@ -31,7 +37,21 @@
 #define D   A3
 #define E   A4
 
+// Single-buffered: two 64x64 buffers (12 KB at 4 planes) don't fit in the
+// Mega's 8 KB. Where they do (M0, M4), passing true double-buffers, and
+// swapBuffers(true) then only copies the rows drawn since the last swap.
 RGBmatrixPanel matrix(A, B, C, D, E, CLK, LAT, OE, false, 64);
+
+// FM6126A register setup; the RGB pins are the ones RGBmatrixPanel drives
+// on PORTA
+const uint8_t RGB_PINS[6] = {24, 25, 26, 27, 28, 29}; // R1 G1 B1 R2 G2 B2
+PanelDriver panelDriver(RGB_PINS, 6, CLK, LAT, OE, 64);
+
+// Cached-glyph renderer for the GFXfont text
+GlyphText text(matrix);
+
+// Row address settle time in microseconds, see address_delay_test()
+#define ADDRESS_DELAY 10
 //Configure the serial port to use the standard printf function
 //start
 int serial_putc( char c, struct __file * )
@@ -47,110 +67,29 @@ void printf_begin(void)
 
 void setup()
 {
-  Reginit();
+  panelDriver.begin();
   Serial.begin(115200);
   printf_begin();
+  matrix.setAddressDelay(ADDRESS_DELAY);
   matrix.begin();
+  matrix.calibrateTiming(); // Fit the refresh timing to this board and panel
+  //matrix.setBrightness(255); // Full brightness, default 64 (25%)
+  //matrix.setMaxISRLoad(20); // Or trade refresh rate for CPU time, e.g. for still images
+  printf("refresh %u Hz, ISR load %u%%\n", matrix.getRefreshRate(), matrix.getISRLoad());
   delay(500);
+  //address_delay_test(); // Uncomment to find ADDRESS_DELAY for a panel
 }
 
 
 
 void loop()
 {
-  // Do nothing -- image doesn't change
+  // Re-send the panel registers each pass (well under a millisecond) so a
+  // panel that lost them, e.g. after a brown-out, comes back by itself
+  panelDriver.write();
   Demo();
 }
 
-//Reginit
-void Reginit()
-{
-  pinMode(24, OUTPUT); //R1
-  pinMode(25, OUTPUT); //G1
-  pinMode(26, OUTPUT); //B1
-  pinMode(27, OUTPUT); //R2
-  pinMode(28, OUTPUT); //G2
-  pinMode(29, OUTPUT); //B2
-  pinMode(CLK, OUTPUT);
-  pinMode(OE, OUTPUT);
-  pinMode(LAT, OUTPUT);
-
-  digitalWrite(OE, HIGH);
-  digitalWrite(LAT, LOW);
-  digitalWrite(CLK, LOW);
-  int MaxLed = 64;
-
-  int C12[16] = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
-  int C13[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0};
-
-  for (int l = 0; l < MaxLed; l++)
-  {
-    int y = l % 16;
-    digitalWrite(24, LOW);
-    digitalWrite(25, LOW);
-    digitalWrite(26, LOW);
-    digitalWrite(27, LOW);
-    digitalWrite(28, LOW);
-    digitalWrite(29, LOW);
-    if (C12[y] == 1)
-    {
-      digitalWrite(24, HIGH);
-      digitalWrite(25, HIGH);
-      digitalWrite(26, HIGH);
-      digitalWrite(27, HIGH);
-      digitalWrite(28, HIGH);
-      digitalWrite(29, HIGH);
-    }
-    if (l > MaxLed - 12)
-    {
-      digitalWrite(LAT, HIGH);
-    }
-    else
-    {
-      digitalWrite(LAT, LOW);
-    }
-    digitalWrite(CLK, HIGH);
-    delayMicroseconds(2);
-    digitalWrite(CLK, LOW);
-  }
-  digitalWrite(LAT, LOW);
-  digitalWrite(CLK, LOW);
-
-  // Send Data to control register 12
-  for (int l = 0; l < MaxLed; l++)
-  {
-    int y = l % 16;
-    digitalWrite(24, LOW);
-    digitalWrite(25, LOW);
-    digitalWrite(26, LOW);
-    digitalWrite(27, LOW);
-    digitalWrite(28, LOW);
-    digitalWrite(29, LOW);
-    if (C13[y] == 1)
-    {
-      digitalWrite(24, HIGH);
-      digitalWrite(25, HIGH);
-      digitalWrite(26, HIGH);
-      digitalWrite(27, HIGH);
-      digitalWrite(28, HIGH);
-      digitalWrite(29, HIGH);
-    }
-    if (l > MaxLed - 13)
-    {
-      digitalWrite(LAT, HIGH);
-    }
-    else
-    {
-      digitalWrite(LAT, LOW);
-    }
-    digitalWrite(CLK, HIGH);
-    delayMicroseconds(2);
-    digitalWrite(CLK, LOW);
-  }
-  digitalWrite(LAT, LOW);
-  digitalWrite(CLK, LOW);
-}
-
 //Clear screen
 void screen_clear()
 {
@@ -161,7 +100,7 @@ void screen_clear()
  *  @brief:  display an image
  *           The image data is in the "bit_bmp.h"
  *           You can use some tools to get the image data
- *           You can set the data bits which is 8 or 16 and set the MSB first which is true or false on line 1001 of Adafruit_GFX.c
+ *           You can set the data bits which is 8 or 16 and set the MSB first which is true or false in Adafruit_GFX.h
  *  @param:    x   Top left corner x coordinate
  *             y   Top left corner y coordinate
  *         bitmap  byte array with 16-bit color bitmap,the image data is in the "bit_bmp.h"
@@ -174,6 +113,21 @@ void display_Image(int16_t x, int16_t y, const uint16_t bitmap[],int16_t w, int1
   matrix.display_image(x, y, bitmap, w, h);
 }
 
+/*  @name :  display_Image
+ *  @brief:  display a packed image
+ *           Make the data with tools/pack_image.py from .bmp files or from
+ *           arrays like the ones in "bit_bmp.h"; it takes a fraction of
+ *           their flash, so dozens of frames fit
+ *  @param:    x   Top left corner x coordinate
+ *             y   Top left corner y coordinate
+ *          image  packed image, the data is in the "pack_bmp.h"
+ *  @retval: None
+ */
+void display_Image(int16_t x, int16_t y, const uint8_t image[])
+{
+  matrix.display_image(x, y, image);
+}
+
 
 #include "Fonts/FreeSerif9pt7b.h"
 #include "Fonts/FreeSerifBoldItalic9pt7b.h"
@@ -194,6 +148,14 @@ void display_Image(int16_t x, int16_t y, const uint16_t bitmap[],int16_t w, int1
  */
 void display_text(int x, int y, char *str, const GFXfont *f, int color, int pixels_size)
 {
+  if (f != NULL)
+  {
+    // Same pixels as println() below, drawn from cached glyph rows
+    text.setFont(f);
+    text.setTextSize(pixels_size);
+    text.drawString(x, y, str, color);
+    return;
+  }
   matrix.setTextSize(pixels_size);// size 1 == 8 pixels high
   matrix.setTextWrap(false); // Don't wrap at end of line - will do ourselves
   matrix.setFont(f);      //set font
@@ -202,6 +164,77 @@ void display_text(int x, int y, char *str, const GFXfont *f, int color, int pixe
   matrix.println(str);
 }
 
+/*  @name :  address_delay_test
+ *  @brief:  find the shortest row address settle time a panel needs
+ *           Lights every fourth row and steps the settle time down from
+ *           10 us to 0, holding each for a few seconds and printing it on
+ *           the serial port. Too short a time shows up as faint ghosts in
+ *           the rows next to the lit ones; set ADDRESS_DELAY to the lowest
+ *           value that still looks clean (adding 1 or 2 us of margin).
+ *  @param:  None
+ *  @retval: None
+ */
+void address_delay_test()
+{
+  screen_clear();
+  for (int y = 0; y < matrix.height(); y += 4)
+    matrix.drawFastHLine(0, y, matrix.width(), matrix.Color333(7, 7, 7));
+
+  for (int us = 10; us >= 0; us--)
+  {
+    matrix.setAddressDelay(us);
+    printf("address delay %d us\n", us);
+    delay(3000);
+  }
+  matrix.setAddressDelay(ADDRESS_DELAY);
+}
+
+/*  @name : scroll_text
+ *  @brief: scroll a text string once across the panel from right to left
+ *  @param:    y            Top of the band it scrolls in
+ *           *str           Text string
+ *            *f            Text font, NULL for the built-in one
+ *           color          16-bit 5-6-5 Color to draw text with
+ *           speed          Pixels per second
+ *  @retval: None
+ */
+void scroll_text(int y, const char *str, const GFXfont *f, int color, int speed)
+{
+  Marquee marquee(matrix);
+  if (!marquee.begin(str, f, y, color, 0, speed))
+    return;
+  while (marquee.passes() == 0)
+    marquee.update();
+}
+
+/*  @name : bounce_sprite
+ *  @brief: bounce the animated mascot around the panel; only the area it
+ *          moves over is redrawn each step
+ *  @param:    ms           How long to keep it going
+ *  @retval: None
+ */
+void bounce_sprite(unsigned long ms)
+{
+  SpriteLayer sprites(matrix);
+  sprites.setBackground(NULL, matrix.Color333(0, 0, 1));
+  int x = 0, y = 0, dx = 1, dy = 1;
+  int8_t id = sprites.add(&Pikachu_sprite, x, y);
+  sprites.animate(id, 250);
+  sprites.redraw();
+
+  unsigned long start = millis();
+  while (millis() - start < ms)
+  {
+    x += dx;
+    y += dy;
+    if (x <= 0 || x >= matrix.width() - Pikachu_sprite.w) dx = -dx;
+    if (y <= 0 || y >= matrix.height() - Pikachu_sprite.h) dy = -dy;
+    sprites.move(id, x, y);
+    sprites.update();
+    delay(30);
+  }
+}
+
 void Demo()
 {
   screen_clear();
@@ -242,6 +275,18 @@ void Demo()
 
   screen_clear();
   
-  display_Image(0, 0, Pikachu2_64x64, 64, 64);
+  display_Image(0, 0, Pikachu2_64x64);
   delay(6000);
+
+  // A two-frame animation; frames in back buffer layout only need copying
+  for (int i = 0; i < 10; i++)
+  {
+    matrix.drawPlanes((i & 1) ? Pikachu2_64x64_planes : Pikachu1_64x64_planes);
+    delay(300);
+  }
+
+  screen_clear();
+  scroll_text(24, "RGB Matrix P3 64x64", &FreeSans9pt7b, 0x07FF, 50);
+
+  bounce_sprite(8000);
 }
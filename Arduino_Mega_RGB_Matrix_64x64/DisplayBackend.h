@@ -0,0 +1,139 @@
+#ifndef DISPLAY_BACKEND_H
+#define DISPLAY_BACKEND_H
+
+#include <Arduino.h>
+
+// Colors of an ordered dither (dither565()): a 2x2 pattern, entry
+// (y & 1) * 2 + (x & 1) for pixel (x, y)
+#define DITHER_PHASES 4
+
+// Display backend interface the automata draw through. Shared by
+// fresh_pico_project (lib/DisplayBackend) and Arduino_Mega_RGB_Matrix_64x64;
+// keep the two copies identical.
+//
+// A backend derives from DisplayBackend<itself> (CRTP) and provides the
+// primitives below; the base builds the rest of the drawing calls on them.
+// A backend with a faster version of one of those (MatrixController has
+// them all) declares its own, which hides the base's. Everything is
+// resolved at compile time, so there is no virtual call per pixel, row or
+// span. Which backend a build uses is chosen in src/Display.h.
+//
+// Primitives, in logical coordinates (the backend applies any panel map):
+//
+//   int16_t width(), int16_t height()
+//   void blitIndexedSpan(uint16_t y, uint16_t x, uint16_t count,
+//                        const uint8_t* src, const uint16_t* palette)
+//       Write count pixels of row y from column x on, src holding the
+//       palette index of each
+//   void fillSpan(uint16_t y, uint16_t x, uint16_t count, uint16_t color)
+//   void show()          Put the back buffer on the panel; waits for the swap
+//   bool tryShow()       The same without waiting: false, and nothing
+//                        shown, while the last frame's swap is pending
+//   bool swapPending()   True until a shown frame has reached the panel
+//                        (the vertical sync of a refresh)
+//   uint16_t color565(uint8_t r, uint8_t g, uint8_t b)
+//   uint16_t gammaColor565(uint8_t r, uint8_t g, uint8_t b)
+//       Gamma-corrected and rounded to the shades the panel shows, for
+//       building palettes
+//   static const uint8_t COLOR_DEPTH  Bits per channel the panel shows
+//
+// Colors are RGB565 on every backend; COLOR_DEPTH says how many of the top
+// bits of each channel reach the LEDs.
+
+template <class Backend>
+class DisplayBackend {
+  public:
+    // Write logical row y from one palette index per pixel (width() entries)
+    void blitIndexedRow(uint16_t y, const uint8_t* row, const uint16_t* palette) {
+      self().blitIndexedSpan(y, 0, self().width(), row, palette);
+    }
+
+    // Only the rows whose bit is set in rowMask (bit y & 7 of byte y >> 3);
+    // stride is the distance between frame rows (0 = width())
+    void blitIndexedRows(const uint8_t* frame, const uint16_t* palette, const uint8_t* rowMask, uint16_t stride = 0) {
+      uint16_t h = self().height();
+      if (stride == 0) stride = self().width();
+      for (uint16_t y = 0; y < h; y++) {
+        if (rowMask[y >> 3] == 0) {
+          y |= 7;
+          continue;
+        }
+        if (rowMask[y >> 3] & (1 << (y & 7))) {
+          self().blitIndexedRow(y, frame + (uint32_t)y * stride, palette);
+        }
+      }
+    }
+
+    // One bit-packed row (bit (x & 31) of word (x >> 5) set = onColor), as
+    // runs of one color
+    void blitBitmapSpan(uint16_t y, uint16_t x, uint16_t count, const uint32_t* rowBits, uint16_t offColor, uint16_t onColor) {
+      uint16_t end = x + count;
+      while (x < end) {
+        bool on = (rowBits[x >> 5] >> (x & 31)) & 1;
+        uint16_t run = 1;
+        while (x + run < end && (bool)((rowBits[(x + run) >> 5] >> ((x + run) & 31)) & 1) == on) run++;
+        self().fillSpan(y, x, run, on ? onColor : offColor);
+        x += run;
+      }
+    }
+
+    // Row-masked blit of a 1-bit frame, rows padded to 32 bits
+    void blitBitmapRows(const uint32_t* bits, uint16_t offColor, uint16_t onColor, const uint8_t* rowMask) {
+      uint16_t w = self().width();
+      uint16_t h = self().height();
+      uint16_t wordsPerRow = (w + 31) / 32;
+      for (uint16_t y = 0; y < h; y++) {
+        if (rowMask[y >> 3] == 0) {
+          y |= 7;
+          continue;
+        }
+        if (rowMask[y >> 3] & (1 << (y & 7))) {
+          self().blitBitmapSpan(y, 0, w, bits + (uint32_t)y * wordsPerRow, offColor, onColor);
+        }
+      }
+    }
+
+    // Set one pixel, clipped to the display
+    void drawMappedPixel(int16_t x, int16_t y, uint16_t color) {
+      if ((uint16_t)x >= (uint16_t)self().width() || (uint16_t)y >= (uint16_t)self().height()) return;
+      self().fillSpan(y, x, 1, color);
+    }
+
+    void fillScreen(uint16_t color) {
+      for (uint16_t y = 0; y < (uint16_t)self().height(); y++) {
+        self().fillSpan(y, 0, self().width(), color);
+      }
+    }
+
+    // Same as blitIndexedSpan(), but even and odd columns of the row go
+    // through palettes of their own (dithering); a pixel at a time here
+    void blitDitheredSpan(uint16_t y, uint16_t x, uint16_t count, const uint8_t* src, const uint16_t* even, const uint16_t* odd) {
+      if (even == odd) {
+        self().blitIndexedSpan(y, x, count, src, even);
+        return;
+      }
+      for (uint16_t i = 0; i < count; i++) {
+        self().blitIndexedSpan(y, x + i, 1, src + i, ((x + i) & 1) ? odd : even);
+      }
+    }
+
+    // The DITHER_PHASES colors (r, g, b) is shown with, gamma-corrected or
+    // not: a backend without dithering gives the nearest shade for each
+    void dither565(uint8_t r, uint8_t g, uint8_t b, bool gamma, uint16_t* phases) {
+      uint16_t c = gamma ? self().gammaColor565(r, g, b) : self().color565(r, g, b);
+      for (uint8_t p = 0; p < DITHER_PHASES; p++) phases[p] = c;
+    }
+
+    // Move the picture up by rows rows, for the caller to draw the bottom
+    // ones. A backend that can't read its buffer back returns false and
+    // the caller redraws every row instead.
+    bool scrollUp(uint16_t rows) {
+      (void)rows;
+      return false;
+    }
+
+  private:
+    Backend& self() { return *static_cast<Backend*>(this); }
+};
+
+#endif
@@ -0,0 +1,140 @@
+#include "GlyphText.h"
+
+#ifndef memcpy_P
+#define memcpy_P memcpy ///< PROGMEM is ordinary memory off AVR
+#endif
+
+GlyphText::GlyphText(Adafruit_GFX &gfx) : gfx(&gfx) {
+  hasFont = false;
+  size = 1;
+  slots = 0;
+}
+
+void GlyphText::setFont(const GFXfont *f) {
+  memset(tag, 0, sizeof tag);
+  hasFont = (f != NULL);
+  if (!hasFont)
+    return;
+  memcpy_P(&font, f, sizeof font);
+
+  // Slot size from the largest glyph, so any glyph fits any slot
+  uint16_t biggest = 0;
+  for (uint16_t c = font.first; c <= font.last; c++) {
+    GFXglyph g;
+    memcpy_P(&g, &font.glyph[c - font.first], sizeof g);
+    uint16_t bytes = ((g.width + 7) >> 3) * g.height;
+    if (bytes > biggest)
+      biggest = bytes;
+  }
+  slotBytes = biggest;
+  uint16_t fit = biggest ? GLYPH_CACHE_BYTES / biggest : 0;
+  slots = (fit > GLYPH_CACHE_SLOTS) ? GLYPH_CACHE_SLOTS : fit; // 0: uncached
+}
+
+void GlyphText::setTextSize(uint8_t s) { size = (s > 0) ? s : 1; }
+
+void GlyphText::load(uint8_t c, uint8_t s) {
+  GFXglyph g;
+  memcpy_P(&g, &font.glyph[c - font.first], sizeof g);
+  uint8_t rowBytes = (g.width + 7) >> 3;
+  uint8_t *row = &pool[s * slotBytes];
+  memset(row, 0, rowBytes * g.height);
+
+  // The font packs each glyph as one MSB-first bit stream; give every
+  // row its own bytes
+  const uint8_t *bits = &font.bitmap[g.bitmapOffset];
+  uint8_t byte = 0, bit = 0;
+  for (uint8_t yy = 0; yy < g.height; yy++, row += rowBytes) {
+    for (uint8_t xx = 0; xx < g.width; xx++) {
+      if (!(bit++ & 7))
+        byte = pgm_read_byte(bits++);
+      if (byte & 0x80)
+        row[xx >> 3] |= 0x80 >> (xx & 7);
+      byte <<= 1;
+    }
+  }
+  tag[s] = c;
+}
+
+// One fillRect() per run of lit pixels in a row bitmap
+void GlyphText::drawRow(const uint8_t *row, uint8_t w, int16_t x, int16_t y,
+                        uint16_t color) {
+  uint8_t xx = 0;
+  while (xx < w) {
+    if (!(row[xx >> 3] & (0x80 >> (xx & 7)))) {
+      xx++;
+      continue;
+    }
+    uint8_t start = xx;
+    while ((xx < w) && (row[xx >> 3] & (0x80 >> (xx & 7))))
+      xx++;
+    gfx->writeFillRect(x + start * size, y, (xx - start) * size, size, color);
+  }
+}
+
+int16_t GlyphText::drawString(int16_t x, int16_t y, const char *str,
+                              uint16_t color) {
+  if (!hasFont)
+    return x;
+  int16_t w = gfx->width(), h = gfx->height();
+
+  gfx->startWrite();
+  for (; *str; str++) {
+    uint8_t c = *str;
+    if ((c < font.first) || (c > font.last))
+      continue;
+    GFXglyph g;
+    memcpy_P(&g, &font.glyph[c - font.first], sizeof g);
+    int16_t gx = x + g.xOffset * size, gy = y + g.yOffset * size;
+    int16_t advance = g.xAdvance * size;
+
+    // Nothing to draw, or nothing of it on the display
+    if ((g.width == 0) || (g.height == 0) || (gx >= w) ||
+        (gx + g.width * size <= 0) || (gy >= h) ||
+        (gy + g.height * size <= 0)) {
+      x += advance;
+      continue;
+    }
+
+    uint8_t rowBytes = (g.width + 7) >> 3;
+    if (slots == 0) {
+      // Uncacheable font: unpack a row at a time instead
+      uint8_t line[32];
+      const uint8_t *bits = &font.bitmap[g.bitmapOffset];
+      uint8_t byte = 0, bit = 0;
+      for (uint8_t yy = 0; yy < g.height; yy++) {
+        memset(line, 0, rowBytes);
+        for (uint8_t xx = 0; xx < g.width; xx++) {
+          if (!(bit++ & 7))
+            byte = pgm_read_byte(bits++);
+          if (byte & 0x80)
+            line[xx >> 3] |= 0x80 >> (xx & 7);
+          byte <<= 1;
+        }
+        drawRow(line, g.width, gx, gy + yy * size, color);
+      }
+    } else {
+      uint8_t s = c % slots;
+      if (tag[s] != c)
+        load(c, s);
+      const uint8_t *row = &pool[s * slotBytes];
+      for (uint8_t yy = 0; yy < g.height; yy++, row += rowBytes)
+        drawRow(row, g.width, gx, gy + yy * size, color);
+    }
+    x += advance;
+  }
+  gfx->endWrite();
+  return x;
+}
+
+int16_t GlyphText::width(const char *str) {
+  if (!hasFont)
+    return 0;
+  int16_t w = 0;
+  for (; *str; str++) {
+    uint8_t c = *str;
+    if ((c >= font.first) && (c <= font.last))
+      w += pgm_read_byte(&font.glyph[c - font.first].xAdvance);
+  }
+  return w * size;
+}
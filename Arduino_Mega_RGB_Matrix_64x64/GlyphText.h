@@ -0,0 +1,90 @@
+#ifndef _GLYPHTEXT_H_
+#define _GLYPHTEXT_H_
+
+#include "Adafruit_GFX.h"
+
+/*!
+  @brief  Bytes of RAM for rasterized glyphs. The cache is split into
+          slots of the active font's largest glyph, direct-mapped by
+          character code.
+*/
+#ifndef GLYPH_CACHE_BYTES
+#define GLYPH_CACHE_BYTES 192
+#endif
+
+/*!
+  @brief  Most glyphs kept at once, whatever their size.
+*/
+#ifndef GLYPH_CACHE_SLOTS
+#define GLYPH_CACHE_SLOTS 16
+#endif
+
+/*!
+  @brief  Text renderer for GFXfont fonts, faster than Adafruit_GFX's own:
+          a glyph is unpacked from its PROGMEM bit stream once into row
+          bitmaps, and then every draw of it is one fillRect() per run of
+          lit pixels in a row instead of one drawPixel() per pixel.
+          Glyphs wholly off the display are skipped without being
+          unpacked, which is what keeps long scrolling tickers cheap.
+          Output matches Adafruit_GFX::print() for the same font, size
+          and cursor, with the cursor y on the baseline.
+*/
+class GlyphText {
+public:
+  /*!
+    @brief  Attach to a display.
+    @param  gfx  Display (or canvas) the text is drawn to.
+  */
+  GlyphText(Adafruit_GFX &gfx);
+
+  /*!
+    @brief  Select the font. Changing it empties the glyph cache.
+    @param  f  GFXfont to draw with; NULL draws nothing (the classic
+               built-in font isn't handled, use Adafruit_GFX for it).
+  */
+  void setFont(const GFXfont *f);
+
+  /*!
+    @brief  Magnification, as Adafruit_GFX::setTextSize().
+    @param  s  Pixel scale (1 and up).
+  */
+  void setTextSize(uint8_t s);
+
+  /*!
+    @brief   Draw a string. No wrapping; characters the font lacks are
+             skipped, as Adafruit_GFX does.
+    @param   x      Cursor x of the first character.
+    @param   y      Baseline.
+    @param   str    Text.
+    @param   color  16-bit 5-6-5 color.
+    @return  Cursor x after the last character.
+  */
+  int16_t drawString(int16_t x, int16_t y, const char *str, uint16_t color);
+
+  /*!
+    @brief   Sum of the characters' advances: how far drawString() moves
+             the cursor. Reads the glyph table only, never a bitmap.
+    @param   str  Text.
+    @return  Width in pixels.
+  */
+  int16_t width(const char *str);
+
+private:
+  // Unpack glyph c into slot s
+  void load(uint8_t c, uint8_t s);
+
+  // Draw the lit runs of a w-pixel row bitmap with its left end at (x, y)
+  void drawRow(const uint8_t *row, uint8_t w, int16_t x, int16_t y,
+               uint16_t color);
+
+  Adafruit_GFX *gfx;
+  GFXfont font;            // RAM copy of the font header
+  boolean hasFont;
+  uint8_t size;
+  uint16_t slotBytes;      // Bytes per slot: largest glyph's rows * row bytes
+  uint8_t slots;           // Usable slots for this font
+  uint8_t tag[GLYPH_CACHE_SLOTS]; // Character held by each slot, 0 = none
+  uint8_t pool[GLYPH_CACHE_BYTES];
+};
+
+#endif // _GLYPHTEXT_H_
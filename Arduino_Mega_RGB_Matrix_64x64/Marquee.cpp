@@ -0,0 +1,123 @@
+#include "Marquee.h"
+
+#ifndef memcpy_P
+#define memcpy_P memcpy ///< PROGMEM is ordinary memory off AVR
+#endif
+
+Marquee::Marquee(RGBmatrixPanel &matrix) : matrix(&matrix) {
+  strip = NULL;
+  pass = 0;
+}
+
+Marquee::~Marquee(void) { end(); }
+
+boolean Marquee::begin(const char *str, const GFXfont *f, int16_t y,
+                       uint16_t fg, uint16_t bg, uint16_t speed) {
+  end();
+
+  // Ink extent of the string: the first glyph may start left of the
+  // cursor, the last may end past its advance
+  int16_t x0 = 0, x1 = 0, y0 = 0, y1 = 8, x = 0;
+  if (f) {
+    GFXfont font;
+    memcpy_P(&font, f, sizeof font);
+    y0 = 0;
+    y1 = 0;
+    for (const char *s = str; *s; s++) {
+      uint8_t c = *s;
+      if ((c < font.first) || (c > font.last))
+        continue;
+      GFXglyph g;
+      memcpy_P(&g, &font.glyph[c - font.first], sizeof g);
+      if (g.width && g.height) {
+        if (x + g.xOffset < x0)
+          x0 = x + g.xOffset;
+        if (x + g.xOffset + g.width > x1)
+          x1 = x + g.xOffset + g.width;
+        if (g.yOffset < y0)
+          y0 = g.yOffset;
+        if (g.yOffset + g.height > y1)
+          y1 = g.yOffset + g.height;
+      }
+      x += g.xAdvance;
+    }
+  } else {
+    x1 = 6 * strlen(str); // 5x7 cell plus a blank column
+  }
+  if (x > x1)
+    x1 = x;
+  if ((x1 <= x0) || (y1 <= y0))
+    return false;
+
+  strip = new GFXcanvas1(x1 - x0, y1 - y0);
+  if (!strip->getBuffer()) {
+    end();
+    return false;
+  }
+  strip->setFont(f);
+  strip->setTextWrap(false);
+  strip->setTextColor(1);
+  strip->setCursor(-x0, -y0); // Baseline, or top-left for the classic font
+  strip->print(str);
+
+  top = y;
+  this->fg = fg;
+  this->bg = bg;
+  this->speed = speed;
+  offset = -matrix->width();
+  pass = 0;
+  carry = 0;
+  last = millis();
+  draw();
+  return true;
+}
+
+void Marquee::end(void) {
+  delete strip;
+  strip = NULL;
+}
+
+int16_t Marquee::height(void) { return strip ? strip->height() : 0; }
+
+boolean Marquee::update(void) {
+  if (!strip)
+    return false;
+
+  // Whole pixels due since the last step; the remainder carries over, so
+  // rounding never makes the speed drift
+  uint32_t now = millis();
+  uint32_t due = (uint32_t)(now - last) * speed + carry;
+  last = now;
+  carry = due % 1000;
+  if (due < 1000)
+    return false;
+
+  // Once off the left edge, come back in on the right
+  int16_t period = strip->width() + matrix->width();
+  offset += (due / 1000) % period;
+  while (offset >= strip->width()) {
+    offset -= period;
+    pass++;
+  }
+  draw();
+  return true;
+}
+
+// The display-wide window of the strip at offset, and background where the
+// window runs past either end of it
+void Marquee::draw(void) {
+  int16_t w = matrix->width(), h = strip->height();
+  int16_t sx0 = (offset < 0) ? -offset : 0;
+  int16_t sx1 = (strip->width() - offset < w) ? strip->width() - offset : w;
+  if (sx0 >= sx1) {
+    matrix->fillRect(0, top, w, h, bg);
+    return;
+  }
+  matrix->fillRect(0, top, sx0, h, bg);
+  matrix->fillRect(sx1, top, w - sx1, h, bg);
+
+  const uint8_t *row = strip->getBuffer();
+  uint16_t rowBytes = (strip->width() + 7) >> 3;
+  for (int16_t r = 0; r < h; r++, row += rowBytes)
+    matrix->drawBitRow(sx0, top + r, row, offset + sx0, sx1 - sx0, fg, bg);
+}
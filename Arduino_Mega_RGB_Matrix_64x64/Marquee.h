@@ -0,0 +1,77 @@
+#ifndef _MARQUEE_H_
+#define _MARQUEE_H_
+
+#include "RGBmatrixPanel.h"
+
+/*!
+  @brief  Text scrolled right to left across a band of the display. The
+          message is rendered once into an offscreen 1-bit strip; each
+          step then only copies a display-wide window of it into the
+          frame buffer, one drawBitRow() per row. The position follows
+          millis(), not the number of update() calls, so the speed stays
+          the same however long the caller takes per frame.
+*/
+class Marquee {
+public:
+  /*!
+    @brief  Attach to a display.
+    @param  matrix  Display the message scrolls across.
+  */
+  Marquee(RGBmatrixPanel &matrix);
+  ~Marquee(void);
+
+  /*!
+    @brief   Render a message and start scrolling it in from the right
+             edge. Replaces any message already running.
+    @param   str    Text.
+    @param   f      GFXfont, or NULL for the classic built-in font.
+    @param   y      Top of the band the message scrolls in.
+    @param   fg     16-bit 5-6-5 text color.
+    @param   bg     16-bit 5-6-5 band color.
+    @param   speed  Pixels per second.
+    @return  false if there was no RAM for the strip.
+  */
+  boolean begin(const char *str, const GFXfont *f, int16_t y, uint16_t fg,
+                uint16_t bg, uint16_t speed);
+
+  /*!
+    @brief  Stop and free the strip. The band is left as last drawn.
+  */
+  void end(void);
+
+  /*!
+    @brief   Move the message to where it should be by now and draw it.
+             Nothing is drawn while it hasn't moved a whole pixel, so
+             calling this faster than the speed costs next to nothing.
+    @return  true if the band was redrawn.
+  */
+  boolean update(void);
+
+  /*!
+    @brief   Complete passes so far: the message has come in on the right
+             and left on the left this many times.
+    @return  Pass count.
+  */
+  uint16_t passes(void) { return pass; }
+
+  /*!
+    @brief   Height of the band, for clearing it after end().
+    @return  Rows, 0 with no message.
+  */
+  int16_t height(void);
+
+private:
+  void draw(void);
+
+  RGBmatrixPanel *matrix;
+  GFXcanvas1 *strip; // Rendered message, NULL when stopped
+  int16_t top;       // Display row of the strip's top
+  uint16_t fg, bg;
+  uint16_t speed;    // Pixels per second
+  int16_t offset;    // Strip column at the display's left edge
+  uint16_t pass;
+  uint32_t last;     // millis() of the last position update
+  uint16_t carry;    // Pixel-milliseconds not yet turned into a step
+};
+
+#endif // _MARQUEE_H_
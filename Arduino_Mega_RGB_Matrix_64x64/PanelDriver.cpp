@@ -0,0 +1,138 @@
+#include "PanelDriver.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <hardware/gpio.h>
+
+// SIO writes land within a couple of system clocks; hold CLK a little so
+// the edge survives the ribbon cable (about 60 ns at 133 MHz)
+#define CLOCK_HOLD() __asm volatile ("nop\n nop\n nop\n nop\n nop\n nop\n nop\n nop")
+#else
+// A port read-modify-write already takes longer than the chips need
+#define CLOCK_HOLD()
+#endif
+
+PanelDriver::PanelDriver(const uint8_t* rgbPins, uint8_t rgbCount,
+                         uint8_t clockPin, uint8_t latchPin, uint8_t oePin,
+                         uint16_t chainWidth,
+                         const PanelDriverConfig& config) {
+  this->rgbPins = rgbPins;
+  this->rgbCount = rgbCount;
+  this->clockPin = clockPin;
+  this->latchPin = latchPin;
+  this->oePin = oePin;
+  this->chainWidth = chainWidth;
+  this->config = config;
+}
+
+void PanelDriver::begin() {
+  for (uint8_t i = 0; i < rgbCount; i++) pinMode(rgbPins[i], OUTPUT);
+  pinMode(clockPin, OUTPUT);
+  pinMode(latchPin, OUTPUT);
+  pinMode(oePin, OUTPUT);
+
+#if defined(ARDUINO_ARCH_RP2040)
+  rgbMask = 0;
+  for (uint8_t i = 0; i < rgbCount; i++) rgbMask |= 1UL << rgbPins[i];
+  clockMask = 1UL << clockPin;
+  latchMask = 1UL << latchPin;
+  oeMask = 1UL << oePin;
+#else
+  // Usually all six data pins share one port, making each bit one write
+  rgbPortCount = 0;
+  for (uint8_t i = 0; i < rgbCount; i++) {
+    volatile PanelPort* reg = (volatile PanelPort*)portOutputRegister(digitalPinToPort(rgbPins[i]));
+    PanelPort mask = digitalPinToBitMask(rgbPins[i]);
+    uint8_t p = 0;
+    while (p < rgbPortCount && rgbPorts[p].reg != reg) p++;
+    if (p == rgbPortCount) {
+      if (p == sizeof(rgbPorts) / sizeof(rgbPorts[0])) continue;
+      rgbPorts[p].reg = reg;
+      rgbPorts[p].mask = 0;
+      rgbPortCount++;
+    }
+    rgbPorts[p].mask |= mask;
+  }
+  clockBits.reg = (volatile PanelPort*)portOutputRegister(digitalPinToPort(clockPin));
+  clockBits.mask = digitalPinToBitMask(clockPin);
+  latchBits.reg = (volatile PanelPort*)portOutputRegister(digitalPinToPort(latchPin));
+  latchBits.mask = digitalPinToBitMask(latchPin);
+  oeBits.reg = (volatile PanelPort*)portOutputRegister(digitalPinToPort(oePin));
+  oeBits.mask = digitalPinToBitMask(oePin);
+#endif
+
+  write();
+}
+
+void PanelDriver::setConfig(const PanelDriverConfig& config) {
+  this->config = config;
+}
+
+#if defined(ARDUINO_ARCH_RP2040)
+#define SET(m) gpio_set_mask(m)
+#define CLR(m) gpio_clr_mask(m)
+#define RGB_SET() SET(rgbMask)
+#define RGB_CLR() CLR(rgbMask)
+#define CLK_SET() SET(clockMask)
+#define CLK_CLR() CLR(clockMask)
+#define LAT_SET() SET(latchMask)
+#define LAT_CLR() CLR(latchMask)
+#define OE_SET() SET(oeMask)
+#else
+#define SET(b) (*(b).reg |= (b).mask)
+#define CLR(b) (*(b).reg &= ~(b).mask)
+#define RGB_SET() for (uint8_t p = 0; p < rgbPortCount; p++) SET(rgbPorts[p])
+#define RGB_CLR() for (uint8_t p = 0; p < rgbPortCount; p++) CLR(rgbPorts[p])
+#define CLK_SET() SET(clockBits)
+#define CLK_CLR() CLR(clockBits)
+#define LAT_SET() SET(latchBits)
+#define LAT_CLR() CLR(latchBits)
+#define OE_SET() SET(oeBits)
+#endif
+
+void PanelDriver::writeRegister(uint16_t bits, uint8_t latchClocks) {
+  // LAT goes up after chainWidth - latchClocks clocks, exactly as in the
+  // sequence these panels were brought up with
+  uint16_t latchAfter = chainWidth - latchClocks;
+  for (uint16_t l = 0; l < chainWidth; l++) {
+    if (bits & (1 << (l & 15))) {
+      RGB_SET();
+    } else {
+      RGB_CLR();
+    }
+    if (l > latchAfter) LAT_SET();
+    CLK_SET();
+    CLOCK_HOLD();
+    CLK_CLR();
+  }
+  LAT_CLR();
+}
+
+void PanelDriver::write() {
+  noInterrupts();
+#if defined(ARDUINO_ARCH_RP2040)
+  // With the PIO refresh the pins belong to a state machine; borrow them
+  // for SIO and hand them back afterwards
+  uint32_t allMask = rgbMask | clockMask | latchMask | oeMask;
+  uint8_t functions[32];
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if (!(allMask & (1UL << pin))) continue;
+    functions[pin] = gpio_get_function(pin);
+    gpio_set_function(pin, GPIO_FUNC_SIO);
+  }
+  gpio_set_dir_out_masked(allMask);
+#endif
+
+  // Dark while the registers go in
+  OE_SET();
+  LAT_CLR();
+  CLK_CLR();
+  writeRegister(config.reg12, 12);
+  writeRegister(config.reg13, 13);
+
+#if defined(ARDUINO_ARCH_RP2040)
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if (allMask & (1UL << pin)) gpio_set_function(pin, (decltype(gpio_get_function(0)))functions[pin]);
+  }
+#endif
+  interrupts();
+}
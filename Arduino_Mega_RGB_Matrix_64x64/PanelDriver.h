@@ -0,0 +1,77 @@
+#ifndef PANEL_DRIVER_H
+#define PANEL_DRIVER_H
+
+#include <Arduino.h>
+
+// Control register setup for FM6126A-style panel driver chips, which stay
+// dark (or ghost) until their configuration registers are written. Shared
+// by fresh_pico_project (lib/PanelDriver) and Arduino_Mega_RGB_Matrix_64x64;
+// keep the two copies identical.
+//
+// A register is written by shifting 16 bits into every chip of the chain
+// with LAT raised for the last few clocks; how many selects the register
+// (12 or 13). All GPIO goes through masked port set/clear writes rather
+// than digitalWrite, so the whole sequence takes well under a millisecond
+// and write() can be repeated any time to recover panels that lost their
+// configuration (brown-out, hot-plug) without restarting the refresh.
+
+// Register values, bit i = the bit shifted out at position i of each chip
+// (the C12 / C13 arrays of the old Reginit())
+struct PanelDriverConfig {
+  uint16_t reg12;
+  uint16_t reg13;
+};
+
+// FM6126A as these panels want it: C12 all on but bit 0, C13 bit 9
+static const PanelDriverConfig PANEL_DRIVER_FM6126A = { 0xFFFE, 0x0200 };
+
+class PanelDriver {
+  public:
+    // rgbPins holds rgbCount pins (6 per parallel chain), all written with
+    // the same bit; chainWidth is the pixels clocked per chain (every
+    // panel on it, so every chip gets its registers)
+    PanelDriver(const uint8_t* rgbPins, uint8_t rgbCount,
+                uint8_t clockPin, uint8_t latchPin, uint8_t oePin,
+                uint16_t chainWidth,
+                const PanelDriverConfig& config = PANEL_DRIVER_FM6126A);
+
+    // Set the pins up as outputs and write the registers. Call before the
+    // matrix driver's begin().
+    void begin();
+
+    // Write both registers again. Safe while the matrix is refreshing: it
+    // runs with interrupts off and takes the pins back from a PIO for the
+    // duration, so at most one refresh shows garbage.
+    void write();
+
+    void setConfig(const PanelDriverConfig& config);
+
+  private:
+    void writeRegister(uint16_t bits, uint8_t latchClocks);
+
+    const uint8_t* rgbPins;
+    uint8_t rgbCount;
+    uint8_t clockPin, latchPin, oePin;
+    uint16_t chainWidth;
+    PanelDriverConfig config;
+
+#if defined(ARDUINO_ARCH_RP2040)
+    uint32_t rgbMask, clockMask, latchMask, oeMask;
+#else
+#if defined(__AVR__)
+    typedef uint8_t PanelPort;
+#else
+    typedef uint32_t PanelPort;
+#endif
+    // Each pin as port output register + bit; the RGB pins grouped per port
+    struct PortBits {
+      volatile PanelPort* reg;
+      PanelPort mask;
+    };
+    PortBits rgbPorts[4];
+    uint8_t rgbPortCount;
+    PortBits clockBits, latchBits, oeBits;
+#endif
+};
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef RGBMATRIX_DISPLAY_H
+#define RGBMATRIX_DISPLAY_H
+
+#include "RGBmatrixPanel.h"
+#include "DisplayBackend.h"
+
+// Display backend (DisplayBackend.h) over RGBmatrixPanel, so code written
+// for the Pico's MatrixController, the automata in
+// fresh_pico_project/src/CellularAutomata.h among it, can draw on this
+// panel: build with -D DISPLAY_RGBMATRIXPANEL and that src directory on the
+// include path. Only the primitives are here; rows of indices go out a
+// chunk at a time through drawRGBRow(), spans through drawFastHLine().
+//
+// The matrix should be double-buffered. Every swap copies the shown rows
+// back (swapBuffers(true)), because the automata only redraw what changed.
+class RGBmatrixDisplay : public DisplayBackend<RGBmatrixDisplay> {
+  public:
+    static const uint8_t COLOR_DEPTH = RGBMATRIX_PLANES;
+
+    RGBmatrixDisplay(RGBmatrixPanel& panel) : panel(panel), pending(false) {}
+
+    int16_t width() { return panel.width(); }
+    int16_t height() { return panel.height(); }
+
+    void blitIndexedSpan(uint16_t y, uint16_t x, uint16_t count, const uint8_t* src, const uint16_t* palette) {
+      uint16_t colors[32];
+      while (count > 0) {
+        uint16_t n = count < 32 ? count : 32;
+        for (uint16_t i = 0; i < n; i++) colors[i] = palette[src[i]];
+        panel.drawRGBRow(x, y, colors, n);
+        x += n;
+        src += n;
+        count -= n;
+      }
+    }
+
+    void fillSpan(uint16_t y, uint16_t x, uint16_t count, uint16_t color) {
+      panel.drawFastHLine(x, y, count, color);
+    }
+
+    // Finish any swap still pending, then swap and wait for it
+    void show() {
+      while (swapPending()) {
+      }
+      panel.swapBuffers(true);
+    }
+
+    // Ask for the swap at the end of the refresh under way; false, with
+    // nothing asked, while the last one hasn't happened yet. Don't draw
+    // until swapPending() is false again.
+    bool tryShow() {
+      if (swapPending()) return false;
+      pending = !panel.trySwap(true);
+      return true;
+    }
+
+    bool swapPending() {
+      if (pending) pending = !panel.trySwap(true);
+      return pending;
+    }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+      return panel.Color888(r, g, b);
+    }
+
+    // The panel's own gamma table, which rounds to its bit planes
+    uint16_t gammaColor565(uint8_t r, uint8_t g, uint8_t b) {
+      return panel.Color888(r, g, b, true);
+    }
+
+    RGBmatrixPanel& getPanel() { return panel; }
+
+  private:
+    RGBmatrixPanel& panel;
+    bool pending;  // A trySwap() that hasn't gone through yet
+};
+
+#endif
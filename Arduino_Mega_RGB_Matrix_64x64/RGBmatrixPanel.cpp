@@ -67,6 +67,20 @@
 #include "driver/timer.h"
 #include "freertos/FreeRTOS.h"
 #include <string.h>
+#if defined(RGBMATRIX_USE_DMA)
+#include "driver/periph_ctrl.h"
+#include "esp_heap_caps.h"
+#include "esp_intr_alloc.h"
+#include "rom/gpio.h"
+#include "rom/lldesc.h"
+#include "soc/gpio_sig_map.h"
+#include "soc/i2s_reg.h"
+#include "soc/i2s_struct.h"
+#endif
+#endif
+
+#ifndef memcpy_P
+#define memcpy_P memcpy ///< PROGMEM is ordinary memory off AVR
 #endif
 
 #ifndef _swap_int16_t
@@ -117,7 +131,100 @@
 #define CLKPORT PORTB  ///< RGB clock PORT register
 #endif
 
-#define nPlanes 4 ///< Bit depth per R,G,B (4 = (2^4)^3 = 4096 colors)
+#define nPlanes RGBMATRIX_PLANES ///< Bit depth per R,G,B (4 = 4096 colors)
+
+// Plane bytes per column of a row, each shared by a pixel in the upper and
+// one in the lower half of the display. 4 planes pack into 3: planes 1-3
+// sit in port order in the high six bits and plane 0 is spread over the
+// low two (see colorPlanes()). Deeper displays keep every plane in port
+// order, one byte each.
+#if nPlanes == 4
+#define nBytes 3
+#else
+#define nBytes nPlanes
+#endif
+
+// Brightness until setBrightness() says otherwise: 25%, as pixel data
+// used to be scaled to before dimming moved into the refresh timing
+#define DEFAULT_BRIGHTNESS 64
+
+// Bits of the plane bytes at a pixel's base address (0, WIDTH, 2 * WIDTH...
+// bytes ahead) that belong to a pixel in the upper [0] and the lower [1]
+// half of the display. Together they cover every bit of each byte.
+#if nPlanes == 4
+static const uint8_t planeMask[2][nBytes] = {
+    {B00011100, B00011101, B00011111}, {B11100011, B11100010, B11100000}};
+#else
+static uint8_t planeMask[2][nBytes]; // B00011100 and B11100000, from init()
+#endif
+
+// Channel fields of a 5/6/5 color that select a planeTable entry: the top
+// 4 bits of each with 4 planes, all of them with more
+#if nPlanes == 4
+#define LEVELS 16
+#define RED(c) ((c) >> 12)          // RRRRrggggggbbbbb
+#define GREEN(c) (((c) >> 7) & 0xF) // rrrrrGGGGggbbbbb
+#define BLUE(c) (((c) >> 1) & 0xF)  // rrrrrggggggBBBBb
+#else
+#define LEVELS 64
+#define RED(c) ((c) >> 11)          // RRRRRggggggbbbbb
+#define GREEN(c) (((c) >> 5) & 0x3F) // rrrrrGGGGGGbbbbb
+#define BLUE(c) ((c) & 0x1F)        // rrrrrggggggBBBBB
+#endif
+
+// Plane bytes by half, channel (R, G, B) and channel field, from
+// colorPlanes(). The channels use disjoint bits, so a color's bytes are the
+// OR of its three entries. Filled in by init().
+static uint8_t planeTable[2][3][LEVELS][nBytes];
+
+// Two constants are used in timing each successive BCM interval.
+// These were found empirically, by checking the value of TCNT1 at
+// certain positions in the interrupt code.
+// CALLOVERHEAD is the number of CPU 'ticks' from the timer overflow
+// condition (triggering the interrupt) to the first line in the
+// updateDisplay() method.  It's then assumed (maybe not entirely 100%
+// accurately, but close enough) that a similar amount of time will be
+// needed at the opposite end, restoring regular program flow.
+// LOOPTIME is the number of 'ticks' spent inside the shortest data-
+// issuing loop (not actually a 'loop' because it's unrolled, but eh).
+// Both numbers are rounded up slightly to allow a little wiggle room
+// should different compilers produce slightly different results.
+#if defined(__AVR__)
+#define CALLOVERHEAD 60 // Actual value measured = 56
+#define LOOPTIME 200    // 200 Actual value measured = 188
+#endif
+#if defined(ARDUINO_ARCH_SAMD)
+#define CALLOVERHEAD 60 // Actual = 58
+#define LOOPTIME 600    // Actual = 558
+#endif
+#if defined(ARDUINO_ARCH_ESP32)
+#define CALLOVERHEAD 30 // Actual = 25
+#define LOOPTIME 400    // Actual = 1563 / 4
+#endif
+// These are only starting values: calibrateTiming() measures both on the
+// running hardware, with the refresh timer itself (wider panels take
+// longer to shift out, for one).
+#if defined(__AVR__)
+#define TIMER_HZ F_CPU // Timer1, no prescale
+#elif defined(__SAMD51__)
+#define TIMER_HZ 48000000 // TC4 on the 48 MHz DFLL
+#elif defined(ARDUINO_ARCH_SAMD)
+#define TIMER_HZ F_CPU // TC4 on GCLK0
+#elif defined(ARDUINO_ARCH_ESP32)
+#define TIMER_HZ 40000000 // Timer group 1, divider 2
+#endif
+#define CAL_FRAMES 4 ///< Full frames measured by calibrateTiming()
+
+// Largest refresh timer count (TimerCount), which the longest plane's
+// interval has to fit
+#if defined(ARDUINO_ARCH_ESP32)
+#define MAXCOUNT 0xFFFFFFFF
+#else
+#define MAXCOUNT 0xFFFF
+#endif
+#if ((LOOPTIME + CALLOVERHEAD * 2) * ((1 << (nPlanes - 1)) + 1)) > MAXCOUNT
+#error "Too many bit planes (RGBMATRIX_PLANES) for this board's refresh timer"
+#endif
 
 // The fact that the display driver interrupt stuff is tied to the
 // singular Timer1 doesn't really take well to object orientation with
@@ -155,7 +262,7 @@ void RGBmatrixPanel::init(uint8_t rows, uint8_t a, uint8_t b, uint8_t c,
   nRows = rows; // Number of multiplexed rows; actual height is 2X this
 
   // Allocate and initialize matrix buffer:
-  int buffsize = width * nRows * 3, // x3 = 3 bytes holds 4 planes "packed"
+  int buffsize = width * nRows * nBytes, // 3 bytes hold 4 planes "packed"
       allocsize = (dbuf == true) ? (buffsize * 2) : buffsize;
   if (NULL == (matrixbuff[0] = (uint8_t *)malloc(allocsize)))
     return;
@@ -184,10 +291,43 @@ void RGBmatrixPanel::init(uint8_t rows, uint8_t a, uint8_t b, uint8_t c,
   addrbmask = digitalPinToBitMask(b);
   addrcport = portOutputRegister(digitalPinToPort(c));
   addrcmask = digitalPinToBitMask(c);
+  addrmask = 0;    // Worked out by begin(), once all the pins are known
+  calloverhead = CALLOVERHEAD; // Until calibrateTiming() measures them
+  looptime = shifttime = LOOPTIME;
+  rowbusy = 0;
+  calibrating = false;
+  brightness = DEFAULT_BRIGHTNESS;
+  blanking = false;
+#if defined(RGBMATRIX_USE_DMA)
+  dmabuff[0] = dmabuff[1] = NULL; // Until begin() sets up the DMA
+  dmaswap = 0;
+#endif
+  addrdelay = 10;  // Settle time older panels were found to need
   plane = nPlanes - 1;
   row = nRows - 1;
   swapflag = false;
   backindex = 0; // Array index of back buffer
+  memset(dirtyrow, 0, sizeof dirtyrow); // Both buffers start out cleared
+  swapposted = false;
+  swapcallback = NULL;
+
+#if nPlanes > 4
+  memset(planeMask[0], B00011100, nBytes);
+  memset(planeMask[1], B11100000, nBytes);
+#endif
+
+  // One color per channel value, with the other channels off
+  for (uint8_t v = 0; v < LEVELS; v++) {
+#if nPlanes == 4
+    colorPlanes(v << 12, planeTable[0][0][v], planeTable[1][0][v]); // R
+    colorPlanes(v << 7, planeTable[0][1][v], planeTable[1][1][v]);  // G
+    colorPlanes(v << 1, planeTable[0][2][v], planeTable[1][2][v]);  // B
+#else
+    colorPlanes((v & 0x1F) << 11, planeTable[0][0][v], planeTable[1][0][v]);
+    colorPlanes(v << 5, planeTable[0][1][v], planeTable[1][1][v]);
+    colorPlanes(v & 0x1F, planeTable[0][2][v], planeTable[1][2][v]);
+#endif
+  }
 }
 
 // Constructor for 16x32 panel:
@@ -296,6 +436,27 @@ void RGBmatrixPanel::begin(void) {
     *addreport &= ~addremask; // Low
   }
 
+  // When the address pins all sit on one port (A0-A4 on the Mega do), each
+  // row's pin states are tabulated so the interrupt can switch rows with a
+  // single port write
+  addrmask = 0;
+  if ((addrbport == addraport) && (addrcport == addraport) &&
+      ((nRows <= 8) || (addrdport == addraport)) &&
+      ((nRows <= 16) || (addreport == addraport))) {
+    PortType linemask[5] = {addramask, addrbmask, addrcmask, addrdmask,
+                            addremask};
+    uint8_t lines = (nRows > 16) ? 5 : (nRows > 8) ? 4 : 3;
+    for (uint8_t r = 0; r < nRows; r++) {
+      rowaddr[r] = 0;
+      for (uint8_t i = 0; i < lines; i++) {
+        if (r & (1 << i))
+          rowaddr[r] |= linemask[i];
+      }
+    }
+    for (uint8_t i = 0; i < lines; i++)
+      addrmask |= linemask[i];
+  }
+
 #if defined(__AVR__)
 
   // The high six bits of the data port are set as outputs;
@@ -371,6 +532,11 @@ void RGBmatrixPanel::begin(void) {
   }
 #endif
 
+#if defined(RGBMATRIX_USE_DMA)
+  if (dmaBegin())
+    return; // No refresh interrupt needed
+#endif
+
 #if defined(ARDUINO_ARCH_ESP32)
   timer_config_t tim_config;
   tim_config.divider = 2; // Run Timer at 40 MHz
@@ -532,7 +698,16 @@ uint16_t RGBmatrixPanel::Color888(uint8_t r, uint8_t g, uint8_t b) {
 // 8/8/8 -> gamma -> 5/6/5
 uint16_t RGBmatrixPanel::Color888(uint8_t r, uint8_t g, uint8_t b,
                                   boolean gflag) {
-  if (gflag) {                          // Gamma-corrected color?
+  if (gflag) { // Gamma-corrected color?
+#if nPlanes > 4
+    // More than 4 bits per channel get shown, so correct to 8 bits and
+    // keep whatever 5/6/5 can hold
+    r = pgm_read_byte(&gamma_table_8[r]);
+    g = pgm_read_byte(&gamma_table_8[g]);
+    b = pgm_read_byte(&gamma_table_8[b]);
+    return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) |
+           (b >> 3);
+#endif
     r = pgm_read_byte(&gamma_table[r]); // Gamma correction table maps
     g = pgm_read_byte(&gamma_table[g]); // 8-bit input to 4-bit output
     b = pgm_read_byte(&gamma_table[b]);
@@ -598,6 +773,18 @@ uint16_t RGBmatrixPanel::ColorHSV(long hue, uint8_t sat, uint8_t val,
   // Value (brightness) & 16-bit color reduction: similar to above, add 1
   // to allow shifts, and upgrade to int makes other conversions implicit.
   v1 = val + 1;
+#if nPlanes > 4
+  // 8-bit results, as in Color888()
+  r = (r * v1) >> 8;
+  g = (g * v1) >> 8;
+  b = (b * v1) >> 8;
+  if (gflag) {
+    r = pgm_read_byte(&gamma_table_8[r]);
+    g = pgm_read_byte(&gamma_table_8[g]);
+    b = pgm_read_byte(&gamma_table_8[b]);
+  }
+  return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
+#endif
   if (gflag) { // Gamma-corrected color?
     r = pgm_read_byte(
         &gamma_table[(r * v1) >> 8]); // Gamma correction table maps
@@ -614,127 +801,545 @@ uint16_t RGBmatrixPanel::ColorHSV(long hue, uint8_t sat, uint8_t val,
 }
 
 void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t c) {
-  uint8_t r, g, b, bit, limit, *ptr;
-  uint8_t bit_offset=6;//suggest bit_offset set to 6 or 7, 7:50% brightness 6:25% brightness
-
   if ((x < 0) || (x >= _width) || (y < 0) || (y >= _height))
     return;
 
+  if (rotation) {
+    switch (rotation) {
+    case 1:
+      _swap_int16_t(x, y);
+      x = WIDTH - 1 - x;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      _swap_int16_t(x, y);
+      y = HEIGHT - 1 - y;
+      break;
+    }
+  }
+
+  // Data for the upper half of the display is stored in the lower bits of
+  // each byte, and for the lower half in the upper bits (plane 0 of 4
+  // aside, see colorPlanes()). Adafruit_GFX uses 16-bit color in 5/6/5
+  // format, while 4 planes only take 4/4/4: the top 4 bits of each
+  // channel pick its entry then.
+  uint8_t half = (y >= nRows);
+  const uint8_t(*table)[LEVELS][nBytes] = planeTable[half];
+  const uint8_t *r = table[0][RED(c)];
+  const uint8_t *g = table[1][GREEN(c)];
+  const uint8_t *b = table[2][BLUE(c)];
+  const uint8_t *mask = planeMask[half];
+  markRow(y - half * nRows);
+  uint8_t *ptr =
+      &matrixbuff[backindex][(y - half * nRows) * WIDTH * nBytes + x];
+
+  for (uint8_t k = 0; k < nBytes; k++) {
+    *ptr = (*ptr & ~mask[k]) | r[k] | g[k] | b[k];
+    ptr += WIDTH; // Advance to next bit plane
+  }
+}
+
+void RGBmatrixPanel::fillScreen(uint16_t c) {
+  memset(dirtyrow, 1, nRows);
+  if ((c == 0x0000) || (c == 0xffff)) {
+    // For black or white, all bits in frame buffer will be identically
+    // set or unset (regardless of weird bit packing), so it's OK to just
+    // quickly memset the whole thing:
+    memset(matrixbuff[backindex], c, WIDTH * nRows * nBytes);
+  } else {
+    // Otherwise every pixel of a plane row still holds the same byte: the
+    // upper and lower half bits of the color together fill all of it.
+    // Build those three bytes once and replicate them down the buffer.
+    uint8_t upper[nBytes], lower[nBytes];
+    colorPlanes(c, upper, lower);
+    uint8_t *ptr = matrixbuff[backindex];
+    for (uint8_t y = 0; y < nRows; y++) {
+      for (uint8_t k = 0; k < nBytes; k++) {
+        memset(ptr, upper[k] | lower[k], WIDTH);
+        ptr += WIDTH;
+      }
+    }
+  }
+}
+
+void RGBmatrixPanel::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                              uint16_t c) {
+  // Clip to the (rotated) screen
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > _width)
+    w = _width - x;
+  if (y + h > _height)
+    h = _height - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  // Same transform as drawPixel(), applied to the whole rectangle
   switch (rotation) {
   case 1:
     _swap_int16_t(x, y);
-    x = WIDTH - 1 - x;
+    _swap_int16_t(w, h);
+    x = WIDTH - x - w;
     break;
   case 2:
-    x = WIDTH - 1 - x;
-    y = HEIGHT - 1 - y;
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
     break;
   case 3:
     _swap_int16_t(x, y);
-    y = HEIGHT - 1 - y;
+    _swap_int16_t(w, h);
+    y = HEIGHT - y - h;
     break;
   }
 
-  // Adafruit_GFX uses 16-bit color in 5/6/5 format, while matrix needs
-  // 4/4/4.  Pluck out relevant bits while separating into R,G,B:
-  r = c >> 12;        // RRRRrggggggbbbbb
-  g = (c >> 7) & 0xF; //rrrrrGGGGggbbbbb
-  b = (c >> 1) & 0xF; //rrrrrggggggBBBBb
-  
-  r=uint8_t((r<<bit_offset)>>8);
-  g=uint8_t((g<<bit_offset)>>8);
-  b=uint8_t((b<<bit_offset)>>8);
-
-  // Loop counter stuff
-  bit = 2;
-  limit = 1 << nPlanes;
-
-  if (y < nRows) {
-    // Data for the upper half of the display is stored in the lower
-    // bits of each byte.
-    ptr = &matrixbuff[backindex][y * WIDTH * (nPlanes - 1) + x]; // Base addr
-    // Plane 0 is a tricky case -- its data is spread about,
-    // stored in least two bits not used by the other planes.
-    ptr[WIDTH * 2] &= ~B00000011; // Plane 0 R,G mask out in one op
-    if (r & 1)
-      ptr[WIDTH * 2] |= B00000001; // Plane 0 R: 64 bytes ahead, bit 0
-    if (g & 1)
-      ptr[WIDTH * 2] |= B00000010; // Plane 0 G: 64 bytes ahead, bit 1
-    if (b & 1)
-      ptr[WIDTH] |= B00000001; // Plane 0 B: 32 bytes ahead, bit 0
-    else
-      ptr[WIDTH] &= ~B00000001; // Plane 0 B unset; mask out
-    // The remaining three image planes are more normal-ish.
-    // Data is stored in the high 6 bits so it can be quickly
-    // copied to the DATAPORT register w/6 output lines.
-    for (; bit < limit; bit <<= 1) {
-      *ptr &= ~B00011100; // Mask out R,G,B in one op
-      if (r & bit)
-        *ptr |= B00000100; // Plane N R: bit 2
-      if (g & bit)
-        *ptr |= B00001000; // Plane N G: bit 3
-      if (b & bit)
-        *ptr |= B00010000; // Plane N B: bit 4
-      ptr += WIDTH;        // Advance to next bit plane
+  uint8_t upper[nBytes], lower[nBytes];
+  colorPlanes(c, upper, lower);
+
+  for (int16_t yy = y; yy < y + h; yy++) {
+    // Each of the pixel's plane bytes keeps the other half's bits
+    uint8_t half = (yy >= nRows);
+    const uint8_t *bits = half ? lower : upper;
+    const uint8_t *mask = planeMask[half];
+    markRow(yy - half * nRows);
+    uint8_t *ptr =
+        &matrixbuff[backindex][(yy - half * nRows) * WIDTH * nBytes + x];
+    for (uint8_t k = 0; k < nBytes; k++) {
+      uint8_t keep = ~mask[k], set = bits[k];
+      for (int16_t i = 0; i < w; i++)
+        ptr[i] = (ptr[i] & keep) | set;
+      ptr += WIDTH; // Advance to next bit plane
     }
-  } else {
-    // Data for the lower half of the display is stored in the upper
-    // bits, except for the plane 0 stuff, using 2 least bits.
-    ptr = &matrixbuff[backindex][(y - nRows) * WIDTH * (nPlanes - 1) + x];
-    *ptr &= ~B00000011; // Plane 0 G,B mask out in one op
-    if (r & 1)
-      ptr[WIDTH] |= B00000010; // Plane 0 R: 32 bytes ahead, bit 1
-    else
-      ptr[WIDTH] &= ~B00000010; // Plane 0 R unset; mask out
-    if (g & 1)
-      *ptr |= B00000001; // Plane 0 G: bit 0
-    if (b & 1)
-      *ptr |= B00000010; // Plane 0 B: bit 0
-    for (; bit < limit; bit <<= 1) {
-      *ptr &= ~B11100000; // Mask out R,G,B in one op
-      if (r & bit)
-        *ptr |= B00100000; // Plane N R: bit 5
-      if (g & bit)
-        *ptr |= B01000000; // Plane N G: bit 6
-      if (b & bit)
-        *ptr |= B10000000; // Plane N B: bit 7
-      ptr += WIDTH;        // Advance to next bit plane
+  }
+}
+
+void RGBmatrixPanel::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                   uint16_t c) {
+  fillRect(x, y, w, 1, c);
+}
+
+void RGBmatrixPanel::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                   uint16_t c) {
+  fillRect(x, y, 1, h, c);
+}
+
+// Batched GFX routines (shapes, text) land here; skip the detour through
+// the generic write*() -> draw*() defaults
+void RGBmatrixPanel::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                   uint16_t c) {
+  RGBmatrixPanel::fillRect(x, y, w, h, c);
+}
+
+void RGBmatrixPanel::writeFastHLine(int16_t x, int16_t y, int16_t w,
+                                    uint16_t c) {
+  RGBmatrixPanel::fillRect(x, y, w, 1, c);
+}
+
+void RGBmatrixPanel::writeFastVLine(int16_t x, int16_t y, int16_t h,
+                                    uint16_t c) {
+  RGBmatrixPanel::fillRect(x, y, 1, h, c);
+}
+
+// Pixel p of a PROGMEM image, laid out as bmp_data_bits and MSB_first say
+static inline uint16_t imagePixel(const uint16_t bitmap[], uint16_t p) {
+#if bmp_data_bits == 8
+#if MSB_first
+  return (pgm_read_word(&bitmap[2 * p]) << 8) | pgm_read_word(&bitmap[2 * p + 1]);
+#else
+  return pgm_read_word(&bitmap[2 * p]) | (pgm_read_word(&bitmap[2 * p + 1]) << 8);
+#endif
+#elif bmp_data_bits == 16
+  return pgm_read_word(&bitmap[p]);
+#endif
+}
+
+#define IMAGE_CHUNK 64 ///< Pixels of a PROGMEM image row decoded at a time
+
+void RGBmatrixPanel::drawRGBBitmap(int16_t x, int16_t y,
+                                   const uint16_t bitmap[], int16_t w,
+                                   int16_t h) {
+  if (rotation) {
+    // Rows no longer run along the plane bytes
+    Adafruit_GFX::drawRGBBitmap(x, y, bitmap, w, h);
+    return;
+  }
+
+  // Visible columns i0..i1-1 and rows j0..j1-1 of the image
+  int16_t i0 = (x < 0) ? -x : 0, i1 = (x + w > _width) ? _width - x : w;
+  int16_t j0 = (y < 0) ? -y : 0, j1 = (y + h > _height) ? _height - y : h;
+
+  // Decode a run of flash words into RAM colors, then store them as one row
+  uint16_t line[IMAGE_CHUNK];
+  for (int16_t j = j0; j < j1; j++) {
+    for (int16_t i = i0; i < i1; i += IMAGE_CHUNK) {
+      int16_t n = (i1 - i < IMAGE_CHUNK) ? i1 - i : IMAGE_CHUNK;
+      uint16_t p = j * w + i;
+      for (int16_t k = 0; k < n; k++)
+        line[k] = imagePixel(bitmap, p + k);
+      writeRow(x + i, y + j, line, n);
     }
   }
 }
 
-void RGBmatrixPanel::fillScreen(uint16_t c) {
-  if ((c == 0x0000) || (c == 0xffff)) {
-    // For black or white, all bits in frame buffer will be identically
-    // set or unset (regardless of weird bit packing), so it's OK to just
-    // quickly memset the whole thing:
-    memset(matrixbuff[backindex], c, WIDTH * nRows * 3);
-  } else {
-    // Otherwise, need to handle it the long way:
-    Adafruit_GFX::fillScreen(c);
+void RGBmatrixPanel::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
+                                   int16_t w, int16_t h) {
+  if (rotation) {
+    Adafruit_GFX::drawRGBBitmap(x, y, bitmap, w, h);
+    return;
   }
+
+  int16_t i0 = (x < 0) ? -x : 0, i1 = (x + w > _width) ? _width - x : w;
+  int16_t j0 = (y < 0) ? -y : 0, j1 = (y + h > _height) ? _height - y : h;
+  if (i0 >= i1)
+    return;
+
+  for (int16_t j = j0; j < j1; j++)
+    writeRow(x + i0, y + j, &bitmap[j * w + i0], i1 - i0);
 }
 
-// Return address of back buffer -- can then load/store data directly
-uint8_t *RGBmatrixPanel::backBuffer() { return matrixbuff[backindex]; }
+// Packed image layout: width, height, palette size - 1, format (0 palette,
+// 1 plain colors), then the palette as little-endian 5/6/5 words. Each row
+// follows as runs that never cross rows: a control byte c < 0x80 is c + 1
+// literal pixels, c >= 0x80 one pixel repeated c - 0x7E times. A pixel is a
+// palette index byte, or a little-endian 5/6/5 word without a palette.
+void RGBmatrixPanel::drawPackedBitmap(int16_t x, int16_t y,
+                                      const uint8_t image[]) {
+  uint8_t w = pgm_read_byte(&image[0]), h = pgm_read_byte(&image[1]);
+  boolean plain = pgm_read_byte(&image[3]);
+  const uint8_t *palette = &image[4];
+  const uint8_t *src =
+      plain ? palette : &palette[2 * (pgm_read_byte(&image[2]) + 1)];
+
+  // Visible columns i0..i1-1; a rotated display clips in drawPixel()
+  int16_t i0 = 0, i1 = w;
+  if (!rotation) {
+    i0 = (x < 0) ? -x : 0;
+    i1 = (x + w > _width) ? _width - x : w;
+  }
+
+  uint16_t line[IMAGE_CHUNK];
+  for (int16_t j = 0; j < h; j++) {
+    if (!rotation && (y + j >= _height))
+      break; // Runs only tell where a row ends by decoding it
+    boolean visible = rotation || ((y + j >= 0) && (i0 < i1));
+    int16_t i = 0, n = 0;
+    while (i < w) {
+      uint8_t ctrl = pgm_read_byte(src++);
+      boolean run = ctrl & 0x80;
+      uint8_t count = run ? ctrl - 0x7E : ctrl + 1;
+      uint16_t c = 0;
+      for (uint8_t k = 0; k < count; k++, i++) {
+        if (!run || (k == 0)) {
+          if (plain) {
+            c = pgm_read_byte(src) | (pgm_read_byte(src + 1) << 8);
+            src += 2;
+          } else {
+            const uint8_t *entry = &palette[2 * pgm_read_byte(src++)];
+            c = pgm_read_byte(entry) | (pgm_read_byte(entry + 1) << 8);
+          }
+        }
+        if (!visible || (i < i0) || (i >= i1))
+          continue;
+        if (rotation) {
+          drawPixel(x + i, y + j, c);
+          continue;
+        }
+        line[n++] = c;
+        if (n == IMAGE_CHUNK) {
+          writeRow(x + i + 1 - n, y + j, line, n);
+          n = 0;
+        }
+      }
+    }
+    if (n)
+      writeRow(x + i1 - n, y + j, line, n);
+  }
+}
+
+void RGBmatrixPanel::drawRGBRow(int16_t x, int16_t y, const uint16_t *colors,
+                                int16_t w) {
+  if (rotation) {
+    for (int16_t i = 0; i < w; i++)
+      drawPixel(x + i, y, colors[i]);
+    return;
+  }
+
+  if ((y < 0) || (y >= _height))
+    return;
+  int16_t i0 = (x < 0) ? -x : 0, i1 = (x + w > _width) ? _width - x : w;
+  if (i0 < i1)
+    writeRow(x + i0, y, &colors[i0], i1 - i0);
+}
+
+void RGBmatrixPanel::drawBitRow(int16_t x, int16_t y, const uint8_t *bits,
+                                uint16_t bit, int16_t w, uint16_t fg,
+                                uint16_t bg) {
+  if (rotation) {
+    for (int16_t i = 0; i < w; i++, bit++)
+      drawPixel(x + i, y, (bits[bit >> 3] & (0x80 >> (bit & 7))) ? fg : bg);
+    return;
+  }
+
+  if ((y < 0) || (y >= _height))
+    return;
+  int16_t i0 = (x < 0) ? -x : 0, i1 = (x + w > _width) ? _width - x : w;
+  if (i0 >= i1)
+    return;
+  bit += i0;
+
+  uint8_t upper[2][nBytes], lower[2][nBytes];
+  colorPlanes(bg, upper[0], lower[0]);
+  colorPlanes(fg, upper[1], lower[1]);
+  uint8_t half = (y >= nRows);
+  const uint8_t(*set)[nBytes] = half ? lower : upper;
+  uint8_t keep[nBytes];
+  for (uint8_t k = 0; k < nBytes; k++)
+    keep[k] = ~planeMask[half][k];
+  markRow(y - half * nRows);
+  uint8_t *ptr =
+      &matrixbuff[backindex][(y - half * nRows) * WIDTH * nBytes + x + i0];
+
+  const uint8_t *src = &bits[bit >> 3];
+  uint8_t mask = 0x80 >> (bit & 7);
+  for (int16_t i = i0; i < i1; i++, ptr++) {
+    const uint8_t *c = set[(*src & mask) ? 1 : 0];
+    uint8_t *p = ptr;
+    for (uint8_t k = 0; k < nBytes; k++) {
+      *p = (*p & keep[k]) | c[k];
+      p += WIDTH; // Advance to next bit plane
+    }
+    if (!(mask >>= 1)) {
+      mask = 0x80;
+      src++;
+    }
+  }
+}
+
+// drawPixel() for a run of pixels along one row: the half, masks and base
+// address are worked out once, then each pixel is three table lookups and
+// one store per plane byte.
+void RGBmatrixPanel::writeRow(int16_t x, int16_t y, const uint16_t *colors,
+                              int16_t n) {
+  uint8_t half = (y >= nRows);
+  const uint8_t(*table)[LEVELS][nBytes] = planeTable[half];
+  uint8_t keep[nBytes];
+  for (uint8_t k = 0; k < nBytes; k++)
+    keep[k] = ~planeMask[half][k];
+  markRow(y - half * nRows);
+  uint8_t *ptr =
+      &matrixbuff[backindex][(y - half * nRows) * WIDTH * nBytes + x];
+
+  for (int16_t i = 0; i < n; i++) {
+    uint16_t c = colors[i];
+    const uint8_t *r = table[0][RED(c)];
+    const uint8_t *g = table[1][GREEN(c)];
+    const uint8_t *b = table[2][BLUE(c)];
+    uint8_t *p = &ptr[i];
+    for (uint8_t k = 0; k < nBytes; k++) {
+      *p = (*p & keep[k]) | r[k] | g[k] | b[k];
+      p += WIDTH; // Advance to next bit plane
+    }
+  }
+}
+
+#if nPlanes > 4
+// A channel field `bits` wide scaled to nPlanes bits, its top bits
+// repeated into the low ones so full scale stays full scale
+static inline uint8_t channelLevel(uint8_t v, uint8_t bits) {
+  if (bits >= nPlanes)
+    return v >> (bits - nPlanes);
+  return (v << (nPlanes - bits)) | (v >> (2 * bits - nPlanes));
+}
+#endif
+
+// Plane bytes of a color, masked as planeMask: what a pixel of that color
+// holds in the upper or lower half. drawPixel() goes through planeTable,
+// which is built from this.
+void RGBmatrixPanel::colorPlanes(uint16_t c, uint8_t *upper, uint8_t *lower) {
+#if nPlanes == 4
+  // 5/6/5 -> 4/4/4
+  uint8_t r = c >> 12, g = (c >> 7) & 0xF, b = (c >> 1) & 0xF;
+
+  // Planes 1-3: R,G,B in bits 2-4 (upper half) or 5-7 (lower half)
+  for (uint8_t k = 0; k < nPlanes - 1; k++) {
+    uint8_t bit = 2 << k;
+    uint8_t rgb = ((r & bit) ? 1 : 0) | ((g & bit) ? 2 : 0) | ((b & bit) ? 4 : 0);
+    upper[k] = rgb << 2;
+    lower[k] = rgb << 5;
+  }
+
+  // Plane 0 is spread about the least two bits
+  upper[2] |= (r & 1) | ((g & 1) << 1);
+  upper[1] |= (b & 1);
+  lower[0] |= (g & 1) | ((b & 1) << 1);
+  lower[1] |= (r & 1) << 1;
+#else
+  // 5/6/5 -> nPlanes bits per channel
+  uint8_t r = channelLevel(c >> 11, 5), g = channelLevel((c >> 5) & 0x3F, 6),
+          b = channelLevel(c & 0x1F, 5);
+
+  // Every plane: R,G,B in bits 2-4 (upper half) or 5-7 (lower half)
+  for (uint8_t k = 0; k < nPlanes; k++) {
+    uint8_t bit = 1 << k;
+    uint8_t rgb = ((r & bit) ? 1 : 0) | ((g & bit) ? 2 : 0) | ((b & bit) ? 4 : 0);
+    upper[k] = rgb << 2;
+    lower[k] = rgb << 5;
+  }
+#endif
+}
+
+void RGBmatrixPanel::setAddressDelay(uint8_t us) { addrdelay = us; }
+
+uint8_t RGBmatrixPanel::getAddressDelay(void) { return addrdelay; }
+
+// Return address of back buffer -- can then load/store data directly.
+// Writes through it can't be tracked, so every row counts as drawn to.
+uint8_t *RGBmatrixPanel::backBuffer() {
+  memset(dirtyrow, 1, nRows);
+  return matrixbuff[backindex];
+}
+
+void RGBmatrixPanel::drawPlanes(const uint8_t planes[]) {
+  memset(dirtyrow, 1, nRows);
+  memcpy_P(matrixbuff[backindex], planes, WIDTH * nRows * nBytes);
+}
+
+void RGBmatrixPanel::drawPlanes(const uint8_t planes[], int16_t x, int16_t y,
+                                int16_t w, int16_t h) {
+  // Clip and rotate as fillRect() does
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > _width)
+    w = _width - x;
+  if (y + h > _height)
+    h = _height - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+  switch (rotation) {
+  case 1:
+    _swap_int16_t(x, y);
+    _swap_int16_t(w, h);
+    x = WIDTH - x - w;
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    _swap_int16_t(x, y);
+    _swap_int16_t(w, h);
+    y = HEIGHT - y - h;
+    break;
+  }
+
+  for (int16_t yy = y; yy < y + h; yy++) {
+    // Only this half's bits of each byte come from the image
+    uint8_t half = (yy >= nRows);
+    const uint8_t *mask = planeMask[half];
+    markRow(yy - half * nRows);
+    uint16_t offset = (yy - half * nRows) * WIDTH * nBytes + x;
+    uint8_t *ptr = &matrixbuff[backindex][offset];
+    const uint8_t *src = &planes[offset];
+    for (uint8_t k = 0; k < nBytes; k++) {
+      uint8_t set = mask[k], keep = ~set;
+      for (int16_t i = 0; i < w; i++)
+        ptr[i] = (ptr[i] & keep) | (pgm_read_byte(&src[i]) & set);
+      ptr += WIDTH; // Advance to next bit plane
+      src += WIDTH;
+    }
+  }
+}
+
+// Bring the back buffer's dirty rows up to date with the front buffer
+static void copyRows(uint8_t *dst, const uint8_t *src, uint8_t *dirty,
+                     uint8_t rows, uint16_t rowbytes) {
+  for (uint8_t y = 0; y < rows; y++, dst += rowbytes, src += rowbytes) {
+    if (dirty[y]) {
+      memcpy(dst, src, rowbytes);
+      dirty[y] = 0;
+    }
+  }
+}
 
 // For smooth animation -- drawing always takes place in the "back" buffer;
 // this method pushes it to the "front" for display.  Passing "true", the
 // updated display contents are then copied to the new back buffer and can
-// be incrementally modified.  If "false", the back buffer then contains
-// the old front buffer contents -- your code can either clear this or
-// draw over every pixel.  (No effect if double-buffering is not enabled.)
+// be incrementally modified; only rows drawn to since the buffers last
+// matched (dirtyrow) need copying.  If "false", the back buffer then
+// contains the old front buffer contents -- your code can either clear this
+// or draw over every pixel -- and those rows stay marked, since they still
+// differ.  (No effect if double-buffering is not enabled.)
 void RGBmatrixPanel::swapBuffers(boolean copy) {
-  if (matrixbuff[0] != matrixbuff[1]) {
+  while (!trySwap(copy))
+    delay(1); // wait for interrupt to do the swap
+}
+
+boolean RGBmatrixPanel::trySwap(boolean copy) {
+#if defined(RGBMATRIX_USE_DMA)
+  if (dmabuff[0]) {
+    if (!swapposted) {
+      // The DMA shows an output frame, not the buffer itself: build the
+      // idle frame from the back buffer, then the I2S interrupt moves the
+      // DMA over to it at the end of the frame being shown.
+      dmaFill(1 - dmaindex, matrixbuff[backindex]);
+      dmaswap = 1;
+      I2S1.int_clr.out_eof = 1;
+      I2S1.int_ena.out_eof = 1;
+      swapposted = true;
+    }
+    if (dmaswap)
+      return false;
+    swapposted = false;
+    if (matrixbuff[0] != matrixbuff[1]) {
+      backindex = 1 - backindex;
+      if (copy == true)
+        copyRows(matrixbuff[backindex], matrixbuff[1 - backindex], dirtyrow,
+                 nRows, WIDTH * nBytes);
+    }
+    return true;
+  }
+#endif
+  if (matrixbuff[0] == matrixbuff[1])
+    return true;
+  if (!swapposted) {
     // To avoid 'tearing' display, actual swap takes place in the interrupt
     // handler, at the end of a complete screen refresh cycle.
-    swapflag = true; // Set flag here, then...
-    while (swapflag == true)
-      delay(1); // wait for interrupt to clear it
-    if (copy == true)
-      memcpy(matrixbuff[backindex], matrixbuff[1 - backindex],
-             WIDTH * nRows * 3);
+    swapflag = true;
+    swapposted = true;
   }
+  if (swapflag == true)
+    return false; // Interrupt hasn't got there yet
+  swapposted = false;
+  if (copy == true)
+    copyRows(matrixbuff[backindex], matrixbuff[1 - backindex], dirtyrow,
+             nRows, WIDTH * nBytes);
+  return true;
+}
+
+void RGBmatrixPanel::setSwapCallback(void (*callback)(void)) {
+  swapcallback = callback;
 }
 
 // Dump display contents to the Serial Monitor, adding some formatting to
@@ -744,7 +1349,7 @@ void RGBmatrixPanel::swapBuffers(boolean copy) {
 // back into the display using a pgm_read_byte() loop.
 void RGBmatrixPanel::dumpMatrix(void) {
 
-  int i, buffsize = WIDTH * nRows * 3;
+  int i, buffsize = WIDTH * nRows * nBytes;
 
   Serial.print(F("\n\n"
                  "#include <avr/pgmspace.h>\n\n"
@@ -767,7 +1372,12 @@ void RGBmatrixPanel::dumpMatrix(void) {
 
 void RGBmatrixPanel::display_image(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h)
 {
-  Adafruit_GFX::drawRGBBitmap(x,y,bitmap,w,h);
+  drawRGBBitmap(x, y, bitmap, w, h);
+}
+
+void RGBmatrixPanel::display_image(int16_t x, int16_t y, const uint8_t image[])
+{
+  drawPackedBitmap(x, y, image);
 }
 
 void RGBmatrixPanel::setFont(const GFXfont * f)
@@ -812,31 +1422,193 @@ IRAM_ATTR void IRQ_HANDLER(void *arg) {
 
 #endif
 
-// Two constants are used in timing each successive BCM interval.
-// These were found empirically, by checking the value of TCNT1 at
-// certain positions in the interrupt code.
-// CALLOVERHEAD is the number of CPU 'ticks' from the timer overflow
-// condition (triggering the interrupt) to the first line in the
-// updateDisplay() method.  It's then assumed (maybe not entirely 100%
-// accurately, but close enough) that a similar amount of time will be
-// needed at the opposite end, restoring regular program flow.
-// LOOPTIME is the number of 'ticks' spent inside the shortest data-
-// issuing loop (not actually a 'loop' because it's unrolled, but eh).
-// Both numbers are rounded up slightly to allow a little wiggle room
-// should different compilers produce slightly different results.
-#if defined(__AVR__)
-#define CALLOVERHEAD 60 // Actual value measured = 56
-#define LOOPTIME 200    // 200 Actual value measured = 188
-#endif
-#if defined(ARDUINO_ARCH_SAMD)
-#define CALLOVERHEAD 60 // Actual = 58
-#define LOOPTIME 600    // Actual = 558
-#endif
-#if defined(ARDUINO_ARCH_ESP32)
-#define CALLOVERHEAD 30 // Actual = 25
-#define LOOPTIME 400    // Actual = 1563 / 4
+#if defined(RGBMATRIX_USE_DMA)
+
+// I2S DMA refresh (RGBMATRIX_DMA). Each 16-bit output word holds all the
+// lines for one panel clock: bits 0-5 R1 G1 B1 R2 G2 B2, then LAT, OE and
+// the address lines from bit 8. A row's planes go out in order, plane n
+// 2^n times; every send shifts that plane's data and latches it in its
+// last word, so plane n is shown (until the next plane's latch) for 2^n
+// sends, the same weighting the timer interrupt gives it. The DMA loops
+// the frame's descriptor chain on its own, so once started the refresh
+// needs no CPU at all.
+#define DMA_LAT 0x0040       ///< Output word latch bit
+#define DMA_OE 0x0080        ///< Output word output enable bit (high = off)
+#define DMA_ADDR_SHIFT 8     ///< Output word address bits position
+#define DMA_BASE_HZ 80000000 ///< I2S word clock before clkm_div_num
+
+static IRAM_ATTR void dmaHandler(void *arg) { activePanel->dmaFrame(); }
+
+boolean RGBmatrixPanel::dmaBegin(void) {
+  uint16_t sends = (1 << nPlanes) - 1; // Plane sends per row
+  uint32_t words = (uint32_t)WIDTH * nPlanes * nRows;
+
+  dmalast = nRows * sends - 1;
+  dmadesc[0] = dmadesc[1] = NULL;
+  for (uint8_t n = 0; n < 2; n++) {
+    dmabuff[n] = (uint16_t *)heap_caps_malloc(words * 2, MALLOC_CAP_DMA);
+    dmadesc[n] = (lldesc_t *)heap_caps_malloc((dmalast + 1) * sizeof(lldesc_t),
+                                              MALLOC_CAP_DMA);
+    if (!dmabuff[n] || !dmadesc[n]) {
+      for (n = 0; n < 2; n++) {
+        heap_caps_free(dmabuff[n]);
+        heap_caps_free(dmadesc[n]);
+        dmabuff[n] = NULL;
+      }
+      return false; // Not enough DMA-capable RAM, use the timer
+    }
+  }
+
+  for (uint8_t n = 0; n < 2; n++) {
+    lldesc_t *d = dmadesc[n];
+    for (uint8_t r = 0; r < nRows; r++) {
+      for (uint8_t p = 0; p < nPlanes; p++) {
+        for (uint16_t k = 0; k < (1 << p); k++, d++) {
+          d->size = d->length = WIDTH * 2;
+          d->buf = (uint8_t *)&dmabuff[n][((uint32_t)r * nPlanes + p) * WIDTH];
+          d->offset = 0;
+          d->sosf = 0;
+          d->eof = 0;
+          d->owner = 1;
+          d->qe.stqe_next = d + 1;
+        }
+      }
+    }
+    // The last send of a frame raises the interrupt swapBuffers() uses,
+    // and leads back to the first
+    dmadesc[n][dmalast].eof = 1;
+    dmadesc[n][dmalast].qe.stqe_next = &dmadesc[n][0];
+    dmaFill(n, matrixbuff[1 - backindex]);
+  }
+  dmaindex = 0;
+
+  // Every line but the clock to an I2S data output (16-bit mode uses data
+  // signals 8-23); begin() has already made them GPIO outputs
+  uint8_t lines[] = {rgbpins[0], rgbpins[1], rgbpins[2], rgbpins[3],
+                     rgbpins[4], rgbpins[5], _lat,       _oe,
+                     _a,         _b,         _c,         _d,
+                     _e};
+  uint8_t count = (nRows > 16) ? 13 : (nRows > 8) ? 12 : 11;
+  for (uint8_t i = 0; i < count; i++)
+    gpio_matrix_out(lines[i], I2S1O_DATA_OUT8_IDX + i, false, false);
+  // Data changes on the falling clock edge, the panel samples on rising
+  gpio_matrix_out(_clk, I2S1O_WS_OUT_IDX, true, false);
+
+  periph_module_enable(PERIPH_I2S1_MODULE);
+  I2S1.conf.tx_reset = 1;
+  I2S1.conf.tx_reset = 0;
+  I2S1.conf.tx_fifo_reset = 1;
+  I2S1.conf.tx_fifo_reset = 0;
+  I2S1.lc_conf.out_rst = 1; // DMA reset
+  I2S1.lc_conf.out_rst = 0;
+
+  I2S1.conf2.val = 0;
+  I2S1.conf2.lcd_en = 1; // LCD (parallel output) mode
+  I2S1.sample_rate_conf.val = 0;
+  I2S1.sample_rate_conf.tx_bits_mod = 16;
+  I2S1.sample_rate_conf.tx_bck_div_num = 2;
+  I2S1.clkm_conf.val = 0;
+  I2S1.clkm_conf.clka_en = 0; // 160 MHz PLL_D2 clock, no fractional divide
+  I2S1.clkm_conf.clkm_div_a = 1;
+  I2S1.clkm_conf.clkm_div_b = 0;
+  dmaClock(RGBMATRIX_DMA_HZ);
+
+  I2S1.fifo_conf.val = 0;
+  I2S1.fifo_conf.tx_fifo_mod_force_en = 1;
+  I2S1.fifo_conf.tx_fifo_mod = 1; // 16-bit single channel
+  I2S1.fifo_conf.tx_data_num = 32;
+  I2S1.fifo_conf.dscr_en = 1;
+  I2S1.conf1.val = 0;
+  I2S1.conf1.tx_pcm_bypass = 1;
+  I2S1.conf_chan.val = 0;
+  I2S1.conf_chan.tx_chan_mod = 1;
+  I2S1.conf.tx_right_first = 1;
+  I2S1.timing.val = 0;
+
+  // The interrupt is only enabled while a swap is under way
+  I2S1.int_ena.val = 0;
+  I2S1.int_clr.val = 0xFFFFFFFF;
+  esp_intr_alloc(ETS_I2S1_INTR_SOURCE, ESP_INTR_FLAG_IRAM, dmaHandler, NULL,
+                 NULL);
+
+  I2S1.lc_conf.val = I2S_OUT_DATA_BURST_EN | I2S_OUTDSCR_BURST_EN;
+  I2S1.out_link.addr = (uint32_t)&dmadesc[0][0];
+  I2S1.out_link.start = 1;
+  I2S1.conf.tx_start = 1;
+  return true;
+}
+
+void RGBmatrixPanel::dmaClock(uint32_t hz) {
+  // A word per two bit clocks of the divided 160 MHz, so the base is
+  // 80 MHz. 20 MHz (divide by 4) is as fast as the ESP32's parallel mode
+  // is specified to go; 255 is the largest divider.
+  uint32_t div = hz ? DMA_BASE_HZ / hz : 255;
+  if (div < 4)
+    div = 4;
+  else if (div > 255)
+    div = 255;
+  I2S1.clkm_conf.clkm_div_num = div;
+  dmahz = DMA_BASE_HZ / div;
+}
+
+void RGBmatrixPanel::dmaFill(uint8_t n, const uint8_t *buf) {
+  // Words with the LEDs lit: brightness's share of the row, leaving the
+  // first and last dark around the latch and the address change
+  uint8_t lit = ((WIDTH - 2) * (brightness + 1)) >> 8;
+  uint16_t *word = dmabuff[n];
+
+  for (uint8_t r = 0; r < nRows; r++, buf += WIDTH * nBytes) {
+    for (uint8_t p = 0; p < nPlanes; p++, word += WIDTH) {
+      // Plane 0's send shows the previous row's last plane, which only
+      // makes way at its latch, so that row stays addressed until then
+      uint8_t shown = (p > 0) ? r : (r ? r - 1 : nRows - 1);
+      uint16_t ctrl = (uint16_t)shown << DMA_ADDR_SHIFT;
+      for (uint8_t x = 0; x < WIDTH; x++) {
+        uint8_t b;
+#if nPlanes == 4
+        if (p == 0) // Unpacked as in updateDisplay()
+          b = (buf[x] << 6) | ((buf[x + WIDTH] << 4) & 0x30) |
+              ((buf[x + WIDTH * 2] << 2) & 0x0C);
+        else
+          b = buf[(p - 1) * WIDTH + x];
+#else
+        b = buf[p * WIDTH + x];
 #endif
-// The "on" time for bitplane 0 (with the shortest BCM interval) can
+        uint16_t w = ctrl | (b >> 2);
+        if ((x == 0) || (x > lit))
+          w |= DMA_OE;
+        if (x == WIDTH - 1)
+          w |= DMA_LAT;
+        word[x ^ 1] = w; // 16-bit mode sends each pair of words swapped
+      }
+    }
+  }
+}
+
+IRAM_ATTR void RGBmatrixPanel::dmaFrame(void) {
+  lldesc_t *chain = dmadesc[dmaindex];
+
+  I2S1.int_clr.out_eof = 1;
+  if (dmaswap == 1) {
+    // The shown frame has just started over; point its end at the new
+    // frame, which the DMA then moves on to once this pass is done
+    chain[dmalast].qe.stqe_next = &dmadesc[1 - dmaindex][0];
+    dmaswap = 2;
+  } else if (dmaswap == 2) {
+    // Showing the new frame now, so loop the old one on itself again
+    chain[dmalast].qe.stqe_next = &chain[0];
+    dmaindex = 1 - dmaindex;
+    I2S1.int_ena.out_eof = 0;
+    dmaswap = 0;
+    if (swapcallback)
+      swapcallback();
+  }
+}
+
+#endif // RGBMATRIX_USE_DMA
+
+// With CALLOVERHEAD and LOOPTIME (defined near the top of this file),
+// the "on" time for bitplane 0 (with the shortest BCM interval) can
 // then be estimated as LOOPTIME + CALLOVERHEAD * 2.  Each successive
 // bitplane then doubles the prior amount of time.  We can then
 // estimate refresh rates from this:
@@ -859,7 +1631,149 @@ IRAM_ATTR void IRQ_HANDLER(void *arg) {
 // higher, again due to code used in the LEDs off interval).
 // 16x32 matrix uses about half that CPU load.  CPU time could be
 // further adjusted by padding the LOOPTIME value, but refresh rates
-// will decrease proportionally, and 200 Hz is a decent target.
+// will decrease proportionally, and 200 Hz is a decent target (see
+// setRefreshRate() and setMaxISRLoad(), which do exactly that).
+
+// Refresh timer ticks since the timer last restarted, for
+// calibrateTiming(). Not cheap on SAMD, which has to sync the counter
+// first, so only read while calibrating.
+#if defined(__AVR__)
+static inline uint16_t timerElapsed(void) { return TCNT1; }
+#elif defined(ARDUINO_ARCH_SAMD)
+static inline uint16_t timerElapsed(void) {
+#ifdef __SAMD51__
+  TIMER->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_READSYNC;
+  while (TIMER->COUNT16.SYNCBUSY.bit.CTRLB)
+    ;
+  while (TIMER->COUNT16.SYNCBUSY.bit.COUNT)
+    ;
+#else
+  TIMER->COUNT16.READREQ.reg = TC_READREQ_RREQ | TC_READREQ_ADDR(0x10);
+  while (TIMER->COUNT16.STATUS.bit.SYNCBUSY)
+    ;
+#endif
+  // Counts down from the interval length
+  return TIMER->COUNT16.CC[0].reg - TIMER->COUNT16.COUNT.reg;
+}
+#elif defined(ARDUINO_ARCH_ESP32)
+static inline IRAM_ATTR uint16_t timerElapsed(void) {
+  TIMERG1.hw_timer[TIMER_0].update = 1; // Latch the counter
+  return TIMERG1.hw_timer[TIMER_0].cnt_low;
+}
+#endif
+
+void RGBmatrixPanel::calibrateTiming(void) {
+#if defined(RGBMATRIX_USE_DMA)
+  if (dmabuff[0])
+    return; // Nothing to measure, the I2S clock sets the timing
+#endif
+  // Measure with plenty of slack in every interval, so no interrupt comes
+  // due while the previous one is still running and inflates the entry
+  // overhead, as far as the longest plane still fits the timer count.
+  // Full brightness, so every interrupt shifts data as usual.
+  uint8_t dimmed = brightness;
+  brightness = 255;
+  calloverhead = CALLOVERHEAD;
+  shifttime = LOOPTIME;
+  setPeriod((uint32_t)LOOPTIME * ((nRows > 8) ? 4 : 8) + CALLOVERHEAD * 2);
+  maxentry = maxloop = 0;
+  busyticks = 0;
+  calcount = nRows * nPlanes * CAL_FRAMES;
+  calibrating = true;
+  while (calibrating == true)
+    delay(1); // Wait for the interrupt to finish measuring
+
+  // Rounded up a little for wiggle room, as the constants were
+  calloverhead = maxentry + (maxentry >> 4) + 1;
+  shifttime = maxloop + (maxloop >> 4) + 1;
+  setPeriod((uint32_t)shifttime * ((nRows > 8) ? 1 : 2) + calloverhead * 2);
+  rowbusy = busyticks / (nRows * CAL_FRAMES);
+  brightness = dimmed;
+}
+
+void RGBmatrixPanel::setBrightness(uint8_t b) { brightness = b; }
+
+uint8_t RGBmatrixPanel::getBrightness(void) { return brightness; }
+
+// Shortest intervals per row: each plane's interval doubles the one
+// before, and dimmed planes take one more for their blanking
+static uint16_t rowPeriods(uint8_t brightness) {
+  return ((1 << nPlanes) - 1) + ((brightness < 255) ? nPlanes : 0);
+}
+
+uint16_t RGBmatrixPanel::getRefreshRate(void) {
+#if defined(RGBMATRIX_USE_DMA)
+  if (dmabuff[0]) // One panel clock per word of the output frame
+    return dmahz / ((uint32_t)WIDTH * ((1 << nPlanes) - 1) * nRows);
+#endif
+  uint16_t t = (nRows > 8) ? looptime : (looptime * 2);
+  uint32_t row = (uint32_t)(t + calloverhead * 2) * rowPeriods(brightness);
+  return TIMER_HZ / (row * nRows);
+}
+
+uint8_t RGBmatrixPanel::getISRLoad(void) {
+#if defined(RGBMATRIX_USE_DMA)
+  if (dmabuff[0])
+    return 0; // Only swapBuffers() involves the CPU
+#endif
+  uint16_t t = (nRows > 8) ? looptime : (looptime * 2);
+  uint32_t row = (uint32_t)(t + calloverhead * 2) * rowPeriods(brightness);
+  uint32_t busy = rowbusy;
+  if (busy && (brightness < 255))
+    busy += nPlanes * calloverhead * 2; // The blanking interrupts
+  uint32_t load = busy * 100 / row;
+  return (load < 100) ? load : 100;
+}
+
+uint16_t RGBmatrixPanel::setRefreshRate(uint16_t hz) {
+  if (hz == 0)
+    hz = 1; // Slowest the timer allows, in effect
+#if defined(RGBMATRIX_USE_DMA)
+  if (dmabuff[0]) {
+    dmaClock((uint32_t)hz * WIDTH * ((1 << nPlanes) - 1) * nRows);
+    return getRefreshRate();
+  }
+#endif
+  setPeriod(TIMER_HZ / ((uint32_t)hz * rowPeriods(brightness) * nRows));
+  return getRefreshRate();
+}
+
+uint8_t RGBmatrixPanel::setMaxISRLoad(uint8_t percent) {
+  if (rowbusy && percent) {
+    // Shortest row time that keeps rowbusy within percent of it
+    uint16_t periods = rowPeriods(brightness);
+    uint32_t row = (rowbusy * 100 + percent - 1) / percent;
+    setPeriod((row + periods - 1) / periods);
+  }
+  return getISRLoad();
+}
+
+// period is the shortest plane's interval including the interrupt
+// overhead both ways, i.e. t + calloverhead * 2 in updateDisplay()
+void RGBmatrixPanel::setPeriod(uint32_t period) {
+  // The longest plane's interval, period << (nPlanes - 1), has to fit the
+  // timer count, plus another period when that plane is dimmed
+  uint32_t most = MAXCOUNT / ((1UL << (nPlanes - 1)) + 1);
+  if (most > 0xFFFF)
+    most = 0xFFFF;
+  if (period > most)
+    period = most;
+  int32_t t = (int32_t)period - calloverhead * 2;
+  int32_t longest = (int32_t)most - calloverhead * 2;
+  if (nRows <= 8) {
+    t /= 2; // updateDisplay() doubles it for these
+    longest /= 2;
+  }
+  if (t < shifttime)
+    t = shifttime; // Can't show a plane for less than it takes to load
+  if (t > longest)
+    t = longest; // Nor, if loading takes that long, wrap the timer count
+  if (t < 1)
+    t = 1;
+  noInterrupts(); // 16-bit store, don't let the interrupt see half of it
+  looptime = t;
+  interrupts();
+}
 
 // The flow of the interrupt can be awkward to grasp, because data is
 // being issued to the LED matrix for the *next* bitplane and/or row
@@ -872,70 +1786,110 @@ IRAM_ATTR void RGBmatrixPanel::updateDisplay(void) {
 void RGBmatrixPanel::updateDisplay(void) {
 #endif
   uint8_t i, tick, tock, *ptr;
-  uint16_t t, duration;
-
-  *oeport |= oemask;   // Disable LED output during row/plane switchover
-  *latport |= latmask; // Latch data loaded during *prior* interrupt
-
-  // Calculate time to next interrupt BEFORE incrementing plane #.
-  // This is because duration is the display time for the data loaded
-  // on the PRIOR interrupt.  CALLOVERHEAD is subtracted from the
-  // result because that time is implicit between the timer overflow
-  // (interrupt triggered) and the initial LEDs-off line at the start
-  // of this method.
-  t = (nRows > 8) ? LOOPTIME : (LOOPTIME * 2);
-  duration = ((t + CALLOVERHEAD * 2) << plane) - CALLOVERHEAD;
-
-  // Borrowing a technique here from Ray's Logic:
-  // www.rayslogic.com/propeller/Programming/AdafruitRGB/AdafruitRGB.htm
-  // This code cycles through all four planes for each scanline before
-  // advancing to the next line.  While it might seem beneficial to
-  // advance lines every time and interleave the planes to reduce
-  // vertical scanning artifacts, in practice with this panel it causes
-  // a green 'ghosting' effect on black pixels, a much worse artifact.
-
-  if (++plane >= nPlanes) {   // Advance plane counter.  Maxed out?
-    plane = 0;                // Yes, reset to plane 0, and
-    if (++row >= nRows) {     // advance row counter.  Maxed out?
-      row = 0;                // Yes, reset row counter, then...
-      if (swapflag == true) { // Swap front/back buffers if requested
-        backindex = 1 - backindex;
-        swapflag = false;
-      }
-      buffptr = matrixbuff[1 - backindex]; // Reset into front buffer
-    }
-  } else if (plane == 1) {
-    // Plane 0 was loaded on prior interrupt invocation and is about to
-    // latch now, so update the row address lines before we do that:
-    if (row & 0x1)
-      *addraport |= addramask;
-    else
-      *addraport &= ~addramask;
-    // MYSTERY: certain matrices REQUIRE these delays ???
-    delayMicroseconds(10);
-    if (row & 0x2)
-      *addrbport |= addrbmask;
-    else
-      *addrbport &= ~addrbmask;
-    delayMicroseconds(10);
-    if (row & 0x4)
-      *addrcport |= addrcmask;
-    else
-      *addrcport &= ~addrcmask;
-    delayMicroseconds(10);
-    if (nRows > 8) {
-      if (row & 0x8)
-        *addrdport |= addrdmask;
-      else
-        *addrdport &= ~addrdmask;
-      delayMicroseconds(10);
+  uint16_t t, entry = 0, start = 0;
+  TimerCount duration;
+  boolean dim = false, lit = true;
+
+  if (calibrating)
+    entry = timerElapsed(); // Ticks since the interrupt came due
+
+  if (blanking) {
+    // Second interrupt of a dimmed plane: dark for the rest of its
+    // interval, while the next plane's data goes out. Nothing to latch.
+    *oeport |= oemask;
+    duration = blankticks;
+  } else {
+    *oeport |= oemask;   // Disable LED output during row/plane switchover
+    *latport |= latmask; // Latch data loaded during *prior* interrupt
+
+    // Calculate time to next interrupt BEFORE incrementing plane #.
+    // This is because duration is the display time for the data loaded
+    // on the PRIOR interrupt.  CALLOVERHEAD is subtracted from the
+    // result because that time is implicit between the timer overflow
+    // (interrupt triggered) and the initial LEDs-off line at the start
+    // of this method.
+    t = (nRows > 8) ? looptime : (looptime * 2);
+    duration = ((TimerCount)(t + calloverhead * 2) << plane) - calloverhead;
+
+    // Dimmed (see setBrightness()): the LEDs only stay on for a share of
+    // the interval, then a second interrupt blanks them and shifts out
+    // the next plane while they're dark. That takes one shortest interval
+    // more per plane, so short on-times aren't held up by the shifting.
+    if (brightness < 255) {
+      dim = true;
+      TimerCount full = duration + calloverhead;
+      TimerCount on = ((uint32_t)full * brightness) >> 8;
+      lit = (on > 0);
+      blankticks = full + (t + calloverhead * 2) - on - calloverhead;
+      duration = (on > calloverhead) ? on - calloverhead : 1;
     }
-    if (nRows > 16) {
-      if (row & 0x10)
-        *addreport |= addremask;
-      else
-        *addreport &= ~addremask;
-      delayMicroseconds(10);
+
+    // Borrowing a technique here from Ray's Logic:
+    // www.rayslogic.com/propeller/Programming/AdafruitRGB/AdafruitRGB.htm
+    // This code cycles through all four planes for each scanline before
+    // advancing to the next line.  While it might seem beneficial to
+    // advance lines every time and interleave the planes to reduce
+    // vertical scanning artifacts, in practice with this panel it causes
+    // a green 'ghosting' effect on black pixels, a much worse artifact.
+
+    if (++plane >= nPlanes) {   // Advance plane counter.  Maxed out?
+      plane = 0;                // Yes, reset to plane 0, and
+      if (++row >= nRows) {     // advance row counter.  Maxed out?
+        row = 0;                // Yes, reset row counter, then...
+        if (swapflag == true) { // Swap front/back buffers if requested
+          backindex = 1 - backindex;
+          swapflag = false;
+          if (swapcallback)
+            swapcallback();
+        }
+        buffptr = matrixbuff[1 - backindex]; // Reset into front buffer
+      }
+    } else if (plane == 1) {
+      // Plane 0 was loaded on prior interrupt invocation and is about to
+      // latch now, so update the row address lines before we do that.
+      // Certain matrices need the lines to settle before the row is lit
+      // (addrdelay, see setAddressDelay()); it is spent busy-waiting here,
+      // so the single-port path pays it once rather than per line.
+      if (addrmask) {
+        *addraport = (*addraport & ~addrmask) | rowaddr[row];
+        if (addrdelay)
+          delayMicroseconds(addrdelay);
+      } else {
+        if (row & 0x1)
+          *addraport |= addramask;
+        else
+          *addraport &= ~addramask;
+        if (addrdelay)
+          delayMicroseconds(addrdelay);
+        if (row & 0x2)
+          *addrbport |= addrbmask;
+        else
+          *addrbport &= ~addrbmask;
+        if (addrdelay)
+          delayMicroseconds(addrdelay);
+        if (row & 0x4)
+          *addrcport |= addrcmask;
+        else
+          *addrcport &= ~addrcmask;
+        if (addrdelay)
+          delayMicroseconds(addrdelay);
+        if (nRows > 8) {
+          if (row & 0x8)
+            *addrdport |= addrdmask;
+          else
+            *addrdport &= ~addrdmask;
+          if (addrdelay)
+            delayMicroseconds(addrdelay);
+        }
+        if (nRows > 16) {
+          if (row & 0x10)
+            *addreport |= addremask;
+          else
+            *addreport &= ~addremask;
+          if (addrdelay)
+            delayMicroseconds(addrdelay);
+        }
+      }
     }
   }
 
@@ -943,6 +1897,9 @@ void RGBmatrixPanel::updateDisplay(void) {
   // A local register copy can speed some things up:
   ptr = (uint8_t *)buffptr;
 
+  if (calibrating)
+    busyticks += timerElapsed(); // Time from coming due to the restart
+
 #if defined(__AVR__)
   ICR1 = duration; // Set interval for next interrupt
   TCNT1 = 0;       // Restart interrupt timer
@@ -967,12 +1924,23 @@ static timg_dev_t *TG[2] = {&TIMERG0, &TIMERG1};
 static portMUX_TYPE timer_spinlock[TIMER_GROUP_MAX] = {
     portMUX_INITIALIZER_UNLOCKED, portMUX_INITIALIZER_UNLOCKED};
 portENTER_CRITICAL(&timer_spinlock[TIMER_GROUP_1]);
-TG[TIMER_GROUP_1]->hw_timer[TIMER_0].alarm_high = (uint32_t)(duration >> 32);
+TG[TIMER_GROUP_1]->hw_timer[TIMER_0].alarm_high = (uint32_t)((uint64_t)duration >> 32);
 TG[TIMER_GROUP_1]->hw_timer[TIMER_0].alarm_low = (uint32_t)duration;
 portEXIT_CRITICAL(&timer_spinlock[TIMER_GROUP_1]);
 #endif                  // ARDUINO_ARCH_SAMD
-  *oeport &= ~oemask;   // Re-enable output
-  *latport &= ~latmask; // Latch down
+  if (calibrating)
+    start = timerElapsed();
+  if (blanking) {
+    blanking = false; // Output stays off until the next plane is latched
+  } else {
+    if (lit)
+      *oeport &= ~oemask; // Re-enable output
+    *latport &= ~latmask; // Latch down
+    if (dim) {
+      blanking = true; // Data goes out on the blanking interrupt instead
+      return;
+    }
+  }
 
   // Record current state of CLKPORT register, as well as a second
   // copy with the clock bit set.  This makes the innnermost data-
@@ -988,11 +1956,13 @@ portEXIT_CRITICAL(&timer_spinlock[TIMER_GROUP_1]);
   tick = tock | clkmask;
 #endif
 
-  if (plane > 0) { // 188 ticks from TCNT1=0 (above) to end of function
+  // 188 ticks from TCNT1=0 (above) to end of function
+  if ((nPlanes > 4) || (plane > 0)) {
 
     // Planes 1-3 copy bytes directly from RAM to PORT without unpacking.
     // The least 2 bits (used for plane 0 data) are presumed masked out
-    // by the port direction bits.
+    // by the port direction bits. Past 4 planes every plane is stored
+    // this way, plane 0 included.
 
 #if defined(__AVR__)
 // A tiny bit of inline assembly is used; compiler doesn't pick
@@ -1069,4 +2039,16 @@ portEXIT_CRITICAL(&timer_spinlock[TIMER_GROUP_1]);
     *outclrreg = clkmask; // Set clock low
 #endif
   }
+
+  if (calibrating) {
+    uint16_t shift = timerElapsed() - start;
+    if (entry > maxentry)
+      maxentry = entry;
+    if (((nPlanes > 4) || (plane > 0)) && (shift > maxloop))
+      maxloop = shift;
+    // Exit overhead taken as equal to entry, as for CALLOVERHEAD
+    busyticks += entry + shift;
+    if (--calcount == 0)
+      calibrating = false;
+  }
 }
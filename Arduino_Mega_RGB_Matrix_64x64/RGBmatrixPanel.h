@@ -33,6 +33,66 @@ typedef uint8_t PortType;
 typedef uint32_t PortType; // Formerly 'RwReg' but interfered w/CMCIS header
 #endif
 
+#if defined(ARDUINO_ARCH_ESP32)
+typedef uint32_t TimerCount; ///< Refresh timer interval (64-bit timer)
+#else
+typedef uint16_t TimerCount; ///< Refresh timer interval (16-bit timer)
+#endif
+
+/*!
+    @brief  Bit planes per color channel (4-8): 2^RGBMATRIX_PLANES levels per
+            R, G and B. 4 planes pack into 3 bytes per pixel pair; deeper
+            displays take one byte per plane. Each extra plane about halves
+            the refresh rate, since binary code modulation shows every
+            plane for twice as long as the one before. Estimates from the
+            stock timing constants (measure the real figure with
+            calibrateTiming() and getRefreshRate()):
+
+            Refresh (Hz)      4 planes    5     6     7     8
+            AVR    32x32         208     101    50    25    12
+            AVR    64x64          64      31    15     8     -
+            SAMD   32x32         278     134    66    33     -
+            SAMD   64x64          76      37    18     -     -
+            ESP32  32x32         362     175    86    43    21
+            ESP32  64x64          97      47    23    11     6
+
+            Figures are at full brightness. Dimmed with setBrightness(),
+            each row takes one more of the shortest intervals per plane:
+            a fifth lower at 4 planes (19 instead of 15), less with more
+            planes. '-' overflows the 16-bit
+            refresh timer. The default is 4 on AVR
+            and SAMD21, where RAM is short, and 5 on SAMD51 and ESP32.
+*/
+#ifndef RGBMATRIX_PLANES
+#if defined(__SAMD51__) || defined(ARDUINO_ARCH_ESP32)
+#define RGBMATRIX_PLANES 5
+#else
+#define RGBMATRIX_PLANES 4
+#endif
+#endif
+
+/*!
+    @brief  Define RGBMATRIX_DMA (ESP32 only) to refresh the panel from I2S
+            DMA in place of the timer interrupt. All pins then go through
+            the I2S peripheral in 16-bit parallel (LCD) mode, and the DMA
+            loops a complete output frame -- every bit plane of every row,
+            with the latch, output enable and address lines in each word
+            -- so the CPU only steps in on swapBuffers(), which rebuilds
+            that frame from the drawing buffer. Drawing therefore only
+            reaches the panel on swapBuffers(), double-buffered or not.
+            Takes two output frames of WIDTH * nRows * RGBMATRIX_PLANES
+            words plus 12 bytes of DMA descriptor per plane repeat (64x64
+            at 5 planes: about 64K); if that can't be had, begin() falls
+            back to the timer interrupt.
+*/
+#if defined(RGBMATRIX_DMA) && defined(ARDUINO_ARCH_ESP32)
+#define RGBMATRIX_USE_DMA ///< I2S DMA refresh compiled in
+#ifndef RGBMATRIX_DMA_HZ
+#define RGBMATRIX_DMA_HZ 10000000 ///< Default panel clock with DMA refresh
+#endif
+struct lldesc_s; // ESP32 DMA descriptor (rom/lldesc.h)
+#endif
+
 /*!
     @brief  Class encapsulating RGB LED matrix functionality.
 */
@@ -134,6 +194,216 @@ public:
   */
   void fillScreen(uint16_t c);
 
+  /*!
+    @brief  Fill a rectangle with one color, writing the color's packed
+            bit-plane bytes directly instead of going pixel by pixel.
+            Does not have an immediate effect -- must call updateDisplay()
+            after any drawing operations to refresh matrix contents.
+    @param  x  Left edge (horizontal).
+    @param  y  Top edge (vertical).
+    @param  w  Width in pixels.
+    @param  h  Height in pixels.
+    @param  c  Color (16-bit 5/6/5 color, but actual color on matrix
+               will be decimated from this as it uses fewer bitplanes).
+  */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c);
+
+  /*!
+    @brief  Horizontal line, as a one-pixel-high fillRect().
+    @param  x  Left end (horizontal).
+    @param  y  Row (vertical).
+    @param  w  Length in pixels.
+    @param  c  Color (16-bit 5/6/5).
+  */
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c);
+
+  /*!
+    @brief  Vertical line, as a one-pixel-wide fillRect().
+    @param  x  Column (horizontal).
+    @param  y  Top end (vertical).
+    @param  h  Length in pixels.
+    @param  c  Color (16-bit 5/6/5).
+  */
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c);
+
+  /*!
+    @brief  fillRect() for Adafruit_GFX drawing routines that batch their
+            writes between startWrite() and endWrite().
+    @param  x  Left edge (horizontal).
+    @param  y  Top edge (vertical).
+    @param  w  Width in pixels.
+    @param  h  Height in pixels.
+    @param  c  Color (16-bit 5/6/5).
+  */
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c);
+
+  /*!
+    @brief  drawFastHLine() for batched Adafruit_GFX drawing routines.
+    @param  x  Left end (horizontal).
+    @param  y  Row (vertical).
+    @param  w  Length in pixels.
+    @param  c  Color (16-bit 5/6/5).
+  */
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c);
+
+  /*!
+    @brief  drawFastVLine() for batched Adafruit_GFX drawing routines.
+    @param  x  Column (horizontal).
+    @param  y  Top end (vertical).
+    @param  h  Length in pixels.
+    @param  c  Color (16-bit 5/6/5).
+  */
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c);
+
+  using Adafruit_GFX::drawRGBBitmap;
+
+  /*!
+    @brief  Draw a PROGMEM-resident RGB 5/6/5 image, laid out as set by
+            bmp_data_bits and MSB_first in Adafruit_GFX.h. Each row is
+            converted to bit-plane bytes in one pass and stored straight
+            into the back buffer.
+    @param  x       Left edge (horizontal).
+    @param  y       Top edge (vertical).
+    @param  bitmap  Image data.
+    @param  w       Width of the image in pixels.
+    @param  h       Height of the image in pixels.
+  */
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w,
+                     int16_t h);
+
+  /*!
+    @brief  Draw a RAM-resident RGB 5/6/5 image, one pixel per entry, a row
+            at a time as above.
+    @param  x       Left edge (horizontal).
+    @param  y       Top edge (vertical).
+    @param  bitmap  Image data.
+    @param  w       Width of the image in pixels.
+    @param  h       Height of the image in pixels.
+  */
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w,
+                     int16_t h);
+
+  /*!
+    @brief  Draw one row of RGB 5/6/5 pixels from RAM, the building block
+            of drawRGBBitmap().
+    @param  x       Left end (horizontal).
+    @param  y       Row (vertical).
+    @param  colors  Pixel colors, left to right.
+    @param  w       Number of pixels.
+  */
+  void drawRGBRow(int16_t x, int16_t y, const uint16_t *colors, int16_t w);
+
+  /*!
+    @brief  Draw a PROGMEM image packed by tools/pack_image.py: a palette
+            (or plain 5/6/5 colors) and run-length coded rows. Rows are
+            decoded as they are drawn, into the same row stores as
+            drawRGBBitmap(), so no frame-sized buffer is needed.
+    @param  x      Left edge (horizontal).
+    @param  y      Top edge (vertical).
+    @param  image  Packed image, its size in its header.
+  */
+  void drawPackedBitmap(int16_t x, int16_t y, const uint8_t image[]);
+
+  /*!
+    @brief  Draw one row of a 1-bit bitmap with opaque background, such as
+            a window into a GFXcanvas1: both colors are split into plane
+            bytes once, then each pixel is one store per plane byte.
+    @param  x       Left end (horizontal).
+    @param  y       Row (vertical).
+    @param  bits    Bitmap row, most significant bit first.
+    @param  bit     Index of the first bit drawn.
+    @param  w       Number of pixels.
+    @param  fg      16-bit 5-6-5 color of set bits.
+    @param  bg      16-bit 5-6-5 color of clear bits.
+  */
+  void drawBitRow(int16_t x, int16_t y, const uint8_t *bits, uint16_t bit,
+                  int16_t w, uint16_t fg, uint16_t bg);
+
+  /*!
+    @brief  Set how long the row address lines are left to settle on each
+            row change before the new row is lit. Some panels show faint
+            ghosts of the neighbouring rows without it; others need none.
+            Find the lowest clean value for a panel by stepping it down
+            over a test pattern (see address_delay_test() in the example
+            sketch). When all the address pins share one port they are
+            switched with a single write and settle once; otherwise the
+            delay follows each line, as the library always did.
+    @param  us  Settle time in microseconds, 0 for none (default 10).
+  */
+  void setAddressDelay(uint8_t us);
+
+  /*!
+    @brief   Current row address settle time.
+    @return  Settle time in microseconds.
+  */
+  uint8_t getAddressDelay(void);
+
+  /*!
+    @brief  Set the overall display brightness. Dimming happens in the
+            refresh timing, by blanking the LEDs for part of each bit
+            plane's interval, so pixel data keeps its full color depth
+            and drawing costs nothing extra. Below full brightness each
+            plane takes a second, short interrupt, costing some refresh
+            rate and CPU (see getRefreshRate() and getISRLoad()). The
+            least significant plane can't be shortened below the
+            interrupt overhead, so very dim settings lose some accuracy
+            in dark colors. With RGBMATRIX_DMA the lit share of each
+            plane's output words is set instead, from the next
+            swapBuffers() on.
+    @param  b  Brightness, 0 (off) to 255 (full). Default 64.
+  */
+  void setBrightness(uint8_t b);
+
+  /*!
+    @brief   Current display brightness.
+    @return  Brightness, 0-255.
+  */
+  uint8_t getBrightness(void);
+
+  /*!
+    @brief  Measure the interrupt's entry overhead and data-shifting time
+            with the refresh timer, and derive the bit-plane display
+            intervals from them in place of the built-in estimates
+            (CALLOVERHEAD and LOOPTIME). Call after begin(); blocks for a
+            few frames, during which the display may flicker.
+  */
+  void calibrateTiming(void);
+
+  /*!
+    @brief   Full-screen refresh rate the current timing gives.
+    @return  Refresh rate in Hz.
+  */
+  uint16_t getRefreshRate(void);
+
+  /*!
+    @brief   Share of the CPU spent in the refresh interrupt, as measured
+             by calibrateTiming().
+    @return  Percent of CPU time, or 0 if calibrateTiming() hasn't run.
+  */
+  uint8_t getISRLoad(void);
+
+  /*!
+    @brief   Run the refresh at (or as close as possible below) a target
+             rate, by lengthening the bit-plane display intervals. Lower
+             rates leave more CPU time outside the interrupt; the data
+             shifting time sets the highest rate. Call after
+             calibrateTiming() if using that, as it starts over from the
+             shortest intervals.
+    @param   hz  Target refresh rate in Hz.
+    @return  Refresh rate achieved, in Hz.
+  */
+  uint16_t setRefreshRate(uint16_t hz);
+
+  /*!
+    @brief   Lengthen the bit-plane display intervals until the refresh
+             interrupt takes at most a given share of the CPU. Needs the
+             interrupt time measured by calibrateTiming() first.
+    @param   percent  Highest acceptable interrupt CPU share, in percent.
+    @return  Interrupt CPU share achieved, in percent (0 if not
+             calibrated). Check getRefreshRate() for the resulting rate.
+  */
+  uint8_t setMaxISRLoad(uint8_t percent);
+
   /*!
     @brief  Refresh matrix contents following one or more drawing calls.
   */
@@ -141,8 +411,48 @@ public:
 
   /*!
     @brief  If using double buffering, swap the front and back buffers.
+            With RGBMATRIX_DMA, also builds the panel's output frame from
+            the (back) buffer, double-buffered or not.
+    @param  copy  If true, bring the new back buffer up to date with what
+                  is now shown, so drawing can go on incrementally. Only
+                  the rows drawn to since they last matched are copied
+                  (every row after fillScreen() or backBuffer()), so a
+                  frame that changes a few rows costs a few row copies
+                  rather than the whole buffer. If false, the back buffer
+                  keeps the old front buffer contents.
+  */
+  void swapBuffers(boolean copy);
+
+  /*!
+    @brief   Non-blocking swapBuffers(): the first call asks for the swap
+             at the end of the refresh under way and returns; keep calling
+             (e.g. once per loop, doing other work in between) until it
+             returns true. The swap has then happened and the back buffer
+             is ready to draw into. Don't draw until then: the back buffer
+             is still due to go on screen.
+    @param   copy  As for swapBuffers(), applied once the swap is done.
+    @return  true once the swap has happened (straight away if not
+             double-buffered), false while it is pending.
+  */
+  boolean trySwap(boolean copy);
+
+  /*!
+    @brief  Have a function called when the refresh actually swaps the
+            buffers (the interrupt's end-of-frame point). It runs in
+            interrupt context, so keep it short: set a flag, give a
+            semaphore.
+    @param  callback  Function to call, or NULL for none.
+  */
+  void setSwapCallback(void (*callback)(void));
+
+#if defined(RGBMATRIX_USE_DMA)
+  /*!
+    @brief  Move the DMA refresh over to a newly built output frame; called
+            by the I2S interrupt at the end of each frame while a
+            swapBuffers() is under way.
   */
-  void swapBuffers(boolean);
+  void dmaFrame(void);
+#endif
 
   /*!
     @brief  Dump display contents to the Serial Monitor, adding some
@@ -164,6 +474,30 @@ public:
   */
   uint8_t *backBuffer(void);
 
+  /*!
+    @brief  Copy a whole-screen PROGMEM image already in back buffer
+            format into the back buffer: a dumpMatrix() dump, or
+            the output of tools/pack_image.py --format planes for this
+            panel size and RGBMATRIX_PLANES. Nothing is converted, so
+            this is as fast as copying the bytes.
+    @param  planes  Image: WIDTH * height / 2 * 3 bytes at 4 planes, each
+                    byte holding a pixel of the upper and of the lower half.
+  */
+  void drawPlanes(const uint8_t planes[]);
+
+  /*!
+    @brief  Copy one rectangle of such an image, e.g. to put a background
+            back where something moved away from it. Pixels outside the
+            rectangle are left as they are.
+    @param  planes  Whole-screen image in back buffer format.
+    @param  x       Left edge (horizontal).
+    @param  y       Top edge (vertical).
+    @param  w       Width.
+    @param  h       Height.
+  */
+  void drawPlanes(const uint8_t planes[], int16_t x, int16_t y, int16_t w,
+                  int16_t h);
+
   /*!
     @brief   Promote 3-bits R,G,B (used by earlier versions of this library)
              to the '565' color format used in Adafruit_GFX. New code should
@@ -232,6 +566,7 @@ public:
 
 
   void display_image(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h);
+  void display_image(int16_t x, int16_t y, const uint8_t image[]);
 
 
   void setFont(const GFXfont * f);
@@ -242,6 +577,33 @@ private:
   uint8_t nRows;              ///< Number of rows (derived from A/B/C/D pins)
   volatile uint8_t backindex; ///< Index (0-1) of back buffer
   volatile boolean swapflag;  ///< if true, swap on next vsync
+  uint8_t dirtyrow[32]; ///< Nonzero where back and front buffer rows may differ
+  boolean swapposted;   ///< trySwap() has asked for a swap not yet finished
+  void (*volatile swapcallback)(void); ///< Called by the interrupt on swap
+
+  // Note that buffer row y (display rows y and y + nRows) was drawn to
+  inline void markRow(uint8_t y) { dirtyrow[y] = 1; }
+
+  // Stretch the shortest plane interval to period timer ticks
+  void setPeriod(uint32_t period);
+
+  // Packed plane bytes of one color for the upper and lower half
+  void colorPlanes(uint16_t c, uint8_t *upper, uint8_t *lower);
+
+  // Store n pixel colors at unrotated, already clipped (x, y)
+  void writeRow(int16_t x, int16_t y, const uint16_t *colors, int16_t n);
+
+#if defined(RGBMATRIX_USE_DMA)
+  // Set up the I2S output and DMA chains; false (and no DMA) if short of
+  // memory
+  boolean dmaBegin(void);
+
+  // Build output frame n from a drawing buffer
+  void dmaFill(uint8_t n, const uint8_t *buf);
+
+  // Set the panel clock for the DMA refresh
+  void dmaClock(uint32_t hz);
+#endif
 
   // Init/alloc code common to both constructors:
   void init(uint8_t rows, uint8_t a, uint8_t b, uint8_t c, uint8_t clk,
@@ -277,6 +639,10 @@ private:
   volatile PortType *addrdport; ///< Address/row-select D PORT register
   volatile PortType *addreport; ///< Address/row-select E PORT register
 
+  PortType addrmask;    ///< All address pins, if on one port (else 0)
+  PortType rowaddr[32]; ///< Address pin states of each row, within addrmask
+  uint8_t addrdelay;    ///< Address line settle time (microseconds)
+
 #if defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_ESP32)
   uint8_t rgbpins[6];           ///< Pin numbers for 2x R,G,B bits
   volatile PortType *outsetreg; ///< RGB PORT bit set register
@@ -285,6 +651,28 @@ private:
   PortType expand[256];         ///< 6-to-32 bit converter table
 #endif
 
+  uint16_t calloverhead; ///< Interrupt entry (and exit) time, timer ticks
+  uint16_t looptime;     ///< Shortest plane's display time, timer ticks
+  uint16_t shifttime;    ///< Planes 1-3 data shifting time, timer ticks
+  uint32_t rowbusy;      ///< Measured interrupt time per row, timer ticks
+  volatile uint8_t brightness;  ///< 0-255, see setBrightness()
+  volatile boolean blanking;    ///< Next interrupt blanks a dimmed plane
+  TimerCount blankticks;        ///< Interval of that blanking
+  volatile boolean calibrating; ///< True while calibrateTiming() measures
+  uint16_t calcount;            ///< Interrupts left to measure
+  uint16_t maxentry;            ///< Longest measured entry overhead
+  uint16_t maxloop;             ///< Longest measured planes 1-3 shifting
+  uint32_t busyticks;           ///< Total measured interrupt time
+
+#if defined(RGBMATRIX_USE_DMA)
+  uint16_t *dmabuff[2];         ///< Output frames (NULL: timer refresh)
+  struct lldesc_s *dmadesc[2];  ///< DMA descriptor chain of each frame
+  uint16_t dmalast;             ///< Index of each chain's last descriptor
+  volatile uint8_t dmaindex;    ///< Index (0-1) of the frame being shown
+  volatile uint8_t dmaswap;     ///< 1: swap requested, 2: chains relinked
+  uint32_t dmahz;               ///< Panel clock, Hz
+#endif
+
   volatile uint8_t row;      ///< Row counter for interrupt handler
   volatile uint8_t plane;    ///< Bitplane counter for interrupt handler
   volatile uint8_t *buffptr; ///< Current RGB pointer for interrupt handler
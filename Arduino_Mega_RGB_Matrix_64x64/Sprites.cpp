@@ -0,0 +1,227 @@
+#include "Sprites.h"
+
+#define SPRITE_CHUNK 32 ///< Opaque pixels gathered per drawRGBRow()
+
+SpriteLayer::SpriteLayer(RGBmatrixPanel &matrix) : matrix(&matrix) {
+  background = NULL;
+  color = 0;
+  dirtyCount = 0;
+  for (uint8_t i = 0; i < SPRITE_MAX; i++)
+    sprite[i].sheet = NULL;
+}
+
+void SpriteLayer::setBackground(const uint8_t *planes, uint16_t color) {
+  background = planes;
+  this->color = color;
+}
+
+int8_t SpriteLayer::add(const SpriteSheet *sheet, int16_t x, int16_t y) {
+  for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+    Sprite &s = sprite[i];
+    if (s.sheet)
+      continue;
+    s.sheet = sheet;
+    s.x = x;
+    s.y = y;
+    s.frame = 0;
+    s.period = 0;
+    s.shown = false;
+    s.changed = true;
+    s.removed = false;
+    return i;
+  }
+  return -1;
+}
+
+void SpriteLayer::remove(int8_t id) {
+  sprite[id].removed = true;
+  sprite[id].changed = true;
+}
+
+void SpriteLayer::move(int8_t id, int16_t x, int16_t y) {
+  Sprite &s = sprite[id];
+  if ((x == s.x) && (y == s.y))
+    return;
+  s.x = x;
+  s.y = y;
+  s.changed = true;
+}
+
+void SpriteLayer::setFrame(int8_t id, uint8_t frame) {
+  Sprite &s = sprite[id];
+  s.period = 0;
+  frame %= s.sheet->frames;
+  if (frame != s.frame) {
+    s.frame = frame;
+    s.changed = true;
+  }
+}
+
+void SpriteLayer::animate(int8_t id, uint16_t ms) {
+  sprite[id].period = ms;
+  sprite[id].stepped = millis();
+}
+
+boolean SpriteLayer::update(void) {
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+    Sprite &s = sprite[i];
+    if (!s.sheet || !s.period || (now - s.stepped < s.period))
+      continue;
+    // Late steps are dropped rather than played back to back
+    s.stepped = (now - s.stepped < 2 * s.period) ? s.stepped + s.period : now;
+    s.frame = (s.frame + 1) % s.sheet->frames;
+    s.changed = true;
+  }
+
+  // Where each changed sprite was and where it is now
+  for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+    Sprite &s = sprite[i];
+    if (!s.sheet || !s.changed)
+      continue;
+    s.changed = false;
+    if (s.shown)
+      addDirty(s.drawn);
+    if (s.removed) {
+      s.sheet = NULL;
+      continue;
+    }
+    s.drawn.x = s.x;
+    s.drawn.y = s.y;
+    s.drawn.w = s.sheet->w;
+    s.drawn.h = s.sheet->h;
+    s.shown = true;
+    addDirty(s.drawn);
+  }
+
+  if (!dirtyCount)
+    return false;
+  for (uint8_t d = 0; d < dirtyCount; d++)
+    repaint(dirty[d]);
+  dirtyCount = 0;
+  return true;
+}
+
+void SpriteLayer::redraw(void) {
+  if (background)
+    matrix->drawPlanes(background);
+  else
+    matrix->fillScreen(color);
+
+  Rect screen = {0, 0, matrix->width(), matrix->height()};
+  for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+    Sprite &s = sprite[i];
+    if (s.sheet && s.removed)
+      s.sheet = NULL;
+    if (!s.sheet)
+      continue;
+    s.changed = false;
+    s.drawn.x = s.x;
+    s.drawn.y = s.y;
+    s.drawn.w = s.sheet->w;
+    s.drawn.h = s.sheet->h;
+    s.shown = true;
+    drawSprite(s, screen);
+  }
+  dirtyCount = 0;
+}
+
+// Clip to the screen and merge with any rectangle it overlaps, so no area
+// is repainted twice
+void SpriteLayer::addDirty(const Rect &rect) {
+  Rect r = rect;
+  if (r.x < 0) {
+    r.w += r.x;
+    r.x = 0;
+  }
+  if (r.y < 0) {
+    r.h += r.y;
+    r.y = 0;
+  }
+  if (r.x + r.w > matrix->width())
+    r.w = matrix->width() - r.x;
+  if (r.y + r.h > matrix->height())
+    r.h = matrix->height() - r.y;
+  if ((r.w <= 0) || (r.h <= 0))
+    return;
+
+  uint8_t d = 0;
+  while (d < dirtyCount) {
+    Rect &o = dirty[d];
+    if ((o.x >= r.x + r.w) || (r.x >= o.x + o.w) || (o.y >= r.y + r.h) ||
+        (r.y >= o.y + o.h)) {
+      d++;
+      continue;
+    }
+    int16_t x1 = r.x + r.w, y1 = r.y + r.h;
+    if (o.x + o.w > x1)
+      x1 = o.x + o.w;
+    if (o.y + o.h > y1)
+      y1 = o.y + o.h;
+    if (o.x < r.x)
+      r.x = o.x;
+    if (o.y < r.y)
+      r.y = o.y;
+    r.w = x1 - r.x;
+    r.h = y1 - r.y;
+    // The union may overlap rectangles already passed over: start again
+    dirty[d] = dirty[--dirtyCount];
+    d = 0;
+  }
+  dirty[dirtyCount++] = r;
+}
+
+void SpriteLayer::repaint(const Rect &r) {
+  if (background)
+    matrix->drawPlanes(background, r.x, r.y, r.w, r.h);
+  else
+    matrix->fillRect(r.x, r.y, r.w, r.h, color);
+
+  for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+    if (sprite[i].sheet && sprite[i].shown)
+      drawSprite(sprite[i], r);
+  }
+}
+
+// The opaque pixels of a sprite inside clip, each run of them along a row
+// stored with drawRGBRow()
+void SpriteLayer::drawSprite(const Sprite &s, const Rect &clip) {
+  const SpriteSheet *sheet = s.sheet;
+  int16_t i0 = clip.x - s.x, i1 = clip.x + clip.w - s.x;
+  int16_t j0 = clip.y - s.y, j1 = clip.y + clip.h - s.y;
+  if (i0 < 0)
+    i0 = 0;
+  if (i1 > sheet->w)
+    i1 = sheet->w;
+  if (j0 < 0)
+    j0 = 0;
+  if (j1 > sheet->h)
+    j1 = sheet->h;
+  if ((i0 >= i1) || (j0 >= j1))
+    return;
+
+  uint8_t bw = (sheet->w + 7) >> 3;
+  const uint16_t *bitmap = &sheet->bitmap[(uint16_t)s.frame * sheet->w * sheet->h];
+  const uint8_t *mask = &sheet->mask[(uint16_t)s.frame * bw * sheet->h];
+  uint16_t line[SPRITE_CHUNK];
+  for (int16_t j = j0; j < j1; j++) {
+    const uint16_t *pixels = &bitmap[j * sheet->w];
+    const uint8_t *bits = &mask[j * bw];
+    int16_t n = 0, start = 0;
+    for (int16_t i = i0; i < i1; i++) {
+      if (pgm_read_byte(&bits[i >> 3]) & (0x80 >> (i & 7))) {
+        if (!n)
+          start = i;
+        line[n++] = pgm_read_word(&pixels[i]);
+        if (n < SPRITE_CHUNK)
+          continue;
+      } else if (!n) {
+        continue;
+      }
+      matrix->drawRGBRow(s.x + start, s.y + j, line, n);
+      n = 0;
+    }
+    if (n)
+      matrix->drawRGBRow(s.x + start, s.y + j, line, n);
+  }
+}
@@ -0,0 +1,133 @@
+#ifndef _SPRITES_H_
+#define _SPRITES_H_
+
+#include "RGBmatrixPanel.h"
+
+/*!
+  @brief  Most sprites on screen at once.
+*/
+#ifndef SPRITE_MAX
+#define SPRITE_MAX 8
+#endif
+
+/*!
+  @brief  A PROGMEM sprite sheet in the layout of Adafruit_GFX's masked
+          drawRGBBitmap(): one 16-bit 5/6/5 word per pixel plus a 1-bit
+          mask (set = opaque) with rows padded to whole bytes. Frames are
+          stacked top to bottom. tools/pack_image.py --format sprite
+          writes these.
+*/
+struct SpriteSheet {
+  const uint16_t *bitmap; ///< w * h words per frame
+  const uint8_t *mask;    ///< (w + 7) / 8 * h bytes per frame
+  uint8_t w;              ///< Frame width
+  uint8_t h;              ///< Frame height
+  uint8_t frames;         ///< Number of frames
+};
+
+/*!
+  @brief  Masked sprites over a background on an RGBmatrixPanel. Moving a
+          sprite, or stepping its animation, only redraws the rectangles
+          it left and entered: the background is put back there and every
+          sprite touching them is drawn again, clipped to them, in the
+          order they were added (later ones on top). The rest of the
+          frame buffer isn't touched.
+*/
+class SpriteLayer {
+public:
+  /*!
+    @brief  Attach to a display.
+    @param  matrix  Display the sprites are drawn on.
+  */
+  SpriteLayer(RGBmatrixPanel &matrix);
+
+  /*!
+    @brief  Background under the sprites: a whole-screen image in back
+            buffer format (see RGBmatrixPanel::drawPlanes()), or a solid
+            color. Call redraw() after changing it.
+    @param  planes  Image, or NULL for the color.
+    @param  color   16-bit 5-6-5 color used without an image.
+  */
+  void setBackground(const uint8_t *planes, uint16_t color = 0);
+
+  /*!
+    @brief   Put a sprite on screen (at the next update()).
+    @param   sheet  Its frames. Must stay valid while it is shown.
+    @param   x      Left edge.
+    @param   y      Top edge.
+    @return  Sprite number, or -1 with SPRITE_MAX sprites already up.
+  */
+  int8_t add(const SpriteSheet *sheet, int16_t x, int16_t y);
+
+  /*!
+    @brief  Take a sprite off screen (at the next update()) and free its
+            number.
+    @param  id  Sprite number.
+  */
+  void remove(int8_t id);
+
+  /*!
+    @brief  Move a sprite.
+    @param  id  Sprite number.
+    @param  x   New left edge.
+    @param  y   New top edge.
+  */
+  void move(int8_t id, int16_t x, int16_t y);
+
+  /*!
+    @brief  Show a given frame and stop any animation.
+    @param  id     Sprite number.
+    @param  frame  Frame of its sheet.
+  */
+  void setFrame(int8_t id, uint8_t frame);
+
+  /*!
+    @brief  Step through all of a sprite's frames, over and over.
+    @param  id  Sprite number.
+    @param  ms  Time per frame, timed by millis(); 0 stops on the current
+                frame.
+  */
+  void animate(int8_t id, uint16_t ms);
+
+  /*!
+    @brief   Step animations that are due, then redraw what changed since
+             the last update().
+    @return  true if anything was drawn.
+  */
+  boolean update(void);
+
+  /*!
+    @brief  Draw the whole background and every sprite.
+  */
+  void redraw(void);
+
+private:
+  struct Rect {
+    int16_t x, y, w, h;
+  };
+
+  struct Sprite {
+    const SpriteSheet *sheet; // NULL: free
+    int16_t x, y;
+    uint8_t frame;
+    uint16_t period;          // Animation ms per frame, 0 = still
+    uint32_t stepped;         // millis() of the last frame step
+    boolean shown;            // Drawn at drawn.x, drawn.y
+    boolean changed;          // Needs redrawing at the next update()
+    boolean removed;          // Take off screen, then free
+    Rect drawn;               // Where it was last drawn
+  };
+
+  void addDirty(const Rect &r);
+  void repaint(const Rect &r);
+  void drawSprite(const Sprite &s, const Rect &clip);
+
+  RGBmatrixPanel *matrix;
+  const uint8_t *background;
+  uint16_t color;
+  Sprite sprite[SPRITE_MAX];
+  Rect dirty[2 * SPRITE_MAX];
+  uint8_t dirtyCount;
+};
+
+#endif // _SPRITES_H_
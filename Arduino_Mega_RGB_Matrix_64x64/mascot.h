@@ -0,0 +1,202 @@
+// Made with tools/pack_image.py --format sprite, for
+// SpriteLayer. Do not edit.
+#ifndef __MASCOT_H
+#define __MASCOT_H
+#include "avr/pgmspace.h"
+#include "Sprites.h"
+
+// 32x32, 2 frames, transparent 0xFFFF: 4352 bytes
+const uint16_t PROGMEM Pikachu_sprite_bitmap[] = {
+  0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xF7BE,0xFFDF,0x5ACB,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0x0000,0xFFFF,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0x7BEF,0x0000,0xEF7D,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xFFFF,0x0000,0xD640,0xE73C,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xFFFF,0xACA0,0xFF40,0xDF1E,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xDF1E,0xFF60,0xFF20,0xE75F,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xDEFB,0xFF40,0xF6C0,0xF7FF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xE73F,0xDEDA,0xDED7,
+  0xD6D9,0xDF1F,0xFFDF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xDEFB,0xFF40,0xEEA1,0xDEFB,
+  0xD644,0xEE80,0xEE80,0xD5E2,0xEEA0,0xFF40,0xFF40,0xFF40,0xFF40,0xFF40,0xF700,0x2126,
+  0xF79E,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xE73F,0xFF80,0xCDC0,0xFF60,0xFF00,0xFF20,0xFF20,0xFF20,
+  0xFF20,0xDE21,0xE680,0xF6C0,0xFF40,0x7BA0,0x0000,0x0000,0x0000,0x8430,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xFFFF,0xCD80,0xFF20,0xFF00,0xFF00,0xFF20,0xFF00,0xFF20,0xFFE0,0xFF00,0xFFFF,0xFFFF,
+  0xEF7F,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xFFFF,0xF6C0,0xFF60,0xFF00,
+  0xFF00,0xFF00,0xFF00,0xACE1,0x18E7,0xFFC0,0xE75F,0xF7BE,0xFFFF,0xE75F,0xFFFF,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7DF,0xFF60,0x5288,0xC5C0,0xFF00,0xFF60,0xFF00,0xBD60,
+  0x0000,0xFFC0,0xD791,0xEF7F,0xCE27,0xFF20,0xBD64,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xEF9F,0xD6DC,0xD652,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xFFFF,0xFFE0,0x0000,0x83A0,0xFF20,0xEEC0,0xFFE0,0xFF20,0xFFE0,0xDE80,0xE001,0xFFC0,
+  0xFF00,0xFF60,0xCE76,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xDF1F,0xCE4F,0xDE40,
+  0xFF00,0xFF80,0xDEB8,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xCE20,0xFFE0,0xFF60,
+  0xAD20,0x0800,0x0800,0x8BA0,0xFF00,0xDB40,0xE800,0xFFE0,0xFF00,0xEE40,0xFFFF,0xF7BE,
+  0xF7BE,0xFFDF,0xF7DF,0xCE53,0xDE40,0xFF60,0xFF20,0xFF00,0xFF20,0xFEC0,0xF7DF,0xFFFF,
+  0xFFFF,0xFFFF,0xBD86,0xDE45,0xE741,0xF800,0xEF80,0xFF00,0xFFE0,0x5800,0xD1A3,0xC3C0,
+  0xFF00,0xEF20,0xC280,0xFF20,0xFFA0,0xCDD8,0xF7BE,0xF7BE,0xF7BF,0xCE2C,0xF6E0,0xFF40,
+  0xFF00,0xFF00,0xFF00,0xFF00,0xFF00,0xDE44,0xFFFF,0xFFFF,0xFFFF,0xE75F,0xFF80,0xFF00,
+  0xFF00,0xDBE0,0xEE20,0xFF00,0xFF00,0xDCE3,0xFB47,0xDDC0,0xFF00,0xE660,0xFF60,0xFF60,
+  0xC445,0xFFFF,0xF7BE,0xFFFF,0xDD20,0xF663,0xFEC1,0xFF40,0xFF60,0xFF40,0xFF00,0xFF00,
+  0xFF40,0xD6B6,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xBDD2,0xF660,0xFF40,0xFF60,0xCE00,0xF6E0,
+  0xFF40,0xFFC0,0xC3A2,0xFFE0,0xFF20,0xF6E0,0xFF40,0xCC63,0xFFFF,0xF7BE,0xF7BE,0xF7FF,
+  0xE502,0xE566,0xE566,0xE527,0xE527,0xED86,0xF623,0xFEC0,0xFF00,0xEF9F,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xE77F,0xCC83,0xFF01,0xFF60,0xFF20,0xDE80,0xEDA6,0xE547,0xDCE9,
+  0xFF40,0xFF00,0xFEE1,0xFF60,0xD6BA,0xF7BE,0xF7BE,0xEFBF,0xE523,0xE565,0xCCC4,0xCD2A,
+  0xCDB0,0xD655,0xDEDA,0xE73D,0xE75F,0xFFBE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xFFFF,0xCE37,0xC487,0xF662,0xFF20,0xFF60,0xFF60,0xFF40,0xFF40,0xEEA0,0xCE00,0xF700,
+  0xE640,0xFFFF,0xF7BE,0xE75F,0xED64,0xCDB0,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xDE84,
+  0xFF00,0xFF00,0xFF00,0xFF80,0x9480,0xFF20,0xFF20,0xF6E0,0xFF60,0xEF9F,0xCDB1,0xC5D3,
+  0xF5A5,0xD656,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xE661,0xFF00,0xFF00,0xFF00,0xFF40,
+  0xB501,0xDEA0,0xFF40,0xF662,0xFEE1,0xFFFE,0xA2E1,0xCDAE,0xD54A,0xE71C,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xFFFF,0xE662,0xFF00,0xFF00,0xFF00,0xFF00,0xDE60,0xDCC9,0xF6A2,0xED67,
+  0xED87,0x5000,0x4800,0xDEDB,0xFFDF,0xFFDF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xDE65,
+  0xFF00,0xFF20,0xFF00,0xFF00,0xFF40,0xCCC7,0xEDA7,0xCCE5,0xFE87,0x50E6,0xCE38,0xE6FB,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xE660,0xFF20,0xFF00,0xFF20,0xFF00,
+  0xFF60,0xDD07,0xE566,0xD4A0,0xCE37,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xFFFF,0xEE80,0xFF00,0xFF00,0xFF60,0xF643,0xE528,0xD4C2,0xD656,0xFFFF,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFDF,0xCD8E,
+  0xFF21,0xF663,0xE528,0xEDA6,0xC484,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xBC88,0xE587,0xD4A2,0xC5B2,
+  0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFDF,0xDDA8,0xD340,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xC646,0xC3A2,0xFFFF,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,
+  0xFFFF,0xFFFF,0xF79E,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xBD68,0xE75E,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,
+  0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xF7BE,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,
+  0xFFFF,0xFFFF,0xFFFF,0xFFFF,0x1C47,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,
+  0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,
+  0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,0x1406,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x0405,0x0445,0x01E2,0x01E2,
+  0x0425,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E5,0x0405,0x0405,0x1142,0x81E4,0x8285,0x8184,0x0465,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x0465,0x00E2,0x2180,0xBCE0,
+  0x52A0,0x9306,0x92E6,0x0242,0x03C4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03C4,0x04A5,
+  0x0264,0x11C1,0x2A61,0x00E1,0x6360,0xFFE0,0xFFE0,0xFFC0,0xFFE0,0x5125,0x00A0,0x0465,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x0344,0x04A5,0x0325,0x9C00,0xFFE0,0xFFE0,0xFFE0,0xFFE0,
+  0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xFFE0,0x0061,0x0465,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x3343,0x7B80,0xCDE0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFE0,
+  0x0001,0x0465,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03C4,0x0465,0x0841,0xF780,0xFFA0,0xFFA0,
+  0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFE0,0x00E2,0x0465,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03C4,0x03C5,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x0485,0x01E4,0xA460,0x2960,0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFC0,
+  0xFFC0,0xFFA0,0xFFA0,0xEEA0,0x0324,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x04C5,0x8B00,0x0324,0x03E4,0x1406,0x03E4,0x03E4,0x0425,0x0344,0x7320,0xFFE0,0x7BA0,
+  0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0x8C40,0x3160,0xFFE0,0xFFA0,0xFFC0,
+  0x4A20,0x0485,0x03E4,0x03E4,0x03E4,0x03E4,0x03C4,0x04A5,0x2820,0xFFE0,0x00C3,0x03C4,
+  0x1406,0x03C4,0x04A5,0x0921,0x28C1,0xFFE0,0xFFC0,0x39C0,0xFFE0,0xFFA0,0xFFA0,0xFFA0,
+  0xFFA0,0xFFA0,0xFFE0,0x0000,0xD699,0x18E1,0xFFC0,0xFFA0,0xFFE0,0x0285,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x0465,0x3080,0xFFE0,0xFFA0,0x93C0,0x0485,0x1406,0x0344,0x48E2,0x9B27,
+  0x6A24,0xC600,0xFFE0,0x39E0,0xFFC0,0xFFE0,0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xFFE0,0x0000,
+  0x0800,0x0001,0xFFE0,0xFFE0,0xFFE0,0x0141,0x03E4,0x03E4,0x03E4,0x0465,0x0001,0xFFE0,
+  0xFFA0,0xFFA0,0x7B80,0x0465,0x1426,0x02A3,0x0222,0x0182,0x01A2,0x0243,0x0305,0x00E1,
+  0xFFE0,0x7360,0x3180,0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xB5C0,0x6984,0x8480,0xDCAF,0xD450,
+  0xFFE0,0x00E2,0x03C4,0x03E4,0x0465,0x0001,0xFFE0,0xFFA0,0xFFA0,0xFFA0,0x7B80,0x0465,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x00E3,0xFFE0,0x0000,0xFFFF,0xFFA0,
+  0xFFC0,0xCE20,0xFFA0,0xFFE0,0xFFE0,0xF686,0xFD70,0xF4D3,0xFFE0,0xD5A0,0x0486,0x0445,
+  0x0001,0xFFE2,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0x7B80,0x0465,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x04E6,0x9C20,0x8400,0x6920,0x4A80,0xFFE0,0xD660,0xC5E0,0xBDC0,
+  0xFFA0,0xFFE0,0xFEA6,0xFEE5,0xFFC0,0xFFE0,0x2100,0x0182,0xFFE0,0xFFA0,0xFFA0,0xFFA0,
+  0xFFA0,0xFFA0,0x7B80,0x0465,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x2A04,0xF629,0x8C60,0xFFE0,0x9460,0xCE00,0xCE20,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,
+  0xFFA0,0xFFA0,0xEF40,0x0840,0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xFFA0,0xFFC0,0x93C0,0x0485,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x0240,0xFE95,0xE5C9,0xFFA0,
+  0xFFC0,0xFFC0,0xFFA0,0xFFA0,0xFFA0,0xFFE0,0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xF780,0x00A2,
+  0xFFE0,0xFFA0,0xFFA0,0xFFA0,0xFFE0,0x7320,0x02A4,0x03C4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x0466,0x0102,0x9C60,0xD5E0,0xFFE0,0xFFA0,0xFFA0,0xFFA0,
+  0xFFC0,0x6B40,0xC5E0,0xFFA0,0xFFA0,0xEF20,0x4867,0x2B04,0x0103,0xCE40,0xD660,0x9C60,
+  0x0183,0x0465,0x03C4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x0485,0x03C5,0x4160,0xFFC0,0xFFA0,0xFFA0,0xE700,0x5280,0xFFC0,0xFFA0,
+  0xFFC0,0xE681,0xFFE0,0x7B80,0x0405,0xA4A0,0xFFE0,0x0305,0x03C4,0x03E4,0x03E4,0x03E4,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x0405,0x19E1,0x0365,
+  0xF6A0,0xFFA0,0xFFA0,0xFFC0,0x3180,0xFFE0,0xFFA0,0xFFE0,0xFFA0,0xFFA0,0xFFE0,0x6905,
+  0x01C1,0xFFE0,0x10C0,0x0465,0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x0485,0x9400,0x62C0,0x3AA1,0x3180,0xFFE0,0xFFA0,
+  0xEF20,0x8C40,0x6B80,0x4220,0xFFC0,0xF760,0x48C7,0x9306,0x00C0,0x4023,0x0465,0x03C4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x0465,0x7B80,0xFFE0,0xFFE0,0xFFE0,0xFFA0,0xFFA0,0x83E0,0x7BC0,0xD6A0,0xFFE0,
+  0xFFA0,0xFFC0,0xFFE0,0xFFE0,0x3864,0x1800,0x0445,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x0425,0x4A80,0xFFC0,
+  0xFFA0,0xFFA0,0xFFA0,0xFFE0,0x0860,0xFFE0,0xC620,0x7BE0,0xFFC0,0xFFA0,0xFFE0,0x1800,
+  0x0445,0x0445,0x03C4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03C5,0xE620,0xFFE0,0xFFC0,0xFFA0,0xFFA0,
+  0xFFE0,0x9CE0,0xFFA0,0xFFE0,0xFFC0,0xFFE0,0x0000,0x04E6,0x03C4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03C4,0x0365,0x01E3,0x4301,0x9C20,0xD5C0,0xD5C0,0x7B20,0xD600,0xD5E0,
+  0x4301,0x0183,0x04E6,0x03C4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E5,0x0445,0x0405,0x0405,0x0445,0x0405,0x0405,0x0405,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x1406,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+  0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,0x03E4,
+};
+const uint8_t PROGMEM Pikachu_sprite_mask[] = {
+  0x00,0x00,0x00,0x00,0x3E,0xFF,0xFF,0xFE,0x3A,0xFF,0xFF,0xFE,0x3F,0xFF,0xFF,0xFE,
+  0x37,0xFF,0xFF,0xFE,0x37,0xFF,0xFF,0xFE,0x3F,0xFF,0xFF,0xFE,0x3F,0x07,0xEF,0xFE,
+  0x3F,0xFF,0xFB,0xFE,0x3F,0xFF,0xFF,0xFE,0x37,0xFC,0x83,0xFE,0x37,0xFF,0x5F,0xFE,
+  0x3F,0xFF,0xEF,0xEE,0x37,0xFF,0xFF,0x7E,0x07,0xFF,0xDF,0xFE,0x3F,0xFF,0xFF,0xFC,
+  0x7F,0xFF,0xAF,0xFE,0x3F,0xFF,0x7F,0xFE,0x3F,0xFF,0xFF,0xFE,0x37,0xFF,0xBC,0xFE,
+  0x3D,0xFF,0xFF,0xFE,0x3D,0xFF,0xFF,0xFE,0x3D,0xFF,0xFF,0xFE,0x3D,0xFF,0xFF,0xFE,
+  0x3D,0xFF,0xBF,0xFE,0x3D,0xFE,0xFF,0xFE,0x3F,0xFB,0xFF,0xFE,0x3E,0xF7,0xFF,0xFE,
+  0x3F,0xDF,0xFF,0xFE,0x3E,0xDF,0xFF,0xFE,0x3F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+};
+const SpriteSheet Pikachu_sprite = {Pikachu_sprite_bitmap, Pikachu_sprite_mask, 32, 32, 2};
+
+#endif
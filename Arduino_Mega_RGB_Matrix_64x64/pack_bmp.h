@@ -0,0 +1,725 @@
+// Made with tools/pack_image.py --format packed --planes 4, for
+// RGBmatrixPanel::drawPackedBitmap(). Do not edit.
+#ifndef __PACK_BMP_H
+#define __PACK_BMP_H
+#include "avr/pgmspace.h"
+
+// 64x64, 226-color palette: 1982 bytes
+const uint8_t PROGMEM Pikachu1_64x64[] = {
+  0x40,0x40,0xE1,0x00,0x00,0x00,0x02,0x00,0x06,0x00,0x80,0x10,0x82,0x10,0x86,0x10,
+  0x00,0x20,0x00,0x21,0x04,0x21,0x06,0x21,0x0C,0x21,0x00,0x30,0x80,0x31,0x86,0x31,
+  0x8A,0x31,0x00,0x40,0x82,0x40,0x80,0x41,0x0A,0x42,0x00,0x50,0x84,0x50,0x86,0x50,
+  0x80,0x51,0x80,0x52,0x88,0x52,0x8A,0x52,0x12,0x53,0x00,0x60,0x8A,0x61,0x00,0x62,
+  0x0C,0x63,0x10,0x63,0x00,0x70,0x00,0x71,0x00,0x73,0x80,0x73,0x8E,0x73,0x00,0x83,
+  0x80,0x83,0x10,0x84,0x18,0x84,0x9A,0x84,0x00,0x93,0x80,0x93,0x00,0x94,0x10,0x94,
+  0x80,0x94,0x8A,0x94,0x92,0x94,0x82,0xA0,0x80,0xA2,0x00,0xA4,0x08,0xA4,0x80,0xA4,
+  0x00,0xA5,0x82,0xB0,0x00,0xB3,0x06,0xB3,0x00,0xB4,0x04,0xB4,0x06,0xB4,0x80,0xB4,
+  0x82,0xB4,0x84,0xB4,0x88,0xB4,0x8A,0xB4,0x8C,0xB4,0x8E,0xB4,0x00,0xB5,0x04,0xB5,
+  0x08,0xB5,0x10,0xB5,0x12,0xB5,0x14,0xB5,0x86,0xB5,0x90,0xB5,0x92,0xB5,0x94,0xB5,
+  0x96,0xB5,0x00,0xC0,0x80,0xC0,0x00,0xC2,0x80,0xC2,0x00,0xC3,0x80,0xC3,0x82,0xC3,
+  0x00,0xC4,0x02,0xC4,0x04,0xC4,0x06,0xC4,0x12,0xC4,0x80,0xC4,0x82,0xC4,0x84,0xC4,
+  0x86,0xC4,0x88,0xC4,0x8E,0xC4,0x02,0xC5,0x04,0xC5,0x06,0xC5,0x08,0xC5,0x0A,0xC5,
+  0x0C,0xC5,0x0E,0xC5,0x80,0xC5,0x82,0xC5,0x86,0xC5,0x8E,0xC5,0x90,0xC5,0x92,0xC5,
+  0x94,0xC5,0x98,0xC5,0x00,0xC6,0x06,0xC6,0x0C,0xC6,0x0E,0xC6,0x10,0xC6,0x12,0xC6,
+  0x14,0xC6,0x16,0xC6,0x18,0xC6,0x1C,0xC6,0x80,0xC6,0x9A,0xC6,0x9C,0xC6,0x00,0xD0,
+  0x00,0xD1,0x82,0xD1,0x00,0xD3,0x04,0xD3,0x80,0xD3,0x00,0xD4,0x02,0xD4,0x80,0xD4,
+  0x82,0xD4,0x88,0xD4,0x00,0xD5,0x02,0xD5,0x04,0xD5,0x06,0xD5,0x08,0xD5,0x0A,0xD5,
+  0x80,0xD5,0x82,0xD5,0x88,0xD5,0x90,0xD5,0x92,0xD5,0x00,0xD6,0x02,0xD6,0x04,0xD6,
+  0x06,0xD6,0x08,0xD6,0x0A,0xD6,0x0C,0xD6,0x0E,0xD6,0x10,0xD6,0x12,0xD6,0x14,0xD6,
+  0x16,0xD6,0x18,0xD6,0x80,0xD6,0x84,0xD6,0x8C,0xD6,0x8E,0xD6,0x90,0xD6,0x92,0xD6,
+  0x94,0xD6,0x96,0xD6,0x98,0xD6,0x9A,0xD6,0x9C,0xD6,0x9E,0xD6,0x16,0xD7,0x18,0xD7,
+  0x1C,0xD7,0x1E,0xD7,0x90,0xD7,0x00,0xE0,0x06,0xE2,0x80,0xE4,0x00,0xE5,0x02,0xE5,
+  0x04,0xE5,0x06,0xE5,0x08,0xE5,0x80,0xE5,0x84,0xE5,0x86,0xE5,0x00,0xE6,0x02,0xE6,
+  0x04,0xE6,0x80,0xE6,0x82,0xE6,0x8E,0xE6,0x90,0xE6,0x98,0xE6,0x9A,0xE6,0x00,0xE7,
+  0x1C,0xE7,0x1E,0xE7,0x80,0xE7,0x9E,0xE7,0x00,0xF0,0x08,0xF1,0x08,0xF2,0x88,0xF2,
+  0x06,0xF3,0x86,0xF3,0x00,0xF4,0x80,0xF4,0x02,0xF5,0x80,0xF5,0x82,0xF5,0x84,0xF5,
+  0x86,0xF5,0x00,0xF6,0x02,0xF6,0x04,0xF6,0x06,0xF6,0x08,0xF6,0x80,0xF6,0x82,0xF6,
+  0x86,0xF6,0x00,0xF7,0x80,0xF7,0x9E,0xF7,0xBE,0xE1,0xBE,0xE1,0x8A,0xE1,0x80,0x19,
+  0xB0,0xE1,0x89,0xE1,0x02,0xA9,0x00,0x08,0xB0,0xE1,0x89,0xE1,0x02,0x19,0x00,0x0D,
+  0xB0,0xE1,0x88,0xE1,0x03,0xC6,0x00,0x00,0x08,0xB0,0xE1,0x88,0xE1,0x04,0x24,0x00,
+  0x00,0x01,0xC6,0xAF,0xE1,0x88,0xE1,0x04,0x08,0x00,0x00,0x17,0xC6,0xAF,0xE1,0x87,
+  0xE1,0x05,0xA8,0x00,0x03,0x93,0xE0,0xC6,0xAF,0xE1,0x87,0xE1,0x05,0x1F,0x00,0xC5,
+  0xE0,0xBC,0xAE,0xAF,0xE1,0x87,0xE1,0x05,0x12,0x35,0xE0,0xDF,0xBD,0xAF,0xAF,0xE1,
+  0x86,0xE1,0x06,0xC7,0x6A,0xE0,0xDF,0xDF,0x95,0xC7,0xAF,0xE1,0x86,0xE1,0x01,0xAF,
+  0xC0,0x81,0xDF,0x01,0x96,0xC7,0xAF,0xE1,0x86,0xE1,0x01,0xAA,0xBC,0x81,0xDF,0x01,
+  0x98,0xC9,0xAF,0xE1,0x86,0xE1,0x05,0xA9,0xBC,0xDF,0xDF,0xDC,0xA4,0x89,0xE1,0x0A,
+  0xC9,0xC7,0xAA,0xA9,0xA8,0xA7,0xA8,0xA8,0xAA,0xAF,0xC7,0x9A,0xE1,0x86,0xE1,0x09,
+  0xA9,0xBC,0xDF,0xDF,0xBF,0xA6,0xE1,0xE1,0xAF,0xA8,0x81,0xA6,0x06,0xA8,0xAA,0xA8,
+  0x74,0x98,0x96,0x94,0x83,0xBC,0x04,0x93,0x95,0x97,0xC2,0xA8,0x98,0xE1,0x86,0xE1,
+  0x09,0xA9,0xBC,0xDF,0xDF,0xBF,0xAB,0xA9,0x99,0x95,0xBC,0x81,0xBF,0x03,0xBC,0x8F,
+  0xBC,0xBF,0x88,0xDF,0x04,0xE0,0xDF,0x03,0x09,0x30,0x96,0xE1,0x86,0xE1,0x07,0xAF,
+  0x94,0xDF,0xDF,0x6A,0x4B,0xBC,0xDC,0x89,0xDF,0x00,0xE0,0x84,0xDF,0x02,0xE0,0xBF,
+  0x0C,0x81,0x00,0x02,0x04,0x24,0xC6,0x93,0xE1,0x86,0xE1,0x05,0xC7,0x95,0xE0,0xBF,
+  0x68,0xDC,0x8A,0xDF,0x08,0x93,0x94,0xBF,0xBF,0xDC,0xDC,0xDF,0xBF,0x23,0x85,0x00,
+  0x00,0x27,0x93,0xE1,0x86,0xE1,0x03,0xC7,0x97,0xDF,0xDC,0x8C,0xDF,0x0F,0x8E,0x4E,
+  0xAD,0xA6,0xA4,0xA2,0xA2,0x2F,0x0E,0x12,0x1E,0x24,0x27,0x30,0x4E,0xA9,0x94,0xE1,
+  0x87,0xE1,0x01,0x6C,0x68,0x8A,0xDF,0x80,0xE0,0x80,0xDF,0x00,0xC1,0x82,0xE1,0x00,
+  0xC7,0x9D,0xE1,0x87,0xE1,0x02,0x77,0x8E,0xE0,0x88,0xDF,0x06,0xE0,0x3D,0x8E,0xE0,
+  0xDF,0x97,0xC7,0xA1,0xE1,0x87,0xE1,0x04,0xA5,0xDC,0xDF,0xDF,0xE0,0x85,0xDF,0x07,
+  0xE0,0x35,0x28,0x05,0x35,0xE0,0x95,0xC7,0x83,0xE1,0x80,0xC7,0x9A,0xE1,0x87,0xE1,
+  0x05,0xA3,0xDC,0xE0,0xDC,0x8E,0xE0,0x84,0xDF,0x07,0xE0,0x11,0x1A,0x02,0x07,0xE0,
+  0xBC,0xAA,0x81,0xE1,0x04,0xC7,0x76,0x4A,0x46,0xA9,0x99,0xE1,0x87,0xE1,0x06,0xA3,
+  0xDF,0x68,0x18,0x27,0x68,0xE0,0x83,0xDF,0x10,0xE0,0x44,0x00,0x00,0x35,0xE0,0xE0,
+  0xB0,0xE1,0xC7,0x76,0x71,0xBF,0xDF,0xDF,0x45,0xC7,0x90,0xE1,0x04,0xC9,0xC7,0xAA,
+  0xA6,0x9C,0x81,0xE1,0x87,0xE1,0x09,0xA5,0xE0,0x11,0x0A,0x29,0x11,0xE0,0xDF,0xDC,
+  0x93,0x81,0xDF,0x09,0xE0,0x93,0x68,0xE0,0xE0,0xB4,0x39,0x7C,0x98,0xBC,0x81,0xDF,
+  0x02,0xE0,0x68,0x7B,0x8D,0xE1,0x07,0xC7,0xA9,0x9C,0x99,0x96,0x93,0xBC,0x6A,0x81,
+  0xE1,0x87,0xE1,0x09,0xA6,0xE0,0x2C,0x00,0x00,0x26,0xE0,0xDF,0xBF,0xBF,0x81,0xE0,
+  0x00,0xDF,0x81,0xE0,0x04,0xA0,0x7D,0xB1,0x3E,0xE0,0x82,0xDF,0x01,0xBF,0x77,0x8B,
+  0xE1,0x0A,0xAF,0xA8,0x73,0x96,0x93,0xBF,0xDF,0xDF,0xE0,0xBF,0xA8,0x81,0xE1,0x87,
+  0xE1,0x15,0xAC,0xDF,0xDF,0x22,0x22,0xDF,0xDF,0xE0,0xE0,0x44,0x2B,0x33,0x2C,0x44,
+  0xE0,0xDF,0xE0,0x83,0xCA,0xCA,0xB3,0xE0,0x82,0xDF,0x01,0x96,0xC9,0x88,0xE1,0x05,
+  0xC7,0xA8,0x73,0x95,0xBC,0xDC,0x84,0xDF,0x01,0x95,0xC7,0x81,0xE1,0x87,0xE1,0x01,
+  0xA8,0x70,0x81,0xE0,0x03,0xDF,0xBF,0x36,0x1D,0x82,0x00,0x0D,0x26,0xE0,0xDF,0xE0,
+  0x80,0xCA,0xB1,0x85,0xE0,0xDF,0xDF,0xE0,0xBC,0x9E,0x87,0xE1,0x04,0xAB,0x75,0x71,
+  0x93,0xDC,0x86,0xDF,0x01,0xDC,0x9A,0x82,0xE1,0x82,0xE1,0x1A,0xAA,0xA9,0xC7,0xAE,
+  0xC6,0x5A,0x50,0x93,0xE0,0xDF,0xDF,0xE0,0x25,0x00,0x0B,0x1B,0x20,0x0B,0x2A,0xE0,
+  0xDF,0xE0,0x83,0xCA,0xB1,0x93,0xE0,0x81,0xDF,0x01,0x63,0xC7,0x84,0xE1,0x04,0xC9,
+  0xA9,0x73,0x94,0xBF,0x89,0xDF,0x01,0xBC,0xA8,0x82,0xE1,0x81,0xE1,0x1F,0xA7,0x4A,
+  0x93,0x95,0x93,0xC5,0x56,0xCA,0x7E,0xC8,0xDF,0xDF,0xE0,0xE0,0x16,0x13,0x50,0x7F,
+  0x37,0x54,0xE0,0xDF,0xDF,0xC5,0x51,0x52,0xE0,0xDF,0xDF,0xE0,0x88,0x6F,0x84,0xE1,
+  0x03,0xA9,0x72,0x93,0xDC,0x8B,0xDF,0x01,0x95,0xAF,0x82,0xE1,0x80,0xE1,0x02,0xC9,
+  0x4A,0xDC,0x81,0xDF,0x1A,0xE0,0xBF,0xB1,0xCA,0x8E,0xE0,0xDF,0xDF,0xE0,0x8E,0x31,
+  0xCE,0xCF,0xCD,0x88,0xE0,0xDF,0xDC,0xE0,0x7A,0xA0,0xDF,0xDF,0xE0,0xD3,0x42,0xC9,
+  0x82,0xE1,0x04,0xC6,0x72,0x93,0xDF,0xE0,0x8B,0xDF,0x01,0xDC,0x99,0x83,0xE1,0x80,
+  0xE1,0x02,0xC7,0x69,0xE0,0x82,0xDF,0x04,0xE0,0x82,0x4F,0xBC,0xE0,0x81,0xDF,0x0A,
+  0xE0,0x86,0xCC,0xCE,0xB2,0x8E,0xE0,0xDF,0xE0,0xBC,0x68,0x81,0xDF,0x02,0xDC,0x58,
+  0xAA,0x83,0xE1,0x05,0x6D,0x88,0xDD,0xD8,0xDD,0xDC,0x8A,0xDF,0x01,0xBC,0xA7,0x83,
+  0xE1,0x81,0xE1,0x03,0x73,0x8E,0xDF,0xE0,0x81,0xDF,0x03,0xE0,0x3A,0x8E,0xE0,0x81,
+  0xDF,0x09,0xE0,0xC8,0x55,0xCB,0x81,0xC5,0xDF,0xDF,0xBF,0x68,0x81,0xDF,0x02,0xDC,
+  0x84,0x77,0x84,0xE1,0x01,0x91,0x86,0x82,0xB7,0x05,0xBB,0xBA,0xBE,0xD8,0xDC,0xDC,
+  0x84,0xDF,0x01,0x93,0xAB,0x83,0xE1,0x82,0xE1,0x03,0x4C,0x63,0xD7,0xE0,0x81,0xDF,
+  0x0F,0xE0,0x70,0x68,0xDC,0xE0,0xDF,0xDC,0xE0,0xC5,0x55,0xB9,0xE0,0xDF,0xDF,0xBF,
+  0xDC,0x81,0xDF,0x01,0x57,0x48,0x85,0xE1,0x02,0x91,0xB5,0xBB,0x86,0xB7,0x08,0xBB,
+  0xD5,0xD8,0xD7,0xDC,0xDF,0xDF,0x97,0xC9,0x83,0xE1,0x83,0xE1,0x04,0xAA,0x41,0xB4,
+  0xDF,0xE0,0x81,0xDF,0x0B,0x93,0x68,0x93,0xBF,0xDF,0xDF,0xE0,0xE0,0xDF,0xD9,0xBA,
+  0xDC,0x82,0xDF,0x02,0x8A,0x3D,0xA2,0x84,0xE1,0x07,0xC9,0x6B,0xB5,0xB7,0xB7,0xBB,
+  0xBB,0xBA,0x81,0xB5,0x80,0x86,0x06,0x5D,0x5E,0x5F,0x5F,0x8C,0x63,0xA6,0x84,0xE1,
+  0x84,0xE1,0x03,0xC7,0x47,0x5C,0xD3,0x81,0xDF,0x0A,0xE0,0xDF,0x93,0xA0,0xDD,0xBB,
+  0xB7,0xB7,0x87,0x87,0xD8,0x82,0xDF,0x04,0xDC,0xBD,0xDF,0xBF,0xA9,0x83,0xE1,0x12,
+  0xC9,0x66,0xB5,0xBB,0xB6,0x86,0x5D,0x5E,0x65,0x66,0x6C,0x9C,0x9D,0xA8,0xA9,0xC6,
+  0xC6,0xC7,0xC7,0x85,0xE1,0x86,0xE1,0x04,0x78,0x41,0x5C,0xB9,0xDC,0x82,0xDF,0x05,
+  0xDC,0xD8,0xBE,0xBA,0xBE,0xDC,0x84,0xDF,0x04,0xE0,0xDF,0xDC,0x98,0xC9,0x82,0xE1,
+  0x09,0xC9,0x65,0xB5,0xBA,0x64,0x76,0xA8,0xAE,0xC7,0xC9,0x8E,0xE1,0x87,0xE1,0x05,
+  0xC9,0x77,0x67,0x5E,0x89,0xD8,0x89,0xDF,0x07,0xBF,0x8E,0x70,0x93,0xDF,0xE0,0xBC,
+  0xAA,0x82,0xE1,0x04,0xC7,0x64,0xB6,0xB4,0x6C,0x93,0xE1,0x89,0xE1,0x04,0xC9,0xAE,
+  0x4D,0x5D,0xDC,0x86,0xDF,0x80,0xBF,0x07,0x68,0xBF,0xBF,0x93,0x68,0xDF,0xDC,0x9B,
+  0x82,0xE1,0x04,0xC9,0x64,0xD5,0x86,0x9C,0x93,0xE1,0x8B,0xE1,0x01,0xC9,0xA1,0x85,
+  0xDF,0x14,0xE0,0x68,0x2E,0x44,0xDF,0xE0,0xDF,0xE0,0xDC,0xDC,0xDF,0x95,0xC9,0xC6,
+  0x6C,0x9D,0x6D,0x8B,0xD5,0x86,0x9E,0x93,0xE1,0x8B,0xE1,0x01,0xC7,0x95,0x85,0xDF,
+  0x04,0xE0,0x68,0x35,0x8E,0x93,0x81,0xDF,0x81,0xE0,0x09,0xBC,0xC7,0xC3,0x85,0xB5,
+  0x85,0xB5,0xD2,0x86,0xA8,0x93,0xE1,0x8B,0xE1,0x01,0xAE,0xBC,0x87,0xDF,0x12,0x44,
+  0x93,0xA0,0x93,0xDF,0xDF,0xD8,0xD8,0xDC,0xBF,0xE1,0x79,0x32,0xDA,0x6B,0x6B,0x8D,
+  0x40,0xC6,0x93,0xE1,0x8B,0xE1,0x01,0xAE,0xBC,0x86,0xDF,0x12,0xE0,0x44,0x3F,0xDD,
+  0xDF,0xDC,0xBB,0x8C,0xB8,0xB7,0xD8,0x34,0x1C,0x0F,0x21,0xAF,0xE1,0xC9,0xC7,0x94,
+  0xE1,0x8B,0xE1,0x01,0xC6,0xBD,0x87,0xDF,0x04,0x93,0x3E,0x87,0xD9,0xDD,0x81,0xB7,
+  0x06,0xBB,0xDB,0x13,0x06,0x0F,0x0B,0xA9,0x97,0xE1,0x8B,0xE1,0x01,0xC7,0x95,0x87,
+  0xDF,0x0E,0xBF,0x61,0x59,0xB7,0xBB,0x62,0xB7,0xB7,0xD6,0x8B,0x13,0x14,0x0F,0x06,
+  0xA9,0x97,0xE1,0x8B,0xE1,0x01,0xC7,0x95,0x88,0xDF,0x0D,0x8F,0x5E,0x3F,0xBB,0x5E,
+  0x5D,0xBB,0xDE,0x21,0x15,0xE1,0x78,0x2D,0xC4,0x97,0xE1,0x8B,0xE1,0x01,0xAF,0x94,
+  0x87,0xDF,0x0A,0xE0,0xBC,0x5E,0x8B,0x5D,0x3B,0x5E,0xD5,0x5D,0x10,0x49,0x9B,0xE1,
+  0x8B,0xE1,0x01,0xA8,0xBC,0x88,0xDF,0x08,0xD9,0x8B,0xBB,0xB7,0x5C,0x85,0x5E,0x77,
+  0xC9,0x9C,0xE1,0x8B,0xE1,0x01,0xA7,0xBF,0x87,0xDF,0x07,0xBA,0xB8,0xD6,0xB5,0x86,
+  0x8C,0x6C,0xAF,0x9E,0xE1,0x8B,0xE1,0x01,0xA8,0xBF,0x85,0xDF,0x07,0xD8,0xB7,0xB8,
+  0xBA,0x86,0x65,0x9E,0xC7,0xA0,0xE1,0x8B,0xE1,0x02,0xAB,0x93,0xE0,0x82,0xDF,0x07,
+  0xD8,0xBB,0xB8,0xB7,0xB5,0x5C,0x6E,0xC9,0xA2,0xE1,0x8C,0xE1,0x0B,0x6B,0xD7,0xDF,
+  0xDC,0xD8,0xBB,0xB8,0xB7,0xBB,0xB4,0x5D,0x78,0xA4,0xE1,0x8C,0xE1,0x0A,0xAA,0x3C,
+  0xD4,0xD6,0xB7,0xB7,0xBB,0xD4,0x85,0x5F,0xAA,0xA5,0xE1,0x8D,0xE1,0x08,0xA9,0x40,
+  0x5D,0xBB,0xB6,0x86,0x5E,0x6D,0xC9,0xA6,0xE1,0x8E,0xE1,0x05,0x60,0x38,0x55,0x40,
+  0x9E,0xAF,0xA8,0xE1,0x8D,0xE1,0x04,0xC9,0x90,0xD0,0x80,0x92,0xAA,0xE1,0x8D,0xE1,
+  0x04,0xC9,0x96,0xD1,0x53,0x9F,0xAA,0xE1,0x8D,0xE1,0x04,0xC7,0x71,0xB3,0x55,0xC7,
+  0xAA,0xE1,0x8D,0xE1,0x03,0xC9,0x6A,0x5B,0x43,0xAB,0xE1,0x8E,0xE1,0x02,0x46,0x35,
+  0xC7,0xAB,0xE1,0x8E,0xE1,0x01,0xA8,0xA7,0xAC,0xE1,0xBE,0xE1,0xBE,0xE1,
+};
+
+// 64x64, 185-color palette: 2122 bytes
+const uint8_t PROGMEM Pikachu2_64x64[] = {
+  0x40,0x40,0xB8,0x00,0x00,0x00,0x02,0x00,0x04,0x00,0x80,0x00,0x82,0x00,0x00,0x01,
+  0x02,0x01,0x80,0x01,0x82,0x01,0x84,0x01,0x00,0x02,0x02,0x02,0x04,0x02,0x82,0x02,
+  0x84,0x02,0x02,0x03,0x04,0x03,0x82,0x03,0x84,0x03,0x86,0x03,0x04,0x04,0x06,0x04,
+  0x84,0x04,0x86,0x04,0x06,0x05,0x00,0x10,0x04,0x10,0x80,0x10,0x00,0x11,0x02,0x11,
+  0x80,0x11,0x82,0x11,0x02,0x12,0x82,0x12,0x86,0x13,0x06,0x14,0x00,0x20,0x02,0x20,
+  0x04,0x20,0x80,0x20,0x84,0x20,0x00,0x21,0x0A,0x21,0x80,0x21,0x00,0x22,0x04,0x22,
+  0x80,0x22,0x82,0x22,0x04,0x23,0x00,0x30,0x04,0x30,0x80,0x30,0x82,0x30,0x00,0x31,
+  0x02,0x31,0x80,0x31,0x84,0x31,0x00,0x32,0x80,0x32,0x86,0x32,0x02,0x33,0x02,0x40,
+  0x06,0x40,0x82,0x40,0x86,0x40,0x00,0x41,0x02,0x41,0x80,0x41,0x82,0x41,0x88,0x41,
+  0x00,0x42,0x80,0x42,0x00,0x43,0x02,0x50,0x82,0x50,0x86,0x50,0x02,0x51,0x04,0x51,
+  0x80,0x51,0x86,0x51,0x00,0x52,0x80,0x52,0x84,0x52,0x88,0x52,0x00,0x53,0x00,0x61,
+  0x02,0x61,0x04,0x61,0x80,0x61,0x82,0x61,0x84,0x61,0x00,0x62,0x02,0x62,0x04,0x62,
+  0x80,0x62,0x00,0x63,0x80,0x63,0x00,0x64,0x06,0x71,0x84,0x71,0x04,0x72,0x82,0x72,
+  0x84,0x72,0x00,0x73,0x80,0x73,0x8C,0x73,0x00,0x74,0x84,0x81,0x86,0x81,0x04,0x82,
+  0x06,0x82,0x84,0x82,0x86,0x82,0x00,0x83,0x0A,0x83,0x80,0x83,0x8C,0x83,0x00,0x84,
+  0x10,0x84,0x80,0x84,0x96,0x84,0x00,0x85,0x84,0x92,0x86,0x92,0x04,0x93,0x06,0x93,
+  0x08,0x93,0x80,0x93,0x00,0x94,0x80,0x94,0x00,0x95,0x8C,0xA2,0x06,0xA3,0x00,0xA4,
+  0x02,0xA4,0x80,0xA4,0x00,0xA5,0x80,0xB4,0x82,0xB4,0x00,0xB5,0x02,0xB5,0x80,0xB5,
+  0x10,0xC3,0x00,0xC5,0x80,0xC5,0x82,0xC5,0x00,0xC6,0x92,0xD3,0x94,0xD3,0x96,0xD3,
+  0x10,0xD4,0x8E,0xD4,0x80,0xD5,0x00,0xD6,0x80,0xD6,0x98,0xD6,0x00,0xD7,0x12,0xE4,
+  0x14,0xE4,0x8E,0xE4,0x92,0xE4,0x94,0xE4,0x10,0xE5,0x88,0xE5,0x00,0xE6,0x80,0xE6,
+  0x00,0xE7,0x14,0xF4,0x92,0xF4,0x0C,0xF5,0x0E,0xF5,0x10,0xF5,0x96,0xF5,0x08,0xF6,
+  0x80,0xF6,0x84,0xF6,0x86,0xF6,0x94,0xF6,0x00,0xF7,0x02,0xF7,0x08,0xF7,0x80,0xF7,
+  0x82,0xF7,0x86,0xF7,0x9E,0xF7,0xBE,0x23,0xBE,0x12,0x00,0x23,0xBC,0x12,0x00,0x23,
+  0x00,0x23,0xBC,0x12,0x00,0x23,0x00,0x23,0xBC,0x12,0x00,0x23,0x00,0x23,0xBC,0x12,
+  0x00,0x23,0x00,0x23,0xBC,0x12,0x00,0x23,0x00,0x23,0xA9,0x12,0x81,0x16,0x00,0x14,
+  0x8D,0x12,0x00,0x23,0x00,0x23,0xA5,0x12,0x82,0x14,0x81,0x08,0x01,0x0D,0x14,0x8C,
+  0x12,0x00,0x23,0x00,0x23,0xA4,0x12,0x09,0x17,0x12,0x0D,0x1F,0x1F,0x24,0x5A,0x49,
+  0x05,0x16,0x8C,0x12,0x00,0x23,0x00,0x23,0xA0,0x12,0x82,0x14,0x09,0x0B,0x1D,0x4C,
+  0x6B,0x6B,0x6F,0x84,0x6B,0x05,0x14,0x8C,0x12,0x00,0x23,0x00,0x23,0x9E,0x12,0x80,
+  0x14,0x0D,0x12,0x10,0x09,0x1F,0x5E,0x3F,0x7D,0x66,0x64,0x6F,0x7A,0x44,0x0D,0x14,
+  0x8C,0x12,0x00,0x23,0x00,0x23,0x9D,0x12,0x0F,0x14,0x12,0x04,0x00,0x2B,0x43,0x89,
+  0xB5,0x51,0x26,0x7D,0x6F,0x7B,0x31,0x0B,0x17,0x8D,0x12,0x00,0x23,0x00,0x23,0x94,
+  0x12,0x81,0x14,0x82,0x12,0x06,0x14,0x17,0x0E,0x00,0x67,0x68,0xAE,0x81,0xB5,0x07,
+  0x8D,0x42,0x6E,0x7B,0x31,0x03,0x12,0x14,0x8D,0x12,0x00,0x23,0x00,0x23,0x92,0x12,
+  0x0C,0x14,0x16,0x10,0x0C,0x06,0x1E,0x2E,0x2C,0x2E,0x03,0x04,0x5F,0x90,0x85,0xB5,
+  0x05,0x46,0x4D,0x3F,0x03,0x14,0x14,0x8E,0x12,0x00,0x23,0x00,0x23,0x8D,0x12,0x80,
+  0x14,0x80,0x12,0x06,0x14,0x12,0x08,0x2C,0x5F,0x5E,0x98,0x81,0xB2,0x01,0x85,0x5B,
+  0x87,0xB5,0x04,0x81,0x00,0x00,0x14,0x14,0x8F,0x12,0x00,0x23,0x00,0x23,0x8C,0x12,
+  0x08,0x14,0x10,0x10,0x16,0x14,0x10,0x21,0x80,0xB2,0x8F,0xB5,0x03,0x71,0x00,0x12,
+  0x14,0x90,0x12,0x00,0x23,0x00,0x23,0x8C,0x12,0x06,0x14,0x2B,0x39,0x0C,0x04,0x00,
+  0x92,0x90,0xB5,0x03,0x5B,0x00,0x14,0x14,0x91,0x12,0x00,0x23,0x00,0x23,0x8D,0x12,
+  0x04,0x3C,0x7F,0x68,0x68,0x90,0x90,0xB5,0x03,0x50,0x00,0x14,0x14,0x92,0x12,0x00,
+  0x23,0x00,0x23,0x8C,0x12,0x03,0x16,0x0E,0x04,0xB2,0x90,0xB5,0x04,0x87,0x2B,0x04,
+  0x12,0x16,0x8E,0x12,0x80,0x14,0x81,0x12,0x00,0x23,0x00,0x23,0x8A,0x12,0x80,0x14,
+  0x02,0x0E,0x00,0x80,0x91,0xB5,0x03,0x8B,0x04,0x15,0x14,0x8E,0x12,0x02,0x14,0x12,
+  0x0D,0x81,0x12,0x00,0x23,0x00,0x23,0x89,0x12,0x04,0x16,0x10,0x0C,0x50,0x50,0x93,
+  0xB5,0x02,0x67,0x01,0x16,0x8D,0x12,0x07,0x14,0x17,0x08,0x00,0x16,0x12,0x12,0x23,
+  0x00,0x23,0x87,0x12,0x06,0x16,0x14,0x09,0x1D,0x85,0x73,0x29,0x93,0xB5,0x03,0xA5,
+  0x37,0x10,0x14,0x8B,0x12,0x08,0x14,0x16,0x06,0x71,0x60,0x10,0x14,0x12,0x23,0x00,
+  0x23,0x84,0x12,0x80,0x14,0x07,0x15,0x0C,0x06,0x68,0xA4,0x9A,0x51,0x92,0x94,0xB5,
+  0x02,0x8F,0x04,0x17,0x8A,0x12,0x09,0x14,0x17,0x06,0x19,0xB2,0xA4,0x04,0x17,0x12,
+  0x23,0x00,0x23,0x83,0x12,0x80,0x14,0x07,0x10,0x2F,0x67,0x8F,0xB5,0xB5,0x68,0x5F,
+  0x8C,0xB5,0x03,0x75,0x46,0x35,0x81,0x83,0xB5,0x03,0xB2,0x46,0x0C,0x16,0x88,0x12,
+  0x0A,0x14,0x16,0x06,0x24,0xA5,0xB5,0x85,0x04,0x18,0x12,0x23,0x00,0x23,0x82,0x12,
+  0x80,0x16,0x02,0x03,0x00,0xAE,0x82,0xB5,0x01,0x81,0x51,0x8B,0xB5,0x05,0x8D,0x00,
+  0x00,0x1A,0x02,0x87,0x83,0xB5,0x02,0x90,0x06,0x14,0x87,0x12,0x0B,0x14,0x16,0x06,
+  0x19,0xA5,0xB5,0xB5,0x99,0x39,0x10,0x14,0x23,0x09,0x23,0x12,0x12,0x14,0x16,0x0D,
+  0x05,0x4C,0x27,0xB2,0x82,0xB5,0x01,0x37,0x67,0x8B,0xB5,0x05,0x88,0x00,0x34,0x9B,
+  0x78,0x1B,0x84,0xB5,0x02,0x54,0x0E,0x14,0x86,0x12,0x03,0x14,0x06,0x33,0xA5,0x82,
+  0xB5,0x03,0x7F,0x06,0x16,0x23,0x08,0x23,0x12,0x14,0x18,0x0B,0x00,0x63,0x7B,0x36,
+  0x82,0xB5,0x01,0xA5,0x37,0x8C,0xB5,0x06,0x8B,0x00,0x27,0x69,0x74,0x00,0x73,0x83,
+  0xB5,0x02,0x90,0x06,0x14,0x85,0x12,0x03,0x17,0x0C,0x31,0xB2,0x83,0xB5,0x03,0x73,
+  0x06,0x14,0x23,0x0E,0x23,0x14,0x10,0x0B,0x3F,0x64,0x7D,0x70,0x5D,0x60,0x92,0xB5,
+  0xB5,0x73,0x37,0x8C,0xB5,0x06,0x88,0x00,0x27,0x00,0x27,0x00,0x5F,0x83,0xB5,0x02,
+  0xA4,0x05,0x14,0x84,0x12,0x80,0x14,0x01,0x00,0x85,0x84,0xB5,0x03,0x68,0x08,0x14,
+  0x23,0x13,0x23,0x14,0x03,0x31,0x6D,0x63,0x56,0x59,0x63,0x19,0x00,0x48,0x47,0x04,
+  0x29,0xA6,0xB5,0xB5,0xA5,0x99,0x87,0xB5,0x0E,0xA6,0x39,0x00,0x6F,0x57,0x1B,0x9C,
+  0xB5,0xAF,0xB3,0xB5,0xB5,0x98,0x06,0x14,0x83,0x12,0x80,0x14,0x02,0x00,0x5B,0xA6,
+  0x84,0xB5,0x03,0x68,0x08,0x14,0x23,0x14,0x23,0x14,0x0D,0x08,0x0B,0x08,0x08,0x07,
+  0x08,0x08,0x0B,0x10,0x10,0x14,0x03,0x67,0xB5,0xB5,0x67,0x00,0x37,0x87,0xB5,0x0D,
+  0x8D,0x00,0x5A,0x01,0x77,0xB6,0x97,0x93,0x96,0xAF,0xB5,0x98,0x04,0x17,0x82,0x12,
+  0x80,0x14,0x01,0x00,0x4E,0x86,0xB5,0x03,0x68,0x08,0x14,0x23,0x01,0x23,0x12,0x87,
+  0x14,0x0A,0x12,0x14,0x16,0x09,0x67,0xB5,0x8D,0x29,0x45,0x2A,0x46,0x87,0xB5,0x13,
+  0x90,0x75,0x82,0xB6,0x9F,0x9D,0xA2,0x9E,0x97,0xB5,0xB2,0x51,0x0C,0x16,0x12,0x12,
+  0x14,0x14,0x00,0x50,0x87,0xB5,0x03,0x68,0x08,0x14,0x23,0x00,0x23,0x8A,0x12,0x08,
+  0x16,0x04,0x7F,0xB5,0x68,0x00,0x72,0xB8,0x53,0x81,0xB5,0x01,0x8D,0x92,0x85,0xB5,
+  0x10,0xB0,0x95,0xAB,0xAB,0xA8,0xA3,0xB5,0xB5,0x98,0x1F,0x17,0x12,0x14,0x14,0x00,
+  0x5C,0xB6,0x87,0xB5,0x03,0x68,0x08,0x14,0x23,0x00,0x23,0x8A,0x12,0x11,0x14,0x10,
+  0x46,0xA5,0x92,0x29,0x28,0x76,0x38,0x75,0xB5,0xB5,0x87,0x99,0xB5,0xB5,0x99,0x87,
+  0x81,0xB5,0x04,0xB6,0xAA,0xA7,0xA1,0xA8,0x82,0xB5,0x06,0x50,0x04,0x16,0x14,0x00,
+  0x43,0xB6,0x88,0xB5,0x03,0x68,0x08,0x14,0x23,0x00,0x23,0x8B,0x12,0x08,0x17,0x06,
+  0x80,0xB5,0x75,0x00,0x55,0x00,0x47,0x81,0xB5,0x04,0x99,0x9A,0x90,0x1B,0x8D,0x83,
+  0xB5,0x02,0xB0,0xAF,0xAF,0x82,0xB5,0x04,0x90,0x29,0x15,0x08,0x58,0x8A,0xB5,0x03,
+  0x68,0x08,0x14,0x23,0x00,0x23,0x8C,0x12,0x0E,0x13,0x2C,0xB5,0xB5,0x5F,0x4A,0x67,
+  0xB5,0xA6,0x8D,0x92,0x46,0x5F,0x46,0x5F,0x8C,0xB5,0x02,0x8B,0x01,0x2C,0x8B,0xB5,
+  0x03,0x68,0x08,0x14,0x23,0x00,0x23,0x8D,0x12,0x0C,0x2D,0xA9,0xAD,0xB3,0x75,0xB5,
+  0xB5,0xA5,0x80,0x29,0x92,0x9A,0x92,0x8D,0xB5,0x02,0xA6,0x37,0x00,0x8B,0xB5,0x03,
+  0x7F,0x06,0x16,0x23,0x00,0x23,0x8C,0x12,0x05,0x11,0x2D,0x8E,0xA0,0x9D,0xB4,0x82,
+  0xB5,0x00,0x9A,0x91,0xB5,0x02,0x6A,0x00,0x9A,0x89,0xB5,0x04,0x8F,0x51,0x0E,0x14,
+  0x23,0x00,0x23,0x8C,0x12,0x05,0x14,0x0A,0x4F,0xB1,0x94,0xA3,0x96,0xB5,0x02,0x65,
+  0x04,0x46,0x87,0xB5,0x06,0x99,0x67,0x06,0x0E,0x16,0x12,0x23,0x00,0x23,0x8C,0x12,
+  0x05,0x14,0x0F,0x1B,0x83,0xAC,0xB7,0x8C,0xB5,0x01,0x5F,0x87,0x84,0xB5,0x06,0xB2,
+  0x6F,0x6C,0x22,0x0D,0x80,0xA6,0x83,0xB5,0x08,0xB2,0x8B,0x1C,0x04,0x17,0x14,0x12,
+  0x12,0x23,0x00,0x23,0x8D,0x12,0x06,0x15,0x0D,0x06,0x7E,0x80,0x80,0x98,0x89,0xB5,
+  0x02,0x5F,0x00,0x90,0x83,0xB5,0x10,0xA6,0x64,0x3E,0x62,0x30,0x16,0x06,0x27,0x92,
+  0xB5,0x99,0x80,0x80,0x47,0x08,0x10,0x14,0x82,0x12,0x00,0x23,0x00,0x23,0x8E,0x12,
+  0x80,0x14,0x06,0x07,0x08,0x06,0x1B,0x51,0x46,0x8D,0x85,0xB5,0x02,0x75,0x00,0x9A,
+  0x83,0xB5,0x10,0xA6,0x6F,0x7C,0x91,0x91,0x29,0x10,0x18,0x01,0x50,0xB5,0x80,0x01,
+  0x08,0x0E,0x17,0x14,0x83,0x12,0x00,0x23,0x00,0x23,0x90,0x12,0x06,0x14,0x16,0x14,
+  0x12,0x01,0x41,0xA6,0x84,0xB5,0x02,0xA6,0x00,0x51,0x84,0xB5,0x01,0xB2,0xA5,0x81,
+  0xB5,0x09,0x68,0x04,0x14,0x39,0x87,0xB5,0xB5,0x61,0x10,0x14,0x85,0x12,0x00,0x23,
+  0x00,0x23,0x90,0x12,0x05,0x14,0x12,0x14,0x15,0x20,0xB2,0x85,0xB5,0x01,0x68,0x00,
+  0x8A,0xB5,0x02,0x89,0x04,0x0B,0x81,0xB5,0x03,0xA5,0x35,0x10,0x14,0x85,0x12,0x00,
+  0x23,0x00,0x23,0x8F,0x12,0x09,0x14,0x0D,0x1E,0x06,0x10,0x21,0xAE,0xB5,0xB5,0x92,
+  0x81,0xB5,0x02,0xA6,0x37,0x68,0x83,0xB5,0x00,0x92,0x83,0xB5,0x09,0x8C,0x57,0x3B,
+  0x07,0x98,0xB5,0x99,0x1B,0x06,0x14,0x86,0x12,0x00,0x23,0x00,0x23,0x8E,0x12,0x80,
+  0x14,0x08,0x00,0x85,0x85,0x00,0x05,0xB5,0xB5,0x75,0x75,0x82,0xB5,0x01,0x51,0x46,
+  0x81,0xB5,0x02,0x9A,0x51,0x75,0x82,0xB5,0x09,0x8A,0x4B,0x6C,0x52,0x05,0x29,0x8B,
+  0x21,0x10,0x14,0x87,0x12,0x00,0x23,0x00,0x23,0x8F,0x12,0x08,0x16,0x09,0x80,0xB5,
+  0x5E,0x00,0x3A,0x37,0x37,0x83,0xB5,0x06,0xA6,0x51,0x75,0x75,0x60,0x37,0x46,0x81,
+  0xB5,0x0B,0xB2,0x86,0x40,0x64,0x7D,0x42,0x03,0x5D,0x3D,0x06,0x14,0x14,0x87,0x12,
+  0x00,0x23,0x00,0x23,0x8F,0x12,0x08,0x14,0x08,0x67,0xB5,0xB5,0x79,0x20,0x1B,0x8D,
+  0x84,0xB5,0x04,0x88,0x51,0x88,0x9A,0x9A,0x82,0xB5,0x0B,0x99,0x64,0x86,0xB5,0xB5,
+  0x75,0x25,0x84,0x6D,0x19,0x12,0x14,0x87,0x12,0x00,0x23,0x00,0x23,0x8F,0x12,0x02,
+  0x14,0x08,0x68,0x89,0xB5,0x04,0x73,0x1B,0x68,0x5F,0x9A,0x88,0xB5,0x05,0x88,0x32,
+  0x7B,0x19,0x07,0x14,0x88,0x12,0x00,0x23,0x00,0x23,0x8F,0x12,0x02,0x16,0x04,0x7F,
+  0x88,0xB5,0x06,0x99,0x37,0x90,0xB5,0x92,0x51,0x92,0x86,0xB5,0x06,0x99,0x27,0x1D,
+  0x1D,0x07,0x16,0x14,0x88,0x12,0x00,0x23,0x00,0x23,0x8F,0x12,0x03,0x14,0x0E,0x47,
+  0xB2,0x87,0xB5,0x07,0x88,0x00,0xA5,0xB5,0xB5,0x92,0x46,0x68,0x84,0xB5,0x06,0xA5,
+  0x19,0x06,0x14,0x12,0x14,0x14,0x89,0x12,0x00,0x23,0x00,0x23,0x90,0x12,0x02,0x17,
+  0x04,0x4E,0x88,0xB5,0x01,0x46,0x5F,0x81,0xB5,0x02,0x9A,0x51,0x81,0x82,0xB5,0x05,
+  0x92,0x19,0x08,0x17,0x14,0x14,0x8B,0x12,0x00,0x23,0x00,0x23,0x92,0x12,0x01,0x06,
+  0xA4,0x88,0xB5,0x01,0x68,0x81,0x82,0xB5,0x00,0x9A,0x81,0xB5,0x03,0x99,0x00,0x08,
+  0x17,0x8E,0x12,0x00,0x23,0x00,0x23,0x91,0x12,0x04,0x14,0x12,0x2C,0x68,0x87,0x87,
+  0xB5,0x01,0x5F,0x8D,0x83,0xB5,0x04,0x87,0x68,0x2B,0x0C,0x16,0x8F,0x12,0x00,0x23,
+  0x00,0x23,0x92,0x12,0x07,0x16,0x10,0x09,0x08,0x47,0x48,0x46,0x80,0x82,0x98,0x0B,
+  0xA4,0x67,0x35,0x99,0x98,0x98,0x8B,0x48,0x03,0x08,0x12,0x17,0x90,0x12,0x00,0x23,
+  0x00,0x23,0x93,0x12,0x05,0x14,0x16,0x14,0x0E,0x10,0x09,0x85,0x06,0x00,0x08,0x81,
+  0x06,0x04,0x08,0x10,0x12,0x14,0x14,0x91,0x12,0x00,0x23,0x00,0x23,0x96,0x12,0x01,
+  0x14,0x12,0x8D,0x14,0x93,0x12,0x00,0x23,0x00,0x23,0xBC,0x12,0x00,0x23,0x00,0x23,
+  0xBC,0x12,0x00,0x23,0x00,0x23,0xBC,0x12,0x00,0x23,0x00,0x23,0xBC,0x12,0x00,0x23,
+  0x00,0x23,0xBC,0x12,0x00,0x23,0xBE,0x12,0xBE,0x23,
+};
+
+// 64x64, 451 plain colors: 7176 bytes
+const uint8_t PROGMEM Doraemon_64x64[] = {
+  0x40,0x40,0x00,0x01,0x05,0x90,0xB4,0x12,0xD5,0x92,0xD5,0x92,0xE5,0x14,0xE6,0x14,
+  0xF6,0x81,0x14,0xE6,0x00,0x94,0xE5,0x8C,0x92,0xD5,0x03,0x12,0xD5,0x92,0xD5,0x92,
+  0xD5,0x12,0xD5,0x89,0x92,0xD5,0x81,0x92,0xE5,0x04,0x94,0xE5,0x12,0xE6,0x92,0xE5,
+  0x92,0xD5,0x12,0xD5,0x8F,0x92,0xD5,0x0C,0x02,0x00,0x84,0x10,0x04,0x21,0x86,0x31,
+  0x08,0x52,0x8A,0x62,0x8C,0x83,0x0E,0x94,0x90,0xB4,0x12,0xC5,0x92,0xD5,0x92,0xE5,
+  0x94,0xE5,0x83,0x14,0xE6,0x00,0x94,0xE5,0x8A,0x92,0xD5,0x80,0x12,0xD5,0x0D,0x92,
+  0xD5,0x14,0xE6,0x14,0xE6,0x92,0xE5,0x92,0xD5,0x92,0xD5,0x10,0xC5,0x8C,0x83,0x0C,
+  0x73,0x8E,0x83,0x8C,0x83,0x90,0xA4,0x92,0xE5,0x92,0xE5,0x8F,0x92,0xD5,0x1B,0x0C,
+  0x83,0x8A,0x62,0x08,0x52,0x86,0x31,0x04,0x21,0x84,0x10,0x82,0x00,0x02,0x00,0x02,
+  0x00,0x82,0x00,0x82,0x10,0x04,0x21,0x86,0x31,0x08,0x52,0x0A,0x73,0x8C,0x83,0x0E,
+  0xA4,0x90,0xB4,0x10,0xC5,0x92,0xD5,0x92,0xE5,0x14,0xE6,0x14,0xE6,0x14,0xF6,0x14,
+  0xE6,0x14,0xE6,0x94,0xE5,0x92,0xE5,0x81,0x92,0xD5,0x08,0x12,0xE6,0x14,0xF6,0x92,
+  0xD5,0x8E,0x93,0x0E,0x94,0x92,0xD5,0x90,0xA4,0x0A,0x52,0x0A,0x42,0x81,0x88,0x31,
+  0x06,0x88,0x21,0x88,0x31,0x8C,0x73,0x12,0xC5,0x92,0xE5,0x92,0xD5,0x12,0xD5,0x8C,
+  0x92,0xD5,0x27,0x14,0xF6,0x16,0xF6,0x14,0xF6,0x14,0xF6,0x92,0xE5,0x92,0xD5,0x12,
+  0xC5,0x0E,0xA4,0x8C,0x83,0x0C,0x73,0x88,0x62,0x88,0x41,0x86,0x31,0x04,0x21,0x84,
+  0x10,0x02,0x00,0x02,0x00,0x82,0x00,0x82,0x00,0x84,0x10,0x86,0x31,0x86,0x41,0x8A,
+  0x62,0x0C,0x73,0x8C,0x93,0x8E,0xA4,0x10,0xC5,0x12,0xC5,0x90,0xD5,0x92,0xD5,0x12,
+  0xD5,0x0E,0x94,0x8E,0xA4,0x8E,0x83,0x88,0x21,0x08,0x32,0x8A,0x52,0x0A,0x42,0x88,
+  0x31,0x08,0x32,0x83,0x08,0x42,0x07,0x88,0x31,0x08,0x42,0x8A,0x62,0x92,0xD5,0x14,
+  0xF6,0x14,0xE6,0x92,0xD5,0x12,0xD5,0x89,0x92,0xD5,0x84,0x92,0xD5,0x14,0x92,0xE5,
+  0x14,0xE6,0x14,0xF6,0x14,0xF6,0x16,0xF6,0x14,0xF6,0x14,0xE6,0x92,0xD5,0x12,0xD5,
+  0x10,0xC5,0x0E,0xA4,0x8C,0x83,0x0A,0x63,0x08,0x52,0x86,0x41,0x06,0x31,0x04,0x21,
+  0x82,0x10,0x02,0x00,0x02,0x00,0x84,0x10,0x81,0x04,0x21,0x0C,0x84,0x10,0x02,0x00,
+  0x82,0x00,0x04,0x11,0x86,0x21,0x86,0x31,0x86,0x21,0x86,0x31,0x08,0x42,0x08,0x42,
+  0x86,0x41,0x86,0x41,0x06,0x42,0x81,0x0A,0x42,0x08,0x0A,0x32,0x88,0x31,0x0C,0x63,
+  0x8E,0x83,0x0A,0x63,0x0E,0xA4,0x94,0xF6,0x92,0xD5,0x12,0xD5,0x87,0x92,0xD5,0x8C,
+  0x92,0xD5,0x01,0x92,0xE5,0x94,0xE5,0x83,0x14,0xF6,0x0B,0x14,0xE6,0x92,0xD5,0x12,
+  0xC5,0x90,0xB4,0x0E,0xA4,0x0A,0x73,0x88,0x41,0x04,0x21,0x84,0x00,0x02,0x00,0x82,
+  0x00,0x02,0x00,0x84,0x00,0x00,0x10,0x82,0x10,0x8C,0x12,0x0E,0x23,0x0A,0x22,0x86,
+  0x21,0x04,0x31,0x84,0x31,0x86,0x41,0x06,0x42,0x86,0x31,0x86,0x31,0x04,0x21,0x0C,
+  0x63,0x10,0xB5,0x92,0xD5,0x14,0xE6,0x92,0xE5,0x86,0x92,0xD5,0x95,0x92,0xD5,0x14,
+  0x92,0xE5,0x96,0xF6,0x12,0xD5,0x0C,0x73,0x8A,0x52,0x8A,0x52,0x0A,0x42,0x08,0x42,
+  0x86,0x41,0x86,0x41,0x08,0x32,0x86,0x31,0x0C,0x12,0x14,0x03,0x12,0x03,0x0C,0x02,
+  0x8E,0x02,0x9C,0x04,0x14,0x03,0x8E,0x01,0x0A,0x01,0x83,0x04,0x00,0x0E,0x06,0x01,
+  0x0A,0x22,0x02,0x21,0x82,0x00,0x88,0x62,0x92,0xE5,0x92,0xD5,0x92,0xD5,0x14,0xF6,
+  0x14,0xF6,0x14,0xE6,0x14,0xE6,0x94,0xE5,0x94,0xE5,0x94,0xD5,0x94,0x92,0xD5,0x04,
+  0x12,0xD5,0x14,0xE6,0x8E,0xA4,0x0A,0x42,0x88,0x31,0x81,0x08,0x42,0x21,0x86,0x41,
+  0x0A,0x32,0x8A,0x32,0x8E,0x22,0x90,0x12,0x94,0x13,0x1C,0x05,0x9A,0x04,0x1A,0x05,
+  0x9A,0x04,0x16,0x04,0x8C,0x01,0x06,0x00,0x88,0x00,0x94,0x74,0x16,0x85,0x92,0x63,
+  0x92,0x53,0x92,0x53,0x90,0x22,0x8C,0x01,0x84,0x00,0x02,0x00,0x02,0x00,0x04,0x21,
+  0x84,0x10,0x04,0x31,0x0A,0x73,0x8C,0x83,0x0E,0xA4,0x90,0xB4,0x10,0xC5,0x92,0xD5,
+  0x92,0xE5,0x95,0x92,0xD5,0x17,0x92,0xE5,0x0C,0x73,0x86,0x21,0x08,0x42,0x08,0x42,
+  0x84,0x41,0x04,0x41,0x8C,0x22,0x18,0x04,0x96,0x03,0x8C,0x01,0x0C,0x01,0x8E,0x01,
+  0x0C,0x02,0x0E,0x02,0x0E,0x02,0x8C,0x01,0x90,0x02,0x8E,0x01,0x0C,0x22,0x14,0xA5,
+  0x9C,0xF7,0x9E,0xF7,0x9C,0xF7,0x81,0x9E,0xF7,0x06,0x0E,0x53,0x0C,0x01,0x16,0x04,
+  0x94,0x03,0x0E,0x02,0x00,0x10,0x00,0x00,0x82,0x02,0x00,0x02,0x82,0x00,0x84,0x10,
+  0x84,0x31,0x01,0x14,0xE6,0x92,0xE5,0x90,0x92,0xD5,0x2B,0x12,0xD5,0x92,0xD5,0x92,
+  0xE5,0x8C,0x73,0x08,0x32,0x08,0x42,0x86,0x41,0x86,0x31,0x0E,0x23,0x8E,0x22,0x18,
+  0x04,0x9A,0x04,0x90,0x02,0x8C,0x01,0x88,0x00,0x8A,0x00,0x88,0x00,0x88,0x00,0x06,
+  0x00,0x88,0x00,0x88,0x00,0x06,0x00,0x0E,0x53,0x9E,0xF7,0x9A,0xE6,0x18,0xD6,0x1A,
+  0xE7,0x1C,0xE7,0x96,0xB5,0x9A,0xD6,0x18,0xC6,0x94,0x94,0x94,0x13,0x18,0x04,0x18,
+  0x14,0x92,0x33,0x8C,0x32,0x08,0x83,0x10,0xC5,0x8E,0xA4,0x8C,0x83,0x0A,0x73,0x88,
+  0x52,0x08,0x42,0x03,0x10,0xC5,0x92,0xD5,0x92,0xE5,0x14,0xE6,0x82,0x14,0xF6,0x01,
+  0x14,0xE6,0x92,0xE5,0x89,0x92,0xD5,0x2A,0x14,0xF6,0x8C,0x83,0x88,0x21,0x08,0x32,
+  0x84,0x41,0x0A,0x32,0x16,0x14,0x9A,0x04,0x9A,0x04,0x98,0x04,0x12,0x13,0x0A,0x01,
+  0x8A,0x21,0x16,0x95,0x94,0x84,0x8E,0x42,0x0E,0x43,0x8E,0x42,0x0C,0x22,0x88,0x00,
+  0x00,0x00,0x0E,0x63,0x1C,0xF7,0x9A,0xD6,0x9A,0xD6,0x9A,0xE6,0x18,0xC6,0x96,0xB5,
+  0x9A,0xD6,0x9E,0xF7,0x9E,0xF7,0x1A,0xB6,0x96,0x13,0x98,0x03,0x9E,0x05,0x16,0x04,
+  0x0E,0x94,0x12,0xF6,0x96,0xF6,0x96,0xF6,0x14,0xF6,0x94,0xF6,0x14,0xF6,0x0C,0x00,
+  0x00,0x82,0x00,0x04,0x21,0x86,0x41,0x88,0x52,0x0A,0x73,0x8C,0x83,0x8C,0x93,0x8E,
+  0xB4,0x12,0xC5,0x92,0xD5,0x94,0xE5,0x14,0xE6,0x81,0x14,0xF6,0x80,0x14,0xE6,0x80,
+  0x92,0xD5,0x28,0x12,0xE6,0x90,0xB4,0x08,0x42,0x88,0x21,0x86,0x41,0x8C,0x32,0x94,
+  0x03,0x96,0x03,0x1C,0x05,0x94,0x03,0x16,0x04,0x12,0x03,0x06,0x00,0x08,0x01,0x9C,
+  0xF7,0x18,0xD6,0x1C,0xF7,0x9E,0xF7,0x1C,0xF7,0x9A,0xE6,0x94,0xB5,0x92,0x94,0x1A,
+  0xC6,0x18,0xC6,0x9A,0xD6,0x1A,0xE7,0x16,0xB5,0x9A,0xD6,0x98,0xD6,0x98,0xD6,0x94,
+  0x94,0x14,0xA5,0x9E,0xF7,0x1A,0x96,0x96,0x13,0x14,0x03,0x9C,0x04,0x92,0x03,0x0E,
+  0x94,0x10,0xD5,0x10,0xC5,0x81,0x92,0xD5,0x04,0x0A,0x63,0x08,0x52,0x86,0x31,0x82,
+  0x10,0x82,0x00,0x81,0x00,0x00,0x80,0x02,0x00,0x35,0x84,0x10,0x04,0x21,0x86,0x41,
+  0x88,0x62,0x0A,0x73,0x8C,0x93,0x0E,0xA4,0x90,0xB4,0x12,0xD5,0x92,0xE5,0x92,0xE5,
+  0x8A,0x52,0x88,0x31,0x08,0x42,0x04,0x41,0x0E,0x23,0x9A,0x04,0x94,0x03,0x18,0x04,
+  0x18,0x04,0x16,0x04,0x8C,0x01,0x8A,0x11,0x16,0x95,0x9A,0xE6,0x9A,0xD6,0x18,0xC6,
+  0x90,0x63,0x8C,0x42,0x92,0x84,0x1C,0xF7,0x9E,0xF7,0x9E,0xF7,0x96,0xB5,0x18,0xC6,
+  0x18,0xD6,0x9A,0xE6,0x1A,0xE7,0x12,0xA5,0x0E,0x53,0x0C,0x22,0x8C,0x42,0x18,0xC6,
+  0x9E,0xF7,0x8C,0x42,0x00,0x00,0x8E,0x01,0x92,0x02,0x0E,0x02,0x8A,0x21,0x8C,0x83,
+  0x14,0xE6,0x92,0xD5,0x92,0xD5,0x80,0x14,0xF6,0x0C,0x96,0xF6,0x8C,0x73,0x8A,0x42,
+  0x8A,0x52,0x08,0x42,0x86,0x21,0x08,0x52,0x0A,0x73,0x08,0x42,0x84,0x31,0x84,0x10,
+  0x82,0x00,0x02,0x00,0x81,0x00,0x00,0x2D,0x02,0x00,0x84,0x10,0x04,0x21,0x82,0x10,
+  0x82,0x10,0x02,0x21,0x10,0x13,0x18,0x14,0x18,0x04,0x9A,0x04,0x94,0x13,0x18,0x04,
+  0x18,0x04,0x86,0x00,0x0E,0x53,0x9E,0xF7,0x1A,0xE7,0x1C,0xF7,0x90,0x63,0x8A,0x21,
+  0x08,0x11,0x0A,0x32,0x18,0xB6,0x1A,0xE7,0x9A,0xE6,0x9A,0xD6,0x1A,0xE7,0x18,0xC6,
+  0x90,0x73,0x12,0x74,0x90,0x63,0x0A,0x22,0x88,0x21,0x82,0x00,0x08,0x52,0x98,0xD6,
+  0x12,0x84,0x14,0xB5,0x92,0x94,0x10,0x53,0x04,0x00,0x8A,0x00,0x8C,0x52,0x92,0xF5,
+  0x92,0xD5,0x92,0xD5,0x80,0x92,0xD5,0x3D,0x10,0xB5,0x8A,0x52,0x0A,0x42,0x8A,0x52,
+  0x8A,0x52,0x8A,0x42,0x8A,0x52,0x12,0xC5,0x96,0xF6,0x14,0xE6,0x92,0xE5,0x92,0xD5,
+  0x10,0xC5,0x0E,0xA4,0x8C,0x83,0x0A,0x73,0x88,0x52,0x86,0x41,0x02,0x00,0x02,0x00,
+  0x00,0x00,0x8A,0x01,0x1A,0x04,0x18,0x04,0x96,0x03,0x18,0x04,0x92,0x03,0x18,0x04,
+  0x96,0x03,0x88,0x00,0x12,0x74,0x1C,0xF7,0x1C,0xE7,0x18,0xC6,0x0A,0x32,0x82,0x10,
+  0x84,0x20,0x06,0x21,0x06,0x21,0x18,0xC6,0x9C,0xF7,0x14,0xA5,0x98,0xD6,0x18,0xC6,
+  0x88,0x21,0x84,0x10,0x06,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x88,0x52,0x98,0xD6,
+  0x9A,0xE6,0x9E,0xF7,0x1A,0xF7,0x9A,0xE6,0x0E,0x63,0x0C,0x32,0x90,0x22,0x94,0xE5,
+  0x12,0xF6,0x14,0xF6,0x09,0x92,0xD5,0x12,0xC5,0x8A,0x42,0x0A,0x42,0x8A,0x52,0x8A,
+  0x52,0x8A,0x42,0x8A,0x42,0x88,0x31,0x8A,0x52,0x82,0x92,0xD5,0x00,0x92,0xE5,0x81,
+  0x14,0xF6,0x2D,0x16,0xF7,0x92,0xD5,0x88,0x31,0x86,0x31,0x86,0x31,0x94,0x13,0x96,
+  0x03,0x94,0x03,0x9A,0x04,0x18,0x14,0x94,0x03,0x16,0x04,0x16,0x14,0x8E,0x01,0x0E,
+  0x63,0x9A,0xD6,0x1C,0xF7,0x14,0x95,0x06,0x11,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
+  0x00,0x8C,0x52,0x9A,0xD6,0x9A,0xD6,0x1C,0xE7,0x1A,0xE7,0x86,0x31,0x00,0x00,0x00,
+  0x10,0x00,0x10,0x00,0x00,0x88,0x52,0x18,0xC6,0x96,0xC5,0x1C,0xF7,0x98,0xD6,0x9A,
+  0xE6,0x9C,0xF7,0x92,0x94,0x8C,0x52,0x8E,0x22,0x18,0x55,0x94,0xB5,0x0E,0xB4,0x04,
+  0x14,0xE6,0x90,0xA4,0x08,0x32,0x8A,0x42,0x8A,0x52,0x81,0x8A,0x42,0x01,0x08,0x32,
+  0x8A,0x52,0x86,0x92,0xD5,0x2D,0x10,0xC5,0x0A,0x63,0x86,0x31,0x84,0x41,0x16,0x14,
+  0x1C,0x05,0x18,0x04,0x94,0x03,0x18,0x04,0x94,0x03,0x9A,0x04,0x96,0x03,0x16,0x04,
+  0x90,0x02,0x96,0xA5,0x1C,0xE7,0x16,0xC6,0x12,0x74,0x08,0x21,0x00,0x10,0x00,0x00,
+  0x86,0x21,0x86,0x31,0x00,0x00,0x92,0x94,0x1C,0xE7,0x18,0xC6,0x96,0xB5,0x86,0x21,
+  0x82,0x00,0x04,0x01,0x82,0x00,0x8C,0x63,0x1C,0xE7,0x18,0xC6,0x18,0xD6,0x9A,0xD6,
+  0x16,0xD6,0x16,0xD6,0x90,0x73,0x8A,0x21,0x0A,0x32,0x0E,0x63,0x14,0x54,0x84,0x00,
+  0x00,0x00,0x03,0x94,0xE5,0x90,0xB4,0x08,0x32,0x8A,0x32,0x82,0x8A,0x42,0x01,0x08,
+  0x32,0x8A,0x52,0x81,0x92,0xD5,0x80,0x12,0xD5,0x30,0x92,0xD5,0x12,0xD5,0x14,0xE6,
+  0x8C,0x83,0x04,0x11,0x88,0x41,0x0A,0x32,0x96,0x03,0x16,0x04,0x9A,0x04,0x18,0x04,
+  0x94,0x03,0x94,0x03,0x16,0x04,0x94,0x03,0x16,0x04,0x92,0x02,0x14,0x95,0x9C,0xF7,
+  0x9A,0xE6,0x98,0xB5,0x84,0x10,0x00,0x00,0x86,0x31,0x1C,0xE7,0x96,0xB5,0x00,0x00,
+  0x8A,0x52,0x9A,0xD6,0x1C,0xE7,0x90,0x53,0x06,0x11,0x06,0x71,0x86,0x70,0x06,0x41,
+  0x90,0x83,0x9A,0xD6,0x1A,0xE7,0x1C,0xF7,0x98,0xD6,0x14,0xB5,0x8C,0x52,0x88,0x21,
+  0x8E,0x42,0x90,0x63,0x0E,0x63,0x82,0x20,0x00,0x00,0x02,0x31,0x80,0x92,0xD5,0x09,
+  0x0C,0x73,0x88,0x51,0x0A,0x62,0x0A,0x52,0x8A,0x32,0x8A,0x32,0x08,0x22,0x8A,0x52,
+  0x92,0xD5,0x92,0xD5,0x81,0x12,0xD5,0x30,0x92,0xD5,0x12,0xD5,0x12,0xE6,0x0E,0x94,
+  0x04,0x21,0x0A,0x32,0x9A,0x04,0x16,0x04,0x12,0x13,0x94,0x03,0x94,0x03,0x94,0x13,
+  0x1C,0x05,0x18,0x04,0x96,0x13,0x98,0x14,0x8A,0x01,0x86,0x00,0x16,0xC6,0x9A,0xE6,
+  0x1C,0xE7,0x06,0x31,0x00,0x00,0x08,0x42,0x9E,0xF7,0x98,0xC5,0x00,0x00,0x10,0x84,
+  0x9E,0xF7,0x92,0x84,0x06,0x21,0x02,0x90,0x00,0xF0,0x00,0xD0,0x02,0xC0,0x00,0xB0,
+  0x10,0xA4,0x9E,0xF7,0x1A,0xF7,0x92,0x94,0x8E,0x42,0x8A,0x21,0x8C,0x42,0x90,0x63,
+  0x8E,0x73,0x00,0x10,0x00,0x10,0x10,0x84,0x10,0x84,0x16,0x14,0xE6,0x16,0xE7,0x10,
+  0xD4,0x02,0xD0,0x04,0xC0,0x84,0xB0,0x86,0xB0,0x86,0xB0,0x84,0x70,0x8C,0x63,0x14,
+  0xE6,0x92,0xE5,0x92,0xD5,0x92,0xE5,0x12,0xE6,0x92,0xE5,0x92,0xE5,0x94,0xF6,0x8E,
+  0x83,0x82,0x20,0x88,0x31,0x1A,0x04,0x9A,0x04,0x81,0x18,0x04,0x25,0x94,0x13,0x12,
+  0x03,0x94,0x03,0x96,0x03,0x90,0x02,0x04,0x00,0x0A,0x11,0x18,0xC6,0x96,0xC5,0x1C,
+  0xE7,0x92,0xA4,0x00,0x00,0x00,0x00,0x10,0x84,0x0C,0x63,0x00,0x00,0x8E,0x73,0x9A,
+  0xD6,0x0A,0x52,0x00,0x80,0x02,0xA0,0x0E,0x93,0x8C,0x92,0x02,0xB0,0x02,0xD0,0x88,
+  0xD1,0x94,0xC5,0x8E,0x63,0x88,0x21,0x0A,0x32,0x8C,0x42,0x0E,0x63,0x86,0x31,0x00,
+  0x00,0x00,0x00,0x0C,0x63,0x14,0x95,0x8C,0x32,0x25,0x90,0xA4,0x12,0xC5,0x0C,0xD3,
+  0x02,0xC0,0x04,0xD0,0x02,0xC0,0x02,0xC0,0x04,0xD0,0x00,0xB0,0x88,0xB1,0x14,0xE6,
+  0x12,0xC5,0x10,0xC5,0x8C,0x93,0x8C,0x83,0x0C,0x73,0x8A,0x62,0x10,0xC5,0x0A,0x73,
+  0x04,0x11,0x10,0x13,0x1A,0x04,0x16,0x04,0x16,0x04,0x9A,0x04,0x94,0x13,0x90,0x02,
+  0x0A,0x01,0x08,0x01,0x06,0x00,0x04,0x00,0x0E,0x53,0x18,0xD6,0x18,0xD6,0x1C,0xE7,
+  0x1C,0xF7,0x9A,0xE6,0x10,0x84,0x81,0x00,0x00,0x16,0x86,0x31,0x96,0xB5,0x9A,0xC6,
+  0x88,0x61,0x00,0xD0,0x06,0xA1,0x1A,0xA7,0x9E,0xC7,0x0E,0xD3,0x00,0xB0,0x02,0xB0,
+  0x86,0x80,0x0A,0x22,0x0A,0x42,0x0E,0x53,0x08,0x32,0x84,0x10,0x00,0x10,0x82,0x10,
+  0x04,0x21,0x88,0x21,0x0A,0x22,0x08,0x21,0x3F,0x00,0x00,0x02,0x60,0x04,0xF0,0x04,
+  0xA0,0x04,0xB0,0x04,0xD0,0x02,0xA0,0x04,0xD0,0x04,0xF0,0x02,0xE0,0x0A,0x83,0x8A,
+  0x42,0x08,0x42,0x88,0x31,0x86,0x21,0x86,0x21,0x06,0x21,0x08,0x42,0x86,0x51,0x8E,
+  0x12,0x9C,0x04,0x98,0x14,0x96,0x13,0x94,0x13,0x96,0x13,0x18,0x04,0x90,0x02,0x08,
+  0x01,0x8C,0x11,0x8A,0x31,0x0E,0x63,0x18,0xC6,0x18,0xD6,0x16,0xC6,0x9E,0xF7,0x9A,
+  0xD6,0x1C,0xE7,0x9A,0xE6,0x8A,0x52,0x86,0x31,0x08,0x42,0x96,0xC5,0x9E,0xF7,0x98,
+  0xB6,0x86,0x60,0x00,0xC0,0x06,0xC1,0x1A,0xD7,0x9E,0xE7,0x8E,0xE3,0x00,0x90,0x00,
+  0xB0,0x8C,0xB2,0x8C,0x22,0x8E,0x42,0x8A,0x52,0x82,0x10,0x00,0x00,0x04,0x21,0x88,
+  0x31,0x88,0x21,0x84,0x10,0x84,0x20,0x00,0x10,0x3F,0x0A,0x63,0x02,0x80,0x02,0xC0,
+  0x84,0xC0,0x84,0xA0,0x84,0xC0,0x04,0xB0,0x02,0xB0,0x04,0xF0,0x02,0xC0,0x00,0x00,
+  0x00,0x00,0x02,0x00,0x82,0x10,0x84,0x10,0x04,0x21,0x04,0x21,0x04,0x11,0x82,0x20,
+  0x10,0x13,0x18,0x04,0x12,0x13,0x18,0x04,0x18,0x04,0x94,0x03,0x1C,0x05,0x12,0x03,
+  0x04,0x00,0x0A,0x22,0x12,0x74,0x0E,0x53,0x0A,0x32,0x0A,0x42,0x8E,0x73,0x94,0xB5,
+  0x9A,0xE6,0x1A,0xE7,0x1C,0xF7,0x9E,0xF7,0x9A,0xE6,0x9A,0xD6,0x96,0xB5,0x96,0xC5,
+  0x98,0xB6,0x04,0x70,0x00,0xB0,0x02,0xB0,0x0A,0xC2,0x8E,0xA3,0x02,0xA0,0x02,0xA0,
+  0x00,0xC0,0x90,0xC3,0x92,0x74,0x84,0x10,0x00,0x10,0x00,0x10,0x84,0x10,0x06,0x21,
+  0x82,0x10,0x82,0x10,0x80,0x10,0x00,0x00,0x82,0x10,0x0B,0x96,0xF6,0x8A,0xD2,0x04,
+  0xB1,0x84,0xC0,0x06,0xD1,0x06,0xD1,0x04,0xF0,0x02,0x90,0x02,0x90,0x04,0xB0,0x84,
+  0x20,0x02,0x00,0x85,0x00,0x00,0x0A,0x8E,0x02,0x1C,0x05,0x18,0x04,0x96,0x03,0x94,
+  0x03,0x16,0x14,0x14,0x03,0x0E,0x02,0x86,0x00,0x8E,0x42,0x8C,0x42,0x81,0x0A,0x32,
+  0x16,0x88,0x21,0x0A,0x42,0x92,0x94,0x18,0xD6,0x9E,0xF7,0x9A,0xE6,0x96,0xB5,0x1A,
+  0xE7,0x9A,0xE6,0x1C,0xE7,0x1A,0xD7,0x0E,0x94,0x02,0xC0,0x02,0xE0,0x02,0xA0,0x00,
+  0xA0,0x04,0xD0,0x02,0xC0,0x02,0xC0,0x98,0xF6,0x98,0xB6,0x00,0x00,0x00,0x10,0x81,
+  0x82,0x10,0x80,0x00,0x10,0x02,0x82,0x10,0x84,0x20,0x84,0x20,0x3F,0x92,0xD5,0x92,
+  0xE5,0x86,0xD0,0x02,0xC0,0x04,0xC0,0x02,0xB0,0x02,0x40,0x00,0x10,0x00,0x30,0x02,
+  0x80,0x84,0x41,0x0A,0x32,0x86,0x31,0x8E,0x22,0x94,0x03,0x90,0x02,0x8E,0x02,0x0C,
+  0x02,0x06,0x01,0x12,0x03,0x9A,0x04,0x18,0x04,0x92,0x03,0x12,0x13,0x9A,0x04,0x8C,
+  0x01,0x04,0x00,0x0C,0x22,0x0E,0x53,0x0A,0x42,0x8A,0x31,0x8C,0x42,0x0C,0x32,0x8C,
+  0x42,0x88,0x21,0x06,0x11,0x0E,0x53,0x10,0x74,0x14,0xA5,0x14,0xA5,0x96,0xB5,0x12,
+  0xA5,0x18,0xD6,0x18,0xD6,0x9C,0xD7,0x10,0xC4,0x02,0xD0,0x02,0xC0,0x04,0xE0,0x04,
+  0xF0,0x84,0xE0,0x90,0xB3,0x9C,0xD7,0x1C,0xE7,0x06,0x21,0x00,0x00,0x00,0x10,0x00,
+  0x10,0x00,0x00,0x84,0x10,0x88,0x21,0x0A,0x42,0x8E,0x42,0x88,0x21,0x80,0x92,0xD5,
+  0x3D,0x04,0xD0,0x00,0xC0,0x02,0xB0,0x02,0xD0,0x02,0x80,0x80,0x00,0x00,0x10,0x06,
+  0x41,0x8C,0x22,0x94,0x13,0x16,0x04,0x16,0x04,0x9A,0x14,0x1C,0x05,0x1E,0x05,0x18,
+  0x14,0x94,0x13,0x96,0x03,0x96,0x03,0x12,0x13,0x94,0x13,0x94,0x03,0x94,0x03,0x90,
+  0x02,0x0E,0x63,0x12,0xA5,0x82,0x10,0x00,0x00,0x82,0x10,0x08,0x42,0x04,0x21,0x04,
+  0x21,0x06,0x21,0x04,0x21,0x84,0x10,0x02,0x00,0x84,0x10,0x88,0x21,0x0A,0x32,0x88,
+  0x31,0x0A,0x42,0x16,0xC6,0x1C,0xF7,0x1C,0xE7,0x14,0xD5,0x0C,0xA3,0x02,0x60,0x00,
+  0x70,0x0C,0x83,0x98,0xB6,0x98,0xD6,0x1C,0xF7,0x8A,0x52,0x00,0x00,0x00,0x00,0x86,
+  0x21,0x0A,0x42,0x0A,0x42,0x06,0x21,0x88,0x31,0x0A,0x42,0x06,0x21,0x80,0x92,0xD5,
+  0x1B,0x10,0xD5,0x0E,0xE4,0x0C,0xD3,0x08,0x91,0x86,0xB0,0x00,0x40,0x00,0x10,0x90,
+  0x02,0x9E,0x05,0x9A,0x04,0x18,0x04,0x94,0x03,0x90,0x12,0x18,0x04,0x16,0x04,0x12,
+  0x03,0x14,0x03,0x96,0x03,0x94,0x03,0x16,0x04,0x18,0x04,0x94,0x03,0x94,0x03,0x12,
+  0x23,0x9C,0xF7,0x96,0xC5,0x84,0x31,0x80,0x10,0x82,0x00,0x00,0x19,0x80,0x10,0x00,
+  0x10,0x00,0x10,0x04,0x31,0x82,0x20,0x00,0x00,0x82,0x10,0x06,0x21,0x90,0x73,0x1C,
+  0xF7,0x16,0xD6,0x1C,0xE7,0x1A,0xD7,0x1A,0xC7,0x0E,0x64,0x00,0x00,0x82,0x00,0x96,
+  0xB5,0x9A,0xD6,0x9A,0xE6,0x16,0xA5,0x84,0x10,0x00,0x00,0x06,0x31,0x04,0x21,0x02,
+  0x10,0x81,0x00,0x00,0x00,0x00,0x10,0x81,0x92,0xD5,0x1E,0x16,0xF7,0x14,0xC6,0x06,
+  0x12,0x8A,0x12,0x8E,0x22,0x86,0x11,0x10,0x03,0x16,0x04,0x96,0x03,0x9A,0x04,0x18,
+  0x04,0x12,0x03,0x16,0x04,0x18,0x04,0x16,0x04,0x94,0x03,0x18,0x04,0x94,0x13,0x9A,
+  0x04,0x9C,0x04,0x1C,0x05,0x8A,0x00,0x08,0x21,0x1C,0xE7,0x9A,0xD6,0x9A,0xD6,0x14,
+  0xA5,0x10,0x84,0x10,0x94,0x0E,0x84,0x8A,0x52,0x81,0x04,0x21,0x1A,0x86,0x31,0x04,
+  0x31,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x42,0x8A,0x62,0x9A,0xE6,0x1A,0xE7,0x96,
+  0xC5,0x9E,0xF7,0x14,0xA5,0x00,0x00,0x00,0x00,0x96,0xB5,0x96,0xC5,0x96,0xC5,0x9E,
+  0xF7,0x0C,0x73,0x82,0x10,0x00,0x10,0x8E,0x83,0x10,0x84,0x8A,0x62,0x08,0x42,0x8A,
+  0x52,0x0C,0x63,0x3F,0x92,0xD5,0x12,0xD5,0x92,0xD5,0x12,0xC5,0x0A,0x63,0x02,0x31,
+  0x0A,0x32,0x1C,0x05,0x9A,0x04,0x18,0x04,0x18,0x04,0x94,0x03,0x14,0x03,0x18,0x04,
+  0x9A,0x04,0x96,0x13,0x94,0x03,0x18,0x04,0x98,0x04,0x9A,0x04,0x18,0x04,0x94,0x03,
+  0x98,0x04,0x14,0x03,0x08,0x11,0x92,0x94,0x96,0xB5,0x12,0x84,0x1A,0xE7,0x96,0xB5,
+  0x0E,0x53,0x14,0x95,0x94,0x94,0x8E,0x63,0x88,0x31,0x0A,0x32,0x0C,0x42,0x06,0x21,
+  0x06,0x21,0x86,0x31,0x86,0x21,0x84,0x10,0x02,0x00,0x8A,0x62,0x1A,0xE7,0x96,0xC5,
+  0x9A,0xD6,0x9A,0xE6,0x9A,0xD6,0x8A,0x52,0x00,0x00,0x0A,0x42,0x96,0xC5,0x9A,0xD6,
+  0x9E,0xF7,0x9A,0xE6,0x10,0x84,0x12,0xA5,0x9A,0xE6,0x9C,0xF7,0x1C,0xF7,0x9C,0xF7,
+  0x98,0xD6,0x18,0xC6,0x3F,0x14,0xF6,0x14,0xE6,0x96,0xF6,0x0E,0x94,0x02,0x10,0x08,
+  0x32,0x18,0x14,0x18,0x04,0x96,0x03,0x9A,0x04,0x18,0x04,0x16,0x04,0x96,0x03,0x12,
+  0x03,0x96,0x03,0x16,0x04,0x94,0x13,0x18,0x04,0x16,0x04,0x94,0x03,0x96,0x03,0x94,
+  0x03,0x94,0x03,0x0E,0x02,0x12,0x64,0x9E,0xF7,0x94,0x94,0x8A,0x21,0x0E,0x53,0x0E,
+  0x53,0x8A,0x21,0x88,0x11,0x06,0x11,0x8A,0x21,0x88,0x21,0x06,0x21,0x86,0x21,0x88,
+  0x31,0x88,0x21,0x04,0x11,0x06,0x21,0x82,0x10,0x04,0x11,0x14,0xA5,0x9A,0xE6,0x18,
+  0xC6,0x16,0xC6,0x12,0xA5,0x9A,0xD6,0x8A,0x52,0x00,0x00,0x04,0x31,0x9A,0xD6,0x98,
+  0xD6,0x18,0xC6,0x92,0x94,0x96,0xC5,0x9E,0xF7,0x18,0xC6,0x9A,0xD6,0x9A,0xE6,0x18,
+  0xD6,0x14,0xA5,0x9A,0xE6,0x3F,0x0E,0x94,0x90,0xB4,0x10,0xB5,0x06,0x62,0x0A,0x12,
+  0x94,0x03,0x18,0x04,0x98,0x04,0x9A,0x04,0x96,0x03,0x14,0x03,0x98,0x04,0x9C,0x04,
+  0x18,0x04,0x8E,0x12,0x96,0x03,0x9A,0x04,0x18,0x04,0x94,0x03,0x18,0x04,0x9A,0x04,
+  0x18,0x04,0x1C,0x05,0x14,0x03,0x92,0x94,0x9E,0xF7,0x14,0xA5,0x8A,0x31,0x0C,0x22,
+  0x0A,0x22,0x8A,0x31,0x84,0x20,0x84,0x10,0x06,0x21,0x84,0x10,0x00,0x00,0x00,0x10,
+  0x04,0x31,0x84,0x20,0x00,0x10,0x00,0x10,0x82,0x10,0x04,0x21,0x8C,0x73,0x9A,0xE6,
+  0x1C,0xF7,0x18,0xC6,0x96,0xB5,0x18,0xD6,0x92,0xA4,0x82,0x10,0x02,0x10,0x0E,0x73,
+  0x9E,0xF7,0x96,0xB5,0x18,0xC6,0x9E,0xF7,0x96,0xC5,0x1A,0xE7,0x9A,0xE6,0x16,0xC6,
+  0x1A,0xE7,0x9A,0xE6,0x96,0xB5,0x82,0x00,0x00,0x3B,0x0C,0x12,0x9A,0x04,0x12,0x03,
+  0x16,0x04,0x18,0x04,0x18,0x04,0x96,0x03,0x18,0x04,0x16,0x04,0x18,0x04,0x96,0x13,
+  0x96,0x03,0x9A,0x04,0x12,0x13,0x94,0x03,0x12,0x03,0x16,0x14,0x10,0x22,0x0C,0x02,
+  0x08,0x01,0x92,0x84,0x1C,0xE7,0x96,0xB5,0x06,0x21,0x82,0x10,0x82,0x00,0x00,0x00,
+  0x00,0x00,0x82,0x10,0x08,0x42,0x04,0x31,0x82,0x20,0x82,0x20,0x86,0x21,0x86,0x31,
+  0x04,0x21,0x04,0x21,0x06,0x21,0x0C,0x53,0x1A,0xE7,0x9C,0xF7,0x9A,0xE6,0x18,0xC6,
+  0x9A,0xD6,0x9C,0xF7,0x9C,0xD6,0x06,0x21,0x00,0x00,0x8A,0x62,0x9A,0xD6,0x94,0xB5,
+  0x9A,0xD6,0x16,0xC6,0x18,0xC6,0x1C,0xF7,0x96,0xC5,0x16,0xC6,0x18,0xC6,0x18,0xD6,
+  0x14,0x95,0x3F,0x82,0x10,0x02,0x00,0x82,0x10,0x00,0x00,0x8C,0x01,0x1C,0x05,0x96,
+  0x03,0x12,0x03,0x12,0x03,0x9A,0x04,0x9C,0x04,0x12,0x03,0x94,0x03,0x18,0x04,0x9A,
+  0x04,0x9A,0x04,0x18,0x04,0x94,0x03,0x98,0x04,0x98,0x04,0x86,0x80,0x00,0xF0,0x02,
+  0xA0,0x00,0x80,0x14,0xB5,0x18,0xB6,0x14,0x95,0x06,0x21,0x00,0x00,0x08,0x52,0x0C,
+  0x73,0x86,0x31,0x12,0xA5,0x1A,0xE7,0x18,0xC6,0x90,0x94,0x06,0x21,0x88,0x31,0x0A,
+  0x22,0x88,0x21,0x06,0x21,0x84,0x10,0x00,0x00,0x10,0x84,0x98,0xC5,0x16,0xC6,0x18,
+  0xC6,0x14,0xB5,0x18,0xC6,0x1A,0xE7,0x8E,0x73,0x00,0x00,0x04,0x21,0x12,0xA5,0x18,
+  0xC6,0x96,0xB5,0x18,0xC6,0x18,0xC6,0x9A,0xD6,0x94,0xB5,0x96,0xC5,0x1C,0xE7,0x18,
+  0xD6,0x10,0x74,0x3F,0x10,0x84,0x16,0xA5,0x86,0x41,0x12,0x23,0x9A,0x04,0x18,0x04,
+  0x94,0x03,0x98,0x03,0x9A,0x04,0x98,0x04,0x18,0x04,0x96,0x13,0x18,0x14,0x16,0x04,
+  0x12,0x03,0x16,0x04,0x18,0x04,0x9A,0x04,0x94,0x03,0x14,0x03,0x88,0x90,0x00,0xD0,
+  0x02,0xF0,0x00,0xE0,0x96,0xC5,0x1C,0xE7,0x18,0xD6,0x82,0x20,0x00,0x00,0x8C,0x73,
+  0x1A,0xE7,0x1C,0xF7,0x9A,0xE6,0x8E,0x73,0x0E,0x53,0x8E,0x63,0x88,0x21,0x06,0x21,
+  0x84,0x20,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x10,0x92,0x94,0x1A,0xE7,0x96,0xB5,
+  0x9A,0xD6,0x1C,0xE7,0x14,0xA5,0x9A,0xE6,0x14,0xA5,0x00,0x00,0x00,0x00,0x0C,0x73,
+  0x1C,0xE7,0x16,0xC6,0x18,0xC6,0x9A,0xE6,0x96,0xB5,0x92,0x94,0x9A,0xE6,0x9A,0xD6,
+  0x10,0x74,0x84,0x10,0x3F,0x9E,0xF7,0x92,0xB4,0x8A,0x21,0x18,0x14,0x12,0x03,0x98,
+  0x04,0x9A,0x04,0x18,0x04,0x18,0x04,0x94,0x03,0x18,0x04,0x9A,0x04,0x18,0x04,0x94,
+  0x13,0x14,0x03,0x94,0x03,0x94,0x03,0x16,0x04,0x98,0x04,0x8A,0x11,0x02,0xA0,0x04,
+  0xD0,0x02,0xB0,0x00,0x70,0x96,0xA5,0x9E,0xF7,0x18,0xC6,0x8E,0x83,0x00,0x10,0x00,
+  0x00,0x12,0x94,0x18,0xC6,0x8A,0x42,0x88,0x21,0x08,0x11,0x08,0x11,0x06,0x21,0x82,
+  0x10,0x00,0x00,0x00,0x10,0x08,0x42,0x08,0x52,0x16,0xC6,0x9A,0xE6,0x9C,0xF7,0x9A,
+  0xE6,0x96,0xB5,0x18,0xD6,0x9A,0xD6,0x1C,0xF7,0x1C,0xE7,0x86,0x31,0x00,0x00,0x92,
+  0xA4,0x96,0xB5,0x14,0xA5,0x1C,0xE7,0x16,0xC6,0x96,0xB5,0x9E,0xF7,0x18,0xC6,0x8C,
+  0x42,0x84,0x10,0x00,0x00,0x1E,0x8E,0x73,0x8C,0x42,0x92,0x02,0x9A,0x04,0x14,0x03,
+  0x94,0x03,0x9A,0x04,0x96,0x03,0x16,0x04,0x18,0x04,0x96,0x13,0x18,0x04,0x14,0x03,
+  0x9A,0x04,0x9A,0x04,0x16,0x04,0x18,0x04,0x94,0x03,0x9A,0x04,0x14,0x23,0x02,0xC0,
+  0x02,0xB0,0x02,0xB0,0x86,0xA0,0x1C,0xC7,0x1A,0xE7,0x16,0xC6,0x9E,0xF7,0x10,0x94,
+  0x00,0x00,0x02,0x00,0x81,0x88,0x21,0x01,0x84,0x10,0x02,0x21,0x81,0x00,0x00,0x18,
+  0x10,0x84,0x9E,0xF7,0x9E,0xF7,0x9A,0xE6,0x12,0xA5,0x92,0x94,0x18,0xC6,0x9A,0xD6,
+  0x18,0xD6,0x18,0xC6,0x16,0xC6,0x1C,0xE7,0x92,0x94,0x00,0x00,0x0C,0x73,0x18,0xC6,
+  0x9A,0xD6,0x16,0xC6,0x14,0xA5,0x18,0xD6,0x9A,0xC6,0x96,0xA5,0x04,0x11,0x00,0x00,
+  0x00,0x00,0x3F,0x86,0x41,0x96,0x03,0x1A,0x04,0x96,0x03,0x1C,0x05,0x96,0x03,0x94,
+  0x03,0x12,0x03,0x9A,0x04,0x1A,0x04,0x18,0x04,0x96,0x03,0x18,0x04,0x9A,0x04,0x14,
+  0x13,0x96,0x03,0x9A,0x04,0x96,0x03,0x98,0x04,0x96,0x23,0x04,0xD0,0x02,0xB0,0x02,
+  0xC0,0x06,0xD1,0x1A,0xF6,0x1C,0xD7,0x9A,0xD6,0x9A,0xD6,0x18,0xC6,0x08,0x42,0x00,
+  0x00,0x82,0x10,0x06,0x11,0x82,0x10,0x00,0x10,0x00,0x00,0x0C,0x73,0x0C,0x63,0x10,
+  0x94,0x9E,0xF7,0x14,0xB5,0x9A,0xD6,0x18,0xC6,0x96,0xB5,0x96,0xB5,0x96,0xC5,0x96,
+  0xB5,0x98,0xD6,0x96,0xB5,0x9A,0xD6,0x9E,0xF7,0x90,0x73,0x00,0x00,0x00,0x00,0x94,
+  0xB5,0x9E,0xF7,0x14,0xB5,0x96,0xC5,0x12,0x84,0x06,0x11,0x88,0x21,0x00,0x00,0x00,
+  0x00,0x82,0x20,0x39,0x92,0x43,0x96,0x03,0x9A,0x04,0x14,0x13,0x9A,0x04,0x9A,0x04,
+  0x94,0x03,0x12,0x03,0x1A,0x04,0x18,0x04,0x98,0x04,0x9A,0x04,0x94,0x03,0x14,0x03,
+  0x96,0x13,0x18,0x04,0x9A,0x04,0x16,0x04,0x12,0x03,0x16,0x04,0x0E,0x62,0x00,0xB0,
+  0x04,0x80,0x00,0x90,0x06,0x91,0x9E,0xE7,0x9C,0xF7,0x16,0xC6,0x14,0xA5,0x90,0x73,
+  0x02,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x20,0x86,0x41,0x94,0xB5,0x9C,0xF7,
+  0x9C,0xF7,0x18,0xD6,0x96,0xB5,0x18,0xD6,0x96,0xB5,0x1C,0xE7,0x9E,0xF7,0x1A,0xE7,
+  0x96,0xC5,0x18,0xC6,0x96,0xB5,0x96,0xB5,0x9A,0xD6,0x8A,0x52,0x00,0x00,0x00,0x00,
+  0x16,0xC6,0x18,0xC6,0x92,0x94,0x8C,0x42,0x82,0x00,0x00,0x01,0x82,0x10,0x16,0xC6,
+  0x80,0x96,0x03,0x3D,0x1C,0x05,0x10,0x03,0x90,0x02,0x9A,0x04,0x1C,0x05,0x16,0x04,
+  0x12,0x03,0x16,0x04,0x16,0x14,0x9A,0x04,0x94,0x13,0x96,0x03,0x18,0x04,0x16,0x04,
+  0x18,0x04,0x94,0x03,0x96,0x03,0x1C,0x05,0x90,0x32,0x00,0xC0,0x04,0xC0,0x00,0xA0,
+  0x88,0x51,0x1C,0xD7,0x1C,0xF7,0x18,0xC6,0x1C,0xF7,0x10,0x74,0x02,0x00,0x00,0x00,
+  0x00,0x10,0x82,0x10,0x04,0x11,0x0A,0x42,0x88,0x21,0x12,0x84,0x98,0xD6,0x9A,0xE6,
+  0x9C,0xF7,0x9C,0xF7,0x1A,0xE7,0x1C,0xE7,0x18,0xC6,0x96,0xB5,0x9A,0xE6,0x94,0xB5,
+  0x18,0xC6,0x9E,0xF7,0x1A,0xE7,0x10,0x94,0x00,0x00,0x82,0x10,0x8E,0x73,0x8E,0x42,
+  0x0A,0x32,0x84,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x8A,0x52,0x94,0xB5,0x9E,0xF7,
+  0x3F,0x9A,0x04,0x96,0x03,0x18,0x04,0x9A,0x04,0x96,0x03,0x9C,0x04,0x94,0x03,0x18,
+  0x04,0x18,0x04,0x94,0x03,0x96,0x13,0x16,0x04,0x9C,0x04,0x18,0x14,0x94,0x03,0x96,
+  0x03,0x18,0x04,0x9A,0x04,0x18,0x04,0x9A,0x04,0x12,0x63,0x00,0xF0,0x02,0xC0,0x00,
+  0xC0,0x10,0xE3,0x18,0xB6,0x14,0xA5,0x9A,0xD6,0x1C,0xE7,0x10,0x84,0x00,0x00,0x04,
+  0x21,0x82,0x20,0x00,0x00,0x82,0x10,0x04,0x11,0x84,0x10,0x06,0x21,0x90,0x73,0x8E,
+  0x63,0x14,0xA5,0x92,0x94,0x94,0xA4,0x96,0xC5,0x94,0xB5,0x18,0xD6,0x18,0xD6,0x9A,
+  0xE6,0x1C,0xE7,0x94,0x94,0x96,0xB5,0x96,0xB5,0x06,0x31,0x04,0x31,0x08,0x32,0x02,
+  0x00,0x04,0x11,0x00,0x00,0x00,0x10,0x82,0x20,0x90,0x94,0x9A,0xE6,0x1C,0xE7,0x1A,
+  0xE7,0x26,0x16,0x04,0x9A,0x04,0x96,0x03,0x18,0x04,0x1E,0x05,0x96,0x13,0x16,0x04,
+  0x1A,0x04,0x18,0x04,0x18,0x04,0x9A,0x04,0x16,0x04,0x18,0x04,0x18,0x04,0x12,0x03,
+  0x14,0x03,0x16,0x04,0x18,0x04,0x94,0x03,0x14,0x03,0x98,0x14,0x0C,0x92,0x02,0xD0,
+  0x02,0xB0,0x82,0xC0,0x8C,0x92,0x18,0xB6,0x1C,0xE7,0x9A,0xE6,0x9A,0xD6,0x12,0xA5,
+  0x10,0x84,0x8E,0x73,0x10,0x84,0x08,0x52,0x00,0x00,0x00,0x10,0x00,0x00,0x02,0x00,
+  0x81,0x06,0x11,0x15,0x08,0x11,0x0A,0x32,0x14,0x95,0x8C,0x52,0x8C,0x42,0x18,0xC6,
+  0x16,0xA5,0x06,0x11,0x08,0x11,0x0E,0x53,0x86,0x31,0x82,0x10,0x82,0x10,0x00,0x00,
+  0x00,0x00,0x06,0x42,0x04,0x31,0x14,0xA5,0x9E,0xF7,0x9E,0xF7,0x1A,0xE7,0x9A,0xE6,
+  0x02,0x9A,0x04,0x96,0x03,0x16,0x04,0x81,0x18,0x04,0x25,0x94,0x03,0x9A,0x04,0x18,
+  0x04,0x94,0x03,0x9A,0x04,0x96,0x03,0x16,0x04,0x1A,0x04,0x9A,0x04,0x18,0x04,0x16,
+  0x04,0x18,0x04,0x18,0x04,0x94,0x13,0x9A,0x04,0x16,0x04,0x84,0xB0,0x02,0xB0,0x00,
+  0xA0,0x92,0xD4,0x9E,0xE7,0x96,0xC5,0x98,0xD6,0x1A,0xE7,0x14,0xA5,0x8C,0x42,0x0C,
+  0x32,0x0E,0x53,0x8C,0x42,0x04,0x21,0x04,0x21,0x08,0x42,0x84,0x41,0x00,0x00,0x00,
+  0x00,0x02,0x10,0x02,0x10,0x82,0x10,0x81,0x84,0x10,0x03,0x06,0x11,0x84,0x00,0x02,
+  0x00,0x00,0x10,0x81,0x00,0x00,0x09,0x04,0x31,0x0C,0x73,0x0C,0x73,0x1C,0xE7,0x18,
+  0xC6,0x1C,0xE7,0x9C,0xF7,0x1C,0xE7,0x9A,0xD6,0x9A,0xE6,0x28,0x18,0x04,0x1A,0x04,
+  0x94,0x03,0x16,0x04,0x18,0x04,0x9A,0x04,0x94,0x03,0x96,0x03,0x18,0x04,0x18,0x04,
+  0x9A,0x04,0x96,0x03,0x94,0x03,0x18,0x04,0x9A,0x04,0x16,0x04,0x18,0x04,0x18,0x04,
+  0x16,0x14,0x18,0x04,0x12,0x03,0x94,0x03,0x12,0x33,0x02,0xD0,0x00,0xE0,0x04,0xB1,
+  0x18,0xC6,0x9A,0xC6,0x18,0xC6,0x12,0x84,0x0A,0x32,0x88,0x21,0x84,0x00,0x84,0x00,
+  0x86,0x10,0x88,0x21,0x06,0x11,0x0E,0x53,0x14,0xA5,0x86,0x41,0x82,0x20,0x86,0x00,
+  0x00,0x05,0x00,0x10,0x00,0x00,0x86,0x31,0x14,0xA5,0x8E,0x73,0x90,0x83,0x81,0x1C,
+  0xE7,0x00,0x9A,0xE6,0x81,0x1C,0xE7,0x80,0x96,0xB5,0x3F,0x94,0x03,0x18,0x04,0x9A,
+  0x04,0x18,0x04,0x96,0x03,0x9A,0x04,0x9A,0x04,0x94,0x13,0x14,0x03,0x94,0x03,0x16,
+  0x04,0x18,0x04,0x9A,0x04,0x94,0x03,0x16,0x04,0x16,0x14,0x96,0x03,0x16,0x04,0x16,
+  0x04,0x9A,0x04,0x18,0x04,0x10,0x03,0x98,0x04,0x90,0x52,0x8E,0x82,0x88,0x70,0x08,
+  0xE2,0x1C,0xF7,0x0E,0x53,0x08,0x11,0x86,0x00,0x8E,0x63,0x14,0xA5,0x0C,0x53,0x8C,
+  0x52,0x0E,0x53,0x88,0x21,0x06,0x11,0x8C,0x42,0x92,0x94,0x96,0xB5,0x0C,0x73,0x0A,
+  0x63,0x8A,0x62,0x8C,0x73,0x8A,0x52,0x86,0x41,0x84,0x31,0x94,0xB5,0x92,0xA4,0x90,
+  0x94,0x9A,0xD6,0x9E,0xF7,0x1C,0xF7,0x14,0xA5,0x14,0xA5,0x16,0xC6,0x9C,0xE6,0x9A,
+  0xD6,0x1A,0xE7,0x9A,0xD6,0x96,0xB5,0x94,0xC5,0x9A,0xD6,0x3F,0x1A,0x35,0x96,0x03,
+  0x18,0x04,0x18,0x04,0x16,0x04,0x12,0x03,0x18,0x04,0x18,0x04,0x96,0x03,0x96,0x03,
+  0x12,0x13,0x12,0x03,0x9A,0x04,0x96,0x03,0x96,0x03,0x9A,0x04,0x96,0x03,0x12,0x03,
+  0x96,0x03,0x14,0x03,0x18,0x04,0x96,0x13,0x12,0x13,0x98,0x04,0x1E,0x05,0x94,0x03,
+  0x04,0x80,0x90,0xD3,0x90,0x63,0x08,0x11,0x8E,0x73,0x9A,0xD6,0x9C,0xF7,0x9E,0xF7,
+  0x9E,0xF7,0x9A,0xD6,0x18,0xC6,0x9A,0xD6,0x0C,0x53,0x88,0x21,0x9E,0xF7,0x9C,0xF7,
+  0x9A,0xE6,0x9A,0xE6,0x1C,0xF7,0x1A,0xE7,0x9E,0xF7,0x98,0xD6,0x9A,0xE6,0x18,0xC6,
+  0x18,0xC6,0x96,0xB5,0x18,0xC6,0x16,0xC6,0x14,0xA5,0x9A,0xD6,0x9A,0xD6,0x96,0xB5,
+  0x9A,0xD6,0x18,0xD6,0x14,0xB5,0x1C,0xF7,0x1E,0xC7,0x98,0xE6,0x3F,0x96,0x54,0x14,
+  0x03,0x96,0x03,0x9A,0x04,0x9A,0x04,0x96,0x03,0x94,0x03,0x18,0x04,0x9A,0x04,0x12,
+  0x03,0x18,0x04,0x9A,0x04,0x94,0x03,0x18,0x04,0x16,0x04,0x12,0x13,0x16,0x04,0x9A,
+  0x04,0x16,0x14,0x12,0x03,0x94,0x03,0x18,0x04,0x18,0x04,0x14,0x03,0x12,0x03,0x92,
+  0x02,0x90,0x02,0x90,0x12,0x8C,0x52,0x12,0x94,0x1A,0xE7,0x18,0xC6,0x16,0xC6,0x9A,
+  0xD6,0x9A,0xD6,0x9E,0xF7,0x18,0xC6,0x18,0xC6,0x96,0xB5,0x8C,0x52,0x0E,0x63,0x9E,
+  0xF7,0x9A,0xE6,0x9A,0xD6,0x96,0xC5,0x96,0xB5,0x1C,0xE7,0x96,0xB5,0x96,0xB5,0x9A,
+  0xD6,0x96,0xB5,0x14,0xB5,0x9A,0xD6,0x1C,0xE7,0x9A,0xE6,0x16,0xD6,0x9A,0xD6,0x96,
+  0xB5,0x98,0xE6,0x1A,0xF7,0x1A,0xF7,0x9C,0xA6,0x18,0x45,0x92,0xE5,0x0B,0x98,0x03,
+  0x18,0x04,0x94,0x03,0x94,0x03,0x18,0x04,0x9C,0x04,0x9A,0x04,0x12,0x13,0x16,0x04,
+  0x9C,0x04,0x18,0x04,0x9A,0x04,0x81,0x18,0x04,0x80,0x94,0x03,0x2E,0x16,0x14,0x9A,
+  0x04,0x18,0x04,0x92,0x03,0x18,0x04,0x9A,0x04,0x18,0x04,0x92,0x13,0x9A,0x04,0x98,
+  0x04,0x94,0x03,0x10,0x23,0x96,0xC5,0x9A,0xD6,0x92,0x84,0x18,0xD6,0x1C,0xE7,0x98,
+  0xC6,0x18,0xC6,0x14,0xA5,0x98,0xC5,0x1A,0xC6,0x96,0xB5,0x0E,0x63,0x92,0x94,0x12,
+  0xA5,0x18,0xC6,0x1A,0xE7,0x1C,0xE7,0x18,0xD6,0x96,0xC5,0x9A,0xD6,0x9A,0xE6,0x9E,
+  0xF7,0x1C,0xE7,0x18,0xE6,0x9E,0xF7,0x9A,0xC6,0x1A,0xB6,0x94,0xC5,0x98,0xE6,0x1E,
+  0x76,0x1C,0x76,0x9E,0x86,0x98,0x03,0x96,0x13,0x96,0xC5,0x01,0x1A,0x45,0x98,0x03,
+  0x81,0x18,0x04,0x0B,0x94,0x03,0x96,0x03,0x18,0x04,0x94,0x03,0x9A,0x04,0x18,0x04,
+  0x18,0x04,0x12,0x03,0x12,0x03,0x9A,0x04,0x1C,0x05,0x9A,0x04,0x82,0x18,0x04,0x2A,
+  0x1A,0x04,0x94,0x03,0x18,0x04,0x18,0x04,0x14,0x03,0x98,0x04,0x18,0x04,0x9A,0x65,
+  0x9C,0xF7,0x18,0xC6,0x9E,0xF7,0x9E,0xF7,0x9A,0xE6,0x18,0xC6,0x92,0x94,0x9A,0xD6,
+  0x1C,0xE7,0x18,0xD6,0x9E,0xF7,0x9A,0xD6,0x10,0x84,0x9A,0xE6,0x1C,0xE7,0x14,0xA5,
+  0x9A,0xD6,0x9A,0xD6,0x96,0xB5,0x18,0xC6,0x1C,0xD7,0x96,0xB5,0x16,0xE6,0x1A,0xC6,
+  0x98,0x64,0x98,0x24,0x18,0x04,0x18,0x45,0x1E,0x66,0x1A,0x04,0x96,0x03,0x18,0x04,
+  0x18,0x04,0x1C,0x04,0x16,0x44,0x3F,0x9A,0xF6,0x18,0x75,0x98,0x34,0x1A,0x04,0x1A,
+  0x04,0x96,0x03,0x14,0x03,0x16,0x04,0x9A,0x04,0x94,0x03,0x94,0x03,0x9A,0x04,0x94,
+  0x03,0x96,0x03,0x96,0x03,0x94,0x03,0x9A,0x04,0x9A,0x04,0x96,0x03,0x94,0x13,0x9A,
+  0x04,0x9A,0x04,0x18,0x04,0x12,0x03,0x96,0x03,0x9A,0x04,0x96,0x03,0x96,0x03,0x18,
+  0x55,0x9C,0xF7,0x18,0xD6,0x18,0xC6,0x1A,0xE7,0x96,0xB5,0x18,0xC6,0x1A,0xE7,0x98,
+  0xC6,0x1C,0xE7,0x96,0xC5,0x14,0xA5,0x9E,0xF7,0x9A,0xD6,0x14,0xA5,0x92,0x94,0x92,
+  0x94,0x18,0xD6,0x18,0xD6,0x9C,0xD6,0x1C,0xD7,0x98,0xF6,0x94,0xF5,0x16,0xB5,0x9A,
+  0x14,0x14,0x03,0x96,0x03,0x18,0x04,0x1A,0x04,0x16,0x03,0x90,0x02,0x16,0x14,0x94,
+  0x03,0x16,0x04,0x9A,0x04,0x08,0x01,0x3F,0x14,0xF6,0x14,0xF7,0x98,0xF6,0x1A,0x55,
+  0x1A,0x45,0x1E,0x15,0x18,0x04,0x14,0x03,0x18,0x04,0x96,0x03,0x18,0x04,0x1A,0x04,
+  0x1A,0x04,0x9C,0x04,0x96,0x03,0x94,0x03,0x16,0x04,0x1A,0x04,0x96,0x03,0x98,0x03,
+  0x14,0x03,0x94,0x13,0x9A,0x14,0x96,0x03,0x12,0x03,0x94,0x03,0x96,0x03,0x92,0x02,
+  0x16,0x65,0x1A,0xF7,0x1C,0xE7,0x9A,0xD6,0x96,0xB5,0x18,0xC6,0x1C,0xE7,0x14,0xA5,
+  0x18,0xC6,0x9A,0xD6,0x9A,0xD6,0x9E,0xF7,0x9E,0xF7,0x9C,0xD6,0x94,0x94,0x1C,0xE7,
+  0x9E,0xF7,0x1E,0xE7,0x9A,0xD6,0x96,0xE6,0x16,0xE5,0x08,0xB1,0x14,0x84,0x1A,0x25,
+  0x96,0x03,0x18,0x04,0x16,0x04,0x94,0x03,0x96,0x03,0x12,0x03,0x18,0x04,0x18,0x04,
+  0x96,0x13,0x1A,0x04,0x16,0x03,0x0E,0x84,0x3F,0x86,0x41,0x08,0x52,0x0A,0x73,0x0C,
+  0xA4,0x8E,0xB4,0x16,0x75,0x9A,0x04,0x9C,0x04,0x9E,0x05,0x1C,0x05,0x1A,0x04,0x98,
+  0x24,0x9A,0x75,0x9C,0x55,0x9A,0x34,0x18,0x04,0x98,0x03,0x1A,0x35,0x18,0x75,0x9A,
+  0x65,0x18,0x34,0x16,0x85,0x18,0xB6,0x9A,0x04,0x1A,0x04,0x8E,0x12,0x16,0x04,0x14,
+  0x03,0x92,0x33,0x9E,0xD7,0x9E,0xF7,0x9A,0xD6,0x18,0xC6,0x18,0xC6,0x96,0xB5,0x98,
+  0xB5,0x9A,0xD6,0x18,0xC6,0x96,0xB5,0x96,0xB5,0x14,0xA5,0x0E,0xD5,0x8C,0xC5,0x0E,
+  0xC5,0x0E,0xD5,0x12,0xC6,0x96,0xF7,0x84,0xD4,0x80,0xA1,0x8E,0x42,0x14,0x03,0x94,
+  0x03,0x98,0x14,0x12,0x03,0x12,0x13,0x18,0x04,0x16,0x04,0x98,0x04,0x94,0x03,0x14,
+  0x13,0x9C,0x04,0x98,0x24,0x96,0x64,0x18,0xC6,0x01,0x02,0x21,0x82,0x10,0x82,0x00,
+  0x00,0x80,0x84,0x00,0x0B,0x06,0x01,0x0E,0x02,0x92,0x02,0x8E,0x22,0x0C,0xB4,0x8E,
+  0xC4,0x12,0x64,0x1A,0x04,0x9C,0x35,0x1C,0xF7,0x9A,0xF7,0x9C,0xF7,0x81,0x9E,0xF7,
+  0x28,0x9E,0x96,0x18,0x04,0x18,0x04,0x9A,0x04,0x9A,0x04,0x96,0x03,0x92,0x43,0x96,
+  0xC5,0x18,0xD6,0x1C,0xE7,0x18,0xD6,0x96,0xB5,0x1C,0xE7,0x1C,0xE7,0x9A,0xE6,0x18,
+  0xC6,0x18,0xC6,0x1A,0xC6,0x0A,0xD6,0x00,0xC5,0x82,0xB4,0x00,0x52,0x80,0x31,0x02,
+  0x73,0x86,0xD5,0x86,0xF7,0x12,0x55,0x96,0x02,0x96,0x03,0x94,0x03,0x96,0x03,0x18,
+  0x04,0x12,0x13,0x96,0x13,0x94,0x03,0x92,0x02,0x96,0x03,0x1C,0x04,0x9A,0x34,0x94,
+  0xF6,0x14,0xF6,0x3F,0x14,0xE6,0x92,0xE5,0x10,0xC5,0x8E,0xB4,0x0C,0xA4,0x8A,0x93,
+  0x86,0x82,0x06,0x62,0x82,0x51,0x00,0x41,0x80,0x30,0x00,0x10,0x00,0x00,0x00,0x00,
+  0x02,0x00,0x06,0x01,0x84,0x10,0x84,0x41,0x88,0x52,0x8A,0x62,0x8E,0x83,0x90,0xA4,
+  0x12,0xB5,0x16,0xD6,0x98,0x54,0x1A,0x04,0x18,0x14,0x94,0x13,0x94,0x13,0x94,0x02,
+  0x12,0x64,0x1A,0xE7,0x96,0xB5,0x18,0xC6,0x9E,0xF7,0x96,0xB5,0x14,0xA5,0x18,0xC6,
+  0x9A,0xC6,0x16,0xA5,0x9A,0xF7,0x88,0xF6,0x04,0xC5,0x04,0x94,0x80,0x00,0x82,0x20,
+  0x04,0x31,0x06,0xD6,0x84,0xE6,0x12,0xE6,0x9A,0x85,0x18,0x04,0x96,0x03,0x94,0x02,
+  0x1A,0x04,0x98,0x03,0x98,0x03,0x18,0x04,0x18,0x04,0x98,0x03,0x98,0x24,0x94,0xC5,
+  0x14,0xE6,0x14,0xE6,0x80,0x14,0xE6,0x00,0x16,0xE6,0x83,0x96,0xF6,0x0A,0x14,0xF6,
+  0x14,0xE6,0x92,0xE5,0x10,0xC5,0x8E,0xB4,0x0C,0xA4,0x0A,0x93,0x86,0x82,0x04,0x62,
+  0x04,0x31,0x82,0x20,0x83,0x00,0x00,0x27,0x02,0x00,0x08,0x01,0x96,0x03,0x16,0x04,
+  0x16,0x14,0x9A,0x04,0x16,0x04,0x1A,0x96,0x18,0xD6,0x1C,0xE7,0x9C,0xF7,0x9C,0xF7,
+  0x9E,0xF7,0x1C,0xF7,0x1C,0xF7,0x9A,0xD6,0x16,0xB6,0x84,0xA4,0x04,0xE6,0x86,0xA4,
+  0x06,0x31,0x08,0x62,0x88,0x41,0x06,0xA4,0x8A,0xE6,0x12,0xF6,0x14,0xF6,0x16,0xC6,
+  0x94,0xB5,0x18,0x75,0x98,0x65,0x18,0x65,0x96,0x54,0x18,0x14,0x18,0x65,0x16,0xC6,
+  0x96,0xC5,0x12,0xF6,0x14,0xE6,0x14,0xE6,0x81,0x92,0xD5,0x00,0x94,0xD5,0x81,0x92,
+  0xD5,0x00,0x94,0xE5,0x81,0x14,0xE6,0x00,0x16,0xF6,0x83,0x96,0xF6,0x80,0x14,0xF6,
+  0x21,0x92,0xE5,0x10,0xC5,0x8E,0xB4,0x0C,0xA4,0x8A,0x83,0x86,0x72,0x84,0x71,0x8A,
+  0x52,0x14,0x03,0x1C,0x04,0x9A,0x04,0x94,0x03,0x16,0x14,0x98,0x34,0x14,0x44,0x18,
+  0x55,0x98,0x65,0x16,0x65,0x98,0x85,0x9A,0xC6,0x9E,0x96,0x98,0x03,0x86,0xC5,0x86,
+  0xF7,0x06,0xC5,0x86,0x62,0x86,0x41,0x88,0x62,0x06,0xD6,0x14,0xF7,0x98,0xF6,0x96,
+  0xF6,0x94,0xF6,0x14,0xF6,0x81,0x12,0xF6,0x07,0x14,0xF6,0x16,0xE6,0x14,0xE6,0x12,
+  0xF6,0x14,0xF6,0x94,0xD5,0x14,0xE6,0x14,0xE6,0x04,0x92,0xD5,0x94,0xD5,0x94,0xD5,
+  0x92,0xD5,0x92,0xD5,0x84,0x94,0xD5,0x03,0x94,0xE5,0x94,0xD5,0x94,0xE5,0x94,0xE5,
+  0x82,0x14,0xE6,0x00,0x16,0xF6,0x81,0x96,0xF6,0x1C,0x98,0xF6,0x96,0xF6,0x96,0xF6,
+  0x92,0xF5,0x96,0x95,0x16,0x65,0x16,0x03,0x96,0x03,0x9A,0x04,0x1A,0x04,0x92,0x02,
+  0x98,0x03,0x96,0x03,0x16,0x03,0x96,0x03,0x18,0x04,0x96,0x03,0x96,0x03,0x0E,0x23,
+  0x80,0x93,0x84,0xC5,0x80,0x31,0x00,0x00,0x04,0xB5,0x08,0xA5,0x0E,0x94,0x90,0xB4,
+  0x12,0xC5,0x94,0xD5,0x81,0x96,0xF6,0x05,0x18,0xF7,0x16,0xF7,0x16,0xF7,0x96,0xF6,
+  0x96,0xF6,0x14,0xF6,0x81,0x14,0xE6,0x80,0x92,0xD5,0x83,0x94,0xD5,0x80,0x94,0xE5,
+  0x80,0x94,0xD5,0x84,0x94,0xE5,0x01,0x14,0xE6,0x94,0xE5,0x86,0x14,0xE6,0x13,0x12,
+  0xF6,0x92,0xE5,0x16,0x75,0x1A,0x35,0x1A,0x04,0x18,0x04,0x16,0x04,0x94,0x03,0x96,
+  0x03,0x18,0x04,0x96,0x03,0x14,0x03,0x92,0x02,0x9A,0x04,0x94,0x33,0x08,0x93,0x0A,
+  0xB5,0x86,0x52,0x04,0x52,0x04,0x73,0x83,0x00,0x00,0x0B,0x04,0x21,0x86,0x31,0x08,
+  0x52,0x0A,0x63,0x8C,0x83,0x0E,0x94,0x90,0xB4,0x92,0xC5,0x94,0xE5,0x96,0xF6,0x96,
+  0xF6,0x16,0xF7,0x00,0x92,0xD5,0x81,0x94,0xD5,0x01,0x94,0xE5,0x92,0xD5,0x81,0x94,
+  0xE5,0x00,0x94,0xD5,0x83,0x94,0xE5,0x02,0x14,0xE6,0x94,0xE5,0x94,0xE5,0x81,0x14,
+  0xE6,0x81,0x94,0xE5,0x80,0x14,0xE6,0x1C,0x94,0xE5,0x14,0xD6,0x14,0xE6,0x92,0xF6,
+  0x96,0xC5,0x98,0x34,0x16,0x24,0x96,0x13,0x94,0x13,0x96,0x03,0x1A,0x04,0x1C,0x04,
+  0x98,0x14,0x98,0x44,0x96,0x95,0x94,0xF6,0x96,0xF6,0x94,0xD5,0x14,0xE6,0x94,0xD5,
+  0x12,0xC5,0x90,0xC4,0x8E,0xB4,0x8C,0x93,0x0A,0x83,0x88,0x62,0x84,0x41,0x04,0x31,
+  0x82,0x10,0x83,0x00,0x00,0x03,0x02,0x00,0x04,0x21,0x86,0x41,0x8A,0x52,0x02,0x14,
+  0xF6,0x14,0xE6,0x14,0xE6,0x82,0x94,0xE5,0x00,0x94,0xD5,0x88,0x94,0xE5,0x01,0x14,
+  0xE6,0x94,0xE5,0x87,0x14,0xE6,0x0B,0x94,0xE5,0x14,0xE6,0x14,0xF6,0x14,0xE6,0x16,
+  0xD6,0x18,0xB6,0x98,0x85,0x96,0x95,0x18,0x85,0x16,0xC6,0x94,0xF6,0x14,0xF6,0x82,
+  0x14,0xE6,0x00,0x16,0xF6,0x81,0x96,0xF6,0x00,0x98,0xF6,0x81,0x96,0xF6,0x0A,0x16,
+  0xF6,0x14,0xE6,0x92,0xD5,0x10,0xC5,0x8E,0xB4,0x8C,0x93,0x0A,0x83,0x88,0x62,0x86,
+  0x41,0x04,0x21,0x82,0x10,0x02,0x90,0xB4,0x92,0xD5,0x14,0xE6,0x84,0x96,0xF6,0x02,
+  0x16,0xF6,0x14,0xF6,0x14,0xE6,0x87,0x94,0xE5,0x84,0x14,0xE6,0x00,0x94,0xE5,0x82,
+  0x14,0xE6,0x06,0x14,0xF6,0x12,0xF6,0x14,0xF6,0x12,0xF6,0x14,0xF6,0x12,0xF6,0x14,
+  0xF6,0x8D,0x14,0xE6,0x00,0x16,0xF6,0x81,0x96,0xF6,0x00,0x18,0xF7,0x81,0x96,0xF6,
+  0x01,0x14,0xF6,0x14,0xE6,0x0E,0x00,0x00,0x02,0x10,0x04,0x21,0x86,0x31,0x08,0x52,
+  0x8A,0x62,0x8C,0x83,0x0E,0x94,0x90,0xA4,0x12,0xC5,0x92,0xD5,0x14,0xE6,0x96,0xF6,
+  0x96,0xF6,0x98,0xF6,0x82,0x96,0xF6,0x00,0x14,0xF6,0x81,0x14,0xE6,0x02,0x94,0xE5,
+  0x14,0xE6,0x94,0xE5,0xA2,0x14,0xE6,0x01,0x16,0xE6,0x16,0xF6,0x05,0x8C,0x83,0x88,
+  0x72,0x06,0x52,0x04,0x31,0x82,0x20,0x00,0x10,0x82,0x00,0x00,0x09,0x82,0x10,0x04,
+  0x21,0x86,0x31,0x08,0x52,0x0A,0x63,0x8C,0x83,0x0E,0x94,0x90,0xA4,0x12,0xC5,0x94,
+  0xD5,0x81,0x96,0xF6,0x00,0x16,0xF7,0x82,0x96,0xF6,0x00,0x16,0xF6,0xA1,0x14,0xE6,
+  0x80,0x96,0xF6,0x0B,0x16,0xF6,0x14,0xF6,0x14,0xE6,0x92,0xD5,0x10,0xC5,0x8E,0xB4,
+  0x0C,0xA4,0x0A,0x83,0x88,0x72,0x06,0x52,0x04,0x31,0x82,0x20,0x83,0x00,0x00,0x10,
+  0x82,0x10,0x04,0x21,0x06,0x42,0x8A,0x62,0x0C,0x73,0x8E,0x83,0x0E,0x94,0x90,0xB4,
+  0x92,0xC5,0x14,0xE6,0x96,0xF6,0x96,0xF6,0x16,0xF7,0x18,0xF7,0x18,0xF7,0x96,0xF6,
+  0x96,0xF6,0x9A,0x14,0xE6,0x02,0x94,0xD5,0x94,0xE5,0x94,0xE5,0x81,0x14,0xE6,0x84,
+  0x96,0xF6,0x18,0x14,0xF6,0x14,0xE6,0x92,0xD5,0x10,0xC5,0x8E,0xB4,0x0C,0xA4,0x0A,
+  0x83,0x88,0x72,0x06,0x52,0x04,0x31,0x80,0x10,0x00,0x10,0x02,0x10,0x02,0x10,0x82,
+  0x10,0x82,0x10,0x04,0x21,0x06,0x42,0x88,0x52,0x0A,0x73,0x8C,0x83,0x0E,0x94,0x90,
+  0xA4,0x12,0xC5,0x94,0xD5,0x99,0x14,0xE6,
+};
+
+#endif
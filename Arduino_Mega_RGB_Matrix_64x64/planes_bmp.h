@@ -0,0 +1,1171 @@
+// Made with tools/pack_image.py --format planes --planes 4, for
+// RGBmatrixPanel::drawPlanes(). Do not edit.
+#ifndef __PLANES_BMP_H
+#define __PLANES_BMP_H
+#include "avr/pgmspace.h"
+
+// 64x64, back buffer layout: 6144 bytes
+const uint8_t PROGMEM Pikachu1_64x64_planes[] = {
+  0xFF,0xFF,0xFE,0x5F,0x7D,0x7C,0x7C,0x7C,0x7C,0x7D,0x5D,0x1C,0x3C,0x7D,0x7C,0x7C,
+  0x7C,0x7D,0x1F,0x3C,0xFE,0xBE,0x5D,0x7D,0x7C,0x7D,0x3C,0x5D,0x7C,0x7C,0x7C,0x3D,
+  0x9C,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0x5F,0x5C,0x3F,0x3E,0x3F,0x3D,0x7C,0x7C,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x3C,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFD,0x3D,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x3D,0x7D,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x3F,0xFF,0x7F,0x7D,0x3F,0x7F,0x7F,0x7F,0x7D,0x3D,0x7F,0x7F,0x7F,0x7F,
+  0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7D,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x3F,0x3F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x3F,0x3F,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0x9E,0x5D,0x7C,0x7D,0x7C,0x7C,0x7C,0x7D,0x3C,0x5D,0x7D,0x7C,0x7C,
+  0x7C,0x7D,0x7D,0x5F,0x7C,0xDC,0x7C,0x7C,0x7C,0x3D,0x5D,0x7C,0x7C,0x7C,0x3D,0x1E,
+  0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0x1F,0xFE,0xFE,0xFE,0xFE,0xFF,0xFD,0xBC,
+  0x3E,0x3D,0x3D,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x1C,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFD,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x1F,0x3F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7D,0x7D,0xBF,0x7F,0x7D,0x7F,0x7F,0x7D,0x3D,0x7F,0x7F,0x7F,0x7F,0x3F,
+  0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x3F,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x7D,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x3F,0x3F,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x7F,0xDE,0x3C,0x7D,0x7C,0x7C,0x7C,0x7D,0x00,0x41,0x3D,0x7D,
+  0x7C,0x3D,0x7D,0x7C,0x5F,0x7D,0x7D,0x7C,0x7C,0x3D,0x3D,0x7C,0x7C,0x7C,0x1E,0x7E,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0x7E,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
+  0xFE,0xFE,0xFF,0xFD,0x3E,0x3C,0x3D,0x7C,0x7C,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x1F,0x3D,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7D,0x3D,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7D,0x7D,0x3D,0x7F,0x7F,0x7F,0x7D,0x7F,0x7F,0x7F,0x7F,0x3D,0x1F,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x63,0x63,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0x3F,0x7C,0x7C,0x7D,0x7C,0x60,0x60,0x1C,0x5D,0x1C,
+  0x3D,0x7C,0x7C,0x7D,0x7D,0x7C,0xBC,0xFD,0x3D,0x7C,0x7C,0x7C,0x7C,0xDC,0x3D,0x9D,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x7E,0xFE,0xFE,0xFF,0xFF,0xFD,0x7E,0x7E,
+  0x7E,0x1F,0x1F,0x9D,0x9F,0x1D,0x1D,0x5C,0xDE,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x3D,0x7F,0x7F,0x7F,0x7F,0x62,0x62,0x3D,0x7F,
+  0x7D,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x3D,0x7F,0x7F,0x7F,0x7F,0x7F,0x3F,0x1F,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xBD,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3F,0x3F,0x3D,0x3D,0xBD,0xBD,0xBF,0x3D,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x60,0x60,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x7C,0x1F,0x7D,0x7C,0x60,0x60,0x7D,0x7C,0x1C,
+  0x1D,0x3F,0xFF,0xFE,0xFE,0x1D,0x1D,0x3E,0x7C,0x7C,0x7C,0x7C,0x3D,0x3E,0x7C,0x3D,
+  0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0x7E,0xFF,0xFC,0x1F,0x9D,0x9F,0x5E,0xDC,
+  0x5D,0x1E,0x9C,0x1D,0x1F,0xFC,0xFC,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x1F,0x3D,0x3F,0x7F,0x7F,0x62,0x63,0x7F,0x7F,
+  0x7F,0x7F,0x3D,0x3D,0x3D,0xBF,0xBF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7D,0x7F,0x7D,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xBD,0x3D,0x3D,0x3D,0x3F,0x3D,0x3D,0xBD,0xBD,
+  0x3D,0x7F,0x7F,0xFF,0xFF,0xFD,0xFD,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x63,0x60,0x63,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0x3F,0x1F,0x61,0x21,0x7C,0x7C,0x7C,
+  0x7C,0x3D,0x3E,0xBC,0xFD,0xBC,0x3D,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7D,0x7C,0x3D,
+  0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0x7E,0xFD,0x5C,0x9C,0x1D,0xDC,0xFE,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x9F,0x3C,0x20,0x62,0x62,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7D,0x3D,0x7D,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFD,0xBD,0x3D,0x3D,0xBD,0x7D,0xFF,0xFF,0xFD,0xFD,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7C,0x60,0x60,0x60,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xC2,0x83,0x42,0x3E,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x3D,0x5D,0x1C,0x1C,0x7C,0x7D,
+  0x3C,0x9D,0xFF,0xFF,0xFF,0xFF,0xFE,0x5C,0xFC,0x7C,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x7D,0xA0,0x20,0x23,0x7E,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7D,0x3F,0x7D,0x7F,0x7F,0x7F,
+  0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xBD,0x3D,0x3D,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x60,0x60,0x60,0x7C,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xC0,0xE1,0x9D,0x3D,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x3D,0x3D,0x5D,0x3D,0x3D,0x1C,0x5D,0x7C,
+  0x3D,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xFD,0x1F,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xE0,0xE2,0x0E,0x3C,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7D,0x7D,0x3D,0x7D,0x7D,0x7F,0x3D,0x7F,
+  0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFD,0xBD,0x3F,0x3F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xE0,0xE0,0xE3,0x7C,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE3,0xE3,0xE3,0xEF,0x9D,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7D,0x5D,0x1D,0x7C,0x7C,0x7D,0x7C,0x7D,0x3D,0x3D,
+  0x7C,0x9C,0xFF,0xFC,0x5D,0x9C,0x5F,0xDE,0xFD,0x1F,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE2,0xE2,0xEE,0xEC,0x7E,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x3D,0x1F,0x1F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0xFD,0xFD,0x3D,0x7F,0x3D,0x3F,0x3F,0x3F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xE3,0xED,0xEF,0x7C,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xE3,0xEF,0xEF,0xE6,0x98,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7D,0x5D,0x3D,0x5D,0x1C,0x7C,0x7C,0x7C,0x7D,0x7D,
+  0x7D,0x3C,0xFE,0x3D,0x1D,0x7E,0x1D,0x7E,0x7E,0x1F,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xE2,0xEE,0xEE,0xEC,0x7E,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x3D,0x1D,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7D,0xFD,0xFD,0x3F,0x3D,0x3F,0x3D,0x3F,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xE0,0xEC,0xEF,0xEC,0x7D,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0xFF,0xFF,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE7,0xEF,0xEF,0xC4,0x38,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x1C,0x1D,0x1C,0x7C,0x7C,0x3E,0x3E,
+  0x3D,0x3D,0xFF,0x9C,0x3D,0xBE,0xDF,0xDF,0x5E,0x3D,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0xEE,0xEE,0xEF,0x7D,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x1F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7D,0xFF,0xFD,0x5D,0x7F,0xBD,0xBD,0xBF,0x9F,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xEE,0xEF,0xED,0xEC,0x7D,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0xFF,0xFF,0x3F,0x7F,0x7F,0x7F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xEF,0xEF,0xEF,0xD0,0x3C,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7D,0x7C,0xBD,0x3F,0x7C,0x3D,0xFF,0x5C,0x7C,
+  0xFE,0x3E,0x3C,0x7F,0x1C,0x7C,0xDE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xEE,0xEE,0xEE,0xEE,0x7D,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x1F,0x1F,0x7F,0x7F,0x7F,0x3D,0xBF,0xBD,
+  0x3D,0x7F,0x9D,0xBD,0x3D,0x3F,0xFF,0xFF,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xEE,0xEF,0xED,0xED,0xED,0x7C,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x1F,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE7,0xEF,0xEF,0xEF,0xF0,0x3E,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x1C,0x3F,0x1D,0xBC,0x3F,0xFE,0xFE,0xFE,
+  0xFF,0x3C,0x1C,0x3C,0x1C,0x3C,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEE,0xEE,0xEE,0xED,0x7D,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x1F,0xBF,0x7F,0x7F,0x3D,0x3D,0x3D,
+  0x3D,0xFF,0x3F,0x1D,0x3D,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xEE,0xED,0xED,0xED,0xED,0x7C,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x1F,0x1F,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xE7,0xEF,0xEF,0xEF,0xE2,0x9C,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x3D,0x5E,0x9E,0xFE,0xFF,0xDC,0xFE,0xFE,
+  0xFF,0xDE,0x1C,0x9D,0x1C,0x3C,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEE,0xEE,0xEE,0xEE,0xFD,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3F,0x3F,0x3F,0x3F,0x3D,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xED,0xED,0xED,0xED,0x7E,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x7F,0x1F,0x1F,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE7,0xEF,0xEF,0xE7,0xE2,0x9C,0x7C,
+  0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x7C,0x5F,0x9F,0xB1,0xE3,0x83,0x91,0xE3,
+  0xA3,0x70,0x9B,0xFF,0x1C,0x1C,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xEE,0xEE,0xEE,0xEC,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x3F,0x3D,0x1E,0x3D,0x3C,0x2D,0x3C,
+  0x7E,0x3E,0x3F,0xFF,0xFD,0x1F,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xED,0xED,0xEF,0xFF,0x7F,0x7F,
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7C,0x7F,0x7F,0x7F,0x7F,0x7F,
+  0x7F,0x1F,0x1D,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE7,0xEF,0xEF,0xE7,0xD2,0x1E,0x7C,
+  0x78,0x60,0x70,0x70,0x70,0x60,0x70,0x60,0x61,0x20,0x93,0xC2,0x85,0xA4,0x87,0xE5,
+  0x85,0x03,0xF0,0xE3,0xE7,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xEE,0xEE,0xEE,0xEE,0x7F,0x7F,
+  0x7F,0x7E,0x6E,0x6E,0x6E,0x7E,0x7E,0x7E,0x6E,0x7D,0x2D,0x2F,0x2C,0x0E,0x2C,0x2E,
+  0x2C,0x2C,0x0E,0xFE,0xEE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xED,0xED,0xEE,0xFF,0x7F,0x7F,
+  0x7D,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7C,0x6D,0x6D,0x6D,0x6C,0x6C,0x6C,0x6C,
+  0x6C,0x0D,0xED,0xED,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE7,0xEF,0xEF,0xE7,0x11,0x20,0x70,
+  0x70,0x64,0x64,0x64,0x64,0x64,0x68,0x64,0x64,0xAC,0xCE,0xEF,0xEE,0x0F,0x0D,0x8F,
+  0x8E,0xEF,0xEF,0xEF,0xEF,0xE3,0xFF,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xEE,0xEE,0xEE,0xFF,0x7D,0x7E,
+  0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x67,0x6E,0x6E,0x6E,0x2E,0x2C,0x2C,0x2C,0x2E,0x2C,
+  0x6C,0xEC,0xEE,0xEE,0xEE,0xE2,0xE3,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xED,0xED,0xEE,0xFF,0x7F,0x6D,
+  0x6D,0x6C,0x6E,0x6E,0x6E,0x6C,0x6F,0x6C,0x6E,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,
+  0xED,0xED,0xED,0xEF,0xED,0xE3,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE3,0xEF,0xEF,0xFB,0x8F,0x25,0x64,
+  0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0xED,0x6C,0xEF,0x6E,0x0F,0x4C,0x4D,0xCE,
+  0xEF,0xEF,0xEF,0xE7,0xEF,0xE3,0xE3,0xE3,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEE,0xEE,0xE7,0x62,0x6C,0x6E,
+  0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x2C,0xAC,0x2E,0x2C,0x2E,0xAE,0x2C,0xEE,
+  0xEE,0xEE,0xEE,0xEE,0xE2,0xE2,0xE2,0xE2,0xE3,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xED,0xED,0xED,0xEE,0xFF,0x6C,0x6F,
+  0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6F,0x6D,0x6D,0xED,0xED,
+  0xED,0xED,0xEF,0xEE,0xE3,0xE0,0xE0,0xE0,0xE3,0xE3,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xEF,0xE7,0xEB,0x05,0x2D,0x6C,
+  0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x2E,0xEE,0x6C,0xED,0x03,0x42,0x86,0xE6,0xE7,0xE7,
+  0xEF,0xE7,0xEF,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xEE,0xEE,0xE6,0xEE,0x6C,0x6E,
+  0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x2C,0xAC,0x2C,0x2E,0xAD,0x6E,0xEC,0xEE,0xEE,
+  0xEE,0xEE,0xEE,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xED,0xEF,0xEE,0xEE,0xEF,0x6D,0x6D,
+  0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0xEE,0xEE,0xEF,0xEF,
+  0xED,0xEE,0xE3,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xEF,0xE7,0xEF,0x8F,0x0C,0x6D,
+  0x6C,0x6C,0x6C,0x6C,0x2E,0xEF,0x6C,0xEE,0x6E,0x0F,0xC9,0xFF,0xEB,0xF3,0xE3,0xF3,
+  0xF3,0xE3,0xEF,0xE3,0xFF,0xFF,0xE3,0xE3,0xFF,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEE,0xEE,0xEE,0xEE,0x6E,0x6E,
+  0x6E,0x6E,0x6E,0x6E,0x6E,0x2C,0xAC,0x2C,0x2C,0x2C,0x24,0xE1,0xFE,0xEE,0xEE,0xFE,
+  0xFE,0xF3,0xF3,0xFF,0xFE,0xFF,0xE2,0xE3,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xED,0xED,0xEF,0xED,0xED,0x6D,0x6D,
+  0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0xEF,0xFF,0xFD,0xFF,0xFF,0xEF,
+  0xEF,0xEF,0xE3,0xE0,0xE0,0xE3,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xEB,0xEF,0xEF,0xEF,0xCF,0x2C,
+  0x6C,0x2D,0x2E,0xEF,0x6C,0xEE,0xEF,0x6C,0x8D,0x0C,0xEF,0xF7,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xE6,0xEE,0xEE,0xEE,0xAC,0x6E,
+  0x6E,0x6E,0x6E,0x2C,0xAC,0x2C,0x2C,0x2C,0x2C,0xEC,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEE,0xED,0xED,0xED,0x6D,0x6D,
+  0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6F,0x6F,0xED,0xED,0xEE,0xFF,0xFF,0xFF,0xFF,
+  0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xEB,0xEF,0xEF,0xEF,0x8D,0xAE,
+  0x6F,0xEF,0xEE,0xEE,0xEF,0x6F,0x0D,0x05,0x89,0xEF,0xEF,0xE3,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xE6,0xEE,0xEE,0xEE,0xEE,0x0E,
+  0x2E,0x2E,0x2C,0x2C,0x2C,0x2E,0x2E,0xA0,0xE6,0xEE,0xEE,0xFE,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xEF,0xEF,0xED,0xED,0xED,0x6D,
+  0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6F,0x6F,0xEF,0xEF,0xED,0xED,0xFC,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE7,0xEF,0xEF,0xEF,0xEF,0x0F,
+  0x2D,0x8D,0xEF,0xEC,0x0F,0x8F,0x47,0xE3,0xF3,0xE7,0xEF,0xF3,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,
+  0x8E,0x2C,0x2C,0x2C,0x2E,0x2C,0x20,0xF0,0xE3,0xE2,0xEE,0xEE,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xED,0xED,0xEF,0xED,0xED,
+  0x6D,0x6D,0x6D,0x6D,0x6D,0x6F,0xEE,0xFC,0xE3,0xEE,0xEF,0xED,0xFC,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFC,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xE7,0xEF,0xE7,0xEB,0xEF,0xEF,
+  0x8F,0x6C,0x4F,0x2D,0x8E,0xCE,0xEB,0xEB,0xF3,0xEF,0xEF,0xE7,0xF3,0xFF,0xFF,0xFF,
+  0xFF,0xF3,0xFF,0xEF,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xEE,0xEE,0xE6,0xEE,0xEE,
+  0xAC,0x4E,0x6C,0x8E,0x6E,0xEE,0xE6,0xEF,0xE3,0xE2,0xEE,0xEE,0xFE,0xFF,0xFF,0xFF,
+  0xFF,0xEE,0xE3,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xED,
+  0x6D,0x2D,0x2D,0x6D,0xED,0xEF,0xE2,0xF1,0xE0,0xE0,0xEF,0xEC,0xFF,0xFF,0xFF,0xFF,
+  0xFC,0xFC,0xEF,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xEF,0xEB,0xE3,0xE3,0xEB,0xEF,
+  0x4D,0x2C,0x4C,0x4F,0xEF,0xEF,0xEF,0xE3,0xE3,0xE7,0xEF,0xEF,0xEB,0xFF,0xFF,0xF3,
+  0xF3,0xE7,0xEF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xF3,0xE3,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xE6,0xFE,0xE2,0xE6,0xEC,
+  0xAE,0x2E,0x6E,0x2E,0xEE,0xEE,0xE2,0xE2,0xE2,0xE2,0xEE,0xEE,0xEE,0xFF,0xFF,0xEE,
+  0xEF,0xEE,0xEE,0xEE,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEE,0xEF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xED,0xEE,0xE3,0xFC,0xEE,0xEF,
+  0x6D,0x6D,0x2D,0xED,0xED,0xEF,0xED,0xE0,0xE0,0xEE,0xEF,0xEF,0xFF,0xFF,0xFC,0xFC,
+  0xEC,0xEE,0xED,0xED,0xED,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFC,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xEF,0xEB,0xFF,0xE3,0xEB,0xEF,
+  0x8E,0x25,0x40,0x0C,0xEF,0xEF,0xEF,0xE3,0xEB,0xEF,0xEF,0xEF,0xFF,0xF3,0xE3,0xE7,
+  0xEF,0xEF,0xEF,0xEF,0xEB,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE3,0xF3,0xF3,0xE3,0xE7,0xFB,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEE,0xE6,0xF2,0xF3,0xE6,0xEC,
+  0x6E,0x2E,0x6C,0xEE,0xEE,0xEE,0xEE,0xEE,0xE6,0xEE,0xEE,0xE6,0xEB,0xFE,0xFF,0xEE,
+  0xEE,0xEE,0xEE,0xEE,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFE,0xEF,0xEE,0xEE,0xE7,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xE2,0xE0,0xFE,0xE2,0xEF,
+  0x6D,0x6F,0x2D,0xED,0xED,0xED,0xEF,0xED,0xEE,0xEF,0xEF,0xEC,0xE5,0xFE,0xED,0xEC,
+  0xED,0xED,0xED,0xEF,0xEE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFF,0xFD,0xED,0xED,0xED,0xEC,0xEE,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xEF,0xE3,0xE3,0xE3,0xEB,0xEE,
+  0x8E,0x25,0x47,0xEE,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xE3,0xE3,0xE7,0xE7,0xEF,0xEF,
+  0xEF,0xEF,0xEF,0xE7,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFB,0xE3,0xF3,0xF3,0xE3,0xE7,0xEF,0xEF,0xEF,0xE7,0xE3,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xEE,0xE2,0xE2,0xE2,0xEA,0xEC,
+  0x6C,0x2C,0x6C,0xEC,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xE6,0xE6,0xE3,0xEE,0xEE,
+  0xEE,0xEE,0xEE,0xEE,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFE,0xFF,0xEF,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xFE,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xED,0xE0,0xE0,0xE6,0xEF,
+  0x6D,0x6E,0x2E,0xEF,0xEF,0xEF,0xED,0xEF,0xEF,0xEF,0xEF,0xE5,0xE4,0xEF,0xEF,0xED,
+  0xED,0xED,0xED,0xEE,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFD,0xFF,0xEC,0xED,0xED,0xEE,0xED,0xED,0xEF,0xEE,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,
+  0xCF,0x0D,0xAF,0xEB,0xE7,0xE3,0xEF,0xEF,0xEF,0xEF,0xE3,0xE7,0xE7,0xE7,0xEF,0xEF,
+  0xEF,0xEF,0xEF,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xE3,0xF3,0xF3,0xE7,0xE7,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xF3,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEE,0xEE,0xEE,0xEE,0xEE,0xEC,
+  0x2C,0x2C,0x82,0xEA,0xE2,0xE2,0xE2,0xEE,0xEE,0xEE,0xE6,0xE6,0xE6,0xE6,0xEE,0xEE,
+  0xEE,0xEE,0xEE,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFE,0xFF,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xED,0xED,0xE1,0xE1,0xED,0xED,
+  0x6F,0x6F,0x6D,0xE7,0xEC,0xED,0xED,0xEF,0xED,0xEF,0xED,0xE5,0xE5,0xEE,0xEF,0xED,
+  0xED,0xED,0xED,0xED,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
+  0xFF,0xEC,0xED,0xEC,0xEF,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xFC,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xE3,0xEF,0xEF,0xEF,0xEF,0xE7,
+  0x6C,0x25,0xE2,0xE3,0xE3,0xE3,0xEB,0xEF,0xEF,0xEF,0xEB,0xE7,0xE7,0xE3,0xEF,0xEF,
+  0xEF,0xEF,0xE7,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xE3,0xF3,
+  0xE3,0xE7,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xE7,0xF3,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,
+  0x82,0x0C,0xE0,0xE2,0xE2,0xE2,0xEA,0xEE,0xEE,0xEE,0xEE,0xE6,0xE6,0xE6,0xEE,0xEE,
+  0xEE,0xEE,0xEE,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEF,
+  0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xEF,0xEF,0xEF,0xED,0xEE,
+  0x6C,0x60,0xE0,0xE0,0xE0,0xE0,0xE6,0xEF,0xED,0xEF,0xE5,0xE5,0xE4,0xEF,0xEF,0xED,
+  0xED,0xEF,0xEC,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xEC,
+  0xED,0xEF,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xEF,0xED,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xF3,0xE3,0xFF,0xFB,0xFF,0xE3,0xE3,0xE3,0xEF,0xEF,0xEF,0xEF,
+  0x09,0x83,0xE7,0xE7,0xE7,0xE7,0xEB,0xEF,0xEF,0xEF,0xE3,0xE7,0xE7,0xE3,0xEF,0xEF,
+  0xEF,0xEF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xF3,0xE3,0xE7,0xEF,
+  0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xE7,0xE3,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFE,0xFE,0xE7,0xE6,0xEE,0xEE,0xEE,0xEE,0xEE,
+  0xEA,0x62,0xE2,0xE6,0xE6,0xE2,0xEA,0xEE,0xEE,0xEE,0xE6,0xE6,0xE6,0xEE,0xEE,0xEE,
+  0xEE,0xEE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEE,0xEE,
+  0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xFE,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFD,0xFC,0xFC,0xE6,0xED,0xEF,0xED,0xED,0xEF,
+  0xE4,0xE0,0xE1,0xE0,0xE1,0xE1,0xE5,0xEF,0xED,0xEF,0xED,0xE5,0xE4,0xED,0xEF,0xED,
+  0xED,0xED,0xEC,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xEC,0xED,0xEE,0xED,
+  0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xF3,0xFF,0xE3,0xF3,0xE3,0xEF,0xE3,0xE7,0xEB,0xEF,0xEF,0xEF,0xEF,
+  0xEF,0xEB,0xE3,0xE3,0xEB,0xE7,0xEB,0xEF,0xEF,0xEF,0xEF,0xE3,0xE3,0xEF,0xEF,0xEF,
+  0xEF,0xEB,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xF3,0xE3,0xE7,0xEF,0xEF,0xEF,
+  0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xF3,0xFB,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xEF,0xE3,0xEE,0xEE,0xEE,0xEE,0xE6,0xE6,0xE6,0xEE,0xEE,0xEE,0xEE,
+  0xEE,0xE6,0xE6,0xE6,0xE7,0xE3,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,
+  0xEE,0xE6,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEE,0xEE,0xEE,0xEE,0xEE,
+  0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xEF,0xED,0xED,0xED,0xEC,0xEC,0xE5,0xE5,0xEE,0xED,0xED,0xEF,
+  0xEF,0xE3,0xE1,0xE6,0xE7,0xE7,0xE6,0xEF,0xED,0xED,0xEC,0xE4,0xE6,0xEF,0xED,0xED,
+  0xEF,0xED,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xED,0xEF,0xED,0xED,0xED,
+  0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xFD,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xE7,0xEF,0xEF,0xEF,0xEF,0xE7,0xE7,0xE7,0xEB,0xEF,0xEF,0xEF,
+  0xEF,0xEB,0xE7,0xFF,0xFF,0xE7,0xEB,0xEF,0xEF,0xE7,0xEF,0xE3,0xE3,0xEF,0xEF,0xEF,
+  0xEF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xE3,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,
+  0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xEF,0xE7,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xE3,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xE6,0xE6,0xE6,0xEE,0xEE,0xEE,
+  0xEE,0xE6,0xE3,0xEF,0xEF,0xFE,0xE6,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,
+  0xE6,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,
+  0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xEE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFE,0xEF,0xEF,0xED,0xED,0xED,0xEF,0xEE,0xE4,0xE5,0xEF,0xEF,0xED,0xED,
+  0xEF,0xEF,0xE6,0xE5,0xE7,0xE7,0xED,0xEF,0xED,0xEF,0xEF,0xEE,0xEF,0xED,0xED,0xEF,
+  0xEF,0xEF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFC,0xEC,0xED,0xED,0xEF,0xED,0xED,0xED,0xED,
+  0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xED,0xEF,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,
+};
+
+// 64x64, back buffer layout: 6144 bytes
+const uint8_t PROGMEM Pikachu2_64x64_planes[] = {
+  0x92,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0xD1,0x91,0x13,0x51,
+  0x71,0x71,0x10,0x52,0xF3,0x11,0x71,0x71,0x71,0x71,0x10,0x71,0x71,0x71,0x71,0x71,
+  0x71,0x71,0xB3,0xD3,0x70,0x70,0x33,0x71,0x71,0x71,0x51,0x53,0x93,0xD1,0x90,0x90,
+  0x10,0x32,0x73,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x71,0x53,0x90,0x92,
+  0x03,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x01,0x01,0x43,
+  0x63,0x63,0x01,0xC1,0xE3,0xE3,0x63,0x63,0x63,0x03,0x61,0x63,0x63,0x63,0x63,0x63,
+  0x63,0x63,0x63,0x63,0x23,0x23,0x23,0xA1,0x63,0x63,0x23,0x03,0x01,0x41,0x01,0x01,
+  0x01,0x61,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x01,0x01,0x03,
+  0x49,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x49,0x09,0x29,
+  0x69,0x09,0x09,0x29,0xE9,0x09,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,
+  0x69,0x69,0x69,0xA9,0xE9,0xE9,0xE9,0x69,0x69,0x69,0x69,0x09,0x49,0x09,0x49,0x49,
+  0x09,0x09,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x09,0x09,0x49,0x49,
+  0x9A,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x98,0xD8,0x18,
+  0x39,0x18,0x78,0xB9,0x18,0xF9,0x18,0x79,0x79,0x39,0x18,0x79,0x79,0x18,0x39,0x79,
+  0x79,0x79,0x7B,0xFA,0xB8,0xB9,0x3B,0x79,0x79,0x79,0x79,0x18,0x1B,0x99,0x98,0x18,
+  0x59,0x7B,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x5B,0x98,0x9A,
+  0x0A,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x08,0x48,0x68,
+  0x68,0x68,0x08,0x08,0x08,0x0A,0x08,0x6A,0x6A,0x08,0x6A,0x6A,0x6A,0x6A,0x08,0x6A,
+  0x6A,0x6A,0x6A,0xAA,0x2A,0x28,0x2A,0x6A,0x6A,0x6A,0x6A,0x6A,0x08,0x08,0x08,0x08,
+  0x28,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x08,0x08,0x0A,
+  0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x42,0x02,0x02,
+  0x62,0x62,0x02,0x02,0xE2,0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x62,0x62,0x62,0xE2,0xE2,0xE2,0x62,0x62,0x62,0x62,0x02,0x02,0x42,0x42,0x02,
+  0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x42,0x42,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x9B,0x5A,
+  0x18,0x79,0x18,0x18,0x78,0x18,0x19,0x79,0x79,0x79,0x18,0x19,0x59,0x19,0x79,0x79,
+  0x79,0x79,0x79,0x79,0xBB,0xB9,0xB9,0x79,0x79,0x79,0x79,0x59,0x78,0x9A,0x5B,0x79,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x5B,0x98,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x08,0x08,
+  0x0A,0x6A,0x08,0x08,0x28,0x08,0x68,0x6A,0x6A,0x6A,0x6A,0x6A,0x28,0x0A,0x0A,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x28,0x08,0x08,0x08,0x28,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x08,0x08,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x42,0x02,
+  0x62,0x62,0x62,0x02,0x02,0x02,0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x62,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x42,0x02,0x02,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x42,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xDB,
+  0x38,0x79,0x79,0x78,0x1B,0x78,0x79,0x78,0x79,0x18,0x18,0x78,0x18,0x78,0x79,0x79,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x78,0x1A,0x38,0x79,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x5B,0x98,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x6A,0x6A,0x68,0x2A,0x6A,0x6A,0x68,0x0A,0x68,0x68,0x68,0x68,0x68,0x6A,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x0A,0x08,0x48,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x08,0x08,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x62,0x62,0x02,0x02,0x02,0x62,0x62,0x62,0x62,0x02,0x02,0x02,0x02,0x62,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x42,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xB8,0xF8,0x38,0x7A,0x18,0x79,0x79,0x39,0x18,0x78,0x18,0x19,0x18,0x79,0x79,0x79,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x78,0x79,0x18,0x79,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x59,0x5A,0x99,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0xAA,0xEA,0x6A,0x08,0x6A,0x6A,0x68,0x0A,0x08,0x68,0x6A,0x68,0x6A,0x6A,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x68,0x0A,0x08,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x4A,0x08,0x08,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x22,0x02,0x42,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x5B,
+  0xB8,0x58,0x3B,0x3A,0x78,0x79,0x79,0x79,0x79,0x19,0x79,0x79,0x79,0x79,0x79,0x79,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x38,0x18,0x19,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x58,0x19,0x99,0x98,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x68,0x28,0x28,0xEA,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x2A,0x08,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x28,0x6A,0x48,0x08,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0xA2,0xE2,0xE2,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x42,0x02,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x42,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x98,
+  0x18,0xDB,0xB9,0xD9,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x3B,0x1B,0x18,
+  0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x18,0x78,0x5A,0x99,0x99,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x08,
+  0x48,0x2A,0x6A,0x6A,0xA8,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x08,0x68,
+  0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x08,0x48,0x08,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x42,
+  0x02,0x02,0xE2,0xA2,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x02,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x02,0x42,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x98,
+  0x5A,0x19,0xB9,0xFB,0xFB,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,
+  0x79,0x79,0x79,0x78,0x39,0x79,0x79,0x79,0x79,0x79,0x79,0x78,0x91,0xD3,0xD3,0x13,
+  0x18,0x78,0x79,0x79,0x79,0x79,0x79,0x78,0x78,0x58,0x1B,0x9B,0x98,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x08,
+  0x48,0x0A,0xC8,0x2A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,
+  0x6A,0x6A,0x6A,0x68,0x08,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x40,0x00,0x42,0x40,
+  0x0A,0x68,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x0A,0x0A,0x08,0x08,0x08,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x42,
+  0x02,0x02,0x22,0xE2,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x62,0x62,0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x2A,0x2A,0x0A,0x08,
+  0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x42,0x42,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0x9A,0x1B,0x5A,0x58,0x18,0x18,0x59,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,0x79,
+  0x79,0x79,0x78,0x18,0x59,0x79,0x79,0x79,0x71,0x71,0x70,0xB0,0x8A,0xEA,0xE8,0x81,
+  0x52,0x39,0x18,0x79,0x18,0x18,0x18,0x19,0x5B,0xD8,0x98,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x08,0x48,0x08,0xCA,0x0A,0x0A,0x2A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,
+  0x6A,0x6A,0x68,0x08,0x28,0x6A,0x6A,0x6A,0x62,0x62,0x60,0x62,0x21,0x23,0x41,0x09,
+  0x00,0x08,0x68,0x6A,0x6A,0x0A,0x0A,0x68,0x08,0x48,0x08,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x42,0x02,0x02,0x22,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x62,0x02,0x02,0x62,0x62,0x62,0x62,0x68,0x68,0x68,0x08,0x02,0x02,0x02,0x42,
+  0x08,0x02,0x62,0x62,0x62,0x62,0x62,0x02,0x02,0x02,0x42,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0x98,0x98,0x59,0x5B,0x5A,0x19,0x19,0x18,0x79,0x79,0x79,0x79,0x79,0x79,0x79,
+  0x79,0x18,0x18,0x19,0x79,0x79,0x79,0x71,0x79,0x60,0x89,0xC8,0x47,0x5F,0x60,0xC8,
+  0xD2,0x1A,0x18,0x79,0x18,0x1A,0x5B,0x99,0x9B,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x08,0x08,0x08,0x08,0x08,0x0A,0x6A,0x68,0x0A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,
+  0x6A,0x08,0x08,0x6A,0x6A,0x6A,0x6A,0x63,0x6A,0x69,0x41,0x43,0x20,0x24,0x05,0x40,
+  0x00,0x08,0x6A,0x6A,0x0A,0x08,0x08,0x48,0x08,0x08,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x42,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x62,0x02,0x62,0x62,0x62,0x62,0x6A,0x62,0x62,0x23,0x23,0x60,0x62,0x01,0x00,
+  0x4A,0x02,0x02,0x62,0x62,0x02,0x02,0x02,0x42,0x42,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0x98,0x99,0x98,0xD9,0x1A,0x58,0x78,0x79,0x79,0x79,0x79,0x79,0x79,
+  0x78,0x18,0x19,0x71,0x71,0x71,0x71,0x61,0x69,0x68,0x39,0x79,0x71,0x7D,0x79,0x0B,
+  0x90,0x38,0x39,0x79,0x79,0x38,0xD8,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x08,0x08,0x08,0x48,0x08,0x28,0x68,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,
+  0x68,0x08,0x6A,0x62,0x62,0x62,0x62,0x6B,0x63,0x67,0x60,0x62,0x6A,0x6B,0x62,0x00,
+  0x00,0x4A,0x08,0x6A,0x6A,0x28,0x48,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x42,0x42,0x42,0x02,0x02,0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x62,0x02,0x02,0x68,0x68,0x68,0x68,0x60,0x61,0x61,0x66,0x66,0x66,0x64,0x06,0x00,
+  0x48,0x02,0x62,0x62,0x62,0x42,0x02,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0x98,0xD9,0x98,0x9A,0x1A,0x78,0x79,0x79,0x79,0x79,0x79,0x79,0x79,
+  0x79,0x10,0x71,0x79,0x79,0x79,0x69,0x65,0x61,0x79,0x75,0x75,0x71,0x71,0x29,0x03,
+  0x12,0x79,0x79,0x79,0x39,0x78,0xD8,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x08,0x48,0x08,0x08,0x4A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,
+  0x6A,0x00,0x62,0x6A,0x6A,0x62,0x63,0x6E,0x67,0x6B,0x6E,0x6E,0x6A,0x6A,0x07,0x09,
+  0x40,0x6A,0x6A,0x6A,0x68,0x0A,0x48,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x42,0x02,0x42,0x42,0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x02,0x08,0x68,0x62,0x60,0x62,0x63,0x62,0x62,0x65,0x63,0x61,0x66,0x67,0x62,0x02,
+  0x08,0x62,0x62,0x62,0x62,0x02,0x02,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0x98,0x1B,0x59,0x5A,0xD8,0x1B,0x39,0x79,0x79,0x18,0x79,0x79,0x79,0x78,
+  0x71,0x79,0x61,0x61,0x6D,0x69,0x65,0x0C,0x61,0x75,0x79,0x71,0x71,0x66,0xE0,0xB3,
+  0x59,0x59,0x79,0x18,0x19,0x5A,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x08,0x48,0x0A,0x08,0x48,0x4A,0x6A,0x6A,0x6A,0x68,0x6A,0x6A,0x6A,0x68,
+  0x02,0x6A,0x63,0x62,0x62,0x66,0x62,0x6C,0x6E,0x62,0x6B,0x6A,0x6B,0x02,0x29,0x43,
+  0x08,0x2A,0x6A,0x6A,0x0A,0x08,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x42,0x02,0x02,0x02,0x02,0x02,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,
+  0x08,0x02,0x62,0x60,0x62,0x62,0x6F,0x6F,0x63,0x60,0x65,0x66,0x67,0x61,0x00,0x0A,
+  0x02,0x62,0x62,0x62,0x02,0x02,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0x98,0x98,0x18,0x38,0x38,0x18,0x50,0x71,0x71,0x18,0x18,0x79,0x79,0x71,0x71,
+  0x11,0x00,0x6D,0x6D,0x65,0x0D,0x0D,0x0C,0x6D,0x69,0x71,0x71,0x27,0x83,0xDB,0x91,
+  0x58,0x78,0x78,0x1B,0xD8,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x62,0x62,0x08,0x08,0x6A,0x6A,0x62,0x63,
+  0x6A,0x60,0x6E,0x6E,0x6E,0x6E,0x6E,0x0C,0x62,0x67,0x6B,0x6B,0x02,0x22,0x08,0x62,
+  0x08,0x08,0x0A,0x4A,0x48,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x42,0x42,0x02,0x62,0x62,0x02,0x08,0x68,0x68,0x62,0x62,0x62,0x62,0x68,0x6A,
+  0x02,0x00,0x61,0x63,0x6F,0x6F,0x0F,0x6F,0x6F,0x60,0x64,0x67,0x61,0x02,0x22,0x08,
+  0x02,0x02,0x62,0x02,0x02,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0x99,0xD9,0x18,0x71,0x31,0x18,0x31,0x69,0x69,0x65,0x65,0x65,0x61,0x61,
+  0x6C,0x09,0x0C,0x0C,0x6D,0x6D,0x0C,0x6D,0x6D,0x61,0x78,0x22,0x83,0xB0,0xD2,0x5A,
+  0x19,0xB8,0x1A,0x5A,0x98,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x08,0x08,0x0A,0x62,0x60,0x08,0x4A,0x03,0x02,0x6A,0x6A,0x6A,0x62,0x63,
+  0x6C,0x66,0x0C,0x0C,0x6C,0x0E,0x6C,0x6E,0x6E,0x6E,0x66,0x05,0x20,0x62,0x42,0x28,
+  0x08,0x68,0x28,0x08,0x08,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x42,0x02,0x62,0x68,0x0A,0x00,0x00,0x00,0x03,0x62,0x60,0x62,0x62,0x62,
+  0x60,0x0E,0x6F,0x6F,0x0F,0x0F,0x0F,0x6F,0x6F,0x60,0x61,0x62,0x02,0x08,0x28,0x02,
+  0x02,0x02,0x02,0x02,0x42,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD1,0xD1,0x98,0x5B,0x70,0x79,0x69,0x44,0x0E,0x05,0x69,0x6D,0x6D,0x6D,0x65,0x65,
+  0x6D,0x6C,0x0D,0x6C,0x0D,0x0D,0x6D,0x6D,0x6D,0x61,0x00,0xA0,0x32,0x71,0x79,0x18,
+  0x3A,0xFA,0x98,0x18,0xD9,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x40,0x40,0x08,0x08,0x62,0x6A,0x63,0x08,0x4E,0x0E,0x06,0x6E,0x6E,0x6E,0x62,0x6E,
+  0x6E,0x0C,0x6E,0x0C,0x6E,0x6E,0x6E,0x6E,0x6E,0x62,0x62,0x62,0x00,0x62,0x6A,0x08,
+  0x08,0x48,0x48,0x0A,0x48,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x08,0x08,0x42,0x02,0x08,0x62,0x62,0x60,0x00,0x02,0x6F,0x6D,0x6D,0x6D,0x6C,0x60,
+  0x6F,0x6F,0x0F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x60,0x00,0x68,0x68,0x62,0x62,
+  0x02,0x22,0x22,0x02,0x02,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,
+  0xD9,0xD9,0x90,0x53,0x79,0x61,0x61,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,
+  0x4D,0x0D,0x6D,0x6C,0x0D,0x6D,0x6D,0x6D,0x6D,0x69,0x61,0x79,0x71,0x79,0x79,0x78,
+  0xB8,0x9B,0x18,0x59,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,
+  0x48,0x48,0x00,0x00,0x6A,0x6B,0x62,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,
+  0x4C,0x0E,0x6E,0x6C,0x6E,0x6E,0x6E,0x6E,0x6E,0x6A,0x62,0x6A,0x62,0x6A,0x6A,0x08,
+  0x0A,0x4A,0x0A,0x08,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x08,
+  0x00,0x00,0x4A,0x08,0x00,0x63,0x6D,0x6D,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,
+  0x2F,0x0F,0x0F,0x0F,0x6F,0x6F,0x6F,0x6F,0x6F,0x64,0x60,0x62,0x68,0x62,0x62,0x62,
+  0x02,0x22,0x02,0x02,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,
+  0xCD,0xC5,0x91,0x03,0x41,0x61,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x0C,
+  0x6D,0x4D,0x6D,0x0C,0x0D,0x0C,0x6D,0x6D,0x65,0x61,0x71,0x71,0x79,0x79,0x18,0x39,
+  0x5A,0x5A,0x59,0x99,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,
+  0x40,0x48,0x08,0x01,0x42,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,
+  0x0E,0x2C,0x6E,0x6C,0x6E,0x6C,0x6E,0x6E,0x6E,0x62,0x62,0x62,0x6A,0x6A,0x6A,0x08,
+  0x0A,0x0A,0x08,0x08,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x08,
+  0x02,0x01,0x40,0x02,0x20,0x6C,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,
+  0x0F,0x6F,0x6F,0x6F,0x0F,0x6F,0x6F,0x6F,0x60,0x60,0x68,0x68,0x62,0x62,0x62,0x02,
+  0x02,0x02,0x02,0x42,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xCD,0xC9,0x8C,0x8D,0x09,0x6C,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6C,
+  0x0C,0x2D,0x6D,0x6D,0x0C,0x0C,0x6D,0x61,0x61,0x71,0x71,0x79,0x79,0x39,0x18,0x5A,
+  0x98,0xD9,0x98,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+  0x49,0x48,0x0C,0x4C,0x64,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x0C,
+  0x0C,0x6C,0x6E,0x6E,0x6C,0x6C,0x6E,0x6E,0x62,0x62,0x62,0x6A,0x6A,0x68,0x0A,0x08,
+  0x08,0x48,0x08,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x01,0x07,0x43,0x03,0x0E,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,
+  0x0F,0x6F,0x6F,0x6F,0x6F,0x0F,0x0F,0x61,0x60,0x68,0x68,0x62,0x62,0x62,0x02,0x02,
+  0x42,0x02,0x42,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,
+  0xD1,0xC1,0xCD,0x8F,0x0F,0x4D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,
+  0x0C,0x6C,0x6D,0x6D,0x6D,0x05,0x0D,0x01,0x79,0x71,0x79,0x79,0x18,0x18,0x5B,0x9B,
+  0x98,0x98,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,
+  0x48,0x41,0x4C,0x0C,0x0C,0x2E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,
+  0x6C,0x6C,0x6E,0x6E,0x6E,0x62,0x62,0x03,0x6A,0x62,0x6A,0x6A,0x68,0x0A,0x08,0x08,
+  0x08,0x08,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x40,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x0A,
+  0x02,0x02,0x0D,0x4F,0x0F,0x0F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,
+  0x0F,0x0F,0x6F,0x6F,0x6F,0x6E,0x02,0x62,0x62,0x6A,0x62,0x62,0x62,0x02,0x02,0x42,
+  0x42,0x42,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x08,0x08,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xD1,
+  0xC1,0xC1,0xCD,0xCD,0xCD,0x4E,0x2C,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,
+  0x6D,0x6D,0x0D,0x6D,0x6D,0x6D,0x61,0x11,0x71,0x79,0x79,0x18,0x18,0x5B,0x9B,0xD9,
+  0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD9,0xC1,0xD9,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x40,0x48,
+  0x40,0x40,0x4C,0x4C,0x4C,0x0C,0x6C,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,
+  0x6E,0x6E,0x0E,0x6E,0x6E,0x62,0x63,0x63,0x62,0x6A,0x6A,0x6A,0x08,0x08,0x08,0x48,
+  0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x48,0x49,0x48,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x08,0x08,0x02,
+  0x00,0x0D,0x0F,0x0F,0x0F,0x0F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,
+  0x6F,0x0F,0x6F,0x6F,0x6F,0x6D,0x62,0x68,0x68,0x62,0x62,0x62,0x02,0x02,0x42,0x02,
+  0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x08,0x02,0x02,0x02,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD9,0xD1,0xC1,
+  0xC1,0xCD,0xCD,0xCD,0x8C,0xCD,0x2C,0x6D,0x2D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,
+  0x6D,0x6D,0x6C,0x6D,0x6D,0x6D,0x6D,0x61,0x71,0x39,0x79,0x79,0x98,0x99,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xC9,0xC1,0xD1,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x48,0x48,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x0C,0x4C,0x4C,0x6E,0x0C,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,0x6E,
+  0x6E,0x6E,0x6C,0x0E,0x6E,0x6E,0x6E,0x63,0x62,0x08,0x6A,0x08,0x48,0x08,0x48,0x48,
+  0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x41,0x41,0x40,0x40,0x48,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x0A,0x00,0x00,0x01,
+  0x01,0x0F,0x0F,0x0F,0x4F,0x0F,0x0F,0x0F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,0x6F,
+  0x6F,0x6F,0x0F,0x6F,0x6F,0x6F,0x61,0x60,0x6A,0x62,0x02,0x02,0x02,0x42,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x08,0x0A,0x02,0x00,0x0A,0x02,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xD9,0xC9,0xC5,0xC9,
+  0xCD,0xCD,0xCD,0xCD,0xCD,0x8D,0xCC,0xCD,0x4F,0x0D,0x4C,0x0C,0x0C,0x4D,0x4D,0x4D,
+  0x4D,0x2C,0x6C,0x6C,0x0C,0x4D,0x45,0x6C,0x58,0x11,0x5B,0xD9,0x9B,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xC9,0xC9,0xCD,0xD9,0xD1,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x40,0x40,0x41,0x40,0x48,
+  0x40,0x4C,0x4C,0x4C,0x4C,0x0C,0x4C,0x0C,0x0C,0x6C,0x6C,0x6C,0x0E,0x2E,0x2E,0x2E,
+  0x2E,0x6C,0x6E,0x0E,0x6E,0x2E,0x2E,0x02,0x68,0x00,0x08,0x48,0x08,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x40,0x41,0x48,0x4C,0x48,0x40,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x0A,0x08,0x02,0x01,0x0C,0x06,
+  0x00,0x0F,0x0F,0x0F,0x0F,0x4F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x6F,0x6F,0x6F,0x6F,
+  0x6F,0x6F,0x0F,0x0F,0x6F,0x6F,0x6E,0x63,0x00,0x08,0x02,0x02,0x42,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x08,0x0A,0x00,0x04,0x02,0x00,0x08,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xD1,0xD1,0xC9,0xCD,0xC5,0xC1,0xC1,
+  0xC1,0xCD,0xCD,0xCD,0xCD,0xCD,0x8C,0x8D,0x8C,0x8D,0xCC,0xCD,0x4E,0x4E,0x4E,0x4E,
+  0x4E,0x4E,0x4E,0x4F,0x4E,0x4E,0x4E,0x4B,0xC0,0xD1,0x98,0x98,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xC9,0xC1,0xCD,0xC5,0xC1,0xD1,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x40,0x41,0x48,0x41,0x4C,0x4C,0x4C,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x0C,0x0C,0x0C,0x4C,0x4C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x04,0x41,0x41,0x08,0x08,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x48,0x48,0x48,0x40,0x41,0x41,0x40,0x4C,0x4C,0x41,0x41,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x02,0x08,0x08,0x08,0x00,0x00,0x03,0x0C,0x0F,0x03,
+  0x0C,0x0F,0x0F,0x0F,0x0F,0x0F,0x4F,0x4F,0x4F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,
+  0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0C,0x02,0x0A,0x42,0x42,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x02,0x02,0x08,0x0A,0x00,0x01,0x0D,0x0C,0x02,0x0A,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xD9,0xC5,0xCD,0xC9,0xCD,0xCD,0xCD,0xCD,
+  0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0x8C,0xCD,0x8C,0x8C,0x8C,0x80,0x80,
+  0x8C,0x80,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x80,0x90,0xD1,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xC9,0xC5,0xC5,0xCD,0xC5,0xC1,0xD9,0xD9,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x48,0x40,0x40,0x48,0x49,0x4C,0x44,0x4C,0x4C,0x4C,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x0C,0x4C,0x0C,0x0C,0x0C,0x00,0x0C,
+  0x00,0x00,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x08,0x40,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x48,0x48,0x40,0x40,0x41,0x40,0x4C,0x4C,0x40,0x41,0x41,0x48,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x02,0x08,0x08,0x00,0x02,0x01,0x0C,0x0F,0x0F,0x03,0x00,
+  0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x4F,0x0F,0x4F,0x4F,0x4F,0x4C,0x40,
+  0x41,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4D,0x40,0x40,0x0A,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x02,0x08,0x0A,0x00,0x00,0x0E,0x0F,0x0C,0x02,0x08,0x02,0x49,
+  0x92,0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xC1,0xC1,0xC5,0xCD,0xCD,0xCD,0xCD,0xC1,0xC1,
+  0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC1,0xC1,
+  0xD1,0xD1,0xC5,0xCD,0xCD,0xCD,0xCD,0xCD,0xC9,0xC9,0xD1,0xD9,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0xD9,0xD1,0xD1,0xC9,0xC1,0xC5,0xCD,0xCD,0xC1,0xC5,0xD9,0xD1,0x92,
+  0x03,0x48,0x48,0x48,0x48,0x40,0x40,0x40,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x40,0x40,
+  0x40,0x40,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x44,0x41,0x40,0x48,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x48,0x40,0x40,0x41,0x40,0x4C,0x4C,0x4C,0x4C,0x48,0x48,0x40,0x03,
+  0x49,0x02,0x02,0x02,0x02,0x0A,0x0A,0x02,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x03,
+  0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x00,
+  0x01,0x00,0x0E,0x0F,0x0F,0x0F,0x0F,0x0F,0x0E,0x00,0x08,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x08,0x0A,0x00,0x01,0x0E,0x0F,0x0F,0x0D,0x01,0x00,0x08,0x49,
+  0x92,0xD9,0xD9,0xD1,0xD1,0xC1,0xC9,0xC9,0xC5,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,
+  0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC1,0xC5,
+  0xC1,0xD1,0xC1,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC9,0xD1,0xD1,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0xD9,0xD1,0xC9,0xC5,0xC5,0xCD,0xCD,0xCD,0xCD,0xC9,0xC9,0xD1,0x92,
+  0x03,0x48,0x48,0x40,0x40,0x49,0x40,0x45,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x40,0x41,
+  0x5C,0x41,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x48,0x40,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x48,0x40,0x41,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x48,0x41,0x40,0x03,
+  0x49,0x02,0x02,0x08,0x0A,0x02,0x00,0x01,0x02,0x0D,0x0F,0x0F,0x0F,0x0F,0x03,0x01,
+  0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0C,0x00,0x03,
+  0x1F,0x1E,0x03,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x01,0x02,0x08,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x08,0x00,0x03,0x0E,0x0F,0x0F,0x0F,0x0F,0x07,0x00,0x0A,0x49,
+  0x92,0xD9,0xD1,0xD9,0xC1,0xC1,0xDD,0xD1,0xCD,0xCD,0xCD,0xCD,0xCD,0xC5,0xCD,0xCD,
+  0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC1,0xC5,
+  0xDD,0xD9,0xC1,0xC9,0xCD,0xCD,0xCD,0xCD,0xCD,0xC9,0xC9,0xD1,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD9,0xD1,0xD1,0xC5,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC9,0xC9,0xD1,0x92,
+  0x03,0x48,0x40,0x41,0x49,0x40,0x44,0x49,0x41,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x40,0x40,
+  0x5C,0x58,0x40,0x48,0x4C,0x4C,0x4C,0x4C,0x4C,0x44,0x41,0x40,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x48,0x41,0x48,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x48,0x41,0x40,0x03,
+  0x49,0x02,0x08,0x08,0x00,0x00,0x03,0x07,0x01,0x0F,0x0F,0x0F,0x0F,0x0E,0x03,0x0F,
+  0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0D,0x00,0x02,
+  0x03,0x06,0x00,0x06,0x0F,0x0F,0x0F,0x0F,0x0F,0x0E,0x00,0x08,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x0A,0x00,0x01,0x0D,0x0F,0x0F,0x0F,0x0F,0x0F,0x06,0x00,0x08,0x49,
+  0x92,0xD1,0xD9,0xC1,0xC1,0xD5,0xD9,0xD1,0xD5,0xCD,0xC1,0xCD,0xCD,0xC9,0xCD,0xCD,
+  0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC1,0xC5,
+  0xC1,0xC5,0xC1,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC5,0xC9,0xD1,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD9,0xD1,0xD1,0xC1,0xC5,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC9,0xD1,0x92,
+  0x03,0x40,0x48,0x49,0x45,0x4C,0x49,0x49,0x4C,0x4C,0x4C,0x4C,0x4C,0x48,0x40,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x40,0x40,
+  0x40,0x40,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x40,0x48,0x48,0x48,0x48,
+  0x48,0x48,0x40,0x40,0x40,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x41,0x40,0x03,
+  0x49,0x08,0x00,0x00,0x02,0x01,0x05,0x06,0x00,0x02,0x0C,0x0F,0x0F,0x06,0x03,0x0F,
+  0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0C,0x00,0x02,
+  0x00,0x02,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0C,0x00,0x08,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x08,0x08,0x00,0x0C,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x03,0x02,0x08,0x49,
+  0x92,0xD1,0xC1,0xC5,0xD1,0xDD,0xCD,0xCD,0xDD,0xC1,0xC1,0xC9,0xC1,0xC1,0xCD,0xCD,
+  0xCD,0xCD,0xC5,0xC1,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC5,0xC1,
+  0xD1,0xDD,0xC1,0xC9,0xCD,0xD5,0xCD,0xCD,0xCD,0xC9,0xC9,0xD1,0xD9,0xD9,0xD9,0xD9,
+  0xD9,0xD1,0xD1,0xC1,0xC5,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC9,0xD1,0x92,
+  0x03,0x40,0x40,0x40,0x48,0x44,0x45,0x45,0x44,0x40,0x40,0x4C,0x4C,0x41,0x40,0x4C,
+  0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x48,0x40,
+  0x48,0x44,0x40,0x4C,0x4C,0x4C,0x4D,0x4C,0x4C,0x44,0x41,0x40,0x48,0x48,0x48,0x48,
+  0x48,0x40,0x40,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x41,0x40,0x03,
+  0x49,0x08,0x02,0x01,0x04,0x03,0x00,0x02,0x03,0x01,0x00,0x00,0x02,0x02,0x00,0x0C,
+  0x0F,0x0F,0x0E,0x0D,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0C,0x01,0x00,
+  0x06,0x00,0x03,0x0D,0x0F,0x0F,0x0D,0x0F,0x0F,0x0F,0x00,0x08,0x02,0x02,0x02,0x02,
+  0x02,0x08,0x08,0x00,0x00,0x0C,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x03,0x02,0x08,0x49,
+  0xD1,0xD1,0xC1,0xC9,0xC1,0xC9,0xC9,0xC9,0xC9,0xC9,0xC1,0xD9,0xD9,0xD1,0xC1,0xCD,
+  0xCD,0xCD,0xCD,0xC1,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC1,
+  0xDD,0xC1,0xC1,0xCD,0xD1,0xC9,0xC1,0xD5,0xCD,0xC9,0xC1,0xD1,0xD9,0xD9,0xD9,0xD9,
+  0xD1,0xD1,0xC1,0xC9,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC9,0xD1,0xD1,
+  0x41,0x40,0x49,0x41,0x49,0x41,0x41,0x40,0x41,0x41,0x49,0x48,0x48,0x40,0x40,0x4C,
+  0x4C,0x4C,0x4C,0x40,0x40,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x40,0x40,
+  0x44,0x41,0x40,0x4D,0x55,0x4D,0x44,0x4C,0x4C,0x44,0x41,0x41,0x48,0x48,0x48,0x48,
+  0x40,0x40,0x40,0x44,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x4C,0x41,0x40,0x41,
+  0x09,0x08,0x02,0x02,0x00,0x02,0x02,0x02,0x02,0x02,0x00,0x00,0x00,0x08,0x02,0x01,
+  0x0F,0x0F,0x01,0x00,0x03,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,
+  0x02,0x00,0x0E,0x0F,0x0F,0x17,0x1D,0x0F,0x0F,0x0F,0x02,0x0A,0x02,0x02,0x02,0x02,
+  0x08,0x08,0x00,0x03,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x03,0x02,0x08,0x09,
+  0x92,0x9A,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x9A,0x92,0x92,0x9A,0x8E,
+  0x8E,0x8E,0x8E,0x8A,0x8E,0x82,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8A,
+  0x82,0x8A,0x8E,0x96,0x86,0x8E,0x96,0x92,0x8E,0x8E,0x82,0x92,0x92,0x9A,0x9A,0x92,
+  0x92,0x82,0x82,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8E,0x8A,0x92,0x92,
+  0x03,0x0A,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x0A,0x02,0x02,0x02,0x0E,
+  0x0E,0x02,0x02,0x16,0x13,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x06,
+  0x02,0x02,0x0F,0x17,0x07,0x06,0x06,0x17,0x0E,0x0E,0x0E,0x0A,0x02,0x0A,0x0A,0x02,
+  0x02,0x02,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x03,0x02,0x03,
+  0x49,0x42,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x42,0x48,0x4A,0x42,0x41,
+  0x4F,0x4F,0x40,0x42,0x40,0x40,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4E,
+  0x4C,0x4D,0x4F,0x4E,0x5C,0x5C,0x5C,0x4F,0x4F,0x4D,0x43,0x40,0x4A,0x42,0x42,0x48,
+  0x48,0x40,0x41,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x4F,0x43,0x42,0x48,0x49,
+};
+
+// 64x64, back buffer layout: 6144 bytes
+const uint8_t PROGMEM Doraemon_64x64_planes[] = {
+  0x07,0x0A,0x0B,0x0C,0xD5,0xD4,0xD7,0x56,0x56,0x1F,0x89,0x4A,0xC9,0x08,0x0B,0x0B,
+  0x08,0xC9,0x09,0x09,0x8B,0x28,0x2A,0x08,0xE8,0x28,0xC8,0xEA,0x08,0x08,0xE8,0xEB,
+  0x6A,0x6A,0x08,0x09,0xEA,0x69,0x2A,0x6D,0xEE,0x8D,0x1C,0x04,0x4D,0x8A,0x08,0xE8,
+  0x08,0x6A,0xEB,0x08,0xE8,0x6A,0x08,0xEB,0x08,0x08,0x0B,0xE9,0xCB,0xE8,0x08,0x28,
+  0x02,0x05,0x07,0x05,0x8C,0x8C,0x4C,0x4C,0x4C,0x84,0x85,0x45,0x45,0x85,0x85,0x85,
+  0x85,0x45,0x85,0x85,0x05,0x27,0x05,0x05,0x07,0xC7,0x07,0x05,0x05,0xE7,0xE7,0x07,
+  0x05,0xE5,0xE5,0x07,0x05,0x87,0xC5,0x85,0x05,0x07,0x04,0x0D,0xA5,0x65,0xE5,0x07,
+  0xE5,0xE5,0xE7,0x05,0x05,0x05,0xE5,0x07,0xE5,0xE5,0xE7,0x07,0x25,0xE5,0xE7,0x27,
+  0x1F,0x1D,0x1F,0x1E,0x1C,0xDD,0x9C,0x9C,0x9C,0xDE,0xDF,0x9F,0x9F,0xDF,0xDF,0xDF,
+  0xDF,0x9F,0xDF,0xDF,0x3F,0x3F,0x3F,0x3F,0xFD,0xFF,0xFF,0x1D,0x1F,0x1F,0x1F,0x1F,
+  0xFF,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0x1E,0x1E,0x1E,0x1E,0xFC,0xFE,0xFF,0xFD,0xFF,
+  0xFF,0xFF,0x1F,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,
+  0x00,0xF2,0xDF,0x7E,0x03,0x04,0xD9,0x51,0x07,0x09,0x08,0xCF,0x1C,0x96,0x56,0x96,
+  0x14,0x17,0xDD,0xC8,0x09,0x08,0x2A,0x28,0xCB,0xE8,0x08,0x2B,0x08,0xE9,0x6A,0xE8,
+  0x2B,0xEB,0xD6,0xF7,0x6D,0xEA,0xA9,0x0B,0x18,0x1C,0x18,0x1B,0x66,0xEF,0x0F,0xE8,
+  0xE8,0x2B,0xE8,0x08,0x08,0xE8,0xE8,0x8A,0x08,0x2B,0xEB,0x0B,0x2B,0x0B,0x28,0x89,
+  0x01,0x00,0x20,0x41,0x9C,0x9D,0x58,0xD1,0x80,0x85,0x85,0x47,0x86,0x0C,0x4C,0x0C,
+  0x8C,0x8C,0x44,0x45,0x87,0x27,0x27,0x25,0x25,0xE5,0xE7,0x05,0x05,0xE7,0xE5,0xE7,
+  0xE5,0xE7,0xEE,0xEC,0x85,0x05,0x05,0x06,0x18,0x1C,0x1B,0x1A,0xE0,0x07,0xE7,0xE5,
+  0x05,0xE5,0x05,0x05,0x05,0xE7,0xE5,0x65,0xE5,0xE5,0x07,0x07,0xE5,0xE7,0x27,0x07,
+  0xE0,0xE3,0x00,0x83,0xC1,0xC2,0x86,0x8D,0xDF,0xDC,0xDF,0x9E,0xDE,0xDC,0x9C,0xDC,
+  0xDC,0xDC,0x9E,0x9F,0x3F,0x3F,0x3F,0x3F,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0xFF,0xFD,
+  0xFD,0x1F,0x1C,0x1C,0x1E,0x1F,0x1F,0x1C,0x06,0x01,0x06,0xE6,0xFE,0xFE,0xFE,0xFF,
+  0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x1F,
+  0xFB,0x27,0x63,0x1C,0x5E,0x11,0x03,0x00,0x00,0xC1,0x00,0x1F,0x1C,0xC1,0xCC,0xD9,
+  0xD5,0x86,0x09,0x4B,0x2E,0x94,0x36,0x34,0xF7,0xF7,0x1C,0xCF,0x08,0x08,0x0A,0x04,
+  0x17,0x69,0x58,0x50,0xEA,0x07,0x00,0x00,0x0C,0x0C,0x8E,0x2F,0xED,0x3F,0xEB,0x0C,
+  0x0B,0xE8,0xE8,0xEB,0x08,0x2B,0xEB,0xE8,0xE8,0x8A,0xEB,0xEB,0x08,0x89,0x89,0x08,
+  0xFA,0x1F,0x9C,0x83,0x40,0x80,0x81,0x81,0x81,0x41,0x81,0x80,0x81,0x5E,0x5D,0x58,
+  0x51,0x00,0x84,0x87,0x05,0x2E,0x0E,0x2E,0x0C,0xEE,0xE4,0xC5,0x07,0x05,0x07,0xED,
+  0xEC,0x85,0x9B,0x93,0x05,0x02,0x1D,0x1F,0xF0,0xF2,0x70,0xF0,0xF2,0xFC,0x07,0xE7,
+  0xE7,0xE7,0xE5,0x07,0x05,0x05,0x07,0x05,0xE5,0x65,0x07,0xE7,0xE5,0xE5,0x07,0x05,
+  0xE4,0xE2,0x01,0xC3,0x80,0xC3,0xC2,0xC0,0xC0,0x82,0xC3,0xC0,0xC3,0x81,0x81,0x86,
+  0x8C,0xDF,0xDC,0x1F,0x3E,0x3C,0x3C,0x1D,0xFC,0xFC,0xFE,0x3E,0x1F,0x1F,0xFF,0xFC,
+  0x1D,0x1F,0x07,0x0D,0x1F,0x1E,0x01,0x00,0x03,0x03,0xE3,0xE2,0xE3,0xE3,0xFC,0xFE,
+  0xFF,0xFD,0xFF,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,
+  0xF7,0x95,0x17,0x17,0xCC,0xC9,0x0B,0xD7,0x9A,0x1C,0xC7,0x08,0xDC,0x1F,0x13,0x82,
+  0x00,0xC1,0x03,0xF0,0x1E,0x3A,0x26,0xBF,0xD8,0x76,0x8A,0xEB,0x08,0x08,0x0A,0x71,
+  0x75,0x79,0x8D,0x66,0x00,0x00,0x0C,0x04,0xE3,0xE3,0x23,0x62,0x03,0x0C,0x03,0x04,
+  0x08,0x96,0xF4,0x0B,0x08,0xE8,0x08,0x0B,0x8A,0xE8,0x08,0x0B,0xEB,0xC8,0x08,0x08,
+  0xEE,0xED,0x4C,0x8C,0x45,0x45,0x85,0x51,0x18,0x9C,0x5E,0x94,0x41,0x80,0x80,0x01,
+  0x81,0x41,0x81,0x40,0x21,0x07,0x1F,0x1C,0xF8,0xF1,0x64,0xE7,0x06,0x05,0x05,0x91,
+  0x91,0x99,0x12,0x18,0x1D,0x1D,0x10,0x18,0xFE,0xFE,0xFC,0x1C,0x1E,0xF0,0xFE,0xFF,
+  0xE5,0x6C,0xEC,0x07,0x05,0xE7,0xE5,0xE7,0x65,0x05,0xE7,0xE5,0x05,0x07,0x05,0x05,
+  0x1D,0x1D,0x9D,0xDD,0x9E,0x9F,0xDC,0x8C,0xC6,0xC1,0x82,0xC2,0x83,0xC0,0xC3,0xC0,
+  0xC0,0x82,0xC2,0x83,0x23,0x22,0x22,0x21,0xE7,0xEE,0xFC,0xFC,0xFF,0x1F,0x1D,0x0D,
+  0x0E,0x06,0x02,0x01,0x03,0x00,0x03,0xE1,0xE0,0xE0,0xE0,0xE0,0xE0,0xE3,0xE0,0xE2,
+  0xFF,0xFD,0xFC,0xFF,0x1D,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,
+  0xCB,0xCB,0x0A,0xCB,0xC8,0xCB,0xCD,0x56,0x17,0x16,0x14,0xD7,0x14,0x0B,0xC8,0xCB,
+  0x17,0xDB,0x0D,0xE3,0x98,0x3E,0x1E,0xC2,0x22,0xC0,0x13,0x1F,0x1C,0x1C,0x10,0x03,
+  0xC2,0x1B,0x1C,0x1C,0xFC,0xFC,0x00,0xE3,0xF8,0x1B,0x10,0xE3,0xE3,0xC3,0xE7,0x0D,
+  0xFF,0x1B,0xEF,0x75,0x14,0x08,0xE9,0xEB,0xE8,0xCB,0x0A,0xCA,0x69,0x08,0x08,0x2B,
+  0x25,0x45,0x85,0x45,0x85,0x45,0x45,0x4C,0x8C,0x8C,0x8D,0x4C,0x8C,0x85,0x47,0x44,
+  0x91,0x58,0x9D,0x5C,0x27,0x03,0x20,0x23,0xE3,0xE3,0xE2,0xE2,0xE0,0xE0,0x00,0x03,
+  0x03,0x02,0x03,0x01,0xE3,0xE1,0x1E,0xFE,0x07,0xE7,0xED,0x1F,0x1F,0x3D,0x1B,0xF2,
+  0x1E,0xFB,0xFF,0x73,0x0C,0x05,0x07,0xE7,0x07,0x25,0x05,0x07,0x85,0x05,0x05,0x05,
+  0x1F,0x9F,0xDF,0x9F,0xDF,0x9F,0x9E,0x9C,0xDD,0xDD,0xDD,0x9D,0xDC,0xDF,0x9D,0x9C,
+  0xCC,0x86,0xC0,0x81,0x22,0x21,0x20,0x23,0xE0,0xE0,0xE3,0xE0,0xE0,0x00,0x03,0x00,
+  0x02,0x01,0x02,0x03,0x02,0x03,0xE0,0xE0,0xE2,0xE2,0xE0,0xE0,0xE0,0xE0,0xE1,0xE3,
+  0xE0,0xE6,0xE0,0x8C,0x1F,0x1F,0xFD,0xFF,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0x1F,0x1F,
+  0x4B,0xCB,0x0B,0xC8,0x0B,0x0B,0xC9,0x4A,0x0A,0x08,0x09,0x0B,0xC9,0xC8,0xCF,0x1C,
+  0x17,0x96,0x56,0x96,0xB6,0x34,0x88,0x08,0xC6,0xF7,0xED,0x8A,0xFC,0x71,0x02,0x00,
+  0x00,0x03,0x20,0xC3,0xE1,0xE1,0xE1,0x00,0xF3,0x1C,0xE7,0xFC,0xFF,0x7E,0xDB,0x10,
+  0xFF,0xFF,0x1F,0x1F,0x0C,0x08,0x96,0x0C,0x0B,0x89,0x08,0x08,0x08,0x08,0x0B,0x8A,
+  0x65,0x45,0x85,0x47,0x85,0x85,0x45,0x45,0x85,0x85,0x85,0x85,0x45,0x45,0x47,0x84,
+  0x8C,0x0C,0x4C,0x0C,0xEC,0x0E,0x05,0x07,0x02,0xF1,0xFF,0x74,0x00,0x62,0x01,0x01,
+  0x01,0x02,0x00,0x20,0x02,0xE2,0xE2,0xE3,0x1A,0xFB,0x1B,0xE1,0xE2,0xE0,0x25,0xED,
+  0x03,0x03,0xE2,0xFE,0x00,0x05,0x6C,0xE5,0x07,0xE5,0x05,0x05,0x05,0x05,0x07,0x65,
+  0x9F,0x9F,0xDF,0x9F,0xDF,0xDF,0x9F,0x9F,0xDF,0xDF,0xDF,0xDF,0x9F,0x9F,0x9E,0xDE,
+  0xDD,0xDD,0x9D,0xDD,0x1D,0x3C,0x3F,0x3C,0x3F,0xEC,0xE1,0xE2,0xE0,0x82,0x00,0x02,
+  0x00,0x00,0x00,0x00,0xE0,0xE0,0xE0,0xE3,0xE3,0xE0,0xE0,0xE2,0xE1,0xE3,0xE2,0xE0,
+  0xE3,0xE3,0xE0,0x00,0x1D,0x1F,0xFC,0xFE,0xFF,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0xFF,
+  0xCB,0xCB,0xC8,0x48,0x09,0x0B,0xC8,0x8A,0x4A,0x8A,0x8A,0x0B,0xC9,0xCB,0x08,0x8A,
+  0x08,0xC9,0xCB,0xC8,0x29,0x08,0x88,0x2C,0x55,0xC8,0xFC,0x00,0xE0,0x20,0x02,0x18,
+  0x18,0x07,0xDC,0x12,0x79,0x0A,0x11,0x33,0xF1,0xF9,0x7A,0xE8,0x10,0xF3,0x33,0xF1,
+  0x10,0xFB,0x66,0x0C,0x00,0x07,0xEF,0x8B,0x2A,0x95,0x14,0x14,0x14,0x1F,0xFD,0xFB,
+  0x45,0x45,0x85,0x45,0x45,0x85,0x85,0x05,0x45,0x05,0x07,0x85,0x47,0x45,0x85,0x05,
+  0x85,0x45,0x45,0x85,0x47,0x25,0x25,0x05,0xAF,0xE7,0xFE,0xFD,0xFF,0x3F,0x1C,0x05,
+  0x07,0x1A,0x03,0xF8,0x88,0x09,0xFA,0xF9,0xF2,0xEA,0xF1,0xF1,0xE0,0x02,0xE0,0x02,
+  0xE0,0xE3,0xF9,0x03,0x01,0x1E,0xE7,0xE5,0xC7,0x0C,0x0C,0x0E,0x0C,0xE6,0x06,0xE6,
+  0x9F,0x9F,0xDF,0x9F,0x9F,0xDF,0xDF,0xDF,0x9F,0xDF,0xDF,0xDF,0x9F,0x9F,0xDF,0xDF,
+  0xDF,0x9F,0x9F,0xDF,0x9F,0x3F,0x3F,0x3E,0x1F,0xFD,0xE1,0xE3,0xE3,0xC0,0x00,0x02,
+  0x02,0x01,0x03,0x01,0x10,0xF0,0xE0,0xE2,0xFA,0xF0,0xE2,0xE0,0xE0,0xE0,0xE0,0xE0,
+  0xE0,0xE0,0xE0,0xE0,0x02,0x02,0x1E,0x1F,0x1F,0x1D,0x1D,0x1C,0x1C,0x1E,0xFE,0xFF,
+  0x0B,0xCB,0x08,0x0B,0xCB,0x89,0xC9,0x08,0x08,0xC9,0xCB,0x8A,0x89,0x08,0xC9,0xCB,
+  0x08,0x0B,0x08,0x0B,0x6A,0x28,0x0A,0x14,0x74,0x20,0xEC,0x03,0xE0,0x00,0x18,0xE4,
+  0x27,0x14,0x03,0xD8,0x99,0xE2,0x69,0xE3,0xF0,0x1B,0xB1,0xC3,0xF5,0x18,0x0C,0x2B,
+  0xE8,0x85,0xFB,0xF3,0xE2,0xE0,0x3C,0x12,0xDC,0x0C,0x18,0x37,0x05,0x2B,0xE8,0x6E,
+  0x85,0x45,0x85,0x85,0x45,0x85,0x45,0x85,0x85,0x45,0x47,0x05,0x85,0x87,0x45,0x45,
+  0x85,0x85,0x85,0x85,0x65,0x27,0x25,0x2C,0x71,0xDF,0x10,0xFE,0xFC,0x1C,0x05,0x19,
+  0x19,0x19,0x0A,0x0A,0x12,0x11,0x73,0xF1,0x01,0x12,0x01,0x30,0x06,0xE3,0xEF,0xED,
+  0xED,0x0A,0x12,0x02,0x03,0x03,0xC2,0x00,0x02,0x1D,0x1A,0x11,0x02,0xE4,0xE5,0xE5,
+  0xDF,0x9F,0xDF,0xDF,0x9F,0xDF,0x9F,0xDF,0xDF,0x9F,0x9F,0xDF,0xDF,0xDF,0x9F,0x9F,
+  0xDF,0xDF,0xDF,0xDF,0x9F,0x3F,0x3D,0x3C,0xAE,0xE0,0xE3,0xE0,0xE0,0xE0,0x02,0x01,
+  0x03,0x02,0x13,0x13,0x18,0x1A,0x98,0x1A,0xF8,0xE2,0xE0,0xE2,0xFB,0xFC,0xF2,0xF3,
+  0xF3,0xF2,0xE2,0xE2,0x00,0x00,0x00,0x03,0x01,0x01,0x06,0x0C,0xFF,0xFC,0xFF,0xFE,
+  0x8A,0x0B,0xCB,0x08,0xCA,0xCB,0x8A,0x0A,0x08,0x08,0x0B,0x8A,0x08,0x08,0x4A,0xC8,
+  0x8A,0x08,0xC9,0xC8,0x09,0x88,0x0A,0x2E,0x1F,0x9D,0x20,0xE0,0x3B,0x1B,0x76,0x00,
+  0xFB,0x18,0x18,0x18,0x10,0x10,0x12,0xDA,0xC2,0xDA,0x54,0x3E,0xDC,0x9D,0x9D,0x1C,
+  0xFE,0xDE,0x58,0xDA,0xF3,0x1B,0x13,0x00,0x00,0x82,0xE0,0xE0,0xE3,0xE3,0x72,0x3F,
+  0x05,0x85,0x45,0x85,0x85,0x47,0x05,0x85,0x85,0x85,0x85,0x05,0x85,0x85,0x45,0x45,
+  0x05,0x85,0x45,0x45,0x87,0xC7,0x27,0x07,0x3C,0xC3,0xDE,0xFC,0xE4,0xE6,0x18,0x10,
+  0xEB,0x10,0xF2,0x11,0x1A,0x19,0x19,0x12,0x0A,0x13,0x9A,0xC2,0x1E,0xFF,0xFC,0xFD,
+  0x1D,0x1F,0x9F,0xF2,0x03,0x0A,0x1B,0x00,0x00,0x61,0x03,0x01,0xE3,0xE3,0xE0,0xE0,
+  0xDF,0xDF,0x9F,0xDF,0xDF,0x9F,0xDF,0xDF,0xDF,0xDF,0xDF,0xDF,0xDF,0xDF,0x9F,0x9F,
+  0xDF,0xDF,0x9F,0x9F,0xDF,0x3F,0x3F,0x3E,0x21,0x22,0xE0,0xE0,0xE2,0xE0,0xE2,0xF8,
+  0x12,0xE2,0x00,0x02,0x00,0x00,0x00,0x02,0x12,0x02,0x00,0x1C,0xFF,0x1F,0x1F,0xFF,
+  0xFF,0x1F,0x01,0x00,0x18,0x12,0x00,0x01,0x00,0x00,0x00,0xE0,0xE0,0xE2,0xE3,0xE3,
+  0x17,0xCF,0x8A,0x08,0x08,0x08,0xC9,0x0B,0x08,0xC9,0x0B,0xCB,0x8A,0x0A,0x0B,0x08,
+  0x8A,0x08,0x08,0xC9,0x0B,0x8A,0xAD,0x3E,0x24,0x03,0xFB,0xDF,0x1D,0x76,0xE0,0x81,
+  0xA0,0xDA,0x81,0xE0,0xE0,0x00,0xD1,0x00,0x00,0x12,0x1A,0x1F,0x85,0x81,0x8D,0xDE,
+  0x9D,0x02,0x00,0x10,0x18,0x00,0xE0,0xEC,0xF4,0xE8,0x08,0xF4,0xF9,0xEC,0x03,0x23,
+  0x8C,0x45,0x05,0x85,0x85,0x85,0x45,0x85,0x85,0x45,0x85,0x45,0x05,0x85,0x85,0x85,
+  0x05,0x85,0x85,0x47,0x85,0x05,0x07,0x1E,0x18,0x3E,0xE5,0x21,0xFB,0xF9,0x10,0xF1,
+  0xCA,0xF2,0xF0,0x11,0x10,0xF0,0x21,0x10,0x10,0x03,0x1F,0x1F,0x1F,0x1E,0x1F,0x1E,
+  0x01,0x1D,0x1E,0x00,0x08,0x10,0x12,0xEB,0xFA,0xF8,0xE4,0xF1,0xFA,0xFD,0xFE,0xFC,
+  0xDC,0x9E,0xDF,0xDF,0xDF,0xDF,0x9F,0xDF,0xDF,0x9F,0xDF,0x9F,0xDF,0xDF,0xDF,0xDF,
+  0xDF,0xDF,0xDF,0x9F,0xDD,0xDF,0x3E,0x23,0x21,0xE0,0xE2,0xE3,0xE0,0xE2,0xF8,0x1A,
+  0x12,0x02,0x02,0x02,0x02,0x02,0x00,0x02,0x02,0x00,0x01,0x1F,0x1E,0x1D,0x1C,0x1C,
+  0x1F,0x1F,0x1C,0x1F,0x13,0x18,0x19,0x13,0x03,0xE4,0xFC,0xEE,0xE6,0xE1,0xE3,0xE0,
+  0x08,0x0A,0xCD,0x96,0x14,0x17,0xD5,0xD7,0x14,0x0C,0x0B,0xCB,0xC9,0x08,0x0B,0x8A,
+  0x08,0x08,0x8A,0x08,0x4A,0xD5,0x7A,0x0E,0x24,0xF8,0x04,0x13,0x00,0x02,0x22,0x69,
+  0x89,0x8D,0x9B,0x71,0xD2,0xDA,0xF0,0xD7,0x23,0x00,0x1C,0x1C,0x00,0x00,0x04,0x00,
+  0x1C,0x00,0x1C,0xFF,0xE4,0xFB,0x49,0xF8,0xF0,0xF0,0x27,0xF4,0xF4,0xF4,0xF7,0xF7,
+  0x84,0x85,0x45,0x0C,0x8C,0x8C,0x4C,0x4C,0x8C,0x85,0x85,0x45,0x45,0x85,0x85,0x05,
+  0x85,0x85,0x07,0x85,0x45,0x4C,0x5A,0x32,0x38,0x06,0xF9,0xE1,0xF1,0x11,0xD2,0x89,
+  0x11,0x11,0x03,0x80,0x1F,0xFF,0x1D,0x38,0x10,0x00,0x1D,0x1C,0x1D,0x1D,0x1D,0x1C,
+  0x01,0x1F,0x1D,0x1F,0x19,0xEB,0x58,0xF1,0xE1,0xF1,0xED,0xED,0xED,0xEC,0x0E,0x0E,
+  0xDC,0xDF,0x9E,0xDC,0xDD,0xDD,0x9D,0x9D,0xDC,0xDE,0xDF,0x9F,0x9F,0xDF,0xDF,0xDF,
+  0xDF,0xDF,0xDF,0xDF,0x9F,0x9D,0x86,0x22,0x21,0x22,0xE1,0xF9,0xFA,0xFA,0x1A,0x11,
+  0x00,0x02,0x1D,0x1E,0x02,0x00,0xE2,0x00,0x02,0x00,0x00,0x1D,0x1F,0x1F,0x1E,0x1C,
+  0x1F,0x1F,0x1F,0x1F,0xFD,0x13,0xB2,0xFA,0xF8,0xED,0xFD,0xFF,0xFF,0xFD,0xFF,0xFD,
+  0xC1,0x00,0x1F,0x18,0xC3,0x0F,0x1B,0xD9,0xD4,0xC9,0x8A,0x1C,0x17,0xD5,0x96,0x96,
+  0xD7,0x96,0x8A,0x0B,0x04,0x44,0x01,0x0D,0x9B,0x35,0x38,0xF8,0xDA,0x58,0x93,0xEB,
+  0xF0,0xC8,0x9D,0xC2,0x7D,0xDE,0x9D,0x07,0xFF,0xE0,0x62,0x23,0xE1,0x0F,0xDF,0xE1,
+  0xE1,0x23,0x11,0x1F,0xFF,0xE0,0xF8,0xF8,0x92,0xA9,0x13,0x6A,0x0B,0xEB,0xC9,0x0B,
+  0x40,0x81,0x80,0x85,0x5C,0x9D,0x98,0x5A,0x51,0x45,0x05,0x84,0x8C,0x4C,0x0C,0x0E,
+  0x4C,0x0C,0x05,0x85,0x8D,0x40,0x9C,0x72,0xC5,0xBA,0xE8,0xEB,0xF2,0x8A,0x01,0xE9,
+  0x01,0xF2,0xFE,0xFE,0x9C,0x1F,0xFC,0x1F,0x02,0xE3,0xFD,0xFC,0xFF,0xFF,0x21,0x1F,
+  0x1E,0x1C,0x02,0xE2,0xFF,0xFB,0x09,0x08,0x70,0xE9,0xF3,0xE4,0xE6,0x07,0x25,0xE7,
+  0x80,0xC2,0xC0,0xC2,0x83,0xC1,0xC6,0x87,0x8F,0x9C,0xDF,0xDE,0xDC,0x9D,0xDD,0xDD,
+  0x9C,0xDC,0xDF,0xDF,0xDC,0x9F,0xC0,0x82,0x22,0x03,0x32,0xF2,0x18,0x12,0x18,0x10,
+  0xE0,0x00,0x1F,0x1D,0x1D,0x1F,0x1D,0xFE,0xFF,0x1F,0x1C,0x1C,0x1F,0x1C,0x1D,0x1F,
+  0xFF,0xFF,0xFF,0xFC,0xFF,0xFD,0xF3,0xF0,0xFA,0xF2,0xED,0xFD,0xFC,0xFF,0xFF,0xFF,
+  0x6E,0xC3,0x1C,0x00,0x82,0x42,0x00,0x00,0xC3,0xC3,0x52,0x5E,0x1B,0xC7,0xCF,0x1B,
+  0xD7,0x46,0xCB,0xCC,0x0C,0xC3,0x4E,0x01,0xDA,0xDD,0x80,0x59,0x61,0x40,0xF3,0x1B,
+  0xE9,0xFB,0xE7,0x03,0x00,0x0F,0xD0,0x61,0xFF,0xFD,0x3F,0x3F,0xE0,0x62,0xE7,0x0D,
+  0x2F,0x18,0x14,0xF3,0x00,0x9E,0xF0,0x03,0x1B,0xE3,0x13,0x0C,0xF8,0xF4,0xCA,0x29,
+  0x9F,0x5C,0x81,0x81,0x01,0x40,0x80,0x80,0x41,0x41,0x42,0x40,0x85,0x5C,0x5D,0x98,
+  0x51,0x40,0x45,0x45,0x85,0x5F,0x52,0x9C,0x84,0x59,0x11,0x6A,0x70,0x92,0xE3,0xF2,
+  0xF3,0xE3,0xFF,0xFF,0xFC,0xEE,0xFE,0x81,0xFE,0xFF,0xFD,0xE1,0xFE,0xFC,0xFF,0xFF,
+  0xE1,0xFD,0xF8,0x1E,0xFC,0x7D,0x1C,0xE2,0xF3,0x0B,0xFB,0xF3,0x1A,0xEE,0xE5,0xE5,
+  0xC0,0x81,0xC3,0xC3,0xC2,0x80,0xC0,0xC0,0x80,0x80,0x83,0x80,0xC2,0x82,0x81,0xC7,
+  0x8C,0x9F,0x9D,0x9E,0xDE,0x83,0x83,0xC0,0xC0,0x80,0x3A,0xB2,0x98,0x18,0x18,0xE2,
+  0xE3,0xFD,0xFE,0xFF,0xFC,0xF2,0x02,0x1E,0xFD,0xFF,0xFF,0xFF,0xFC,0xFD,0xFE,0xFC,
+  0xFC,0xE1,0xE0,0xE2,0xFC,0xFF,0xE2,0xE0,0xE2,0xF2,0xE0,0xE2,0xE6,0xFC,0xFF,0xFF,
+  0x97,0xD4,0xD7,0x1F,0x03,0xC3,0xC1,0x1C,0x03,0x4E,0x00,0x1F,0xD1,0x00,0x82,0x42,
+  0x82,0x03,0x82,0x52,0xDD,0x00,0x00,0xCC,0x4A,0x03,0x01,0x01,0x99,0x02,0x62,0x10,
+  0x9A,0x1F,0x0F,0xFF,0x0C,0x0C,0xEB,0x85,0xE6,0xEF,0x27,0x03,0xCF,0xE3,0xEC,0xE7,
+  0xEF,0x07,0xEF,0xE0,0x03,0xE0,0x23,0x9E,0x03,0xEB,0x31,0x62,0x72,0xAD,0x48,0x6B,
+  0x2E,0x4C,0x4D,0x9C,0x9D,0x5D,0x5C,0x81,0x9C,0x5D,0x9C,0x80,0x40,0x81,0x01,0x42,
+  0x00,0x80,0x03,0x40,0x40,0x81,0x81,0x41,0x48,0x50,0x50,0x53,0xEA,0x12,0xF0,0xE1,
+  0x7D,0xFF,0xFF,0xFE,0xEC,0xF1,0x12,0xFB,0xF8,0xFF,0xFD,0xFF,0x3D,0x1E,0xEC,0x07,
+  0x0E,0xFB,0x12,0x03,0xFE,0xFC,0xE1,0x62,0xE3,0x0E,0xE0,0xF3,0xFE,0xC5,0xA5,0x25,
+  0xDD,0x9D,0x9F,0xC3,0xC2,0x83,0x80,0xC2,0xC1,0x81,0xC0,0xC3,0x83,0xC2,0xC0,0x80,
+  0xC0,0xC0,0xC0,0x83,0x80,0xC3,0xC3,0x80,0x91,0x99,0x98,0x9A,0x13,0xF8,0xF8,0xE2,
+  0xE1,0xFF,0xFC,0xFD,0xF2,0xE2,0xE1,0x01,0x1D,0xFC,0xFE,0xFF,0xFC,0xFC,0xF3,0xF9,
+  0xF2,0xE0,0xE2,0xE2,0xE1,0xFF,0xFC,0xFD,0xFF,0xF1,0xE0,0xE2,0xE3,0xFF,0xDF,0xFF,
+  0x49,0x08,0xCD,0xC1,0x00,0x81,0x03,0x42,0x82,0x89,0x14,0x17,0x0C,0x08,0x08,0xD5,
+  0xD9,0x8E,0x03,0x18,0x43,0x00,0x03,0x08,0x43,0x03,0x19,0xC1,0x68,0xC3,0x1B,0x03,
+  0x04,0xFC,0x1D,0x00,0xE4,0x41,0x16,0xFF,0xFE,0x03,0x7E,0x1C,0x62,0xE0,0x0C,0xD3,
+  0x1F,0x3F,0xE3,0xE0,0x20,0xE3,0x07,0x3E,0xCD,0x25,0xBE,0xB4,0x87,0x5D,0xC7,0xD7,
+  0xC5,0x85,0x40,0x5D,0x9D,0x9D,0x9D,0x5F,0x1D,0x85,0x8D,0x8C,0x85,0x85,0x84,0x51,
+  0x58,0x1F,0x9C,0x85,0x41,0x81,0x80,0x91,0x53,0x90,0x89,0x50,0x49,0x30,0xEB,0x10,
+  0xE7,0xFC,0xFC,0xFC,0x19,0xA1,0xE0,0x03,0xE1,0x1E,0x1C,0xE0,0xFC,0xFC,0xF2,0x20,
+  0xE3,0xE0,0xE2,0xE0,0xFC,0xFE,0xFD,0xDF,0x3D,0xFD,0xFF,0xFA,0xC8,0xC4,0x4F,0x2C,
+  0x9F,0xDF,0x9D,0x83,0xC0,0xC3,0xC3,0x82,0xC3,0xDC,0xDF,0xDC,0xDE,0xDF,0xDC,0x8C,
+  0x86,0xC1,0xC3,0xC2,0x80,0xC0,0xC0,0xC2,0x98,0xD8,0xD2,0x98,0x92,0xF8,0xF2,0xE2,
+  0xF9,0xFD,0xFC,0xFC,0xE1,0xE3,0xE2,0xE0,0x00,0xFC,0xFF,0xFC,0xFF,0xFC,0xE2,0xE3,
+  0xE0,0xE0,0xE0,0xE0,0xE3,0xFF,0xFE,0xFF,0xFD,0xFE,0xC0,0xC1,0xF2,0x9E,0x9D,0xFD,
+  0x4A,0x49,0x00,0x00,0x00,0xC1,0xC3,0x00,0xCD,0x03,0x08,0x08,0x4A,0x4A,0x0F,0xD4,
+  0x17,0x14,0x1C,0x08,0x0C,0x1E,0xDD,0x18,0x18,0xD8,0x01,0x00,0x7B,0xF1,0x10,0xFB,
+  0xFF,0x23,0x1C,0x1B,0x1B,0xE0,0x00,0xE3,0x03,0x10,0x23,0xE0,0xFC,0x0F,0x1F,0xE3,
+  0x00,0xC0,0xE3,0xA2,0x02,0x39,0x3D,0x00,0x44,0xBE,0x02,0xD3,0x14,0x08,0x9C,0x96,
+  0xA5,0xC5,0x9D,0x9D,0x9D,0x5D,0x5D,0x9D,0x50,0x9D,0x85,0x85,0x45,0x45,0x85,0x8C,
+  0x8C,0x8C,0x8D,0x85,0x90,0x81,0x41,0x88,0x89,0x48,0x91,0x90,0xA8,0xE3,0xE1,0xF3,
+  0xFF,0xFD,0xFC,0x02,0xE3,0xE0,0xE2,0xE2,0xE2,0x1C,0xFD,0xFD,0x1C,0xFF,0xE3,0x02,
+  0xE0,0xE2,0x02,0x7C,0xFC,0xA5,0x9C,0x9C,0xBD,0xFC,0x81,0x5C,0x99,0x94,0x80,0x31,
+  0xDF,0x9C,0xC2,0xC0,0xC3,0x83,0x82,0xC2,0x83,0xC3,0xDF,0xDF,0x9F,0x9F,0xDE,0xDD,
+  0xDD,0xDD,0xDD,0xDF,0xC3,0xC3,0x83,0xD3,0xD2,0x92,0xDA,0xD9,0xD2,0xF8,0xF9,0xE2,
+  0xE0,0xFF,0xFD,0xFD,0xE1,0xE1,0xE1,0xE0,0xE0,0xE3,0xFF,0xFF,0xFC,0xFC,0xE3,0xE0,
+  0xE1,0xE1,0xE0,0xE3,0xFC,0xDE,0xDD,0xDF,0xDE,0xDF,0xDF,0x83,0xC2,0xD9,0xDF,0xCD,
+  0x37,0x64,0x25,0x02,0x02,0xC3,0xC0,0x82,0x07,0xC1,0xC9,0x0B,0xC9,0xCB,0xCB,0xC9,
+  0x0B,0x0B,0xCB,0xCD,0x1F,0x1B,0x10,0x5A,0xC3,0x1B,0xC3,0xDB,0x40,0xF9,0x10,0x00,
+  0x7E,0xFF,0x10,0x66,0x0D,0xE0,0xC3,0xFC,0xFF,0x03,0xE0,0x1F,0x03,0x1C,0x1C,0x81,
+  0xD8,0x21,0xFD,0xFE,0x03,0xC0,0xC3,0x10,0x12,0xCE,0x0D,0x86,0xDD,0x92,0x13,0x40,
+  0xEE,0xA2,0x9A,0x9D,0x9D,0x5D,0x5D,0x1D,0x98,0x5D,0x45,0x85,0x45,0x45,0x45,0x45,
+  0x85,0x85,0x44,0x5F,0x81,0x84,0x81,0x50,0x50,0x88,0x50,0x48,0xB3,0xEB,0xE3,0xE8,
+  0xE1,0x1E,0xED,0xE5,0xF0,0xE0,0x20,0x01,0xE3,0xE2,0x01,0x1E,0x1E,0xE3,0xE3,0xE3,
+  0xE2,0xE3,0x3E,0x1E,0x9E,0x5C,0x5D,0x8D,0x8D,0x4C,0x51,0x1B,0x5D,0x04,0x80,0x80,
+  0xFC,0xDE,0xC1,0xC2,0xC3,0x82,0x82,0xC2,0xC1,0x83,0x9F,0xDF,0x9F,0x9F,0x9F,0x9F,
+  0xDF,0xDF,0x9C,0x80,0xC3,0xC2,0xD9,0x98,0x98,0xD2,0x98,0x92,0xDA,0xF2,0xF8,0xF2,
+  0xFE,0xFC,0xFC,0xF9,0xE0,0xE1,0xE0,0xE2,0xE3,0xE0,0xFF,0xFC,0xFC,0xFF,0xE2,0xE2,
+  0xE0,0xE2,0xE2,0xFC,0xDC,0x9D,0x9F,0xDD,0xDD,0x93,0x82,0xC1,0x80,0xD9,0xC2,0x00,
+  0xBC,0xE4,0x25,0x46,0x42,0xC2,0x00,0xC0,0x04,0xC3,0x08,0x0A,0x0A,0x89,0xCB,0xC9,
+  0x8A,0x16,0xDB,0x59,0xC8,0xC5,0x1B,0xD3,0x42,0xC1,0xDB,0x1B,0xF2,0x7A,0xF0,0x03,
+  0xFB,0x1C,0xE4,0xEC,0x10,0x03,0x1F,0xFF,0xFF,0x81,0x81,0xE0,0xFF,0xEA,0x1B,0xBF,
+  0xF6,0x78,0x88,0x62,0xCF,0x1C,0x82,0xDD,0xD3,0x4E,0x10,0x0C,0xDF,0x06,0xC2,0x8E,
+  0x66,0x62,0xFA,0xBB,0xBD,0x9F,0x9D,0x5D,0x98,0x5D,0x85,0x85,0x85,0x85,0x45,0x45,
+  0x05,0x8C,0x58,0xC0,0x54,0x5B,0x8B,0x41,0x51,0x50,0x48,0x48,0x21,0xEA,0xE1,0xEB,
+  0x02,0xFC,0xFD,0x10,0xE0,0xE2,0xE3,0xFE,0xE3,0xE2,0x1F,0xFD,0xFE,0xEC,0xE3,0x65,
+  0x25,0x87,0x08,0x9D,0x5D,0x9C,0x1C,0x40,0x5C,0x50,0x9D,0x8C,0x5F,0x81,0x40,0x81,
+  0xFE,0xFF,0xE1,0xC3,0xC2,0xC2,0xC2,0x82,0xC1,0x83,0xDF,0xDF,0xDF,0xDD,0x9D,0x9F,
+  0xDD,0xDC,0x86,0x81,0x82,0x81,0xD2,0x98,0x9A,0x98,0x92,0x92,0xD8,0xF2,0xF8,0xF2,
+  0xFD,0xFF,0xFE,0xFF,0xE3,0xE0,0xE3,0xFC,0xFF,0xE0,0xE3,0xFF,0xFC,0xF3,0xE1,0xE1,
+  0xE3,0x20,0xF6,0xDF,0x9C,0xDD,0xDF,0x9D,0x83,0x82,0xC2,0xD2,0x80,0xC2,0x80,0x61,
+  0xCB,0x08,0x7E,0xA8,0xA7,0xE2,0x07,0x85,0xC7,0xC0,0x0A,0x29,0x6B,0xC9,0x2B,0x08,
+  0x49,0x66,0x70,0x7F,0x24,0xC2,0x30,0x0B,0x1A,0x9B,0x9A,0xD8,0x63,0xDB,0xE3,0x0B,
+  0x10,0x10,0xE7,0x7D,0x1F,0x00,0xE3,0xFF,0xE8,0xC2,0xC1,0xDE,0xC2,0x1E,0xE3,0x85,
+  0x61,0x83,0xC4,0xC5,0x1D,0x4E,0x42,0x10,0x8E,0x11,0xCD,0xDC,0x81,0x21,0xA3,0x00,
+  0x25,0xE7,0xFE,0x94,0x9F,0x3F,0x99,0x99,0x98,0x9D,0x85,0x85,0xA7,0xA7,0x87,0x85,
+  0xC5,0x8F,0xB3,0xA0,0x9B,0x11,0xC3,0x89,0x88,0xCA,0x08,0x50,0x52,0xEB,0xF2,0xF3,
+  0xE1,0xED,0x1F,0x9E,0xE3,0xE0,0x1E,0x1F,0x14,0xA2,0xA0,0xBD,0xA3,0x61,0x63,0x26,
+  0x04,0xE5,0x40,0x40,0x9F,0x5D,0x43,0x9D,0x11,0x9C,0x4C,0x5F,0x80,0x80,0x20,0xE0,
+  0x1F,0x1F,0x01,0x63,0x60,0xC1,0xC3,0xC3,0xC0,0xC3,0xDF,0xDF,0xDD,0xDD,0xDD,0xDF,
+  0x9D,0xDC,0xCD,0xC0,0xC1,0xFA,0xF8,0xD1,0xD2,0x12,0xD3,0x98,0x98,0xF3,0xFB,0xE2,
+  0xE2,0xFC,0xFE,0xFC,0xE1,0xE0,0xE0,0xFF,0xFE,0x60,0x7C,0x7F,0x7E,0xE0,0xE5,0x65,
+  0x25,0x04,0x85,0x9C,0xDF,0x9D,0x9F,0xC2,0xC2,0xC2,0x92,0x83,0xC1,0xC1,0xDC,0xFC,
+  0x76,0x1F,0x00,0x00,0x10,0x14,0x95,0x95,0xD6,0x9E,0x17,0xAF,0xA8,0x8F,0x26,0x0E,
+  0xED,0xF4,0x7B,0xE5,0xEF,0xE3,0xE3,0x83,0x00,0x00,0x1B,0x0B,0xDB,0x5B,0xC3,0x10,
+  0xE8,0x00,0xFB,0xFC,0xE4,0x23,0x00,0x00,0x1E,0x02,0x5C,0x23,0x00,0x61,0x66,0xDB,
+  0xF3,0x46,0x83,0xCB,0xD9,0xDF,0x0C,0x46,0xD3,0xDD,0x1F,0xC3,0x80,0x3F,0xB9,0xB4,
+  0x0C,0x0F,0x04,0x05,0x04,0x00,0x01,0x01,0x04,0xDC,0x4C,0xC5,0x87,0xA5,0x2D,0x85,
+  0x87,0xEE,0xFB,0xE3,0xF2,0xF3,0xF3,0xD2,0x90,0x90,0x88,0x89,0x48,0x69,0x28,0xE2,
+  0xF1,0xFE,0x07,0xFC,0xE1,0xE0,0xE0,0xE0,0xFC,0xE2,0x3D,0x1F,0x7F,0x02,0x63,0x3B,
+  0x7A,0x23,0x45,0x54,0x44,0x5D,0x90,0x5B,0x5E,0x5D,0x41,0x40,0x80,0x9E,0x62,0x7A,
+  0x1C,0x1C,0x1D,0x05,0x04,0x07,0x07,0x07,0x03,0x02,0x9C,0x1E,0x7F,0x7E,0xDC,0xDE,
+  0xDE,0xFF,0xE6,0xE2,0xE3,0xF8,0xFA,0xF8,0xD8,0xD8,0xD3,0xD0,0x92,0x92,0xF2,0xE0,
+  0xE1,0xFC,0xFE,0xFC,0xFE,0xE0,0xE0,0xFC,0xE0,0x60,0x63,0x7F,0x01,0x04,0x04,0x65,
+  0x67,0xC5,0x85,0x87,0x9E,0x82,0xC2,0x81,0x82,0x80,0x83,0x80,0xC0,0xC0,0xFD,0xE3,
+  0xA4,0x6B,0x58,0xA3,0xB0,0x43,0x83,0xB2,0x47,0x4C,0x35,0x08,0x08,0x18,0x1A,0xDE,
+  0x85,0xC9,0x0D,0x3B,0xCB,0x21,0x72,0x92,0x01,0x1A,0x00,0xC9,0xC9,0x91,0x32,0x7A,
+  0xE3,0x00,0xFF,0xFF,0xE4,0x00,0x03,0xE2,0x63,0x3D,0xDC,0x80,0x0D,0x23,0xFC,0x8E,
+  0xB9,0x3A,0x47,0x04,0xD3,0x85,0x02,0x59,0x45,0x10,0x00,0x41,0x3D,0xCD,0xA4,0xAC,
+  0x60,0x25,0x3C,0x87,0x84,0xC7,0x45,0x64,0x22,0x30,0x0E,0x07,0x04,0x18,0x18,0x1C,
+  0x1F,0x24,0xFF,0xE0,0xC8,0x11,0x03,0x63,0xB3,0x88,0x8A,0x53,0x52,0x41,0x20,0xFD,
+  0x1E,0xFC,0xFE,0x1E,0x1D,0xE0,0xE0,0x00,0xE2,0xE3,0x21,0x1F,0x14,0x04,0x03,0x7B,
+  0x7D,0x7D,0x80,0x81,0x41,0x59,0x9D,0xDD,0xD8,0x80,0x80,0xC1,0x80,0x30,0x79,0x70,
+  0xFE,0xFC,0xE5,0x64,0x65,0x24,0x24,0x05,0x05,0x07,0x1C,0x1C,0x1C,0x07,0x06,0x01,
+  0x02,0x1C,0x01,0x01,0x31,0xF8,0xF8,0xF8,0xDA,0xD3,0xD2,0x80,0x80,0x80,0xC0,0xE1,
+  0xFD,0xFD,0xFC,0xFD,0xFE,0xFC,0xE0,0xE0,0xE0,0x63,0x7F,0x7E,0x02,0x05,0x04,0x7C,
+  0x7E,0xE5,0xE5,0xC5,0x86,0x80,0xC0,0x81,0x81,0xC3,0xC1,0x83,0xC0,0xE2,0xE0,0xE0,
+  0xA0,0xA4,0xB6,0xB7,0xB7,0xB3,0xA7,0xB3,0xB4,0xA4,0x6B,0x40,0xA3,0xAC,0x5E,0x9F,
+  0xBC,0xE0,0x3B,0x10,0x10,0x00,0x18,0x18,0x1A,0x40,0xC3,0x8A,0x9A,0x0F,0x9E,0x02,
+  0x00,0xF0,0xFD,0xE1,0xFF,0xE4,0xE0,0x1F,0xA2,0xB9,0xBC,0xA7,0xF6,0x20,0x59,0xAA,
+  0x3F,0x3E,0xA0,0x86,0xF5,0x74,0x71,0x60,0x83,0x00,0x7C,0x8E,0xCF,0x32,0xB4,0xA0,
+  0x60,0x65,0x64,0x62,0x62,0x66,0x63,0x66,0x66,0x65,0x39,0x3D,0x9E,0x90,0xC3,0x41,
+  0x61,0x1E,0x05,0x19,0x10,0x10,0x09,0x08,0x09,0x90,0x48,0x10,0x12,0x91,0x1D,0xDE,
+  0xFE,0xED,0xFF,0xFF,0xFE,0xFF,0xFF,0xE3,0x5E,0x05,0x7D,0x18,0x07,0xE4,0xA5,0x1D,
+  0xFD,0x7F,0x62,0x60,0x1A,0xBA,0xBD,0xBD,0x23,0x82,0xA0,0x70,0x30,0x62,0x60,0x60,
+  0xE0,0xE0,0xE5,0xE4,0xE5,0xE5,0xE4,0xE5,0xE5,0xE4,0xE4,0xE2,0x60,0x63,0x22,0x22,
+  0x00,0x00,0x03,0x03,0x1A,0x1B,0x13,0x13,0x13,0x18,0x92,0xC0,0xC3,0xC3,0xC0,0xFC,
+  0xFD,0xFC,0xFF,0xFF,0xFC,0xFE,0xE3,0xE3,0xE0,0x7E,0x7F,0x7F,0x02,0x04,0x04,0x7D,
+  0x7E,0xE6,0xE5,0xE5,0xE7,0xC2,0xC2,0xC3,0xC3,0xC0,0xC0,0xE3,0xE2,0xE3,0xE2,0xE1,
+  0x4F,0x43,0x43,0xD1,0x57,0x53,0x57,0xE5,0xB4,0xA0,0xA0,0xA2,0xA3,0xA3,0xB3,0xBF,
+  0xBF,0xB8,0xA4,0x6B,0x40,0xAB,0xA0,0x43,0xBB,0xF9,0x0B,0xD0,0x84,0x07,0xD9,0x86,
+  0x21,0x9C,0x5C,0x65,0xEE,0x5D,0x1F,0x87,0x41,0xDF,0xFB,0xC6,0xB7,0xC7,0x25,0x82,
+  0xFC,0x25,0xA7,0xA1,0xA8,0x26,0x32,0x22,0xA0,0xB2,0xBC,0x22,0xA0,0xC1,0xA0,0xA0,
+  0x3F,0x23,0x27,0x26,0x22,0x26,0x22,0x21,0x64,0x65,0x60,0x62,0x63,0x63,0x62,0x62,
+  0x62,0x62,0x63,0x28,0x30,0x8B,0x90,0xD0,0x6A,0x32,0xEB,0x40,0x99,0x85,0x5D,0x1B,
+  0x9F,0x3D,0xA2,0xBD,0x3D,0x9C,0xFD,0xDF,0xDD,0x21,0x67,0x38,0x64,0x20,0xE1,0x7F,
+  0x7B,0xE3,0x63,0x66,0x6E,0x67,0x62,0x62,0x62,0x60,0x61,0x63,0x63,0x22,0x60,0x61,
+  0xE0,0xE4,0xE4,0xE6,0xE6,0xE6,0xE5,0xE5,0xE5,0xE4,0xE0,0xE0,0xE0,0xE3,0xE3,0xE0,
+  0xE0,0xE1,0xE2,0xF1,0xF8,0x71,0x78,0x38,0x12,0x18,0x10,0x80,0xC0,0xD9,0x81,0xC1,
+  0xC0,0xC3,0xDF,0xDE,0xDC,0xFD,0xFF,0xFE,0x9F,0x7F,0x7E,0x7F,0x01,0x05,0x05,0x64,
+  0xE6,0xE4,0xE4,0xE4,0xF6,0xFB,0xE3,0xE1,0xE1,0xE3,0xE0,0xE3,0xE3,0xE3,0xE0,0xE3,
+  0x57,0xC1,0xDD,0x53,0x5B,0xD9,0xD5,0xC1,0xC1,0xD5,0xD5,0xE1,0xC1,0xE1,0xE1,0xA0,
+  0xA0,0xA0,0xA0,0xB2,0xBB,0xA3,0xBB,0x39,0xB3,0xBB,0x73,0xD3,0xF2,0xD2,0xC7,0x07,
+  0x06,0x0F,0x41,0xC3,0xC2,0xDF,0x04,0xDF,0xCF,0xE6,0x5D,0xC9,0x71,0x00,0xE4,0x64,
+  0x86,0x31,0x42,0xC1,0xA7,0xA7,0xA3,0x60,0xE2,0xE2,0xA3,0xA3,0xA0,0xA0,0xB4,0xB4,
+  0x2F,0x3F,0x22,0x26,0x27,0x27,0x26,0x23,0x23,0x22,0x22,0x21,0x22,0x20,0x20,0x60,
+  0x60,0x60,0x60,0x7B,0x72,0x72,0x6B,0xEA,0x63,0x6A,0x3B,0x03,0x3D,0x5C,0x59,0x99,
+  0x99,0x50,0xDD,0x41,0x5C,0x5D,0x9D,0x41,0x5D,0xDD,0x5E,0x3D,0x13,0x05,0x07,0x81,
+  0x82,0x06,0x25,0x27,0x7E,0x7A,0x62,0xE2,0x63,0x63,0x63,0x62,0x62,0x61,0x60,0x60,
+  0xFF,0xE7,0xE5,0xE6,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE2,0xE0,0xE0,0xE0,0xE0,0xE0,
+  0xE0,0xE0,0xE0,0xE2,0xF8,0xF8,0xF2,0xF2,0xF9,0xF0,0xE0,0xE2,0xC2,0x82,0x81,0xC1,
+  0xC1,0x82,0x80,0x9F,0x9D,0x9F,0xDE,0x9F,0x9C,0x1E,0x3C,0x7D,0x0D,0x04,0x64,0x64,
+  0x64,0xE5,0xE4,0xE4,0xFF,0xFF,0xE0,0xE1,0xE3,0xE3,0xE3,0xE1,0xE1,0xE3,0xE2,0xE2,
+  0x4B,0x4F,0xD1,0xC1,0xD1,0xC5,0xC1,0xE1,0xE5,0xC1,0xD9,0xE5,0xFD,0xF5,0xF9,0xE1,
+  0xF1,0xB0,0xF9,0xA8,0xA0,0xA0,0xA8,0xA8,0xA0,0xB8,0xB0,0x36,0x7B,0xE2,0x6E,0x12,
+  0x14,0x92,0xCD,0xDB,0x18,0xC7,0xDC,0x1F,0x1F,0xED,0x40,0x62,0x9B,0x80,0xE0,0x00,
+  0x14,0x14,0x14,0x0C,0xF8,0xFF,0x1C,0x62,0xC1,0x82,0x21,0x53,0xED,0xA3,0xB3,0xEE,
+  0x27,0x27,0x27,0x27,0x26,0x23,0x27,0x20,0x20,0x23,0x26,0x39,0x21,0x39,0x28,0x28,
+  0x39,0x78,0x21,0x69,0x71,0x70,0x69,0x69,0x71,0x70,0x60,0x7A,0x3D,0x3F,0x93,0x9C,
+  0x98,0x1C,0x50,0x41,0x9D,0x44,0x40,0x40,0x81,0x43,0xDE,0x9E,0x7E,0x66,0x67,0x05,
+  0x04,0x04,0x04,0x08,0x1C,0x1E,0xE3,0xE0,0xC0,0x82,0x02,0x20,0x30,0x7F,0x7F,0x72,
+  0xFF,0xFE,0xE7,0xE4,0xE4,0xE5,0xE0,0xE1,0xE1,0xE4,0xE2,0xE1,0xE3,0xE2,0xF2,0xF2,
+  0xE2,0xE0,0xE0,0xF0,0xFA,0xF8,0xF2,0xF1,0xFA,0xE2,0xE0,0xE0,0xE1,0xC0,0xC3,0xC2,
+  0xC1,0xC2,0x82,0x81,0xC1,0x99,0x9C,0x9C,0xDF,0x9C,0x3D,0x7D,0x1F,0x1C,0x05,0x04,
+  0x04,0x05,0x06,0x17,0x1F,0x1C,0x00,0x00,0x21,0x61,0xE0,0xE3,0xE2,0xE0,0xE2,0xE2,
+  0x4B,0xC9,0xD1,0xC1,0xE5,0x43,0xE1,0xE1,0xE1,0xD9,0xF5,0xF9,0xF1,0xF1,0xE1,0xB8,
+  0xF9,0xE1,0xB8,0xB8,0xB8,0xE9,0xF9,0xF9,0xB8,0xA0,0xFD,0x8C,0xA0,0x23,0xC3,0x21,
+  0xBE,0xDF,0xDD,0xDF,0x12,0x80,0x11,0x0D,0xC7,0xAD,0xA3,0xD1,0xBC,0xDD,0x5A,0x1D,
+  0xA7,0xC5,0x5A,0x25,0xC1,0xFC,0x03,0x00,0x00,0x1C,0x00,0x00,0x1E,0xEC,0xC3,0x1F,
+  0x27,0x27,0x26,0x26,0x21,0x27,0x21,0x20,0x20,0x27,0x38,0x28,0x21,0x21,0x31,0x70,
+  0x31,0x30,0x68,0x69,0x69,0x29,0x28,0x28,0x68,0x68,0x3D,0x63,0x61,0x62,0x21,0x9E,
+  0x00,0x42,0x43,0x40,0x80,0x81,0x82,0xB0,0x1B,0x72,0x7F,0x2F,0x7C,0x3E,0x24,0x38,
+  0x87,0xC6,0xD8,0xF8,0x3C,0x1E,0x1F,0x00,0x00,0x01,0x1D,0x1D,0x01,0x10,0x3D,0xE3,
+  0xFF,0xFF,0xE5,0xE4,0xE5,0xE5,0xE4,0xE2,0xE1,0xE0,0xE2,0xF3,0xF8,0xF8,0xFB,0xF8,
+  0xF8,0xF9,0xF3,0xF2,0xF2,0xF1,0xF3,0xF2,0xF2,0xF2,0xE0,0xFC,0xE3,0xE0,0xE3,0xC0,
+  0xC0,0x80,0x80,0x80,0xC3,0xC0,0xC3,0xC2,0xE1,0xE3,0xE0,0xFC,0xFD,0xFC,0xFD,0xE4,
+  0x60,0x21,0x24,0x1F,0x1F,0x1D,0x03,0x00,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x00,
+  0xA8,0xA8,0xA8,0xF5,0xF9,0xE9,0xF5,0xC1,0xE1,0xE1,0xF9,0xE1,0xE1,0xF9,0xE1,0xE1,
+  0xF1,0xE9,0xB8,0xF9,0xB8,0xB0,0xA0,0xB8,0xB8,0xAC,0xBC,0xB8,0xBC,0xE1,0xA0,0xA0,
+  0xA0,0x82,0x20,0x41,0xC3,0x5C,0x86,0xA1,0xA0,0xBC,0xAC,0xBC,0xB0,0xBE,0xAB,0xAB,
+  0xB7,0x21,0xA3,0xBF,0xA3,0xA6,0xBC,0x53,0x40,0xBF,0xDD,0x42,0x21,0xC3,0xE0,0x03,
+  0x67,0x65,0x64,0x35,0x3C,0x30,0x21,0x26,0x20,0x28,0x31,0x31,0x30,0x28,0x28,0x30,
+  0x21,0x29,0x68,0x29,0x68,0x61,0x70,0x68,0x68,0x69,0x7C,0x65,0x60,0x20,0x60,0x62,
+  0x60,0x62,0xC2,0x80,0x02,0x80,0x61,0x62,0x63,0x61,0x6C,0x7C,0x6D,0x7E,0x7F,0x7F,
+  0x77,0xE2,0x63,0x63,0x7F,0x7F,0x61,0x22,0x20,0x83,0xC2,0xC1,0xE0,0x20,0x00,0x02,
+  0xFF,0xFF,0xFD,0xEC,0xE5,0xE5,0xE7,0xE0,0xE1,0xF2,0xFA,0xFA,0xF8,0xF2,0xF3,0xF8,
+  0xF8,0xF0,0xF0,0xF2,0xF2,0xF8,0xF8,0xF2,0xF2,0xF0,0xFF,0xFE,0xE3,0xE3,0xE0,0xE0,
+  0xE0,0xE0,0xE3,0xE1,0xE1,0xE1,0xE2,0xE0,0xE3,0xE0,0xF3,0xFD,0xFD,0xFC,0xFD,0xFC,
+  0xE8,0xE0,0xE2,0xFF,0xFF,0xFE,0xFC,0xE3,0xE0,0x61,0x20,0x21,0x00,0x00,0x00,0x01,
+  0x29,0x4B,0xA8,0xBF,0xB3,0xB3,0xA3,0xB7,0xBB,0xAA,0xB0,0xB8,0xE1,0xE1,0xE9,0xF1,
+  0xE1,0xF1,0xF9,0xE1,0xF9,0xA0,0xB0,0xB8,0xA0,0xAC,0xBC,0xE1,0xA0,0xBC,0xA0,0xA0,
+  0xB0,0x22,0xBC,0x3E,0xBC,0x3E,0xBC,0xA0,0xA0,0xA0,0xA0,0xA4,0xA4,0xAC,0xB8,0xBC,
+  0xBC,0xA0,0xA0,0xBC,0xB8,0xB8,0xBE,0xBF,0xA3,0xA3,0x78,0xA3,0xA7,0xA3,0xA0,0xBC,
+  0x07,0x27,0x65,0x6F,0x6E,0x6B,0x7B,0x7B,0x63,0x6A,0x63,0x69,0x31,0x30,0x29,0x21,
+  0x30,0x21,0x28,0x30,0x28,0x71,0x70,0x70,0x71,0x70,0x7C,0x3D,0x7D,0x60,0x60,0x60,
+  0x73,0x7F,0x62,0x62,0x62,0x63,0x62,0x60,0x60,0x60,0x7C,0x7D,0x7D,0x7D,0x65,0x7D,
+  0x60,0x60,0x60,0x61,0x65,0x65,0x7F,0x7E,0x63,0x62,0xFB,0x62,0x7F,0x7E,0x7F,0x7C,
+  0xFF,0xFF,0xFF,0xFD,0xFC,0xE1,0xE3,0xE2,0xE3,0xF0,0xF8,0xF2,0xFA,0xF8,0xF0,0xF8,
+  0xF8,0xF8,0xF2,0xF8,0xF3,0xFA,0xFA,0xF8,0xE2,0xE0,0xFC,0xFF,0xFF,0xFC,0xFC,0xFD,
+  0xEC,0xE3,0xE0,0xE0,0xE0,0xE3,0xE1,0xE0,0xE0,0xE1,0xE0,0xE2,0xFE,0xFC,0xFE,0xFF,
+  0xFC,0xE0,0xE0,0xFF,0xFE,0xFE,0xFF,0xE1,0xE3,0xE1,0xE6,0xFC,0xE2,0xE0,0xE3,0xE0,
+  0x08,0x0A,0xE8,0xEB,0x0C,0x2F,0xC5,0x9A,0x21,0x42,0x43,0xB8,0xBB,0xA3,0x21,0xBB,
+  0xBB,0xA3,0xA3,0xA0,0xA0,0xB8,0xA0,0xF9,0xA8,0xE1,0xBC,0xA0,0xAC,0xBC,0xB8,0xB8,
+  0xB0,0xBC,0xAC,0xA4,0xB0,0xBC,0xBC,0xBC,0xBC,0xB0,0xA0,0xA4,0xAC,0xB8,0xA0,0xA4,
+  0xA0,0xA0,0xA0,0xA0,0xB8,0xA0,0xBC,0xA4,0xA0,0xAC,0xA4,0xBC,0xBC,0xBC,0xA2,0xA2,
+  0x05,0x07,0x05,0x07,0xFF,0xE1,0xD9,0x92,0x11,0x30,0x32,0x68,0x6A,0x72,0xF3,0x6B,
+  0x6A,0x72,0x72,0x73,0x70,0x68,0x70,0x28,0x70,0x21,0x61,0x61,0x7D,0x61,0x7D,0x60,
+  0x60,0x7D,0x70,0x79,0x7C,0x61,0x61,0x61,0x61,0x60,0x61,0x7D,0x7D,0x65,0x7D,0x7D,
+  0x7D,0x7D,0x60,0x7D,0x65,0x7D,0x7D,0x7D,0x60,0x61,0x7D,0x7C,0x7C,0x7C,0x7C,0x7E,
+  0x1F,0x1D,0x1F,0x1C,0x00,0x01,0x21,0x78,0xFA,0xF8,0xF8,0xF2,0xF0,0xF8,0xFA,0xF3,
+  0xF2,0xF8,0xFA,0xFA,0xF8,0xF2,0xFA,0xF0,0xE1,0xFF,0xFF,0xFC,0xFC,0xFF,0xE1,0xFD,
+  0xFF,0xE2,0xE3,0xE1,0xE0,0xE0,0xE0,0xE3,0xE2,0xE3,0xE0,0xE2,0xFC,0xFE,0xFF,0xFE,
+  0xFF,0xE3,0xE0,0xE0,0xFE,0xFF,0xFF,0xFE,0xFC,0xFC,0xFE,0xFF,0xFD,0xFF,0xFF,0xFC,
+  0xD5,0x35,0x96,0xF0,0x23,0x04,0x00,0x00,0x18,0x00,0x03,0xF0,0xFB,0x08,0x7A,0xD1,
+  0x9A,0x21,0x52,0xD9,0xBB,0xBB,0xBB,0xF2,0xA7,0xBF,0xB3,0xAF,0xBA,0xB8,0xAC,0xA8,
+  0xB8,0xAC,0xAC,0xBC,0xBC,0xAC,0xAC,0xB8,0xBC,0xA0,0xB8,0xBC,0xA4,0xA0,0xB0,0xAC,
+  0xA0,0xA0,0xA0,0xBC,0xA0,0xA0,0xA0,0xA0,0xB8,0xBC,0xA0,0xA0,0xA4,0xA0,0xBC,0xA4,
+  0xCC,0xEE,0x6F,0x13,0x01,0x1A,0x10,0x10,0x09,0x11,0x12,0x01,0x0B,0xEB,0xE9,0xC1,
+  0x8A,0x10,0x21,0x2A,0x6B,0x6A,0x6A,0x7B,0x67,0x7F,0x62,0x73,0x7F,0x7D,0x71,0x70,
+  0x61,0x71,0x70,0x61,0x61,0x70,0x70,0x60,0x61,0x61,0x60,0x60,0x7D,0x7C,0x6D,0x61,
+  0x7D,0x7D,0x60,0x60,0x7D,0x7C,0x7C,0x61,0x65,0x7D,0x7C,0x7D,0x7D,0x7C,0x60,0x7D,
+  0x3D,0x1C,0x1F,0x0D,0x01,0x01,0x19,0x18,0x12,0x1A,0x18,0x18,0x12,0x10,0x12,0x38,
+  0x73,0xF8,0xF8,0xF2,0xF2,0xF2,0xF2,0xE0,0xF8,0xFF,0xFF,0xE2,0xE1,0xE1,0xE2,0xE3,
+  0xE1,0xE2,0xE2,0xE0,0xE2,0xE3,0xE2,0xE1,0xE0,0xE3,0xE1,0xFC,0xFE,0xFC,0xFC,0xFC,
+  0xFF,0xE3,0xE0,0xE1,0xFF,0xFF,0xFC,0xFF,0xFE,0xFF,0xFC,0xFF,0xFE,0xFD,0xFC,0xFE,
+  0xB3,0xA7,0xAE,0xB4,0xA0,0x5B,0x40,0xA3,0xA0,0x5A,0x39,0x82,0xF0,0x23,0x10,0x18,
+  0x00,0x00,0x18,0x03,0xE0,0x82,0x3B,0xF8,0xC3,0x9E,0x3D,0x4F,0xB4,0xA7,0xAF,0xF6,
+  0x70,0x7C,0xB3,0xA3,0xA0,0xBC,0xB4,0xA0,0xA0,0xA0,0xBC,0xBC,0xA4,0xBC,0xA0,0xBC,
+  0xA0,0xA4,0xA0,0xA0,0xBC,0xBC,0xBC,0xA0,0xBC,0xB8,0xAC,0xA4,0xB0,0xAC,0xA4,0xBC,
+  0x73,0x62,0x62,0x6F,0x79,0x2A,0x30,0x92,0x91,0xC9,0xEA,0x72,0x12,0x10,0x19,0x09,
+  0x11,0x10,0x08,0x12,0x11,0x70,0xF0,0xEA,0xC1,0x9F,0x02,0x31,0x78,0x7B,0x73,0x62,
+  0xE2,0xE3,0x62,0x62,0x60,0x60,0x60,0x60,0x60,0x61,0x60,0x7C,0x7D,0x7C,0x7C,0x61,
+  0x7C,0x61,0x61,0x61,0x7D,0x7D,0x61,0x7C,0x7D,0x65,0x7D,0x7D,0x6D,0x7D,0x7D,0x61,
+  0xED,0xFF,0xFD,0xE0,0xE1,0xF2,0xF8,0x7A,0x7A,0x32,0x10,0x1A,0x1A,0x18,0x03,0x12,
+  0x1A,0x18,0x12,0x18,0x1A,0x18,0x18,0x10,0x3F,0x7F,0xFC,0xE3,0xE0,0xE0,0xE3,0xE2,
+  0xE3,0xE0,0xE3,0xE0,0xE1,0xE1,0xE2,0xE1,0xE1,0xE3,0xE0,0xE3,0xFE,0xFD,0xFC,0xFF,
+  0xFD,0xFE,0xE3,0xE1,0xE1,0xFF,0xFF,0xFC,0xFF,0xFE,0xFC,0xFE,0xFC,0xFC,0xFE,0xFF,
+  0xC1,0xE1,0xE1,0xA0,0xB0,0xA0,0xAB,0xB3,0xA3,0xA3,0xBB,0xA3,0xB0,0xA0,0x5B,0x58,
+  0xA3,0xA8,0x5A,0x29,0x92,0xE4,0x11,0x08,0x02,0x1E,0x1F,0x1F,0xE0,0x82,0x01,0x62,
+  0xC1,0x82,0x3D,0x46,0xC5,0xBC,0xBC,0xBC,0xBC,0xBC,0xB8,0xAC,0xBC,0xA4,0xA0,0xA0,
+  0xBC,0xB0,0xBC,0xA0,0xA4,0xA0,0xBC,0xA0,0xB0,0xA0,0xBC,0xB8,0xB0,0xA0,0xA0,0xB8,
+  0x22,0x20,0x20,0x60,0x78,0x71,0x6B,0x63,0x72,0x72,0x6B,0x72,0x63,0x70,0x2B,0x29,
+  0x93,0x89,0xC8,0xEB,0x63,0x0A,0x1A,0x12,0x03,0x1E,0x03,0x03,0x01,0x61,0xE2,0xE2,
+  0xC1,0x9E,0x00,0x21,0x23,0x61,0x61,0x60,0x60,0x61,0x7C,0x7D,0x7C,0x7D,0x7C,0x7D,
+  0x7C,0x7C,0x61,0x60,0x7D,0x7D,0x60,0x7D,0x6D,0x7C,0x7C,0x65,0x6D,0x7C,0x7C,0x60,
+  0xE0,0xE0,0xE0,0xE0,0xE1,0xFA,0xF0,0xF8,0xF8,0xF8,0xF2,0xF8,0xF8,0xF8,0xF3,0xF2,
+  0x7A,0x71,0x32,0x10,0x19,0x10,0x00,0x00,0x1E,0x1C,0x1F,0x00,0x03,0x02,0x00,0x00,
+  0x23,0x60,0xE1,0xE2,0xE2,0xE2,0xE3,0xE0,0xE0,0xE0,0xE1,0xFC,0xFF,0xFE,0xFC,0xFF,
+  0xFF,0xFF,0xE0,0xE0,0xE2,0xFF,0xFF,0xFF,0xFC,0xFC,0xFD,0xFE,0xFC,0xFC,0xFD,0xFD,
+};
+
+#endif
@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""Convert images for RGBmatrixPanel::drawPackedBitmap() and drawPlanes().
+
+Reads uncompressed 24/32-bit .bmp files, or the uint16_t PROGMEM arrays of
+headers like bit_bmp.h (8-bit entries, low byte first), and writes a header
+of packed `const uint8_t PROGMEM` images:
+
+    pack_image.py -o pack_bmp.h bit_bmp.h
+    pack_image.py -o walk.h --size 64x64 walk1.bmp walk2.bmp
+
+Colors are first cut to what the panel shows (--planes bits per channel, 4
+on the Mega), so the packing loses nothing visible. With up to 256 colors
+left, pixels are palette indices; otherwise plain 5/6/5 words. Rows are
+run-length coded; see drawPackedBitmap() in RGBmatrixPanel.cpp for the
+layout.
+
+With --format planes, whole-screen images are written in RGBmatrixPanel's
+own back buffer layout instead, for drawPlanes(): larger than packed, but
+drawn by copying them.
+
+    pack_image.py -o planes_bmp.h --format planes bit_bmp.h
+
+With --format sprite, all the inputs become the frames of one SpriteSheet
+(Sprites.h): 5/6/5 words plus a mask that leaves out the --key color (by
+default the first frame's top-left pixel). --shrink N keeps every Nth
+pixel of every Nth row.
+
+    pack_image.py -o mascot.h --format sprite --name Pikachu_sprite --shrink 2 \
+        --select Pikachu bit_bmp.h
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+
+def read_bmp(path):
+    data = open(path, 'rb').read()
+    if data[:2] != b'BM':
+        sys.exit('%s: not a BMP file' % path)
+    offset, = struct.unpack_from('<I', data, 10)
+    width, height, _, bpp, compression = struct.unpack_from('<iiHHI', data, 18)
+    if bpp not in (24, 32) or compression not in (0, 3):
+        sys.exit('%s: only uncompressed 24/32-bit BMPs are read' % path)
+    step = bpp // 8
+    stride = (width * step + 3) & ~3
+    rows = []
+    for j in range(abs(height)):
+        # Bottom-up unless the height is negative
+        r = (abs(height) - 1 - j) if height > 0 else j
+        base = offset + r * stride
+        row = []
+        for i in range(width):
+            b, g, r8 = data[base + i * step:base + i * step + 3]
+            row.append(((r8 >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+        rows.append(row)
+    name = re.sub(r'\W', '_', os.path.splitext(os.path.basename(path))[0])
+    return [(name, width, abs(height), rows)]
+
+
+def read_header(path, size):
+    text = open(path).read()
+    images = []
+    for m in re.finditer(r'uint16_t\s+PROGMEM\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};', text, re.S):
+        body = re.sub(r'/\*.*?\*/', '', m.group(2), flags=re.S)
+        values = [int(v, 0) for v in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)]
+        pixels = [values[2 * i] | (values[2 * i + 1] << 8) for i in range(len(values) // 2)]
+        name = m.group(1)
+        w, h = size or guess_size(name, len(pixels))
+        if w * h != len(pixels):
+            sys.exit('%s: %d pixels is not %dx%d, give --size' % (name, len(pixels), w, h))
+        images.append((name, w, h, [pixels[j * w:(j + 1) * w] for j in range(h)]))
+    return images
+
+
+def guess_size(name, count):
+    m = re.search(r'(\d+)x(\d+)$', name)
+    if m:
+        return int(m.group(1)), int(m.group(2))
+    side = int(count ** 0.5)
+    return side, side
+
+
+def quantize(c, planes):
+    # Keep the top `planes` bits of each channel, as the panel does
+    if planes >= 6:
+        return c
+    r, g, b = c >> 11, (c >> 5) & 0x3F, c & 0x1F
+    r5 = max(0, 5 - planes)
+    g6 = 6 - planes
+    return (((r >> r5) << r5) << 11) | (((g >> g6) << g6) << 5) | ((b >> r5) << r5)
+
+
+def encode_row(values):
+    """Runs of one value and literal stretches, each at most 128 long."""
+    out = []
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append([len(chunk) - 1] + [v for item in chunk for v in item])
+
+    i = 0
+    while i < len(values):
+        n = 1
+        while i + n < len(values) and values[i + n] == values[i] and n < 129:
+            n += 1
+        # A pair inside a literal stretch costs less left in it
+        if n >= 3 or (n == 2 and not literal):
+            flush()
+            out.append([0x80 + n - 2] + values[i])
+            i += n
+        else:
+            literal.append(values[i])
+            i += 1
+    flush()
+    return [b for item in out for b in item]
+
+
+def pack(width, height, rows, planes):
+    if width > 255 or height > 255:
+        sys.exit('images are limited to 255x255')
+    rows = [[quantize(c, planes) for c in row] for row in rows]
+    colors = sorted(set(c for row in rows for c in row))
+    plain = len(colors) > 256
+    if plain:
+        header = [width, height, 0, 1]
+        code = lambda c: [c & 0xFF, c >> 8]
+    else:
+        index = {c: i for i, c in enumerate(colors)}
+        header = [width, height, len(colors) - 1, 0]
+        for c in colors:
+            header += [c & 0xFF, c >> 8]
+        code = lambda c: [index[c]]
+    body = []
+    for row in rows:
+        body += encode_row([code(c) for c in row])
+    return header + body, len(colors), plain
+
+
+def channel_level(v, bits, planes):
+    # A channel field scaled to `planes` bits, as channelLevel() does
+    if bits >= planes:
+        return v >> (bits - planes)
+    return (v << (planes - bits)) | (v >> (2 * bits - planes))
+
+
+def color_planes(c, planes):
+    """Plane bytes of a color for the upper and the lower half: colorPlanes()
+    in RGBmatrixPanel.cpp."""
+    if planes == 4:
+        r, g, b = c >> 12, (c >> 7) & 0xF, (c >> 1) & 0xF
+        upper, lower = [0] * 3, [0] * 3
+        # Planes 1-3 in bits 2-4 / 5-7, plane 0 spread over the low two
+        for k in range(3):
+            bit = 2 << k
+            rgb = (1 if r & bit else 0) | (2 if g & bit else 0) | (4 if b & bit else 0)
+            upper[k] = rgb << 2
+            lower[k] = rgb << 5
+        upper[2] |= (r & 1) | ((g & 1) << 1)
+        upper[1] |= b & 1
+        lower[0] |= (g & 1) | ((b & 1) << 1)
+        lower[1] |= (r & 1) << 1
+        return upper, lower
+    r = channel_level(c >> 11, 5, planes)
+    g = channel_level((c >> 5) & 0x3F, 6, planes)
+    b = channel_level(c & 0x1F, 5, planes)
+    upper, lower = [0] * planes, [0] * planes
+    for k in range(planes):
+        bit = 1 << k
+        rgb = (1 if r & bit else 0) | (2 if g & bit else 0) | (4 if b & bit else 0)
+        upper[k] = rgb << 2
+        lower[k] = rgb << 5
+    return upper, lower
+
+
+def planes_buffer(width, height, rows, planes):
+    """The back buffer holding the image: for each of the height / 2 row
+    pairs, one WIDTH-byte run per plane byte."""
+    if height & 1:
+        sys.exit('a whole-screen image has an even height')
+    count = 3 if planes == 4 else planes
+    half = height // 2
+    data = [0] * (width * half * count)
+    for y, row in enumerate(rows):
+        for x, c in enumerate(row):
+            upper, lower = color_planes(c, planes)
+            bits = lower if y >= half else upper
+            base = (y % half) * width * count + x
+            for k in range(count):
+                data[base + k * width] |= bits[k]
+    return data
+
+
+def sprite_sheet(name, images, key, lines):
+    """A SpriteSheet and its bitmap and mask arrays, frames top to bottom."""
+    w, h = images[0][1], images[0][2]
+    if any((iw, ih) != (w, h) for _, iw, ih, _ in images):
+        sys.exit('sprite frames all have to be the same size')
+    if w > 255 or h > 255 or len(images) > 255:
+        sys.exit('sprites are limited to 255x255 and 255 frames')
+    if key is None:
+        key = images[0][3][0][0]
+    words, mask = [], []
+    for _, _, _, rows in images:
+        for row in rows:
+            words += row
+            bits = [0] * ((w + 7) // 8)
+            for i, c in enumerate(row):
+                if c != key:
+                    bits[i >> 3] |= 0x80 >> (i & 7)
+            mask += bits
+    lines.append('// %dx%d, %d frames, transparent 0x%04X: %d bytes'
+                 % (w, h, len(images), key, 2 * len(words) + len(mask)))
+    lines.append('const uint16_t PROGMEM %s_bitmap[] = {' % name)
+    for i in range(0, len(words), 12):
+        lines.append('  ' + ','.join('0x%04X' % c for c in words[i:i + 12]) + ',')
+    lines.append('};')
+    lines.append('const uint8_t PROGMEM %s_mask[] = {' % name)
+    for i in range(0, len(mask), 16):
+        lines.append('  ' + ','.join('0x%02X' % b for b in mask[i:i + 16]) + ',')
+    lines.append('};')
+    lines.append('const SpriteSheet %s = {%s_bitmap, %s_mask, %d, %d, %d};'
+                 % (name, name, name, w, h, len(images)))
+    lines.append('')
+    print('%s: %dx%d, %d frames, %d bytes' % (name, w, h, len(images), 2 * len(words) + len(mask)))
+    return 2 * len(words) + len(mask)
+
+
+def shrink(image, n):
+    name, w, h, rows = image
+    return name, (w + n - 1) // n, (h + n - 1) // n, [row[::n] for row in rows[::n]]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('inputs', nargs='+', help='.bmp files or C headers')
+    parser.add_argument('-o', '--output', required=True, help='header to write')
+    parser.add_argument('--planes', type=int, default=4,
+                        help='bits per channel the panel shows (RGBMATRIX_PLANES)')
+    parser.add_argument('--size', help='WxH of header arrays whose name does not end in it')
+    parser.add_argument('--format', choices=('packed', 'planes', 'sprite'), default='packed',
+                        help='packed for drawPackedBitmap(), planes for drawPlanes(), '
+                             'sprite for SpriteLayer')
+    parser.add_argument('--name', help='sprite sheet name (default: the first image\'s)')
+    parser.add_argument('--key', type=lambda v: int(v, 0),
+                        help='5/6/5 color left transparent in sprites')
+    parser.add_argument('--shrink', type=int, default=1, help='keep every Nth pixel')
+    parser.add_argument('--select', help='only the images whose name matches this regex')
+    args = parser.parse_args()
+    size = tuple(int(v) for v in args.size.split('x')) if args.size else None
+
+    images = []
+    for path in args.inputs:
+        if path.lower().endswith('.bmp'):
+            images += read_bmp(path)
+        else:
+            images += read_header(path, size)
+    if args.select:
+        images = [image for image in images if re.search(args.select, image[0])]
+    if not images:
+        sys.exit('no images found')
+    if args.shrink > 1:
+        images = [shrink(image, args.shrink) for image in images]
+
+    guard = '__' + re.sub(r'\W', '_', os.path.basename(args.output)).upper()
+    target = {'packed': 'RGBmatrixPanel::drawPackedBitmap()',
+              'planes': 'RGBmatrixPanel::drawPlanes()', 'sprite': 'SpriteLayer'}[args.format]
+    made = '--format sprite' if args.format == 'sprite' else \
+        '--format %s --planes %d' % (args.format, args.planes)
+    lines = ['// Made with tools/pack_image.py %s, for' % made,
+             '// %s. Do not edit.' % target,
+             '#ifndef %s' % guard, '#define %s' % guard, '#include "avr/pgmspace.h"']
+    if args.format == 'sprite':
+        lines.append('#include "Sprites.h"')
+    lines.append('')
+    if args.format == 'sprite':
+        total = sprite_sheet(args.name or images[0][0], images, args.key, lines)
+        lines.append('#endif')
+        open(args.output, 'w').write('\n'.join(lines) + '\n')
+        return
+    total = 0
+    for name, w, h, rows in images:
+        if args.format == 'planes':
+            data = planes_buffer(w, h, rows, args.planes)
+            name += '_planes'
+            kind = 'back buffer layout'
+        else:
+            data, colors, plain = pack(w, h, rows, args.planes)
+            kind = '%d plain colors' % colors if plain else '%d-color palette' % colors
+        total += len(data)
+        lines.append('// %dx%d, %s: %d bytes' % (w, h, kind, len(data)))
+        lines.append('const uint8_t PROGMEM %s[] = {' % name)
+        for i in range(0, len(data), 16):
+            lines.append('  ' + ','.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+        print('%s: %dx%d, %s, %d bytes' % (name, w, h, kind, len(data)))
+    lines.append('#endif')
+    open(args.output, 'w').write('\n'.join(lines) + '\n')
+    print('%d images, %d bytes' % (len(images), total))
+
+
+if __name__ == '__main__':
+    main()
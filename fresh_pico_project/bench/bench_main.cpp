@@ -0,0 +1,169 @@
+// Host-side benchmark for the automata in CellularAutomata.h
+//
+// Builds against the mock Arduino/Protomatter headers in bench/mock and runs
+// each automaton for a fixed number of generations at several grid sizes,
+// timing update() (with the activity tracking compute() adds) and render()
+// separately, then update() again from the same start in batches of
+// BENCH_BATCH generations (computeMany()). The native-mock environment runs them on MockDisplay instead
+// of MatrixController, through the DisplayBackend defaults alone.
+//
+//   pio run -e native -t exec
+//   .pio/build/native/program [generations]
+
+#include <Arduino.h>
+#include "Display.h"
+#include "PanelConfig.h"
+#include "CellularAutomata.h"
+
+#define BENCH_GENERATIONS 200  // Default generations per automaton and size
+#define BENCH_SEED 12345       // Fixed seed so runs are comparable
+#define BENCH_BATCH 8          // Generations per computeMany() in the batched run
+
+struct BenchSize {
+  uint8_t width;
+  uint8_t height;
+  int8_t tiles;      // Protomatter vertical tiles (64 rows each)
+  bool usePanelMap;  // Remap through PanelMap like the real 2x2 wall
+};
+
+static const BenchSize sizes[] = {
+  { 64, 64, 1, false },               // Single panel
+  { 128, 64, 1, false },              // Two panels side by side
+  { TOTAL_WIDTH, TOTAL_HEIGHT, 2, true }  // The 2x2 wall, remapped
+};
+
+#ifndef DISPLAY_MOCK
+static uint8_t rgbPins[] = { 0, 0, 0, 0, 0, 0 };
+static uint8_t addrPins[] = { 0, 0, 0, 0, 0 };
+#endif
+
+// A display of the given size; MockDisplay has no pixel map to remap through
+static Display* newDisplay(uint16_t width, uint16_t height, int8_t tiles, bool usePanelMap) {
+#ifdef DISPLAY_MOCK
+  (void)tiles;
+  (void)usePanelMap;
+  return new MockDisplay(width, height);
+#else
+  MatrixController* display = new MatrixController(rgbPins, addrPins, 0, 0, 0,
+                                                   width, height, 1, true, tiles);
+  display->begin();
+  display->setPixelMap(usePanelMap ? PanelMap::data() : NULL);
+  return display;
+#endif
+}
+
+// Same selection as main.cpp, but with fixed parameters
+CellularAutomaton* createAutomaton(uint8_t type, Display* matrix, uint16_t width, uint16_t height) {
+  switch (type) {
+    case 0: return new ElementaryAutomaton(matrix, width, height, 30);
+    case 1: return new GameOfLife(matrix, width, height);
+    case 2: return new BriansBrain(matrix, width, height);
+    case 3: return new LangtonsAnt(matrix, width, height, 5);
+    case 4: return new CyclicAutomaton(matrix, width, height);
+    case 5: return new BubblingLava(matrix, width, height);
+    case 6: return new OrderAndChaos(matrix, width, height);
+    case 7: return new LargerThanLife(matrix, width, height, LargerThanLife::BOSCO);
+    default: return new SmoothLife(matrix, width, height);
+  }
+}
+
+// Millions of cells per second for a stage that took totalUs over all generations
+static double mcellsPerSecond(uint32_t cells, uint32_t generations, uint64_t totalUs) {
+  if (totalUs == 0) return 0;
+  return (double)cells * generations / totalUs;
+}
+
+// Update throughput of an initialized automaton over updateCells cells,
+// BENCH_BATCH generations at a time with nothing rendered
+static double benchBatched(CellularAutomaton* automaton, uint32_t updateCells, uint32_t generations) {
+  uint64_t updateUs = 0;
+  for (uint32_t done = 0; done < generations; done += BENCH_BATCH) {
+    uint32_t start = micros();
+    automaton->computeMany(min((uint32_t)BENCH_BATCH, generations - done));
+    updateUs += micros() - start;
+  }
+  return mcellsPerSecond(updateCells, generations, updateUs);
+}
+
+// Run an initialized automaton for the given generations and print a row:
+// update throughput over updateCells cells, render throughput over the
+// displayed cells, and the batched update throughput measured before
+static void bench(CellularAutomaton* automaton, const char* grid, uint32_t updateCells,
+                  uint32_t renderCells, uint32_t generations, double batched) {
+  uint64_t updateUs = 0;
+  uint64_t renderUs = 0;
+  for (uint32_t i = 0; i < generations; i++) {
+    uint32_t start = micros();
+    automaton->compute();
+    uint32_t mid = micros();
+    automaton->render();
+    uint32_t end = micros();
+    updateUs += mid - start;
+    renderUs += end - mid;
+  }
+
+  printf("%-40.40s %9s %10.2f %10.2f %10.1f %10.2f\n", automaton->getName(), grid,
+         mcellsPerSecond(updateCells, generations, updateUs),
+         mcellsPerSecond(renderCells, generations, renderUs),
+         (double)(updateUs + renderUs) / generations, batched);
+}
+
+int main(int argc, char** argv) {
+  uint32_t generations = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_GENERATIONS;
+  if (generations == 0) generations = BENCH_GENERATIONS;
+
+  PanelMap::begin();
+
+  printf("%u generations per run, Mcells/s (higher is better)\n\n", (unsigned)generations);
+  printf("%-40s %9s %10s %10s %10s %10s\n", "automaton", "grid", "update", "render", "us/frame", "batched");
+
+  for (const BenchSize& size : sizes) {
+    Display* display = newDisplay(size.width, size.height, size.tiles, size.usePanelMap);
+
+    uint32_t cells = (uint32_t)size.width * size.height;
+    char grid[16];
+    snprintf(grid, sizeof(grid), "%ux%u%s", size.width, size.height, size.usePanelMap ? "*" : "");
+
+    for (uint8_t type = 0; type < NUM_AUTOMATA; type++) {
+      fastRandomSeed(BENCH_SEED);
+      CellularAutomaton* automaton = createAutomaton(type, display, size.width, size.height);
+      automaton->init();
+      double batched = benchBatched(automaton, cells, generations);
+      delete automaton;
+
+      fastRandomSeed(BENCH_SEED);
+      automaton = createAutomaton(type, display, size.width, size.height);
+      automaton->init();
+      bench(automaton, grid, cells, cells, generations, batched);
+      delete automaton;
+    }
+    delete display;
+    printf("\n");
+  }
+
+  // Game of Life on a world bigger than the wall, seen through its viewport
+  {
+    Display* display = newDisplay(TOTAL_WIDTH, TOTAL_HEIGHT, 2, true);
+    uint32_t cells = (uint32_t)TOTAL_WIDTH * TOTAL_HEIGHT;
+
+    uint32_t worldCells = cells * GOL_WORLD_SCALE * GOL_WORLD_SCALE;
+
+    fastRandomSeed(BENCH_SEED);
+    CellularAutomaton* automaton = new GameOfLife(display, TOTAL_WIDTH * GOL_WORLD_SCALE,
+                                                  TOTAL_HEIGHT * GOL_WORLD_SCALE);
+    automaton->init();
+    double batched = benchBatched(automaton, worldCells, generations);
+    delete automaton;
+
+    fastRandomSeed(BENCH_SEED);
+    automaton = new GameOfLife(display, TOTAL_WIDTH * GOL_WORLD_SCALE, TOTAL_HEIGHT * GOL_WORLD_SCALE);
+    automaton->init();
+    bench(automaton, "world*", worldCells, cells, generations, batched);
+    delete automaton;
+    delete display;
+    printf("\n");
+  }
+
+  printf("* remapped through PanelMap; batched: update in runs of %u generations\n", BENCH_BATCH);
+  return 0;
+}
@@ -0,0 +1,47 @@
+#ifndef MOCK_ADAFRUIT_GFX_H
+#define MOCK_ADAFRUIT_GFX_H
+
+// Host stand-in for the 16-bit canvas of Adafruit GFX
+
+#include <Arduino.h>
+
+class GFXcanvas16 {
+  public:
+    GFXcanvas16(uint16_t w, uint16_t h) : _width(w), _height(h) {
+      buffer = (uint16_t*)calloc((size_t)w * h, sizeof(uint16_t));
+    }
+    virtual ~GFXcanvas16() { free(buffer); }
+
+    uint16_t* getBuffer() const { return buffer; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+      if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+      buffer[y * _width + x] = color;
+    }
+
+    void fillScreen(uint16_t color) {
+      for (uint32_t i = 0; i < (uint32_t)_width * _height; i++) buffer[i] = color;
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      for (int16_t j = y; j < y + h; j++) {
+        for (int16_t i = x; i < x + w; i++) drawPixel(i, j, color);
+      }
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      fillRect(x, y, w, 1, color);
+      fillRect(x, y + h - 1, w, 1, color);
+      fillRect(x, y, 1, h, color);
+      fillRect(x + w - 1, y, 1, h, color);
+    }
+
+  protected:
+    int16_t _width;
+    int16_t _height;
+    uint16_t* buffer;
+};
+
+#endif
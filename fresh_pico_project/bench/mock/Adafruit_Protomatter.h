@@ -0,0 +1,35 @@
+#ifndef MOCK_ADAFRUIT_PROTOMATTER_H
+#define MOCK_ADAFRUIT_PROTOMATTER_H
+
+// Host stand-in for Adafruit_Protomatter: a plain canvas, no display.
+// show() does nothing, so host numbers cover update() and render() only;
+// use the on-device stage timing for show().
+
+#include <Adafruit_GFX.h>
+
+typedef enum {
+  PROTOMATTER_OK,
+  PROTOMATTER_ERR_PINS,
+  PROTOMATTER_ERR_MALLOC,
+  PROTOMATTER_ERR_ARG
+} ProtomatterStatus;
+
+class Adafruit_Protomatter : public GFXcanvas16 {
+  public:
+    Adafruit_Protomatter(uint16_t bitWidth, uint8_t bitDepth,
+                         uint8_t rgbCount, uint8_t* rgbList,
+                         uint8_t addrCount, uint8_t* addrList,
+                         uint8_t clockPin, uint8_t latchPin, uint8_t oePin,
+                         bool doubleBuffer, int8_t tile = 1, void* timer = NULL)
+      : GFXcanvas16(bitWidth, (2 << addrCount) * rgbCount * (tile < 0 ? -tile : tile)) {}
+
+    ProtomatterStatus begin() { return PROTOMATTER_OK; }
+    void show() {}
+    uint32_t getFrameCount() { return 0; }
+
+    static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+      return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+};
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+// Minimal Arduino API for building the automata on the host (env:native).
+// Only what CellularAutomata.h and MatrixController use is provided.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#define ARDUINO 10800
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define LED_BUILTIN 25
+#define A0 26
+#define DEC 10
+#define HEX 16
+#define PROGMEM
+#define F(x) (x)
+#define PI 3.1415926535897932384626433832795
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+// Same semantics as the Arduino core: random(max) is [0, max), random(min, max) is [min, max)
+inline void randomSeed(unsigned long seed) { srand(seed); }
+inline long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig) {
+  return howbig > howsmall ? howsmall + rand() % (howbig - howsmall) : howsmall;
+}
+
+inline std::chrono::steady_clock::time_point mockStartTime() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return start;
+}
+
+inline unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - mockStartTime()).count();
+}
+
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void delayMicroseconds(unsigned int us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int analogRead(uint8_t) { return 0; }
+
+// Print with the overloads the sketches use
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+      size_t n = 0;
+      while (size--) n += write(*buffer++);
+      return n;
+    }
+    virtual void flush() {}
+
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long v, int base = DEC) { return printf_(base == HEX ? "%lX" : "%ld", v); }
+    size_t print(unsigned long v, int base = DEC) { return printf_(base == HEX ? "%lX" : "%lu", v); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(double v, int digits = 2) {
+      char buf[40];
+      snprintf(buf, sizeof(buf), "%.*f", digits, v);
+      return print(buf);
+    }
+
+    size_t println() { return print("\r\n"); }
+    template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+    template <typename T> size_t println(T v, int format) { size_t n = print(v, format); return n + println(); }
+
+  private:
+    template <typename T> size_t printf_(const char* fmt, T v) {
+      char buf[24];
+      snprintf(buf, sizeof(buf), fmt, v);
+      return print(buf);
+    }
+};
+
+// Serial ports write to stdout
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    using Print::write;
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+};
+
+inline HardwareSerial Serial;
+inline HardwareSerial Serial1;
+
+#endif
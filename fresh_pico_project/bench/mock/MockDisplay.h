@@ -0,0 +1,60 @@
+#ifndef MOCK_DISPLAY_H
+#define MOCK_DISPLAY_H
+
+#include <Arduino.h>
+#include <DisplayBackend.h>
+
+// Host display backend: a logical RGB565 frame buffer and nothing else, so
+// the automata run on the DisplayBackend primitives alone (the base's
+// generic rows, bitmaps and pixels) and the result can be read back
+class MockDisplay : public DisplayBackend<MockDisplay> {
+  public:
+    static const uint8_t COLOR_DEPTH = 4;
+
+    MockDisplay(uint16_t width, uint16_t height)
+      : w(width), h(height), frames(0), pixels(new uint16_t[(uint32_t)width * height]()) {}
+
+    ~MockDisplay() { delete[] pixels; }
+
+    MockDisplay(const MockDisplay&) = delete;
+    MockDisplay& operator=(const MockDisplay&) = delete;
+
+    int16_t width() { return w; }
+    int16_t height() { return h; }
+
+    void blitIndexedSpan(uint16_t y, uint16_t x, uint16_t count, const uint8_t* src, const uint16_t* palette) {
+      uint16_t* dst = pixels + (uint32_t)y * w + x;
+      for (uint16_t i = 0; i < count; i++) dst[i] = palette[src[i]];
+    }
+
+    void fillSpan(uint16_t y, uint16_t x, uint16_t count, uint16_t color) {
+      uint16_t* dst = pixels + (uint32_t)y * w + x;
+      for (uint16_t i = 0; i < count; i++) dst[i] = color;
+    }
+
+    void show() { frames++; }
+    bool tryShow() { frames++; return true; }
+    bool swapPending() { return false; }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+      return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+    // Rounded to COLOR_DEPTH bits without gamma: enough for the bench
+    uint16_t gammaColor565(uint8_t r, uint8_t g, uint8_t b) {
+      const uint8_t mask = (uint8_t)(0xFF << (8 - COLOR_DEPTH));
+      return color565(r & mask, g & mask, b & mask);
+    }
+
+    // Frames shown so far, and the frame buffer
+    uint32_t getFrames() const { return frames; }
+    const uint16_t* data() const { return pixels; }
+
+  private:
+    uint16_t w;
+    uint16_t h;
+    uint32_t frames;
+    uint16_t* pixels;
+};
+
+#endif
@@ -0,0 +1,375 @@
+#ifdef MATRIX_PIO
+
+#include "Hub75Pio.h"
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <hardware/pio_instructions.h>
+
+// Both state machines live on one PIO and hand over through its IRQ flags:
+// the data SM raises SHIFTED when a plane is in the panel's shift
+// registers, the row SM raises LATCHED once it has moved it to the LEDs and
+// the next plane may go in.
+#define IRQ_SHIFTED 0
+#define IRQ_LATCHED 1
+
+// Row SM side-set: bit 0 LAT, bit 1 OE (high = LEDs off)
+#define SIDE_DARK 2
+#define SIDE_LATCH 3
+#define SIDE_LIT 0
+
+// Cycles the row SM spends between planes besides the on-time, and the data
+// SM per plane besides two per pixel
+#define ROW_OVERHEAD 8
+#define DATA_OVERHEAD 3
+
+static Hub75Pio* activeMatrix = NULL; // For the DMA interrupt
+
+// The programs are put together with the SDK's instruction encoders rather
+// than pioasm, which the Arduino build doesn't run. Jumps are relative to
+// the program start; pio_add_program() relocates them.
+//
+// Data SM, clock on side-set; Y holds the pixels per scan line - 1:
+//   0: mov x, y          side 0
+//   1: out pins, 8       side 0   ; one pixel's RGB bits (four per word)
+//   2: jmp x--, 1        side 1   ; clock it in
+//   3: irq set SHIFTED   side 0
+//   4: wait 1 irq LATCHED side 0
+static uint16_t dataProgram[5];
+
+// Row SM, LAT and OE on side-set. Two words per plane from its DMA: the
+// address pin states, and the on-time in cycles - 1.
+//   0: wait 1 irq SHIFTED side dark
+//   1: out pins, span    side latch [3]
+//   2: out null, 32-span side dark  ; (dropped when span is 32)
+//   3: out x, 32         side dark
+//   4: irq set LATCHED   side dark
+//   5: jmp x--, 5        side lit
+static uint16_t rowProgram[6];
+
+// A channel level of bits bits, spread over depth bits by repeating its top
+// bits below (as Protomatter expands 565 color)
+static uint8_t channelLevel(uint8_t v, uint8_t bits, uint8_t depth) {
+  if (bits >= depth) return v >> (bits - depth);
+  uint16_t level = v << (depth - bits);
+  level |= v >> (2 * bits - depth);
+  return level;
+}
+
+// Tiles per chain from Protomatter's tile argument (sign = serpentine, 0 = 1)
+static uint8_t tileCount(int8_t tile) {
+  return tile < 0 ? -tile : (tile ? tile : 1);
+}
+
+Hub75Pio::Hub75Pio(uint16_t bitWidth, uint8_t bitDepth,
+                   uint8_t rgbCount, uint8_t* rgbList,
+                   uint8_t addrCount, uint8_t* addrList,
+                   uint8_t clockPin, uint8_t latchPin, uint8_t oePin,
+                   bool doubleBuffer, int8_t tile)
+  : GFXcanvas16(bitWidth, (2 << addrCount) * rgbCount * tileCount(tile)) {
+  memcpy(rgbPins, rgbList, 6);
+  memcpy(addrPins, addrList, addrCount);
+  this->rgbCount = rgbCount;
+  this->addrCount = addrCount;
+  this->clockPin = clockPin;
+  this->latchPin = latchPin;
+  this->oePin = oePin;
+  this->tile = tile ? tile : 1;
+  depth = bitDepth;
+  chainWidth = bitWidth * tileCount(tile);
+  frameCount = doubleBuffer ? 2 : 1;
+  frameBytes = (uint32_t)chainWidth * depth << addrCount;
+  frames[0] = frames[1] = NULL;
+  rowWords = NULL;
+  active = queued = 0;
+  refreshes = 0;
+  swapCallback = NULL;
+}
+
+bool Hub75Pio::begin() {
+  // Check the wiring fits the programs
+  if (rgbCount != 1 || (chainWidth & 3) || oePin != latchPin + 1) return false;
+  rgbBase = rgbPins[0];
+  for (uint8_t i = 1; i < 6; i++) {
+    if (rgbPins[i] < rgbBase) rgbBase = rgbPins[i];
+  }
+  addrBase = addrPins[0];
+  uint8_t addrTop = addrPins[0];
+  for (uint8_t i = 0; i < 6; i++) {
+    if (rgbPins[i] - rgbBase >= 8) return false;
+  }
+  for (uint8_t i = 1; i < addrCount; i++) {
+    if (addrPins[i] < addrBase) addrBase = addrPins[i];
+    if (addrPins[i] > addrTop) addrTop = addrPins[i];
+  }
+  addrSpan = addrTop - addrBase + 1;
+  if (addrSpan > 32) return false;
+
+  for (uint8_t n = 0; n < frameCount; n++) {
+    frames[n] = (uint8_t*)calloc(frameBytes, 1);
+    if (frames[n] == NULL) return false;
+  }
+  uint16_t steps = depth << addrCount; // Planes per frame
+  rowWords = (uint32_t*)malloc(steps * 2 * sizeof(uint32_t));
+  if (rowWords == NULL) return false;
+
+  // Conversion tables: each channel level sets its bit (R 0, G 1, B 2) in
+  // the nibble of every plane whose bit it has; pinBits turns a pixel
+  // pair's six bits into the byte for the RGB pins
+  for (uint8_t v = 0; v < 64; v++) {
+    uint8_t levels[3] = {
+      channelLevel(v & 0x1F, 5, depth), channelLevel(v, 6, depth), channelLevel(v & 0x1F, 5, depth)
+    };
+    for (uint8_t c = 0; c < 3; c++) {
+      planeBits[c][v] = 0;
+      for (uint8_t p = 0; p < depth; p++) {
+        if (levels[c] & (1 << p)) planeBits[c][v] |= 1UL << (4 * p + c);
+      }
+    }
+    pinBits[v] = 0;
+    for (uint8_t i = 0; i < 6; i++) {
+      if (v & (1 << i)) pinBits[v] |= 1 << (rgbPins[i] - rgbBase);
+    }
+  }
+
+  // State machine clock: two cycles per pixel at MATRIX_PIO_CLOCK_HZ
+  uint32_t sysHz = clock_get_hz(clk_sys);
+  uint32_t div256 = ((uint64_t)sysHz * 256 + MATRIX_PIO_CLOCK_HZ) / (2UL * MATRIX_PIO_CLOCK_HZ);
+  if (div256 < 256) div256 = 256;
+  uint32_t smHz = (uint64_t)sysHz * 256 / div256;
+
+  // BCM unit: the longest on-time for plane 0 that keeps a row within the
+  // refresh budget. Each plane's step lasts its on-time or the next plane's
+  // shift, whichever is longer.
+  uint32_t shift = chainWidth * 2 + DATA_OVERHEAD;
+  uint32_t budget = smHz / ((uint32_t)MATRIX_REFRESH_HZ << addrCount);
+  uint32_t unit = budget / ((1 << depth) - 1);
+  for (; unit > 1; unit--) {
+    uint32_t row = 0;
+    for (uint8_t p = 0; p < depth; p++) {
+      uint32_t on = unit << p;
+      row += (on > shift ? on : shift) + ROW_OVERHEAD;
+    }
+    if (row <= budget) break;
+  }
+  if (unit == 0) unit = 1;
+
+  // Row SM feed, in the order the data goes out
+  uint16_t i = 0;
+  for (uint8_t r = 0; r < (1 << addrCount); r++) {
+    uint32_t address = 0;
+    for (uint8_t a = 0; a < addrCount; a++) {
+      if (r & (1 << a)) address |= 1UL << (addrPins[a] - addrBase);
+    }
+    for (uint8_t p = 0; p < depth; p++) {
+      rowWords[i++] = address;
+      rowWords[i++] = (unit << p) - 1;
+    }
+  }
+
+  // Programs
+  dataProgram[0] = pio_encode_mov(pio_x, pio_y) | pio_encode_sideset(1, 0);
+  dataProgram[1] = pio_encode_out(pio_pins, 8) | pio_encode_sideset(1, 0);
+  dataProgram[2] = pio_encode_jmp_x_dec(1) | pio_encode_sideset(1, 1);
+  dataProgram[3] = pio_encode_irq_set(false, IRQ_SHIFTED) | pio_encode_sideset(1, 0);
+  dataProgram[4] = pio_encode_wait_irq(true, false, IRQ_LATCHED) | pio_encode_sideset(1, 0);
+  uint8_t n = 0;
+  rowProgram[n++] = pio_encode_wait_irq(true, false, IRQ_SHIFTED) | pio_encode_sideset(2, SIDE_DARK);
+  rowProgram[n++] = pio_encode_out(pio_pins, addrSpan) | pio_encode_sideset(2, SIDE_LATCH) | pio_encode_delay(3);
+  if (addrSpan < 32) {
+    rowProgram[n++] = pio_encode_out(pio_null, 32 - addrSpan) | pio_encode_sideset(2, SIDE_DARK);
+  }
+  rowProgram[n++] = pio_encode_out(pio_x, 32) | pio_encode_sideset(2, SIDE_DARK);
+  rowProgram[n++] = pio_encode_irq_set(false, IRQ_LATCHED) | pio_encode_sideset(2, SIDE_DARK);
+  rowProgram[n] = pio_encode_jmp_x_dec(n) | pio_encode_sideset(2, SIDE_LIT);
+  const pio_program_t data = {dataProgram, 5, -1};
+  const pio_program_t row = {rowProgram, (uint8_t)(n + 1), -1};
+
+  // Both on one PIO, for the shared IRQ flags
+  pio = pio0;
+  if (!pio_can_add_program(pio, &data) || !pio_can_add_program(pio, &row)) pio = pio1;
+  int sm0 = pio_claim_unused_sm(pio, false);
+  int sm1 = pio_claim_unused_sm(pio, false);
+  if (sm0 < 0 || sm1 < 0 || !pio_can_add_program(pio, &data)) return false;
+  dataSm = sm0;
+  rowSm = sm1;
+  uint dataOffset = pio_add_program(pio, &data);
+  if (!pio_can_add_program(pio, &row)) return false;
+  uint rowOffset = pio_add_program(pio, &row);
+  pio_interrupt_clear(pio, IRQ_SHIFTED);
+  pio_interrupt_clear(pio, IRQ_LATCHED);
+
+  for (uint8_t i = 0; i < 6; i++) pio_gpio_init(pio, rgbPins[i]);
+  for (uint8_t i = 0; i < addrCount; i++) pio_gpio_init(pio, addrPins[i]);
+  pio_gpio_init(pio, clockPin);
+  pio_gpio_init(pio, latchPin);
+  pio_gpio_init(pio, oePin);
+  pio_sm_set_pins_with_mask(pio, rowSm, 1UL << oePin, 1UL << oePin); // Dark until running
+  pio_sm_set_consecutive_pindirs(pio, dataSm, rgbBase, 8, true);
+  pio_sm_set_consecutive_pindirs(pio, dataSm, clockPin, 1, true);
+  pio_sm_set_consecutive_pindirs(pio, rowSm, addrBase, addrSpan, true);
+  pio_sm_set_consecutive_pindirs(pio, rowSm, latchPin, 2, true);
+
+  pio_sm_config c = pio_get_default_sm_config();
+  sm_config_set_wrap(&c, dataOffset, dataOffset + 4);
+  sm_config_set_out_pins(&c, rgbBase, 8);
+  sm_config_set_sideset(&c, 1, false, false);
+  sm_config_set_sideset_pins(&c, clockPin);
+  sm_config_set_out_shift(&c, true, true, 32);
+  sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+  sm_config_set_clkdiv_int_frac(&c, div256 >> 8, div256 & 0xFF);
+  pio_sm_init(pio, dataSm, dataOffset, &c);
+  // Y = pixels per scan line - 1, loaded before the DMA takes the FIFO
+  pio_sm_put(pio, dataSm, chainWidth - 1);
+  pio_sm_exec(pio, dataSm, pio_encode_pull(false, true));
+  pio_sm_exec(pio, dataSm, pio_encode_out(pio_y, 32));
+
+  c = pio_get_default_sm_config();
+  sm_config_set_wrap(&c, rowOffset, rowOffset + n);
+  sm_config_set_out_pins(&c, addrBase, addrSpan);
+  sm_config_set_sideset(&c, 2, false, false);
+  sm_config_set_sideset_pins(&c, latchPin);
+  sm_config_set_out_shift(&c, true, true, 32);
+  sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+  sm_config_set_clkdiv_int_frac(&c, div256 >> 8, div256 & 0xFF);
+  pio_sm_init(pio, rowSm, rowOffset, &c);
+
+  // DMA: each feed channel, once done, chains to a control channel that
+  // writes its start address back and retriggers it, so both loop forever
+  int channels[4];
+  for (uint8_t i = 0; i < 4; i++) {
+    channels[i] = dma_claim_unused_channel(false);
+    if (channels[i] < 0) return false;
+  }
+  dataChan = channels[0];
+  dataCtrl = channels[1];
+  rowChan = channels[2];
+  rowCtrl = channels[3];
+  nextFrame = (uint32_t)frames[0];
+  rowStart = (uint32_t)rowWords;
+
+  dma_channel_config d = dma_channel_get_default_config(dataChan);
+  channel_config_set_transfer_data_size(&d, DMA_SIZE_32);
+  channel_config_set_read_increment(&d, true);
+  channel_config_set_write_increment(&d, false);
+  channel_config_set_dreq(&d, pio_get_dreq(pio, dataSm, true));
+  channel_config_set_chain_to(&d, dataCtrl);
+  dma_channel_configure(dataChan, &d, &pio->txf[dataSm], frames[0], frameBytes / 4, false);
+
+  d = dma_channel_get_default_config(dataCtrl);
+  channel_config_set_transfer_data_size(&d, DMA_SIZE_32);
+  channel_config_set_read_increment(&d, false);
+  channel_config_set_write_increment(&d, false);
+  dma_channel_configure(dataCtrl, &d, &dma_hw->ch[dataChan].al3_read_addr_trig, &nextFrame, 1, false);
+
+  d = dma_channel_get_default_config(rowChan);
+  channel_config_set_transfer_data_size(&d, DMA_SIZE_32);
+  channel_config_set_read_increment(&d, true);
+  channel_config_set_write_increment(&d, false);
+  channel_config_set_dreq(&d, pio_get_dreq(pio, rowSm, true));
+  channel_config_set_chain_to(&d, rowCtrl);
+  dma_channel_configure(rowChan, &d, &pio->txf[rowSm], rowWords, steps * 2, false);
+
+  d = dma_channel_get_default_config(rowCtrl);
+  channel_config_set_transfer_data_size(&d, DMA_SIZE_32);
+  channel_config_set_read_increment(&d, false);
+  channel_config_set_write_increment(&d, false);
+  dma_channel_configure(rowCtrl, &d, &dma_hw->ch[rowChan].al3_read_addr_trig, &rowStart, 1, false);
+
+  // One interrupt per frame, as the data DMA starts it over
+  activeMatrix = this;
+  dma_channel_set_irq1_enabled(dataCtrl, true);
+  irq_add_shared_handler(DMA_IRQ_1, dmaHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1, true);
+
+  dma_start_channel_mask((1u << dataChan) | (1u << rowChan));
+  pio_enable_sm_mask_in_sync(pio, (1u << dataSm) | (1u << rowSm));
+  return true;
+}
+
+void Hub75Pio::dmaHandler() {
+  Hub75Pio* m = activeMatrix;
+  if (m == NULL || !dma_channel_get_irq1_status(m->dataCtrl)) return;
+  dma_channel_acknowledge_irq1(m->dataCtrl);
+
+  // Which frame the data DMA has just started, from its read address
+  // (nextFrame may have changed since the control channel read it)
+  uint32_t at = dma_hw->ch[m->dataChan].read_addr;
+  uint8_t shown = (at - (uint32_t)m->frames[0] < m->frameBytes) ? 0 : 1;
+  m->refreshes++;
+  if (shown != m->active) {
+    m->active = shown;
+    if (m->swapCallback) m->swapCallback();
+  }
+}
+
+void Hub75Pio::show() {
+  if (frameCount == 1) {
+    convert(0); // Straight into the frame on show, may tear
+    return;
+  }
+
+  // The frame being shown can't be overwritten, so wait for the previous
+  // show() to go up before filling the other one
+  while (active != queued) tight_loop_contents();
+  uint8_t back = 1 - active;
+  convert(back);
+  queued = back;
+  nextFrame = (uint32_t)frames[back];
+}
+
+bool Hub75Pio::tryShow() {
+  if (frameCount > 1 && active != queued) return false;
+  show();
+  return true;
+}
+
+uint32_t Hub75Pio::getFrameCount() {
+  uint32_t n = refreshes;
+  refreshes = 0;
+  return n;
+}
+
+void Hub75Pio::convert(uint8_t n) {
+  // Scan line order matches Protomatter, so canvas layouts carry over:
+  // HUB75 shifts in from the far end, so the last tile goes out first,
+  // and serpentine (negative) tiles run odd tiles upside down
+  const uint16_t* canvas = getBuffer();
+  uint16_t w = width();
+  uint8_t rows = 1 << addrCount;
+  uint8_t tiles = tileCount(tile);
+  uint8_t* dest = frames[n];
+
+  for (uint8_t r = 0; r < rows; r++, dest += (uint32_t)chainWidth * (depth - 1)) {
+    for (int8_t t = tiles - 1; t >= 0; t--, dest += w) {
+      const uint16_t* tileTop = canvas + (uint32_t)t * w * rows * 2;
+      const uint16_t* upper;
+      const uint16_t* lower;
+      int16_t x0, step;
+      if ((t & 1) && tile < 0) {
+        lower = tileTop + (uint32_t)w * (rows - 1 - r);
+        upper = lower + (uint32_t)w * rows;
+        x0 = w - 1;
+        step = -1;
+      } else {
+        upper = tileTop + (uint32_t)w * r;
+        lower = upper + (uint32_t)w * rows;
+        x0 = 0;
+        step = 1;
+      }
+
+      int16_t sx = x0;
+      for (uint16_t x = 0; x < w; x++, sx += step) {
+        uint16_t cu = upper[sx], cl = lower[sx];
+        uint32_t bu = planeBits[0][cu >> 11] | planeBits[1][(cu >> 5) & 0x3F] | planeBits[2][cu & 0x1F];
+        uint32_t bl = planeBits[0][cl >> 11] | planeBits[1][(cl >> 5) & 0x3F] | planeBits[2][cl & 0x1F];
+        uint8_t* out = dest + x;
+        for (uint8_t p = 0; p < depth; p++, out += chainWidth, bu >>= 4, bl >>= 4) {
+          *out = pinBits[(bu & 7) | ((bl & 7) << 3)];
+        }
+      }
+    }
+  }
+}
+
+#endif // MATRIX_PIO
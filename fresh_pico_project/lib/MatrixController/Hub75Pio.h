@@ -0,0 +1,107 @@
+#ifndef HUB75_PIO_H
+#define HUB75_PIO_H
+
+#ifdef MATRIX_PIO
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <hardware/pio.h>
+
+// HUB75 refresh from the RP2040's PIO and DMA, a stand-in for
+// Adafruit_Protomatter (build with -D MATRIX_PIO). Two state machines do
+// the whole refresh: one clocks each bit plane of a scan line out of the
+// RGB pins, the other latches it, sets the row address and holds OE on for
+// the plane's binary code modulation time while the next plane shifts.
+// DMA feeds both from buffers that loop by themselves, so the CPU is only
+// involved once per frame (a DMA interrupt that counts refreshes) and in
+// show(), which converts the canvas into bit planes.
+//
+// Wiring limits: one chain; the six RGB pins within eight consecutive
+// GPIOs; OE on the GPIO after LAT; the address pins within 32 consecutive
+// GPIOs. Address writes also reach the GPIOs in between (CLK, LAT and OE
+// on this wall); that is harmless because they only happen while latching,
+// when the row SM's side-set holds LAT and OE and the clock is idle.
+
+// Panel shift clock
+#ifndef MATRIX_PIO_CLOCK_HZ
+#define MATRIX_PIO_CLOCK_HZ 20000000
+#endif
+
+// Refresh rate the plane on-times are sized for. Higher rates shorten
+// them, which dims the panel once they're down to the shift time.
+#ifndef MATRIX_REFRESH_HZ
+#define MATRIX_REFRESH_HZ 200
+#endif
+
+class Hub75Pio : public GFXcanvas16 {
+  public:
+    // Same arguments as Adafruit_Protomatter, less the timer
+    Hub75Pio(uint16_t bitWidth, uint8_t bitDepth,
+             uint8_t rgbCount, uint8_t* rgbList,
+             uint8_t addrCount, uint8_t* addrList,
+             uint8_t clockPin, uint8_t latchPin, uint8_t oePin,
+             bool doubleBuffer, int8_t tile = 1);
+
+    // Claim the state machines and DMA channels and start refreshing.
+    // False if the wiring doesn't fit (see above) or resources ran out.
+    bool begin();
+
+    // Convert the canvas into the next frame's bit planes. With double
+    // buffering it goes up at the end of the frame being shown; waits only
+    // if the previous show() hasn't gone up yet.
+    void show();
+
+    // show() without the wait: false, and nothing converted, while the
+    // previous show() is still waiting to go up
+    bool tryShow();
+
+    // True from show() until its frame is on the panel
+    bool swapPending() { return active != queued; }
+
+    // Called from the DMA interrupt when a new frame goes up; keep it short
+    void setSwapCallback(void (*callback)(void)) { swapCallback = callback; }
+
+    // Panel refreshes since the last call
+    uint32_t getFrameCount();
+
+    static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+      return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+  private:
+    // Bit planes of canvas for frame n
+    void convert(uint8_t n);
+
+    static void dmaHandler();
+
+    uint8_t rgbPins[6];
+    uint8_t addrPins[5];
+    uint8_t rgbCount;             // Chains
+    uint8_t addrCount;
+    uint8_t rgbBase;              // First GPIO of the RGB output span
+    uint8_t addrBase, addrSpan;   // Address output span
+    uint8_t clockPin, latchPin, oePin;
+    uint8_t depth;
+    int8_t tile;
+    uint16_t chainWidth;          // Pixels per scan line, all tiles
+    uint8_t frameCount;           // Bit plane frames, 1 or 2
+    uint32_t frameBytes;
+    uint8_t* frames[2];           // [row][plane][chainWidth] pin bytes
+    uint32_t* rowWords;           // Per row and plane: address pins, on-time
+    uint32_t planeBits[3][64];    // Per channel level, 4 bits per plane (see convert())
+    uint8_t pinBits[64];          // 6 RGB bits -> output byte
+
+    PIO pio;
+    uint dataSm, rowSm;
+    uint dataChan, dataCtrl, rowChan, rowCtrl;
+    volatile uint32_t nextFrame;  // Read address the data DMA restarts from
+    uint32_t rowStart;            // Read address the row DMA restarts from
+    volatile uint8_t active;      // Frame the DMA is reading
+    volatile uint8_t queued;      // Frame the last show() filled
+    volatile uint32_t refreshes;
+    void (*volatile swapCallback)(void);
+};
+
+#endif // MATRIX_PIO
+
+#endif // HUB75_PIO_H
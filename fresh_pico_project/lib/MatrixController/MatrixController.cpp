@@ -1,82 +1,436 @@
 #include "MatrixController.h"
 
+// 8-bit linear intensity -> 8-bit intensity with gamma 2.2 applied,
+// round(255 * (i / 255) ^ 2.2)
+static const uint8_t gammaTable[256] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06,
+  0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0a, 0x0a,
+  0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0f, 0x0f,
+  0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x15, 0x16,
+  0x16, 0x17, 0x17, 0x18, 0x19, 0x19, 0x1a, 0x1a, 0x1b, 0x1c, 0x1c, 0x1d,
+  0x1e, 0x1e, 0x1f, 0x20, 0x21, 0x21, 0x22, 0x23, 0x23, 0x24, 0x25, 0x26,
+  0x27, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+  0x31, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+  0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x51, 0x52, 0x53, 0x54, 0x55,
+  0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5d, 0x5e, 0x5f, 0x61, 0x62, 0x63, 0x64,
+  0x66, 0x67, 0x69, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x71, 0x72, 0x74, 0x75,
+  0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x87,
+  0x89, 0x8a, 0x8c, 0x8d, 0x8f, 0x91, 0x92, 0x94, 0x95, 0x97, 0x99, 0x9a,
+  0x9c, 0x9e, 0x9f, 0xa1, 0xa3, 0xa5, 0xa6, 0xa8, 0xaa, 0xac, 0xad, 0xaf,
+  0xb1, 0xb3, 0xb5, 0xb6, 0xb8, 0xba, 0xbc, 0xbe, 0xc0, 0xc2, 0xc4, 0xc5,
+  0xc7, 0xc9, 0xcb, 0xcd, 0xcf, 0xd1, 0xd3, 0xd5, 0xd7, 0xd9, 0xdb, 0xdd,
+  0xdf, 0xe1, 0xe3, 0xe5, 0xe7, 0xea, 0xec, 0xee, 0xf0, 0xf2, 0xf4, 0xf6,
+  0xf8, 0xfb, 0xfd, 0xff
+};
+
+// Gamma-correct an 8-bit channel and round it to one of the 2^bits shades
+// the panel shows, returned as an 8-bit value whose top bits are that shade.
+// A lit channel keeps at least the dimmest shade rather than going dark.
+static inline uint8_t gammaChannel(uint8_t v, uint8_t bits) {
+  uint16_t top = (1 << bits) - 1;
+  uint16_t level = (gammaTable[v] * top + 127) / 255;
+  if (level == 0 && v > 0) level = 1;
+  return level * 255 / top;
+}
+
+// Channel v in quarters of the 2^bits shades (0..4 * top), after gamma or
+// not; a lit channel keeps at least a quarter shade
+static inline uint16_t ditherLevel(uint8_t v, uint8_t bits, bool gamma) {
+  uint16_t top = (1 << bits) - 1;
+  uint16_t q = ((gamma ? gammaTable[v] : v) * top * 4 + 127) / 255;
+  if (q == 0 && v > 0) q = 1;
+  return q;
+}
+
+// The channel at 2x2 phase p: the shade below, or the next one where the
+// fraction is above that phase's Bayer threshold, as an 8-bit value
+static inline uint8_t ditherChannel(uint16_t q, uint8_t bits, uint8_t p) {
+  static const uint8_t threshold[DITHER_PHASES] = { 0, 2, 3, 1 };
+  uint16_t top = (1 << bits) - 1;
+  uint16_t level = (q >> 2) + ((q & 3) > threshold[p]);
+  return level * 255 / top;
+}
+
 MatrixController::MatrixController(
   uint8_t rgbPins[],
   uint8_t addrPins[],
   uint8_t clockPin,
   uint8_t latchPin,
   uint8_t oePin,
-  uint8_t width,
-  uint8_t height,
+  uint16_t width,
+  uint16_t height,
   uint8_t panels,
   bool doubleBuffer,
-  int8_t tileMode
+  int8_t tileMode,
+  uint8_t chains
 ) {
   matrixWidth = width;
   matrixHeight = height;
   matrixPanels = panels;
   
-  matrix = new Adafruit_Protomatter(
+  matrix = new MatrixDisplay(
     width,             // Width of matrix (or matrix chain) IN PIXELS
-    4,                 // Bit depth per channel (4 = 16 shades of each R,G,B)
-    1, rgbPins,        // # of data pin pairs, array of RGB pins
+    MATRIX_BIT_DEPTH,  // Bit depth per channel (4 = 16 shades of each R,G,B)
+    chains, rgbPins,   // # of data pin pairs (parallel chains), array of RGB pins
     5, addrPins,       // # of address pins (height is 2^n), array of address pins
     clockPin,          // Clock pin
     latchPin,          // Latch pin
     oePin,             // Output enable pin
     doubleBuffer,      // Use double-buffering
-    tileMode,          // Tiling mode (0=none, 1=serpentine, 2=progressive)
-    NULL               // Timer (NULL = default)
+    tileMode           // Rows of panels per chain, negative for serpentine
+#ifndef MATRIX_PIO
+    , NULL             // Timer (NULL = default)
+#endif
   );
+  canvas = matrix->getBuffer();
+  pixelMap = NULL;
+  drawnRows = new uint8_t[(height + 7) / 8]();
+#ifndef MATRIX_PIO
+  swapCallback = NULL;
+#endif
 }
 
-bool MatrixController::begin() {
+bool MatrixController::begin(Print& log) {
   // Initialize the matrix
+#ifdef MATRIX_PIO
+  if (!matrix->begin()) {
+    log.println("PIO HUB75 init failed");
+    return false;
+  }
+  return true;
+#else
   ProtomatterStatus status = matrix->begin();
   if (status != PROTOMATTER_OK) {
-    Serial1.print("Protomatter init failed: ");
-    Serial1.println((int)status);
+    log.print("Protomatter init failed: ");
+    log.println((int)status);
     return false;
   }
   return true;
+#endif
 }
 
 void MatrixController::clear() {
+  noteAllRows();
   matrix->fillScreen(0);
 }
 
 void MatrixController::show() {
   matrix->show();
+#ifndef MATRIX_PIO
+  if (swapCallback) swapCallback();
+#endif
+}
+
+bool MatrixController::tryShow() {
+#ifdef MATRIX_PIO
+  return matrix->tryShow();
+#else
+  show();
+  return true;
+#endif
+}
+
+bool MatrixController::swapPending() {
+#ifdef MATRIX_PIO
+  return matrix->swapPending();
+#else
+  return false;
+#endif
+}
+
+void MatrixController::setSwapCallback(void (*callback)(void)) {
+#ifdef MATRIX_PIO
+  matrix->setSwapCallback(callback);
+#else
+  swapCallback = callback;
+#endif
 }
 
 void MatrixController::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  noteAllRows();
   matrix->drawPixel(x, y, color);
 }
 
 void MatrixController::fillScreen(uint16_t color) {
+  noteAllRows();
   matrix->fillScreen(color);
 }
 
-Adafruit_Protomatter* MatrixController::getDisplay() {
+void MatrixController::setPixelMap(const uint16_t* map) {
+  pixelMap = map;
+}
+
+void MatrixController::setTarget(uint16_t* frame) {
+  canvas = frame ? frame : matrix->getBuffer();
+}
+
+void MatrixController::blendFrame(const uint16_t* frame, uint16_t alpha) {
+  noteAllRows();
+  uint16_t* out = matrix->getBuffer();
+  uint32_t count = (uint32_t)width() * height();
+  
+  if (alpha >= 256) {
+    memcpy(out, frame, count * sizeof(uint16_t));
+    return;
+  }
+  
+  // Per channel, c += (target - c) * alpha / 256
+  for (uint32_t i = 0; i < count; i++) {
+    uint16_t c = out[i];
+    uint16_t t = frame[i];
+    if (c == t) continue;
+    int16_t r = (c >> 11) + ((((int16_t)(t >> 11) - (c >> 11)) * alpha) >> 8);
+    int16_t g = ((c >> 5) & 0x3F) + ((((int16_t)((t >> 5) & 0x3F) - ((c >> 5) & 0x3F)) * alpha) >> 8);
+    int16_t b = (c & 0x1F) + ((((int16_t)(t & 0x1F) - (c & 0x1F)) * alpha) >> 8);
+    out[i] = (r << 11) | (g << 5) | b;
+  }
+}
+
+void MatrixController::blit(const uint16_t* frame) {
+  noteAllRows();
+  uint32_t count = (uint32_t)width() * height();
+  
+  if (pixelMap == NULL) {
+    memcpy(canvas, frame, count * sizeof(uint16_t));
+    return;
+  }
+  
+  // Scatter through the pixel map, four pixels per iteration
+  const uint16_t* map = pixelMap;
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    canvas[map[i]] = frame[i];
+    canvas[map[i + 1]] = frame[i + 1];
+    canvas[map[i + 2]] = frame[i + 2];
+    canvas[map[i + 3]] = frame[i + 3];
+  }
+  for (; i < count; i++) {
+    canvas[map[i]] = frame[i];
+  }
+}
+
+void MatrixController::blitIndexed(const uint8_t* frame, const uint16_t* palette) {
+  noteAllRows();
+  uint32_t count = (uint32_t)width() * height();
+  
+  if (pixelMap == NULL) {
+    for (uint32_t i = 0; i < count; i++) {
+      canvas[i] = palette[frame[i]];
+    }
+    return;
+  }
+  
+  const uint16_t* map = pixelMap;
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    canvas[map[i]] = palette[frame[i]];
+    canvas[map[i + 1]] = palette[frame[i + 1]];
+    canvas[map[i + 2]] = palette[frame[i + 2]];
+    canvas[map[i + 3]] = palette[frame[i + 3]];
+  }
+  for (; i < count; i++) {
+    canvas[map[i]] = palette[frame[i]];
+  }
+}
+
+void MatrixController::blitIndexedRows(const uint8_t* frame, const uint16_t* palette, const uint8_t* rowMask, uint16_t stride) {
+  uint16_t w = width();
+  uint16_t h = height();
+  if (stride == 0) stride = w;
+  
+  for (uint16_t y = 0; y < h; y++) {
+    // Skip a whole byte of clean rows at once
+    if (rowMask[y >> 3] == 0) {
+      y |= 7;
+      continue;
+    }
+    if (!(rowMask[y >> 3] & (1 << (y & 7)))) continue;
+    
+    blitIndexedRow(y, frame + (uint32_t)y * stride, palette);
+  }
+}
+
+void MatrixController::blitIndexedRow(uint16_t y, const uint8_t* row, const uint16_t* palette) {
+  blitIndexedSpan(y, 0, width(), row, palette);
+}
+
+void MatrixController::blitIndexedSpan(uint16_t y, uint16_t x, uint16_t count, const uint8_t* src, const uint16_t* palette) {
+  noteRow(y);
+  uint32_t start = (uint32_t)y * width() + x;
+  
+  if (pixelMap == NULL) {
+    uint16_t* dst = canvas + start;
+    for (uint16_t i = 0; i < count; i++) {
+      dst[i] = palette[src[i]];
+    }
+  } else {
+    const uint16_t* map = pixelMap + start;
+    for (uint16_t i = 0; i < count; i++) {
+      canvas[map[i]] = palette[src[i]];
+    }
+  }
+}
+
+void MatrixController::blitDitheredSpan(uint16_t y, uint16_t x, uint16_t count, const uint8_t* src, const uint16_t* even, const uint16_t* odd) {
+  noteRow(y);
+  uint32_t start = (uint32_t)y * width() + x;
+  
+  // Palettes for src[0] and src[1], whichever parity x has
+  const uint16_t* first = (x & 1) ? odd : even;
+  const uint16_t* second = (x & 1) ? even : odd;
+  uint16_t pairs = count / 2;
+  if (pixelMap == NULL) {
+    uint16_t* dst = canvas + start;
+    for (uint16_t i = 0; i < pairs; i++) {
+      dst[2 * i] = first[src[2 * i]];
+      dst[2 * i + 1] = second[src[2 * i + 1]];
+    }
+    if (count & 1) dst[count - 1] = first[src[count - 1]];
+  } else {
+    const uint16_t* map = pixelMap + start;
+    for (uint16_t i = 0; i < pairs; i++) {
+      canvas[map[2 * i]] = first[src[2 * i]];
+      canvas[map[2 * i + 1]] = second[src[2 * i + 1]];
+    }
+    if (count & 1) canvas[map[count - 1]] = first[src[count - 1]];
+  }
+}
+
+void MatrixController::blitBitmapRows(const uint32_t* bits, uint16_t offColor, uint16_t onColor, const uint8_t* rowMask) {
+  uint16_t w = width();
+  uint16_t h = height();
+  uint16_t wordsPerRow = (w + 31) / 32;
+  
+  for (uint16_t y = 0; y < h; y++) {
+    // Skip a whole byte of clean rows at once
+    if (rowMask[y >> 3] == 0) {
+      y |= 7;
+      continue;
+    }
+    if (!(rowMask[y >> 3] & (1 << (y & 7)))) continue;
+    
+    blitBitmapSpan(y, 0, w, bits + (uint32_t)y * wordsPerRow, offColor, onColor);
+  }
+}
+
+void MatrixController::blitBitmapSpan(uint16_t y, uint16_t x, uint16_t count, const uint32_t* rowBits, uint16_t offColor, uint16_t onColor) {
+  noteRow(y);
+  const uint16_t colors[2] = { offColor, onColor };
+  uint32_t start = (uint32_t)y * width();
+  uint16_t end = x + count;
+  
+  // A word at a time (or what is left of the span): where all of its cells
+  // match, which is most of a sparse frame, it goes out as one run
+  while (x < end) {
+    uint8_t shift = x & 31;
+    uint16_t n = 32 - shift;
+    if (n > end - x) n = end - x;
+    uint32_t mask = (n == 32) ? 0xFFFFFFFF : (1UL << n) - 1;
+    uint32_t word = (rowBits[x >> 5] >> shift) & mask;
+    
+    if (word == 0 || word == mask) {
+      fillSpan(y, x, n, colors[word != 0]);
+    } else if (pixelMap == NULL) {
+      uint16_t* dst = canvas + start + x;
+      for (uint16_t i = 0; i < n; i++) {
+        dst[i] = colors[(word >> i) & 1];
+      }
+    } else {
+      const uint16_t* map = pixelMap + start + x;
+      for (uint16_t i = 0; i < n; i++) {
+        canvas[map[i]] = colors[(word >> i) & 1];
+      }
+    }
+    x += n;
+  }
+}
+
+void MatrixController::fillSpan(uint16_t y, uint16_t x, uint16_t count, uint16_t color) {
+  noteRow(y);
+  uint32_t start = (uint32_t)y * width() + x;
+  
+  if (pixelMap == NULL) {
+    uint16_t* dst = canvas + start;
+    for (uint16_t i = 0; i < count; i++) {
+      dst[i] = color;
+    }
+  } else {
+    const uint16_t* map = pixelMap + start;
+    for (uint16_t i = 0; i < count; i++) {
+      canvas[map[i]] = color;
+    }
+  }
+}
+
+bool MatrixController::scrollUp(uint16_t rows) {
+  noteAllRows();
+  uint16_t w = width();
+  uint16_t h = height();
+  if (rows == 0 || rows >= h) return true;
+  
+  uint32_t moved = (uint32_t)(h - rows) * w;
+  if (pixelMap == NULL) {
+    memmove(canvas, canvas + (uint32_t)rows * w, moved * sizeof(uint16_t));
+    return true;
+  }
+  
+  // Top to bottom, so every source row is read before it is overwritten
+  const uint16_t* map = pixelMap;
+  uint32_t offset = (uint32_t)rows * w;
+  for (uint32_t i = 0; i < moved; i++) {
+    canvas[map[i]] = canvas[map[i + offset]];
+  }
+  return true;
+}
+
+MatrixDisplay* MatrixController::getDisplay() {
   return matrix;
 }
 
 void MatrixController::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  noteAllRows();
   matrix->drawRect(x, y, w, h, color);
 }
 
 void MatrixController::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  noteAllRows();
   matrix->fillRect(x, y, w, h, color);
 }
 
-int16_t MatrixController::width() {
-  return matrixWidth * matrixPanels;
+uint16_t MatrixController::color565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
 }
 
-int16_t MatrixController::height() {
-  return matrixHeight;
+uint16_t MatrixController::gammaColor565(uint8_t r, uint8_t g, uint8_t b) {
+  // RGB565 carries five bits of red and blue and six of green
+  const uint8_t rbBits = MATRIX_BIT_DEPTH < 5 ? MATRIX_BIT_DEPTH : 5;
+  const uint8_t gBits = MATRIX_BIT_DEPTH;
+  return color565(gammaChannel(r, rbBits), gammaChannel(g, gBits), gammaChannel(b, rbBits));
 }
 
-uint16_t MatrixController::color565(uint8_t r, uint8_t g, uint8_t b) {
-  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+void MatrixController::clearDrawnRows() {
+  memset(drawnRows, 0, (height() + 7) / 8);
+}
+
+void MatrixController::noteAllRows() {
+  memset(drawnRows, 0xFF, (height() + 7) / 8);
+}
+
+void MatrixController::dither565(uint8_t r, uint8_t g, uint8_t b, bool gamma, uint16_t* phases) {
+  const uint8_t rbBits = MATRIX_BIT_DEPTH < 5 ? MATRIX_BIT_DEPTH : 5;
+  const uint8_t gBits = MATRIX_BIT_DEPTH;
+  uint16_t qr = ditherLevel(r, rbBits, gamma);
+  uint16_t qg = ditherLevel(g, gBits, gamma);
+  uint16_t qb = ditherLevel(b, rbBits, gamma);
+  for (uint8_t p = 0; p < DITHER_PHASES; p++) {
+    phases[p] = color565(ditherChannel(qr, rbBits, p), ditherChannel(qg, gBits, p), ditherChannel(qb, rbBits, p));
+  }
+}
+
+uint32_t MatrixController::getRefreshCount() {
+  return matrix->getFrameCount();
 }
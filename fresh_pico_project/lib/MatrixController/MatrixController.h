@@ -3,26 +3,54 @@
 
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
+#include <DisplayBackend.h>
+
+// Panel driver: Adafruit_Protomatter, or with -D MATRIX_PIO the PIO/DMA
+// refresh in Hub75Pio.h. Both are GFX canvases with the same begin(),
+// show() and getFrameCount().
+#ifdef MATRIX_PIO
+#include "Hub75Pio.h"
+typedef Hub75Pio MatrixDisplay;
+#else
 #include <Adafruit_Protomatter.h>
+typedef Adafruit_Protomatter MatrixDisplay;
+#endif
+
+// Bit depth per channel: 2^n shades of each R,G,B. Every extra bit roughly
+// doubles the time Protomatter spends on a refresh (see performance_testing.md);
+// with MATRIX_PIO it costs frame memory and show() time instead, not CPU.
+#ifndef MATRIX_BIT_DEPTH
+#define MATRIX_BIT_DEPTH 4
+#endif
 
-class MatrixController {
+#if MATRIX_BIT_DEPTH < 1 || MATRIX_BIT_DEPTH > 6
+#error "MATRIX_BIT_DEPTH must be between 1 and 6"
+#endif
+
+// The Pico's display backend (see DisplayBackend.h): it has a version of
+// every drawing call of its own, working on the canvas through the pixel map
+class MatrixController : public DisplayBackend<MatrixController> {
   public:
-    // Constructor - sets up matrix display with specific pin configurations
+    static const uint8_t COLOR_DEPTH = MATRIX_BIT_DEPTH;
+    
+    // Constructor - sets up matrix display with specific pin configurations.
+    // rgbPins holds 6 pins per parallel chain (chains RGB pin groups).
     MatrixController(
       uint8_t rgbPins[],
       uint8_t addrPins[],
       uint8_t clockPin,
       uint8_t latchPin,
       uint8_t oePin,
-      uint8_t width,
-      uint8_t height,
+      uint16_t width,
+      uint16_t height,
       uint8_t panels = 1,
       bool doubleBuffer = true,
-      int8_t tileMode = 0
+      int8_t tileMode = 0,
+      uint8_t chains = 1
     );
     
-    // Initialize the display
-    bool begin();
+    // Initialize the display; failures are printed to log
+    bool begin(Print& log = Serial1);
     
     // Clear the display
     void clear();
@@ -30,26 +58,132 @@ class MatrixController {
     // Show buffer on display (when double buffering)
     void show();
     
+    // Show without waiting for the previous frame's swap: false, and
+    // nothing shown, while it is still pending. Protomatter's show() waits
+    // for its own swap, so there this is show() and always true.
+    bool tryShow();
+    
+    // True while a shown frame hasn't reached the panel yet (never with
+    // Protomatter, see tryShow())
+    bool swapPending();
+    
+    // Have callback run when a shown frame reaches the panel. With
+    // MATRIX_PIO it runs in the DMA interrupt at the end of the refresh;
+    // with Protomatter, as show() returns (right after its swap).
+    void setSwapCallback(void (*callback)(void));
+    
     // Set a pixel at specific coordinates with RGB color
     void drawPixel(int16_t x, int16_t y, uint16_t color);
     
     // Fill the entire matrix with a color
     void fillScreen(uint16_t color);
     
+    // Use a logical-to-physical pixel map (one canvas offset per logical
+    // pixel, e.g. PanelMap::data()). NULL means logical == physical.
+    void setPixelMap(const uint16_t* map);
+    
+    // Draw into frame (width() x height() pixels in canvas layout) instead of
+    // the Protomatter canvas, e.g. to composite it later with blendFrame().
+    // NULL draws to the canvas again.
+    void setTarget(uint16_t* frame);
+    
+    // Move every canvas pixel toward the same pixel of frame by alpha / 256
+    // of the difference (256 copies frame). Writes the Protomatter canvas
+    // whatever the target.
+    void blendFrame(const uint16_t* frame, uint16_t alpha);
+    
+    // Set a pixel in logical coordinates, remapped through the pixel map
+    inline void drawMappedPixel(int16_t x, int16_t y, uint16_t color) {
+      if ((uint16_t)x >= (uint16_t)width() || (uint16_t)y >= (uint16_t)height()) return;
+      noteRow(y);
+      uint16_t index = y * width() + x;
+      canvas[pixelMap ? pixelMap[index] : index] = color;
+    }
+
+    // Flip the bits of a pixel in logical coordinates, remapped like
+    // drawMappedPixel()
+    inline void xorMappedPixel(int16_t x, int16_t y, uint16_t bits) {
+      if ((uint16_t)x >= (uint16_t)width() || (uint16_t)y >= (uint16_t)height()) return;
+      noteRow(y);
+      uint16_t index = y * width() + x;
+      canvas[pixelMap ? pixelMap[index] : index] ^= bits;
+    }
+
+    // Push a whole logical frame (width() x height() RGB565 pixels) into the
+    // back buffer in one pass, applying the pixel map
+    void blit(const uint16_t* frame);
+    
+    // Same as blit(), but the frame holds one palette index per pixel
+    void blitIndexed(const uint8_t* frame, const uint16_t* palette);
+    
+    // Same as blitIndexed(), but only rows whose bit is set in rowMask
+    // (bit y & 7 of byte y >> 3) are written; the rest of the canvas is kept.
+    // stride is the distance between frame rows (0 = width()).
+    void blitIndexedRows(const uint8_t* frame, const uint16_t* palette, const uint8_t* rowMask, uint16_t stride = 0);
+    
+    // Write logical row y from one palette index per pixel (width() entries)
+    void blitIndexedRow(uint16_t y, const uint8_t* row, const uint16_t* palette);
+    
+    // Write count pixels of logical row y starting at column x; src holds the
+    // palette index of pixel x onwards
+    void blitIndexedSpan(uint16_t y, uint16_t x, uint16_t count, const uint8_t* src, const uint16_t* palette);
+    
+    // Same as blitIndexedSpan(), but even and odd logical columns go through
+    // palettes of their own, for dithering
+    void blitDitheredSpan(uint16_t y, uint16_t x, uint16_t count, const uint8_t* src, const uint16_t* even, const uint16_t* odd);
+    
+    // Same for one bit-packed row (bit (x & 31) of word (x >> 5) set = onColor).
+    // Words whose cells are all off or all on are written as fillSpan() runs.
+    void blitBitmapSpan(uint16_t y, uint16_t x, uint16_t count, const uint32_t* rowBits, uint16_t offColor, uint16_t onColor);
+    
+    // Write count pixels of logical row y starting at column x in one color
+    void fillSpan(uint16_t y, uint16_t x, uint16_t count, uint16_t color);
+    
+    // Row-masked blit of a 1-bit frame: bit (x & 31) of word (x >> 5) in each
+    // row selects onColor, otherwise offColor. Rows are padded to 32 bits.
+    void blitBitmapRows(const uint32_t* bits, uint16_t offColor, uint16_t onColor, const uint8_t* rowMask);
+    
+    // Move the canvas up by rows logical rows (row y takes row y + rows),
+    // through the pixel map. The bottom rows keep stale pixels for the
+    // caller to redraw. Always true (done).
+    bool scrollUp(uint16_t rows);
+    
     // Get a reference to the underlying display object
-    Adafruit_Protomatter* getDisplay();
+    MatrixDisplay* getDisplay();
     
     // Draw a rectangle on the display
     void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     
     // Method to get matrix dimensions
-    int16_t width();
-    int16_t height();
+    inline int16_t width() { return matrixWidth * matrixPanels; }
+    inline int16_t height() { return matrixHeight; }
     
     // 16-bit color conversion functions
     uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
     
+    // Same, but gamma-corrected (2.2) and rounded to the nearest shade the
+    // panel can show at MATRIX_BIT_DEPTH, so gradients step evenly. Meant for
+    // building palettes, not for per-pixel use.
+    uint16_t gammaColor565(uint8_t r, uint8_t g, uint8_t b);
+    
+    // The DITHER_PHASES colors of an ordered dither for (r, g, b),
+    // gamma-corrected like gammaColor565() or not: each channel, in quarters
+    // of the shades the panel shows at MATRIX_BIT_DEPTH, goes up to the next
+    // shade on as many of the four pixels of a 2x2 pattern as its fraction
+    // says
+    void dither565(uint8_t r, uint8_t g, uint8_t b, bool gamma, uint16_t* phases);
+    
+    // Panel refreshes since the last call (Protomatter's own counter)
+    uint32_t getRefreshCount();
+    
+    // Logical rows drawn to since clearDrawnRows() (bit y & 7 of byte
+    // y >> 3), whatever the target, so the compositor (src/Compositor.h)
+    // knows which rows of its layers were painted over. Calls that don't
+    // work in logical rows mark every row.
+    const uint8_t* getDrawnRows() const { return drawnRows; }
+    void clearDrawnRows();
+    
     // Common colors
     static const uint16_t BLACK = 0x0000;
     static const uint16_t WHITE = 0xFFFF;
@@ -61,10 +195,19 @@ class MatrixController {
     static const uint16_t MAGENTA = 0xF81F;
     
   private:
-    Adafruit_Protomatter* matrix; // Our LED matrix display object
-    uint8_t matrixWidth;
-    uint8_t matrixHeight;
+    inline void noteRow(uint16_t y) { drawnRows[y >> 3] |= 1 << (y & 7); }
+    void noteAllRows();
+    
+    MatrixDisplay* matrix;        // Our LED matrix display object
+    uint16_t matrixWidth;
+    uint16_t matrixHeight;
     uint8_t matrixPanels;
+    uint16_t* canvas;             // Draw target: the Protomatter canvas or an offscreen frame
+    const uint16_t* pixelMap;     // Logical-to-physical offsets, or NULL
+    uint8_t* drawnRows;           // See getDrawnRows()
+#ifndef MATRIX_PIO
+    void (*swapCallback)(void);   // Run after each show()
+#endif
 };
 
 #endif
@@ -0,0 +1,85 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <Arduino.h>
+#include <new>
+#include <utility>
+#include "SerialLog.h"
+
+// Alignment of every arena block (covers the uint64_t counters in StageStats)
+#define ARENA_ALIGN 8
+
+/**
+ * Bump allocator over a fixed buffer
+ *
+ * Blocks are handed out back to back and never freed one by one; reset()
+ * releases all of them at once. Allocation is a few additions, never
+ * fragments and never touches the heap. Only types that need no destructor
+ * (plain arrays, node pools, the automaton objects whose destructors run
+ * before reset()) should live here.
+ */
+class Arena {
+public:
+    Arena(uint8_t* buffer, uint32_t size)
+        : buffer(buffer), size(size), used(0), peak(0) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Raw block of bytes, or NULL (reported in the log) if it doesn't fit
+    void* allocate(uint32_t bytes) {
+        uint32_t start = (used + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1);
+        if (start > size || bytes > size - start) {
+            Print& out = logOut();
+            out.print("Arena exhausted: ");
+            out.print(bytes);
+            out.print(" bytes requested, ");
+            out.print(size - used);
+            out.println(" free");
+            return NULL;
+        }
+        used = start + bytes;
+        if (used > peak) peak = used;
+        return buffer + start;
+    }
+
+    // Uninitialized array of count plain values
+    template<typename T>
+    T* allocate(uint32_t count) {
+        return static_cast<T*>(allocate(count * sizeof(T)));
+    }
+
+    // Construct one object in the arena
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        void* block = allocate(sizeof(T));
+        return block ? new (block) T(std::forward<Args>(args)...) : NULL;
+    }
+
+    // Release every block
+    void reset() {
+        used = 0;
+    }
+
+    // Fill level to hand back to rewind()
+    uint32_t mark() const { return used; }
+
+    // Release the blocks allocated since mark() returned m, for scratch
+    // space taken after everything long-lived (e.g. SnapshotStore staging)
+    void rewind(uint32_t m) {
+        if (m < used) used = m;
+    }
+
+    uint32_t getUsed() const { return used; }
+    uint32_t getPeak() const { return peak; }
+    uint32_t getSize() const { return size; }
+    uint32_t getFree() const { return size - used; }
+
+private:
+    uint8_t* buffer;
+    uint32_t size;
+    uint32_t used;  // Bytes handed out since the last reset()
+    uint32_t peak;  // Largest `used` seen
+};
+
+#endif
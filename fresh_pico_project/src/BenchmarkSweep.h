@@ -0,0 +1,140 @@
+#ifndef BENCHMARK_SWEEP_H
+#define BENCHMARK_SWEEP_H
+
+#include <Arduino.h>
+#include "CellularAutomata.h"
+#include "SerialLog.h"
+
+// Seed every case starts from, so runs on different builds compare
+#define SWEEP_SEED 12345
+
+// Cases, in table order: Elementary, the Game of Life rule sets, Game of
+// Life on a world bigger than the display, Brian's Brain, Langton's Ant,
+// the Cyclic presets, Bubbling Lava, Order and Chaos, the Larger than Life
+// presets and SmoothLife
+#define SWEEP_GOL_WORLD (1 + GameOfLife::DIAMOEBA + 1)
+#define SWEEP_CASES (1 + (GameOfLife::DIAMOEBA + 1) + 3 + (CyclicAutomaton::SKIP_STATES + 1) + 2 + \
+                     LargerThanLife::NUM_PRESETS + 1)
+
+/**
+ * Benchmark of every automaton and preset, for a per-release baseline
+ *
+ * Each case is built from SWEEP_SEED and run twice for the same number of
+ * generations from the same start: once as the display runs it, compute(),
+ * draw() and present() one after another on the calling core, and once
+ * with compute() alone. A row per case gives the average update, render
+ * and show times in microseconds and the frames per second of the first
+ * run, then the update time and generations per second of the second.
+ *
+ * It takes the automaton arena for itself: delete the running automaton
+ * first. Rows are logged as they finish.
+ */
+class BenchmarkSweep {
+public:
+    BenchmarkSweep(Display* matrix, uint16_t width, uint16_t height)
+        : matrix(matrix), width(width), height(height) {}
+
+    void run(uint32_t generations, Print& out) {
+        char line[112];
+        snprintf(line, sizeof(line), "Benchmark sweep, %lu generations per case, seed %u",
+                 (unsigned long)generations, SWEEP_SEED);
+        out.println(line);
+        snprintf(line, sizeof(line), "%-40s %7s %7s %7s %6s | %7s %7s",
+                 "automaton", "update", "render", "show", "fps", "alone", "gen/s");
+        out.println(line);
+        serialLog().service();
+
+        uint32_t sweepStart = millis();
+        for (uint8_t i = 0; i < SWEEP_CASES; i++) {
+            Timing shown = time(i, generations, true);
+            Timing alone = time(i, generations, false);
+            uint32_t fps = rate10(generations, shown.updateUs + shown.renderUs + shown.showUs);
+            uint32_t gens = rate10(generations, alone.updateUs);
+            snprintf(line, sizeof(line), "%-40.40s %7lu %7lu %7lu %4lu.%lu | %7lu %5lu.%lu",
+                     shown.name,
+                     (unsigned long)(shown.updateUs / generations),
+                     (unsigned long)(shown.renderUs / generations),
+                     (unsigned long)(shown.showUs / generations),
+                     (unsigned long)(fps / 10), (unsigned long)(fps % 10),
+                     (unsigned long)(alone.updateUs / generations),
+                     (unsigned long)(gens / 10), (unsigned long)(gens % 10));
+            out.println(line);
+            serialLog().service(); // The rows go out while the next case runs
+        }
+        out.print("Benchmark sweep done in ");
+        out.print((millis() - sweepStart) / 1000);
+        out.println(" s");
+    }
+
+private:
+    // Microseconds spent in each stage over a run
+    struct Timing {
+        uint64_t updateUs, renderUs, showUs;
+        char name[48];
+    };
+
+    // Build case i from the seed
+    CellularAutomaton* create(uint8_t i) {
+        fastRandomSeed(SWEEP_SEED);
+        if (i == 0) return new ElementaryAutomaton(matrix, width, height, 30);
+        i -= 1;
+        if (i <= GameOfLife::DIAMOEBA) {
+            GameOfLife* automaton = new GameOfLife(matrix, width, height);
+            automaton->setRuleSet((GameOfLife::RuleSet)i);
+            return automaton;
+        }
+        i -= GameOfLife::DIAMOEBA + 1;
+        if (i == 0) return new GameOfLife(matrix, width * GOL_WORLD_SCALE, height * GOL_WORLD_SCALE);
+        if (i == 1) return new BriansBrain(matrix, width, height);
+        if (i == 2) return new LangtonsAnt(matrix, width, height, 5);
+        i -= 3;
+        if (i <= CyclicAutomaton::SKIP_STATES) {
+            CyclicAutomaton* automaton = new CyclicAutomaton(matrix, width, height);
+            automaton->setPreset((CyclicAutomaton::Preset)i);
+            return automaton;
+        }
+        i -= CyclicAutomaton::SKIP_STATES + 1;
+        if (i == 0) return new BubblingLava(matrix, width, height);
+        if (i == 1) return new OrderAndChaos(matrix, width, height);
+        i -= 2;
+        if (i < LargerThanLife::NUM_PRESETS) {
+            return new LargerThanLife(matrix, width, height, (LargerThanLife::Preset)i);
+        }
+        return new SmoothLife(matrix, width, height);
+    }
+
+    // Run case i for generations, drawing and showing each one or not
+    Timing time(uint8_t i, uint32_t generations, bool display) {
+        Timing t = {0, 0, 0, {0}};
+        CellularAutomaton* automaton = create(i);
+        automaton->init();
+        automaton->markAllDirty();
+        for (uint32_t g = 0; g < generations; g++) {
+            uint32_t start = micros();
+            automaton->compute();
+            uint32_t computed = micros();
+            t.updateUs += computed - start;
+            if (!display) continue;
+            automaton->draw();
+            uint32_t drawn = micros();
+            automaton->present();
+            t.renderUs += drawn - computed;
+            t.showUs += micros() - drawn;
+        }
+        // getName() fills a buffer the class shares
+        snprintf(t.name, sizeof(t.name), "%s%s", automaton->getName(), i == SWEEP_GOL_WORLD ? " world" : "");
+        delete automaton;
+        return t;
+    }
+
+    // Tenths per second, for n of something that took us microseconds
+    // (snprintf on the Pico may leave out floating point)
+    static uint32_t rate10(uint32_t n, uint64_t us) {
+        return us > 0 ? (uint32_t)(n * 10000000ULL / us) : 0;
+    }
+
+    Display* matrix;
+    uint16_t width, height;
+};
+
+#endif
@@ -2,11 +2,17 @@
 #define CELLULAR_AUTOMATA_H
 
 #include <Arduino.h>
-#include <Adafruit_Protomatter.h>
+#include "Display.h"
 #include "PanelConfig.h"
+#include "Arena.h"
+#include "Colors.h"
+#include "FastRandom.h"
+#include "FixedMath.h"
+#include "Hashlife.h"
+#include "Snapshot.h"
 
 // Number of distinct automata implementations
-#define NUM_AUTOMATA 7
+#define NUM_AUTOMATA 9
 
 // Forward declarations of automata classes
 class CellularAutomaton;
@@ -17,6 +23,425 @@ class LangtonsAnt;
 class CyclicAutomaton;
 class BubblingLava;
 class OrderAndChaos;
+class LargerThanLife;
+class SmoothLife;
+
+// ElementaryAutomaton keeps scrolling once the screen is full instead of
+// starting over with a new rule
+#define ECA_SCROLL 1
+
+// Largest CyclicAutomaton neighborhood range (and its grid halo), and most
+// states
+#define CYCLIC_MAX_RANGE 3
+#define CYCLIC_MAX_STATES 32
+
+// Largest LargerThanLife range, and most states (decaying ones included)
+#define LTL_MAX_RANGE 10
+#define LTL_MAX_STATES 16
+
+// SmoothLife's outer radius (the inner disk's is a third of it)
+#define SMOOTH_LIFE_RADIUS 15
+
+// Longest cycle (in generations) a tracked automaton can repeat and still
+// count as stagnant (see CellularAutomaton::trackActivity())
+#define STAGNATION_PERIOD 16
+
+// Most generations advance() runs through one updateMany() between checks
+// of its time budget
+#define ADVANCE_MAX_BATCH 16
+
+// Count live cells, births and deaths for telemetry, in automata with a
+// live state (see CellularAutomaton::trackPopulation()). Costs a popcount
+// per changed word in update() and per word of each changed row after it.
+#define AUTOMATON_POPULATION 1
+
+// Ordered dithering for the palettes that opt in (CyclicAutomaton's, the
+// trails of BubblingLava): colors between two of the panel's shades are
+// spread over a 2x2 pattern of the shades either side, two more bits of
+// apparent depth for the cost of a second palette lookup per pixel pair.
+// 0 is off, 1 a fixed pattern, 2 a pattern that steps every frame so each
+// pixel cycles through all four phases (temporal dithering); that repaints
+// every row of those automata each frame instead of the changed ones.
+#ifndef AUTOMATON_DITHER
+#define AUTOMATON_DITHER 0
+#endif
+
+// Most cell colors (rule letters) a LangtonsAnt turmite can have
+#define LANGTON_MAX_COLORS 12
+
+// Cells LangtonsAnt repaints one by one per frame before it falls back to
+// repainting dirty tiles
+#define LANGTON_MAX_TOUCHED 2048
+
+// Run GameOfLife through the memoized Hashlife engine when the grid allows it
+#define GOL_HASHLIFE 1
+
+// Generations GameOfLife stays on the dense kernel after the Hashlife cache
+// overflowed too soon to pay off
+#define GOL_HASHLIFE_RETRY_AFTER 256
+
+// Generations the Hashlife cache has to last for a reload to be worth it
+#define GOL_HASHLIFE_MIN_RUN 32
+
+// GameOfLife on a grid bigger than the display runs as a wrapping world and
+// shows it through a viewport that pans and zooms out, up to the whole
+// world. GOL_WORLD_SCALE is the world size in displays across and down.
+#define GOL_WORLD_SCALE 3
+
+// Frames between changes of the viewport's zoom and direction
+#define GOL_WORLD_VIEW_FRAMES 750
+
+// Arena bytes beyond the largest automaton's grids, for the automaton
+// object itself and its small per-row buffers
+#define AUTOMATON_ARENA_SLACK 4096
+
+// Bytes of a TOTAL_WIDTH x TOTAL_HEIGHT HaloGrid with the given halo
+#define HALO_GRID_BYTES(halo) ((uint32_t)(TOTAL_WIDTH + 2 * (halo)) * (TOTAL_HEIGHT + 2 * (halo)))
+
+// Staging for a snapshot of the given grid bytes, with a page to spare for
+// the automaton's other fields
+#define GRID_SNAPSHOT_STAGING(grid) SNAPSHOT_STAGING_BYTES((uint32_t)(grid) + SNAPSHOT_PAGE)
+
+/**
+ * Arena that the running automaton and all of its grids are allocated from
+ * 
+ * Only one automaton exists at a time, so switching rewinds this arena
+ * instead of freeing and reallocating on the heap. It is sized for the
+ * hungriest automaton at TOTAL_WIDTH x TOTAL_HEIGHT: GameOfLife with its
+ * Hashlife cache or on its GOL_WORLD_SCALE world, OrderAndChaos (three halo
+ * grids) or CyclicAutomaton (two grids with a CYCLIC_MAX_RANGE halo). Each
+ * with the room SnapshotStore::begin() needs to stage its snapshot, which
+ * holds the current grid but not the scratch ones or the Hashlife cache.
+ */
+inline Arena& automatonArena() {
+    constexpr uint32_t gameOfLife = Hashlife::storageBytes() + sizeof(Hashlife) +
+                                    (uint32_t)TOTAL_WIDTH * TOTAL_HEIGHT / 4 +
+                                    GRID_SNAPSHOT_STAGING((uint32_t)TOTAL_WIDTH * TOTAL_HEIGHT / 8);
+    constexpr uint32_t gameOfLifeWorld = (uint32_t)TOTAL_WIDTH * TOTAL_HEIGHT *
+                                         GOL_WORLD_SCALE * GOL_WORLD_SCALE / 4 +
+                                         GRID_SNAPSHOT_STAGING((uint32_t)TOTAL_WIDTH * TOTAL_HEIGHT *
+                                                               GOL_WORLD_SCALE * GOL_WORLD_SCALE / 8);
+    constexpr uint32_t life = gameOfLife > gameOfLifeWorld ? gameOfLife : gameOfLifeWorld;
+    constexpr uint32_t orderAndChaos = 3 * HALO_GRID_BYTES(1) + GRID_SNAPSHOT_STAGING(2 * HALO_GRID_BYTES(1));
+    constexpr uint32_t cyclic = 2 * HALO_GRID_BYTES(CYCLIC_MAX_RANGE) +
+                                GRID_SNAPSHOT_STAGING(HALO_GRID_BYTES(CYCLIC_MAX_RANGE));
+    constexpr uint32_t grids = life > orderAndChaos
+                               ? (life > cyclic ? life : cyclic)
+                               : (orderAndChaos > cyclic ? orderAndChaos : cyclic);
+    
+    alignas(ARENA_ALIGN) static uint8_t buffer[grids + AUTOMATON_ARENA_SLACK];
+    static Arena arena(buffer, sizeof(buffer));
+    return arena;
+}
+
+/**
+ * One grid dimension for a kernel specialized at compile time
+ * 
+ * With N > 0 the size is the constant N, so loop bounds and row offsets
+ * strength-reduce, short word loops unroll, and wrapping an index is a mask
+ * when N is a power of two. Extent<0> carries the size in `runtime` instead,
+ * for grids of any other size (the bench harness runs several). Kernels are
+ * templates over their Extents; update() picks the TOTAL_WIDTH x
+ * TOTAL_HEIGHT specialization the firmware runs at (see isDisplaySized())
+ * and falls back to Extent<0>.
+ */
+template <uint16_t N>
+struct Extent {
+    uint16_t runtime;  // Size when N is 0
+    
+    static constexpr bool powerOfTwo = N > 0 && (N & (N - 1)) == 0;
+    
+    uint16_t size() const { return N ? N : runtime; }
+    
+    // Neighboring index, wrapping around the ends
+    uint16_t prev(uint16_t i) const {
+        return powerOfTwo ? (i - 1) & (N - 1) : (i == 0 ? size() - 1 : i - 1);
+    }
+    uint16_t next(uint16_t i) const {
+        return powerOfTwo ? (i + 1) & (N - 1) : (i + 1 == size() ? 0 : i + 1);
+    }
+};
+
+// Rows above and below a grid that is one horizontal slab of a taller one,
+// spread over several controllers (see WallLink.h). Sends the slab's first
+// and last rows (bytes of them, border columns included) to the neighbors
+// and fills above and below with theirs; returns which of the two arrived
+// (HALO_ABOVE | HALO_BELOW), the rest are wrapped round locally as usual.
+typedef uint8_t (*HaloExchange)(const uint8_t* first, const uint8_t* last,
+                                uint8_t* above, uint8_t* below, uint16_t bytes);
+
+#define HALO_ABOVE 1
+#define HALO_BELOW 2
+
+// The exchange refreshHalo() fills the top and bottom borders from, NULL
+// (the default) to wrap the grid's own rows
+inline HaloExchange& haloExchange() {
+    static HaloExchange exchange = NULL;
+    return exchange;
+}
+
+/**
+ * Byte-per-cell grid with a wrap-around halo border
+ * 
+ * Cells are stored with `halo` extra cells on every side. refreshHalo()
+ * copies the opposite edges into that border once per generation, so reads
+ * up to `halo` cells away from any cell are plain indexed loads with no
+ * modulo (the Cortex-M0+ has no hardware divide). Coordinates run from
+ * -halo to width + halo - 1 (and likewise for y). With a haloExchange()
+ * set, the rows above and below come from the neighboring slabs instead.
+ */
+class HaloGrid {
+public:
+    HaloGrid(uint16_t width, uint16_t height, uint8_t halo = 1)
+        : width(width), height(height), halo(halo), stride(width + 2 * halo) {
+        data = automatonArena().allocate<uint8_t>((uint32_t)stride * (height + 2 * halo));
+        origin = data + halo * stride + halo;
+        clear();
+    }
+    
+    HaloGrid(const HaloGrid&) = delete;
+    HaloGrid& operator=(const HaloGrid&) = delete;
+    
+    uint8_t& at(int16_t x, int16_t y) { return origin[y * stride + x]; }
+    uint8_t at(int16_t x, int16_t y) const { return origin[y * stride + x]; }
+    
+    // Pointer to cell (0, y); x offsets from it may be negative
+    uint8_t* row(int16_t y) { return origin + y * stride; }
+    const uint8_t* row(int16_t y) const { return origin + y * stride; }
+    
+    // Distance in bytes between vertically adjacent cells
+    uint16_t getStride() const { return stride; }
+    
+    // Zero every cell, border included
+    void clear() {
+        memset(data, 0, (uint32_t)stride * (height + 2 * halo));
+    }
+    
+    // Copy the wrapped-around edges into the border. Call after the last
+    // write of a generation and before neighbors are read.
+    void refreshHalo() {
+        for (uint16_t y = 0; y < height; y++) {
+            refreshRowHalo(y);
+        }
+        
+        // Whole rows, so the corners come along with the columns above
+        uint8_t filled = 0;
+        if (haloExchange() != NULL) {
+            filled = haloExchange()(row(0) - halo, row(height - halo) - halo,
+                                    row(-halo) - halo, row(height) - halo, stride * halo);
+        }
+        for (uint8_t k = 1; k <= halo; k++) {
+            if (!(filled & HALO_ABOVE)) memcpy(row(-k) - halo, row(height - k) - halo, stride);
+            if (!(filled & HALO_BELOW)) memcpy(row(height - 1 + k) - halo, row(k - 1) - halo, stride);
+        }
+    }
+    
+    // Copy the wrapped-around columns of rows [firstRow, endRow) into the
+    // border, for composite automata whose bands do not wrap vertically
+    void refreshColumnHalo(uint16_t firstRow, uint16_t endRow) {
+        for (uint16_t y = firstRow; y < endRow; y++) {
+            refreshRowHalo(y);
+        }
+    }
+    
+    // Copy the wrapped-around columns of a single row into the border, for
+    // grids that are updated in place row by row
+    void refreshRowHalo(int16_t y) {
+        uint8_t* r = row(y);
+        for (uint8_t k = 1; k <= halo; k++) {
+            r[-k] = r[width - k];
+            r[width - 1 + k] = r[k - 1];
+        }
+    }
+    
+    // Save or restore every cell, border included (see Snapshot.h)
+    void snapshot(Snapshot& s) {
+        s.bytes(data, (uint32_t)stride * (height + 2 * halo));
+    }
+    
+    // Exchange contents with a grid of the same size (generation swap)
+    void swap(HaloGrid& other) {
+        uint8_t* d = data;
+        uint8_t* o = origin;
+        data = other.data;
+        origin = other.origin;
+        other.data = d;
+        other.origin = o;
+    }
+    
+private:
+    uint16_t width;
+    uint16_t height;
+    uint8_t halo;
+    uint16_t stride;
+    uint8_t* data;    // Arena block including the border
+    uint8_t* origin;  // Cell (0, 0)
+};
+
+/**
+ * Bit-packed elementary CA rows
+ * 
+ * Cell x of a row lives in bit x & 31 of word x >> 5; bits past the row
+ * width are kept clear. ecaNextRow() evaluates an 8-bit Wolfram rule on 32
+ * cells at once as a multiplexer tree over the left, center and right
+ * neighbor planes, with the row wrapping around at its ends.
+ */
+inline void ecaNextRow(const uint32_t* in, uint32_t* out, uint16_t width, uint8_t rule) {
+    uint16_t words = (width + 31) / 32;
+    uint8_t lastBit = (width - 1) & 31;
+    uint32_t lastMask = 0xFFFFFFFF >> (31 - lastBit);
+    
+    // All-ones where the rule maps pattern p (left << 2 | center << 1 | right) to 1
+    uint32_t m[8];
+    for (uint8_t p = 0; p < 8; p++) {
+        m[p] = 0 - (uint32_t)((rule >> p) & 1);
+    }
+    
+    for (uint16_t w = 0; w < words; w++) {
+        uint32_t c = in[w];
+        bool last = (w + 1 == words);
+        uint32_t carryIn = (w > 0) ? in[w - 1] >> 31 : (in[words - 1] >> lastBit) & 1;
+        uint32_t carryOut = (last ? in[0] : in[w + 1]) & 1;
+        uint32_t l = (c << 1) | carryIn;
+        uint32_t r = (c >> 1) | (carryOut << (last ? lastBit : 31));
+        uint32_t nr = ~r;
+        
+        // Rule as a function of the right cell, for each (left, center) pair
+        uint32_t g0 = (m[1] & r) | (m[0] & nr);
+        uint32_t g1 = (m[3] & r) | (m[2] & nr);
+        uint32_t g2 = (m[5] & r) | (m[4] & nr);
+        uint32_t g3 = (m[7] & r) | (m[6] & nr);
+        
+        // Select on the center cell, then the left
+        uint32_t lo = (c & g1) | (~c & g0);
+        uint32_t hi = (c & g3) | (~c & g2);
+        uint32_t next = (l & hi) | (~l & lo);
+        out[w] = last ? next & lastMask : next;
+    }
+}
+
+// Pack a row of 0/1 cells into 32-cell words
+inline void packRow(const uint8_t* cells, uint32_t* bits, uint16_t width) {
+    memset(bits, 0, ((width + 31) / 32) * sizeof(uint32_t));
+    for (uint16_t x = 0; x < width; x++) {
+        bits[x >> 5] |= (uint32_t)(cells[x] != 0) << (x & 31);
+    }
+}
+
+// Set bits in a word. The M0+ has no popcount instruction, so the bits are
+// summed in pairs, nibbles and bytes, with a multiply adding up the bytes.
+inline uint8_t countBits(uint32_t v) {
+    v -= (v >> 1) & 0x55555555UL;
+    v = (v & 0x33333333UL) + ((v >> 2) & 0x33333333UL);
+    v = (v + (v >> 4)) & 0x0F0F0F0FUL;
+    return (v * 0x01010101UL) >> 24;
+}
+
+// Expand 32-cell words back into a row of 0/1 cells
+inline void unpackRow(const uint32_t* bits, uint8_t* cells, uint16_t width) {
+    for (uint16_t x = 0; x < width; x++) {
+        cells[x] = (bits[x >> 5] >> (x & 31)) & 1;
+    }
+}
+
+// Rows [top, bottom) of the grid owned by one rule of a composite automaton.
+// Each rule writes every cell of its own band into the next generation, so
+// together the bands cover the grid and it never needs clearing first.
+struct RowBand {
+    uint16_t top;     // First row
+    uint16_t bottom;  // One past the last row
+    
+    bool contains(int16_t y) const { return y >= top && y < bottom; }
+};
+
+// Active-region tiles are ACTIVE_TILE_SIZE cells square (at most 32, so a
+// 32-cell bit-packed word always covers whole tiles)
+#define ACTIVE_TILE_SHIFT 4
+#define ACTIVE_TILE_SIZE (1 << ACTIVE_TILE_SHIFT)
+
+// Number of recent samples kept per stage for percentile estimates
+#define STAGE_STATS_WINDOW 64
+
+/**
+ * Timing statistics for one stage of CellularAutomaton::step()
+ * 
+ * Min, max and average cover the automaton's whole run; percentiles are
+ * taken over the last STAGE_STATS_WINDOW samples.
+ */
+struct StageStats {
+    uint32_t count;
+    uint64_t totalUs;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint32_t recent[STAGE_STATS_WINDOW];
+    uint8_t next;
+    
+    StageStats() { reset(); }
+    
+    void reset() {
+        count = 0;
+        totalUs = 0;
+        minUs = 0xFFFFFFFF;
+        maxUs = 0;
+        next = 0;
+    }
+    
+    void add(uint32_t us) {
+        count++;
+        totalUs += us;
+        if (us < minUs) minUs = us;
+        if (us > maxUs) maxUs = us;
+        recent[next] = us;
+        next = (next + 1) % STAGE_STATS_WINDOW;
+    }
+    
+    uint32_t average() const {
+        return count ? (uint32_t)(totalUs / count) : 0;
+    }
+    
+    // The sample added last (0 before the first)
+    uint32_t last() const {
+        return count ? recent[(next + STAGE_STATS_WINDOW - 1) % STAGE_STATS_WINDOW] : 0;
+    }
+    
+    // pct-th percentile (0-100) of the recent samples
+    uint32_t percentile(uint8_t pct) const {
+        uint8_t n = count < STAGE_STATS_WINDOW ? count : STAGE_STATS_WINDOW;
+        if (n == 0) return 0;
+        
+        // Insertion sort a copy; the window is small and this only runs on dump
+        uint32_t sorted[STAGE_STATS_WINDOW];
+        for (uint8_t i = 0; i < n; i++) {
+            uint32_t v = recent[i];
+            uint8_t j = i;
+            while (j > 0 && sorted[j - 1] > v) {
+                sorted[j] = sorted[j - 1];
+                j--;
+            }
+            sorted[j] = v;
+        }
+        return sorted[(uint16_t)(n - 1) * pct / 100];
+    }
+    
+    // One line: label min/avg/p50/p95/max in microseconds
+    void print(Print& out, const char* label) const {
+        out.print(label);
+        if (count == 0) {
+            out.println(" -");
+            return;
+        }
+        out.print(" min ");
+        out.print(minUs);
+        out.print(" avg ");
+        out.print(average());
+        out.print(" p50 ");
+        out.print(percentile(50));
+        out.print(" p95 ");
+        out.print(percentile(95));
+        out.print(" max ");
+        out.println(maxUs);
+    }
+};
 
 /**
  * Base class for all cellular automata
@@ -24,47 +449,670 @@ class OrderAndChaos;
 class CellularAutomaton {
 public:
     // Constructor
-    CellularAutomaton(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height)
-        : matrix(matrix), width(width), height(height), frameCount(0) {}
+    CellularAutomaton(Display* matrix, uint16_t width, uint16_t height)
+        : matrix(matrix), width(width), height(height), frameCount(0),
+          rowHashes(NULL), gridHash(0), changedRows(0), quietGenerations(0),
+          rowPopulations(NULL), population(0), flips(0), births(0), deaths(0),
+          tileTracking(false), activeTiles(0) {
+        dirtyRows = automatonArena().allocate<uint8_t>((height + 7) / 8);
+        tilesX = (width + ACTIVE_TILE_SIZE - 1) >> ACTIVE_TILE_SHIFT;
+        tilesY = (height + ACTIVE_TILE_SIZE - 1) >> ACTIVE_TILE_SHIFT;
+        tileFlags = automatonArena().allocate<uint8_t>(tilesX * tilesY);
+        memset(tileFlags, 0, tilesX * tilesY);
+        markAllDirty();
+        markAllTilesActive();
+    }
     
-    // Destructor
+    // Destructor (the buffers go with the arena, see operator delete)
     virtual ~CellularAutomaton() {}
     
+    // Automata and their buffers live in automatonArena(), one automaton at
+    // a time. Deleting one runs its destructors and then releases the whole
+    // arena, so switching never touches the heap.
+    static void* operator new(size_t size) noexcept {
+        return automatonArena().allocate(size);
+    }
+    
+    static void operator delete(void*) {
+        automatonArena().reset();
+    }
+    
     // Initialize the automaton with random or preset values
     virtual void init() = 0;
     
     // Update the automaton state
     virtual void update() = 0;
     
-    // Render the current state to the matrix
+    // Render the current state into the matrix canvas (not yet shown)
     virtual void render() = 0;
     
-    // Run a single step (update and render)
+    // Run a single step (update, render and show)
     void step() {
+        compute();
+        draw();
+        present();
+    }
+    
+    // Run generations generations and draw and show only the last, for
+    // simulating faster than the panels can show
+    void stepMany(uint16_t generations) {
+        computeMany(generations);
+        draw();
+        present();
+    }
+    
+    // The three stages of step(), each timed into its own StageStats.
+    // Split out so main.cpp can run the next compute() on the other core
+    // while this frame is being presented.
+    void compute() {
+        uint32_t start = micros();
+        flips = 0;
         update();
+        if (rowHashes) endActivityGeneration();
+        updateStats.add(micros() - start);
+    }
+    
+    // compute() for a batch of generations at once, timed as one update
+    // (see updateMany()). The activity counters then describe the batch.
+    void computeMany(uint16_t generations) {
+        if (generations == 0) return;
+        uint32_t start = micros();
+        runMany(generations);
+        updateStats.add(micros() - start);
+    }
+    
+    // Render the current generation and count the frame
+    void draw() {
+        uint32_t start = micros();
         render();
+        renderStats.add(micros() - start);
         frameCount++;
+        drawCount++;
+    }
+    
+    // Push the canvas to the panels
+    void present() {
+        uint32_t start = micros();
+        matrix->show();
+        showStats.add(micros() - start);
+    }
+
+    // Fast-forward: run up to generations update()s with nothing drawn or
+    // shown, stopping early once maxUs microseconds have gone by (0 = no
+    // limit). Each counts as a frame, so frame-paced behaviour keeps its
+    // rate, but none is timed into the stage stats. The next draw()
+    // repaints everything. Returns the generations run.
+    uint32_t advance(uint32_t generations, uint32_t maxUs = 0) {
+        uint32_t start = micros();
+        uint32_t done = 0;
+        uint16_t batch = 1; // Doubles while twice the last batch still fits
+        while (done < generations) {
+            uint16_t n = min((uint32_t)batch, generations - done);
+            uint32_t batchStart = micros();
+            runMany(n);
+            frameCount++;
+            done += n;
+            
+            uint32_t now = micros();
+            if (maxUs > 0 && now - start >= maxUs) break;
+            if (batch < ADVANCE_MAX_BATCH && (maxUs == 0 || now - start + 2 * (now - batchStart) < maxUs)) {
+                batch *= 2;
+            }
+        }
+        if (done > 0) markAllDirty();
+        return done;
+    }
+    
+    // Dump per-stage timing for this automaton
+    void printStats(Print& out) const {
+        out.print(getName());
+        out.print(": ");
+        out.print(frameCount);
+        out.println(" frames, times in us");
+        updateStats.print(out, "  update");
+        renderStats.print(out, "  render");
+        showStats.print(out, "  show  ");
+        if (rowHashes) {
+            out.print("  activity ");
+            out.print(changedRows);
+            out.print(" rows changed last generation, ");
+            out.print(quietGenerations);
+            out.println(" generations repeating");
+        }
+        out.print("  arena ");
+        out.print(footprint());
+        out.print(" of ");
+        out.print(automatonArena().getSize());
+        out.println(" bytes");
+    }
+    
+    void resetStats() {
+        updateStats.reset();
+        renderStats.reset();
+        showStats.reset();
     }
     
     // Get the name of this automaton
     virtual const char* getName() const = 0;
     
+    // Bytes the automaton takes in automatonArena(): the object itself and
+    // every grid and buffer, all of which its constructors allocate. Taken
+    // the first time it is asked for (or a snapshot is), so scratch space
+    // allocated after that, such as SnapshotStore's staging, isn't counted.
+    uint32_t footprint() const {
+        if (footprintBytes == 0) footprintBytes = automatonArena().getUsed();
+        return footprintBytes;
+    }
+    
+    // Frames drawn, one per generation, and generations advance() ran
+    uint32_t getFrameCount() const { return frameCount; }
+    
+    // Microseconds the last compute() and draw() took
+    uint32_t getLastUpdateUs() const { return updateStats.last(); }
+    uint32_t getLastRenderUs() const { return renderStats.last(); }
+    
+    // Activity of the last generation, for automata that trackActivity():
+    // rows whose cells changed, and how many generations in a row the grid
+    // has matched one from the last STAGNATION_PERIOD (0 while it is still
+    // going somewhere, and always 0 untracked)
+    uint16_t getChangedRows() const { return changedRows; }
+    uint32_t getQuietGenerations() const { return quietGenerations; }
+    bool tracksActivity() const { return rowHashes != NULL; }
+    
+    // Live cells after the last generation, and the cells born and died in
+    // it, for automata that trackPopulation() (0 otherwise)
+    uint32_t getPopulation() const { return population; }
+    uint32_t getBirths() const { return births; }
+    uint32_t getDeaths() const { return deaths; }
+    bool tracksPopulation() const { return rowPopulations != NULL; }
+    
+    // Tiles the next update() visits, for automata that skip inactive ones
+    // (see endTileGeneration(); 0 for the rest)
+    uint16_t getActiveTiles() const { return activeTiles; }
+    uint16_t getTileCount() const { return tilesX * tilesY; }
+    bool tracksTiles() const { return tileTracking; }
+    
+    // Force the next render to repaint every row, e.g. after something else
+    // has drawn over the canvas
+    void markAllDirty() {
+        memset(dirtyRows, 0xFF, (height + 7) / 8);
+        for (uint16_t i = 0; i < tilesX * tilesY; i++) {
+            tileFlags[i] |= TILE_DIRTY;
+        }
+    }
+    
+    // Same for just the rows and tiles under a w x h area at (x, y), e.g.
+    // where an overlay was taken off (see Compositor.h)
+    void markAreaDirty(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+        int16_t x0 = max(x, (int16_t)0), y0 = max(y, (int16_t)0);
+        int16_t x1 = min((int16_t)(x + w), (int16_t)width), y1 = min((int16_t)(y + h), (int16_t)height);
+        if (x0 >= x1 || y0 >= y1) return;
+        for (int16_t row = y0; row < y1; row++) markRowDirty(row);
+        for (uint8_t ty = y0 >> ACTIVE_TILE_SHIFT; ty <= (y1 - 1) >> ACTIVE_TILE_SHIFT; ty++) {
+            for (uint8_t tx = x0 >> ACTIVE_TILE_SHIFT; tx <= (x1 - 1) >> ACTIVE_TILE_SHIFT; tx++) {
+                tileFlags[ty * tilesX + tx] |= TILE_DIRTY;
+            }
+        }
+    }
+
+    // Forget pending repaints, for renders that bypass the dirty tracking
+    void clearDirty() {
+        memset(dirtyRows, 0, (height + 7) / 8);
+        for (uint16_t i = 0; i < tilesX * tilesY; i++) {
+            tileFlags[i] &= ~TILE_DIRTY;
+        }
+    }
+    
+    // Save the running state into a snapshot, or carry on from one instead
+    // of init(): grids, rule, colors and frame count (see Snapshot.h)
+    void snapshot(Snapshot& s) {
+        footprint(); // Before SnapshotStore stages the copy in the arena
+        s.value(frameCount);
+        snapshotState(s);
+        if (s.isLoading()) {
+            markAllDirty();
+            markAllTilesActive();
+        }
+    }
+    
+    // Constructor argument the automaton has to be rebuilt with before a
+    // snapshot of it loads (see createAutomatonOfType())
+    virtual uint8_t snapshotParam() const { return 0; }
+    
 protected:
+    // The automaton's own part of snapshot()
+    virtual void snapshotState(Snapshot& s) = 0;
+    
+    // Advance by generations (at least 1) at once, for computeMany() and
+    // advance(). This runs update() that many times; an automaton with a
+    // kernel that fuses generations overrides it. Either way it ends with
+    // the grid, dirty rows and tiles (everything changed since the last
+    // render) and tile activity that many update()s would have left. The
+    // frame count is taken care of.
+    virtual void updateMany(uint16_t generations) {
+        for (uint16_t i = 0; i < generations; i++) {
+            if (i > 0) frameCount++; // Frame-paced behaviour keeps its rate
+            update();
+        }
+    }
+    
+    // A batch of generations with its activity tracking, leaving the frame
+    // count one short of it, as compute() does
+    void runMany(uint16_t generations) {
+        uint32_t frames = frameCount + generations - 1;
+        flips = 0;
+        updateMany(generations);
+        frameCount = frames;
+        if (rowHashes) endActivityGeneration(generations);
+    }
+    
+    // Stagnation tracking, for automata that die out or settle into still
+    // lifes and oscillators: call this from the constructor and override
+    // hashRow(). From then on compute() rehashes the rows update() marked
+    // dirty, so every change has to land in a dirty row, and keeps a hash of
+    // the whole grid to compare with the last `period` generations (1 to
+    // STAGNATION_PERIOD; 1 only catches a grid that stopped changing).
+    void trackActivity(uint8_t period = STAGNATION_PERIOD) {
+        rowHashes = automatonArena().allocate<uint32_t>(height);
+        memset(rowHashes, 0, height * sizeof(uint32_t));
+        recentPeriod = period < 1 ? 1 : (period > STAGNATION_PERIOD ? STAGNATION_PERIOD : period);
+        recentCount = 0;
+        recentNext = 0;
+    }
+    
+    // Hash of row y's cells, everything update() reads of it included
+    virtual uint32_t hashRow(uint16_t) const { return 0; }
+    
+    // Population counts, on top of trackActivity(): the dirty rows are
+    // recounted with rowPopulation() along with their hashes, and update()
+    // adds up the cells it turned on or off with countFlips(), from the
+    // kernel's own change masks rather than another pass. Births minus
+    // deaths is the change in population, births plus deaths the flips, so
+    // that is all it takes to tell them apart.
+    void trackPopulation() {
+#if AUTOMATON_POPULATION
+        rowPopulations = automatonArena().allocate<uint16_t>(height);
+        memset(rowPopulations, 0, height * sizeof(uint16_t));
+        population = 0;
+        populationCounted = false;
+#endif
+    }
+    
+    // Live cells in row y
+    virtual uint16_t rowPopulation(uint16_t) const { return 0; }
+    
+    void countFlips(uint32_t cells) {
+        flips += cells;
+    }
+    
+    // FNV-1a over a row's bytes, for hashRow()
+    static uint32_t hashBytes(const uint8_t* bytes, uint16_t n, uint32_t hash = 2166136261UL) {
+        while (n--) hash = (hash ^ *bytes++) * 16777619UL;
+        return hash;
+    }
+    
+    // Same a word at a time. A multiply only carries upward, so the top half
+    // is folded back down after each word, or changes to the top bits of two
+    // words could cancel out.
+    static uint32_t hashWords(const uint32_t* words, uint16_t n, uint32_t hash = 2166136261UL) {
+        while (n--) {
+            hash = (hash ^ *words++) * 0x9E3779B1UL;
+            hash ^= hash >> 16;
+        }
+        return hash;
+    }
+    
+    // Whether this grid is the size the firmware is built for, so update()
+    // can take the kernels specialized for it (see Extent)
+    bool isDisplaySized() const {
+        return width == TOTAL_WIDTH && height == TOTAL_HEIGHT;
+    }
+    
+    // Per-row dirty bitmap. update() marks the rows it changed and
+    // renderDirtyRows() repaints only those. Protomatter rebuilds both of its
+    // display buffers from the one persistent canvas on every show(), so rows
+    // left untouched stay correct in either buffer.
+    void markRowDirty(uint16_t y) {
+        dirtyRows[y >> 3] |= (1 << (y & 7));
+    }
+    
+    bool isRowDirty(uint16_t y) const {
+        return dirtyRows[y >> 3] & (1 << (y & 7));
+    }
+    
+    // Mark row y dirty if it differs between two cell generations
+    void markRowIfChanged(const HaloGrid& before, const HaloGrid& after, uint16_t y) {
+        if (memcmp(before.row(y), after.row(y), width) != 0) {
+            markRowDirty(y);
+        }
+    }
+    
+    // Blit the dirty rows of a palette-index cell grid, then clear the bitmap
+    void renderDirtyRows(const uint8_t* cells, const uint16_t* palette) {
+        matrix->blitIndexedRows(cells, palette, dirtyRows);
+        memset(dirtyRows, 0, (height + 7) / 8);
+    }
+    
+    // Same for a halo grid
+    void renderDirtyRows(const HaloGrid& cells, const uint16_t* palette) {
+        matrix->blitIndexedRows(cells.row(0), palette, dirtyRows, cells.getStride());
+        memset(dirtyRows, 0, (height + 7) / 8);
+    }
+    
+    // Same for a bit-packed grid (bit x & 31 of word x >> 5 in each row)
+    void renderDirtyRows(const uint32_t* bits, uint16_t offColor, uint16_t onColor) {
+        matrix->blitBitmapRows(bits, offColor, onColor, dirtyRows);
+        memset(dirtyRows, 0, (height + 7) / 8);
+    }
+    
+    // Repaint rows [firstRow, endRow) of a grid through one palette, dirty or
+    // not. Automata whose colors depend on the screen band give each band its
+    // own state -> color table and call this once per band.
+    void renderRegion(const HaloGrid& cells, const uint16_t* palette, uint16_t firstRow, uint16_t endRow) {
+        for (uint16_t y = firstRow; y < endRow; y++) {
+            matrix->blitIndexedRow(y, cells.row(y), palette);
+        }
+    }
+    
+    // Repaint the dirty rows (with temporal dithering, every row) of a grid
+    // through a dithered palette: DITHER_PHASES tables of entries colors
+    // each, as setDitherColor() fills them
+    void renderDitheredRows(const HaloGrid& cells, const uint16_t* phases, uint16_t entries) {
+        for (uint16_t y = 0; y < height; y++) {
+            if (AUTOMATON_DITHER == 2 || isRowDirty(y)) renderDitheredRow(y, cells.row(y), phases, entries);
+        }
+        memset(dirtyRows, 0, (height + 7) / 8);
+    }
+    
+    // renderRegion() through a dithered palette
+    void renderDitheredRegion(const HaloGrid& cells, const uint16_t* phases, uint16_t entries,
+                              uint16_t firstRow, uint16_t endRow) {
+        for (uint16_t y = firstRow; y < endRow; y++) {
+            renderDitheredRow(y, cells.row(y), phases, entries);
+        }
+    }
+    
+    // Row y through the two phase tables of its parity; with temporal
+    // dithering the pattern moves by a pixel across, then down, each frame
+    // drawn (frameCount moves by the generations per frame instead)
+    void renderDitheredRow(uint16_t y, const uint8_t* row, const uint16_t* phases, uint16_t entries) {
+        uint8_t step = AUTOMATON_DITHER == 2 ? drawCount & 3 : 0;
+        uint8_t py = (y + (step >> 1)) & 1;
+        uint8_t px = step & 1;
+        matrix->blitDitheredSpan(y, 0, width, row, phases + (py * 2 + px) * entries,
+                                 phases + (py * 2 + (px ^ 1)) * entries);
+    }
+    
+    // Entry i of a dithered palette (see renderDitheredRows()): color c,
+    // gamma-corrected or as it is
+    void setDitherColor(uint16_t* phases, uint16_t entries, uint16_t i, Rgb c, bool gamma = true) {
+        uint16_t p[DITHER_PHASES];
+        matrix->dither565(c.r, c.g, c.b, gamma, p);
+        for (uint8_t k = 0; k < DITHER_PHASES; k++) phases[k * entries + i] = p[k];
+    }
+    
+    // Set palette entries first..last (inclusive) to one color, for building
+    // state -> color tables where a range of states shares a color
+    static void fillPalette(uint16_t* palette, uint16_t first, uint16_t last, uint16_t color) {
+        for (uint16_t i = first; i <= last; i++) {
+            palette[i] = color;
+        }
+    }
+    
+    // Set palette entries first..last (inclusive) to an even, gamma-corrected
+    // gradient from `from` to `to`
+    void fillGradient(uint16_t* palette, uint16_t first, uint16_t last, Rgb from, Rgb to) {
+        uint16_t steps = last > first ? last - first : 1;
+        for (uint16_t i = first; i <= last; i++) {
+            palette[i] = gammaColor(mix(from, to, 255 * (i - first) / steps));
+        }
+    }
+    
+    // Active-region tracking. The grid is split into ACTIVE_TILE_SIZE square
+    // tiles. update() reports the cells it changed with markCellChanged()
+    // and ends with endTileGeneration(). On the next generation only tiles
+    // that changed, or that border one that did, report isTileActive(); the
+    // rest cannot change and can be skipped. renderDirtyTiles() repaints just
+    // the rows that changed within the tiles that changed since the last
+    // render.
+    //
+    // Automata that double-buffer may skip a tile outright: it did not
+    // change last generation, so both buffers already hold the same cells.
+    enum TileFlags {
+        TILE_CHANGED = 1,  // Changed this generation
+        TILE_ACTIVE = 2,   // Must be updated this generation
+        TILE_DIRTY = 4     // Changed since the last render
+    };
+    
+    void markCellChanged(uint16_t x, uint16_t y) {
+        markTileChanged(x >> ACTIVE_TILE_SHIFT, y >> ACTIVE_TILE_SHIFT);
+        markRowDirty(y);
+    }
+    
+    // Tile-only version for callers that mark the changed rows themselves
+    void markTileChanged(uint8_t tx, uint8_t ty) {
+        tileFlags[ty * tilesX + tx] |= TILE_CHANGED | TILE_DIRTY;
+    }
+    
+    // Report the tiles holding the changed bits (diff) of 32-cell word w in
+    // tile row ty
+    void markWordChanged(uint16_t w, uint8_t ty, uint32_t diff) {
+        const uint32_t tileBits = 0xFFFFFFFF >> (32 - ACTIVE_TILE_SIZE);
+        uint8_t tx = (w << 5) >> ACTIVE_TILE_SHIFT;
+        for (uint8_t k = 0; k < (32 >> ACTIVE_TILE_SHIFT); k++) {
+            if (diff & (tileBits << (k * ACTIVE_TILE_SIZE))) {
+                markTileChanged(tx + k, ty);
+            }
+        }
+    }
+    
+    // Rehash the dirty rows (no other row can have changed), count the ones
+    // that did change, and compare the grid with the last few. Each row's
+    // hash is scrambled with its index, so a pattern moving up or down
+    // differs, and summed, so one changed row updates the grid's hash
+    // without going over the others. After a batch (computeMany()) a
+    // repeat counts as that many quiet generations.
+    void endActivityGeneration(uint16_t generations = 1) {
+        changedRows = 0;
+        uint32_t before = population;
+        for (uint16_t y = 0; y < height; y++) {
+            if (!dirtyRows[y >> 3]) {
+                y |= 7; // Whole byte of clean rows
+                continue;
+            }
+            if (!isRowDirty(y)) continue;
+            uint32_t h = hashRow(y) ^ (y * 0x9E3779B9UL);
+            h = (h ^ (h >> 16)) * 0x85EBCA6BUL;
+            h = (h ^ (h >> 13)) * 0xC2B2AE35UL;
+            h ^= h >> 16;
+            if (h != rowHashes[y]) {
+                gridHash += h - rowHashes[y];
+                rowHashes[y] = h;
+                changedRows++;
+                if (rowPopulations) {
+                    uint16_t p = rowPopulation(y);
+                    population += p - rowPopulations[y];
+                    rowPopulations[y] = p;
+                }
+            }
+        }
+        
+        // Until every row has been counted once the change means nothing,
+        // and init() or a reseed can add cells without a flip to show for them
+        if (rowPopulations) {
+            int32_t grown = populationCounted ? (int32_t)(population - before) : 0;
+            int32_t born = ((int32_t)flips + grown) / 2;
+            births = born < 0 ? 0 : (born > (int32_t)flips ? flips : born);
+            deaths = flips - births;
+            populationCounted = true;
+        }
+        
+        bool repeated = false;
+        for (uint8_t i = 0; i < recentCount; i++) {
+            if (recentHashes[i] == gridHash) repeated = true;
+        }
+        quietGenerations = repeated ? quietGenerations + generations : 0;
+        recentHashes[recentNext] = gridHash;
+        if (++recentNext == recentPeriod) recentNext = 0;
+        if (recentCount < recentPeriod) recentCount++;
+    }
+    
+    // Repaint the cell without waking its tile for the next update
+    void markCellDirty(uint16_t x, uint16_t y) {
+        tileFlags[(y >> ACTIVE_TILE_SHIFT) * tilesX + (x >> ACTIVE_TILE_SHIFT)] |= TILE_DIRTY;
+        markRowDirty(y);
+    }
+    
+    bool isTileActive(uint8_t tx, uint8_t ty) const {
+        return tileFlags[ty * tilesX + tx] & TILE_ACTIVE;
+    }
+    
+    // Update every tile next generation, e.g. after init() or a rule change
+    void markAllTilesActive() {
+        for (uint16_t i = 0; i < tilesX * tilesY; i++) {
+            tileFlags[i] |= TILE_ACTIVE;
+        }
+    }
+    
+    // Close a generation: the tiles changed in it and their neighbors
+    // (wrapping around the edges) become the next generation's active set
+    void endTileGeneration() {
+        tileTracking = true;
+        for (uint16_t i = 0; i < tilesX * tilesY; i++) {
+            tileFlags[i] &= ~TILE_ACTIVE;
+        }
+        
+        for (uint8_t ty = 0; ty < tilesY; ty++) {
+            for (uint8_t tx = 0; tx < tilesX; tx++) {
+                uint8_t& flags = tileFlags[ty * tilesX + tx];
+                if (!(flags & TILE_CHANGED)) continue;
+                flags &= ~TILE_CHANGED;
+                
+                uint8_t rows[3] = { (uint8_t)(ty ? ty - 1 : tilesY - 1), ty, (uint8_t)(ty + 1 < tilesY ? ty + 1 : 0) };
+                uint8_t cols[3] = { (uint8_t)(tx ? tx - 1 : tilesX - 1), tx, (uint8_t)(tx + 1 < tilesX ? tx + 1 : 0) };
+                for (uint8_t i = 0; i < 3; i++) {
+                    uint8_t* row = tileFlags + rows[i] * tilesX;
+                    row[cols[0]] |= TILE_ACTIVE;
+                    row[cols[1]] |= TILE_ACTIVE;
+                    row[cols[2]] |= TILE_ACTIVE;
+                }
+            }
+        }
+        
+        activeTiles = 0;
+        for (uint16_t i = 0; i < tilesX * tilesY; i++) {
+            activeTiles += (tileFlags[i] & TILE_ACTIVE) != 0;
+        }
+    }
+    
+    // Repaint the dirty tiles of a palette-index grid (width cells per row)
+    void renderDirtyTiles(const uint8_t* cells, const uint16_t* palette) {
+        for (uint8_t ty = 0; ty < tilesY; ty++) {
+            uint16_t endY;
+            uint16_t startY = tileRowSpan(ty, endY);
+            uint8_t tx = 0;
+            uint16_t x, count;
+            while (nextDirtyRun(ty, tx, x, count)) {
+                for (uint16_t y = startY; y < endY; y++) {
+                    if (!isRowDirty(y)) continue;
+                    matrix->blitIndexedSpan(y, x, count, cells + (uint32_t)y * width + x, palette);
+                }
+            }
+        }
+        memset(dirtyRows, 0, (height + 7) / 8);
+    }
+    
+    // Same for a bit-packed grid (bit x & 31 of word x >> 5, rows padded to
+    // 32 bits)
+    void renderDirtyTiles(const uint32_t* bits, uint16_t offColor, uint16_t onColor) {
+        uint16_t wordsPerRow = (width + 31) / 32;
+        for (uint8_t ty = 0; ty < tilesY; ty++) {
+            uint16_t endY;
+            uint16_t startY = tileRowSpan(ty, endY);
+            uint8_t tx = 0;
+            uint16_t x, count;
+            while (nextDirtyRun(ty, tx, x, count)) {
+                for (uint16_t y = startY; y < endY; y++) {
+                    if (!isRowDirty(y)) continue;
+                    matrix->blitBitmapSpan(y, x, count, bits + (uint32_t)y * wordsPerRow, offColor, onColor);
+                }
+            }
+        }
+        memset(dirtyRows, 0, (height + 7) / 8);
+    }
+    
+    // Gamma-corrected RGB565 for the panel's bit depth (see Colors.h for
+    // building the Rgb)
+    uint16_t gammaColor(Rgb c) {
+        return matrix->gammaColor565(c.r, c.g, c.b);
+    }
+    
+    // Fully saturated hue (0-255 around the wheel), gamma-corrected
+    uint16_t hueColor(uint8_t h) {
+        return gammaColor(hue(h));
+    }
+    
     // Helper function for consistent coordinate mapping across all automata
-    // Uses the mapCoordinates function from PanelConfig.h to ensure consistent mapping
+    // The controller looks the pixel up in the precomputed PanelMap table
+    // from PanelConfig.h and stores straight into the Protomatter canvas
     void drawMappedPixel(int16_t x, int16_t y, uint16_t color) {
-        // Map the logical coordinates to physical coordinates using the global mapping function
-        int16_t mapped_x, mapped_y;
-        mapCoordinates(x, y, &mapped_x, &mapped_y);
+        matrix->drawMappedPixel(x, y, color);
+    }
+    
+    // First pixel row of tile row ty, and one past its last in endY
+    uint16_t tileRowSpan(uint8_t ty, uint16_t& endY) const {
+        uint16_t y = ty << ACTIVE_TILE_SHIFT;
+        endY = min((uint16_t)(y + ACTIVE_TILE_SIZE), height);
+        return y;
+    }
+    
+    // Find the next run of dirty tiles in tile row ty from tile tx on, as
+    // pixel columns x..x + count - 1, and clear their dirty flags. Adjacent
+    // tiles are merged so they are blitted as one span.
+    bool nextDirtyRun(uint8_t ty, uint8_t& tx, uint16_t& x, uint16_t& count) {
+        uint8_t* row = tileFlags + ty * tilesX;
+        while (tx < tilesX && !(row[tx] & TILE_DIRTY)) tx++;
+        if (tx == tilesX) return false;
         
-        // Draw the pixel at the mapped position
-        matrix->drawPixel(mapped_x, mapped_y, color);
+        uint8_t first = tx;
+        while (tx < tilesX && (row[tx] & TILE_DIRTY)) {
+            row[tx] &= ~TILE_DIRTY;
+            tx++;
+        }
+        x = first << ACTIVE_TILE_SHIFT;
+        count = min((uint16_t)(tx << ACTIVE_TILE_SHIFT), width) - x;
+        return true;
     }
     
-    Adafruit_Protomatter* matrix;  // Pointer to the LED matrix
+    Display* matrix;               // Pointer to the LED matrix
     uint16_t width;                // Width of the matrix
     uint16_t height;               // Height of the matrix
     uint32_t frameCount;           // Current frame count
+    uint8_t drawCount = 0;         // draw()s, wrapping (temporal dither phase)
+    uint8_t* dirtyRows;            // One bit per row that needs repainting
+    uint8_t* tileFlags;            // TileFlags per active-region tile
+    uint8_t tilesX;                // Tiles per row
+    uint8_t tilesY;                // Tile rows
+    uint32_t* rowHashes;           // Per-row hashes, or NULL when not tracking activity
+    uint32_t gridHash;             // Sum of rowHashes
+    uint32_t recentHashes[STAGNATION_PERIOD]; // gridHash of the last recentCount generations
+    uint8_t recentPeriod;          // Generations compared
+    uint8_t recentCount;           // Entries of recentHashes in use
+    uint8_t recentNext;            // Where the next one goes
+    uint16_t changedRows;          // Rows that changed last generation
+    uint32_t quietGenerations;     // Generations in a row that repeated a recent one
+    uint16_t* rowPopulations;      // Live cells per row, or NULL when not counting them
+    uint32_t population;           // Sum of rowPopulations
+    bool populationCounted;        // Every row is in it
+    uint32_t flips;                // Cells update() turned on or off
+    uint32_t births;               // Cells turned on in the last generation
+    uint32_t deaths;               // Cells turned off in it
+    bool tileTracking;             // Whether update() runs endTileGeneration()
+    uint16_t activeTiles;          // Tiles it left active
+    StageStats updateStats;        // Time spent in update()
+    StageStats renderStats;        // Time spent in render()
+    StageStats showStats;          // Time spent in matrix->show()
+    mutable uint32_t footprintBytes = 0; // footprint(), once taken
 };
 
 /**
@@ -85,41 +1133,47 @@ public:
         THREE_CELLS     // Three adjacent cells in the middle
     };
     
-    ElementaryAutomaton(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height, uint8_t rule = 30) 
-        : CellularAutomaton(matrix, width, height), rule(rule), initPattern(SINGLE_CELL) {
-        cells = new uint8_t[width * height];
-        tempCells = new uint8_t[width];
+    ElementaryAutomaton(Display* matrix, uint16_t width, uint16_t height, uint8_t rule = 30) 
+        : CellularAutomaton(matrix, width, height), rule(rule), initPattern(SINGLE_CELL),
+          scrolling(ECA_SCROLL) {
+        wordsPerRow = (width + 31) / 32;
+        cells = automatonArena().allocate<uint32_t>(wordsPerRow * height);
         
         // Initialize color based on rule
-        updateColor();
-    }
-    
-    ~ElementaryAutomaton() {
-        delete[] cells;
-        delete[] tempCells;
+        updateColor();
     }
     
     void init() override {
         // Clear the cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        memset(cells, 0, wordsPerRow * height * sizeof(uint32_t));
         
         // Choose a random initialization pattern if not specified
-        if (random(100) < 70) {
+        if (fastRandom(100) < 70) {
             // 70% chance to use the default pattern for this rule
             initWithDefaultPattern();
         } else {
             // 30% chance to use a random pattern
-            InitPattern randomPattern = static_cast<InitPattern>(random(5));
+            InitPattern randomPattern = static_cast<InitPattern>(fastRandom(5));
             initWithPattern(randomPattern);
         }
         
         // Reset current row
         currentRow = 0;
+        ringStart = 0;
+        wrapped = false;
+        scrollPending = 0;
+        markAllDirty();
+        markAllTilesActive();
     }
     
     void update() override {
         // Check if we've filled the screen
         if (currentRow >= height - 1) {
+            if (scrolling) {
+                scrollRow();
+                return;
+            }
+            
             // Reset to the top with a new random rule
             randomRule();
             init();
@@ -129,24 +1183,20 @@ public:
         // Increment row
         currentRow++;
         
-        // Calculate next generation based on the rule
-        for (uint16_t x = 0; x < width; x++) {
-            // Get the left, center, and right cells
-            uint8_t left = cells[(currentRow - 1) * width + ((x + width - 1) % width)];
-            uint8_t center = cells[(currentRow - 1) * width + x];
-            uint8_t right = cells[(currentRow - 1) * width + ((x + 1) % width)];
-            
-            // Compute the pattern index (0-7)
-            uint8_t pattern = (left << 2) | (center << 1) | right;
-            
-            // Apply the rule
-            tempCells[x] = (rule >> pattern) & 1;
-        }
+        // Calculate next generation based on the rule, 32 cells at a time
+        uint32_t* row = cells + currentRow * wordsPerRow;
+        ecaNextRow(row - wordsPerRow, row, width, rule);
         
-        // Copy temp cells to the current row
-        for (uint16_t x = 0; x < width; x++) {
-            cells[currentRow * width + x] = tempCells[x];
+        // The new row started out empty, so its live cells are its changes
+        bool changed = false;
+        for (uint16_t w = 0; w < wordsPerRow; w++) {
+            if (row[w]) {
+                markWordChanged(w, currentRow >> ACTIVE_TILE_SHIFT, row[w]);
+                changed = true;
+            }
         }
+        if (changed) markRowDirty(currentRow);
+        endTileGeneration();
     }
     
     void render() override {
@@ -155,23 +1205,34 @@ public:
         // For Elementary Automaton, we need to be careful with how we map coordinates
         // as the animation direction should follow the physical panel layout
         
-        // First fill the entire display with black
-        for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                drawMappedPixel(x, y, 0);  // Black background
-            }
+        // Only tiles with live cells in the newest row change between steps;
+        // everything else is still zero from init() (black background, rule
+        // color)
+        if (!wrapped) {
+            renderDirtyTiles(cells, 0, cellColor);
+            return;
         }
         
-        // Then draw only the active cells up to the current row
-        for (uint16_t y = 0; y <= currentRow && y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                if (cells[y * width + x]) {
-                    drawMappedPixel(x, y, cellColor);  // Colored cells based on rule
+        // Scrolling: shift the canvas and draw just the new bottom rows,
+        // unless markAllDirty() asked for everything (or the backend can't
+        // scroll, when every row is drawn again)
+        uint16_t first = 0;
+        if (scrollPending < height && !isRowDirty(0) && matrix->scrollUp(scrollPending)) {
+            first = height - scrollPending;
+            
+            // Rows a batch grew before it started scrolling were marked at
+            // their place on screen before the scroll moved them up
+            for (uint16_t y = 0; y < first; y++) {
+                if (isRowDirty(y + scrollPending)) {
+                    matrix->blitBitmapSpan(y, 0, width, ringRow(y), 0, cellColor);
                 }
             }
         }
-        
-        matrix->show();
+        for (uint16_t y = first; y < height; y++) {
+            matrix->blitBitmapSpan(y, 0, width, ringRow(y), 0, cellColor);
+        }
+        scrollPending = 0;
+        clearDirty();
     }
     
     void setRule(uint8_t newRule) {
@@ -186,6 +1247,11 @@ public:
         init();  // Reinitialize with the new pattern
     }
     
+    // Scroll continuously once the screen is full (otherwise start over)
+    void setScrolling(bool enabled) {
+        scrolling = enabled;
+    }
+    
     const char* getName() const override {
         static char name[32];
         
@@ -228,76 +1294,118 @@ public:
             190   // Complex patterns
         };
         
-        rule = interestingRules[random(sizeof(interestingRules) / sizeof(interestingRules[0]))];
+        rule = interestingRules[fastRandom(sizeof(interestingRules) / sizeof(interestingRules[0]))];
         updateColor();
     }
     
 private:
-    uint8_t* cells;       // Cell states
-    uint8_t* tempCells;   // Temporary buffer for computation
+    uint32_t* cells;      // Cell states, bit-packed (32 cells per word)
+    uint16_t wordsPerRow; // 32-cell words in each row
     uint8_t rule;         // The rule to apply (0-255)
     uint16_t currentRow;  // Current row being calculated
     InitPattern initPattern; // Current initialization pattern
     uint16_t cellColor;   // Color for active cells
+    bool scrolling;       // Scroll instead of starting over when full
+    bool wrapped;         // The rows have scrolled at least once since init()
+    uint16_t ringStart;   // Storage row shown at the top once scrolling
+    uint16_t scrollPending; // Rows scrolled since the last render
+    
+    void snapshotState(Snapshot& s) override {
+        s.bytes(cells, wordsPerRow * height * sizeof(uint32_t));
+        s.value(rule);
+        s.value(currentRow);
+        s.value(initPattern);
+        s.value(cellColor);
+        s.value(scrolling);
+        s.value(wrapped);
+        s.value(ringStart);
+        if (s.isLoading()) scrollPending = 0; // Everything is repainted
+    }
+    
+    // Storage row shown at screen row y (cells is a ring once scrolling)
+    const uint32_t* ringRow(uint16_t y) const {
+        uint16_t r = ringStart + y;
+        if (r >= height) r -= height;
+        return cells + r * wordsPerRow;
+    }
+    
+    // Compute the next row into the oldest one and advance the ring
+    void scrollRow() {
+        const uint32_t* newest = ringRow(height - 1);
+        ecaNextRow(newest, cells + ringStart * wordsPerRow, width, rule);
+        if (++ringStart == height) ringStart = 0;
+        if (scrollPending < height) scrollPending++;
+        wrapped = true;
+    }
     
     // Update cell color based on rule
     void updateColor() {
         // Randomly select a color scheme
-        uint8_t colorScheme = random(5);
+        uint8_t colorScheme = fastRandom(5);
         
         switch (colorScheme) {
             case 0:
                 // Random vibrant color
-                cellColor = matrix->color565(random(150, 256), random(150, 256), random(150, 256));
+                cellColor = rgb565(fastRandom(150, 256), fastRandom(150, 256), fastRandom(150, 256));
                 break;
                 
             case 1:
                 // Rule-based colors (original behavior)
                 if (rule == 30 || rule == 45 || rule == 73 || rule == 75) {
                     // Chaotic rules - red tones
-                    cellColor = matrix->color565(255, 100, 100);
+                    cellColor = rgb565(255, 100, 100);
                 } else if (rule == 90 || rule == 150 || rule == 182) {
                     // Fractal/symmetric rules - blue tones
-                    cellColor = matrix->color565(100, 100, 255);
+                    cellColor = rgb565(100, 100, 255);
                 } else if (rule == 110 || rule == 124 || rule == 137 || rule == 193) {
                     // Complex/universal rules - green tones
-                    cellColor = matrix->color565(100, 255, 100);
+                    cellColor = rgb565(100, 255, 100);
                 } else if (rule == 184 || rule == 232) {
                     // Traffic/flow rules - yellow tones
-                    cellColor = matrix->color565(255, 255, 100);
+                    cellColor = rgb565(255, 255, 100);
                 } else {
                     // Other rules - white
-                    cellColor = matrix->color565(255, 255, 255);
+                    cellColor = rgb565(255, 255, 255);
                 }
                 break;
                 
             case 2:
                 // Random pastel color
-                cellColor = matrix->color565(random(180, 256), random(180, 256), random(180, 256));
+                cellColor = rgb565(fastRandom(180, 256), fastRandom(180, 256), fastRandom(180, 256));
                 break;
                 
             case 3:
                 // Random primary color (R, G, or B dominant)
-                switch (random(3)) {
-                    case 0: cellColor = matrix->color565(255, random(100), random(100)); break; // Red
-                    case 1: cellColor = matrix->color565(random(100), 255, random(100)); break; // Green
-                    case 2: cellColor = matrix->color565(random(100), random(100), 255); break; // Blue
+                switch (fastRandom(3)) {
+                    case 0: cellColor = rgb565(255, fastRandom(100), fastRandom(100)); break; // Red
+                    case 1: cellColor = rgb565(fastRandom(100), 255, fastRandom(100)); break; // Green
+                    case 2: cellColor = rgb565(fastRandom(100), fastRandom(100), 255); break; // Blue
                 }
                 break;
                 
             case 4:
                 // Random warm or cool color
-                if (random(2)) {
+                if (fastRandom(2)) {
                     // Warm (red/yellow/orange)
-                    cellColor = matrix->color565(random(200, 256), random(100, 200), random(50));
+                    cellColor = rgb565(fastRandom(200, 256), fastRandom(100, 200), fastRandom(50));
                 } else {
                     // Cool (blue/green/purple)
-                    cellColor = matrix->color565(random(50), random(100, 200), random(200, 256));
+                    cellColor = rgb565(fastRandom(50), fastRandom(100, 200), fastRandom(200, 256));
                 }
                 break;
         }
     }
     
+    // Set or clear cell x of the top row
+    void setTopCell(uint16_t x, bool alive) {
+        uint32_t bit = 1UL << (x & 31);
+        if (alive) {
+            cells[x >> 5] |= bit;
+        } else {
+            cells[x >> 5] &= ~bit;
+        }
+    }
+    
     // Initialize with the default pattern for this rule
     void initWithDefaultPattern() {
         // Choose initialization pattern based on the rule
@@ -345,33 +1453,33 @@ private:
     // Special initialization for traffic rule (Rule 184)
     void initTrafficRule() {
         // Clear the cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        memset(cells, 0, wordsPerRow * height * sizeof(uint32_t));
         
         // For traffic rule, we want a mix of vehicles and spaces
         // Density around 40-60% works well for interesting traffic patterns
-        uint8_t density = random(40, 61);
+        uint8_t density = fastRandom(40, 61);
         
         // Initialize top row with random cells based on density
         for (uint16_t x = 0; x < width; x++) {
-            cells[x] = (random(100) < density) ? 1 : 0;
+            setTopCell(x, fastRandom(100) < density);
         }
         
         // Optionally add a traffic jam section
-        if (random(100) < 70) {  // 70% chance to add a traffic jam
-            uint16_t jamStart = random(width / 4);
-            uint16_t jamLength = random(width / 4, width / 2);
+        if (fastRandom(100) < 70) {  // 70% chance to add a traffic jam
+            uint16_t jamStart = fastRandom(width / 4);
+            uint16_t jamLength = fastRandom(width / 4, width / 2);
             
             // Create a dense section (traffic jam)
             for (uint16_t x = jamStart; x < jamStart + jamLength && x < width; x++) {
-                cells[x] = (random(100) < 80) ? 1 : 0;  // 80% density in jam
+                setTopCell(x, fastRandom(100) < 80);  // 80% density in jam
             }
             
             // Create a sparse section (open road) after the jam
             uint16_t openStart = (jamStart + jamLength) % width;
-            uint16_t openLength = random(width / 4, width / 2);
+            uint16_t openLength = fastRandom(width / 4, width / 2);
             
             for (uint16_t x = openStart; x < openStart + openLength && x < width; x++) {
-                cells[x] = (random(100) < 20) ? 1 : 0;  // 20% density in open road
+                setTopCell(x, fastRandom(100) < 20);  // 20% density in open road
             }
         }
         
@@ -382,40 +1490,38 @@ private:
     // Initialize with a specific pattern
     void initWithPattern(InitPattern pattern) {
         // Clear the cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        memset(cells, 0, wordsPerRow * height * sizeof(uint32_t));
         
         // Apply the specified pattern to the top row
         switch (pattern) {
             case SINGLE_CELL:
                 // Single cell in the middle
-                cells[width / 2] = 1;
+                setTopCell(width / 2, true);
                 break;
                 
             case RANDOM_CELLS:
                 // Random cells across the top row
-                for (uint16_t x = 0; x < width; x++) {
-                    cells[x] = random(2);
-                }
+                fastRandomRowBits(cells, width, 50);
                 break;
                 
             case ALTERNATING:
                 // Alternating 0-1 pattern
                 for (uint16_t x = 0; x < width; x++) {
-                    cells[x] = x % 2;
+                    setTopCell(x, x % 2);
                 }
                 break;
                 
             case TWO_CELLS:
                 // Two adjacent cells in the middle
-                cells[width / 2] = 1;
-                cells[width / 2 + 1] = 1;
+                setTopCell(width / 2, true);
+                setTopCell(width / 2 + 1, true);
                 break;
                 
             case THREE_CELLS:
                 // Three adjacent cells in the middle
-                cells[width / 2 - 1] = 1;
-                cells[width / 2] = 1;
-                cells[width / 2 + 1] = 1;
+                setTopCell(width / 2 - 1, true);
+                setTopCell(width / 2, true);
+                setTopCell(width / 2 + 1, true);
                 break;
         }
         
@@ -444,26 +1550,57 @@ public:
         DIAMOEBA     // B35678/S5678 - Diamoeba
     };
     
-    GameOfLife(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height, RuleSet ruleSet = CONWAY) 
+    GameOfLife(Display* matrix, uint16_t width, uint16_t height, RuleSet ruleSet = CONWAY) 
         : CellularAutomaton(matrix, width, height) {
-        cells = new uint8_t[width * height];
-        nextCells = new uint8_t[width * height];
+        // One bit per cell, 32 cells per word (width must be a multiple of 32)
+        wordsPerRow = (width + 31) / 32;
+        cells = automatonArena().allocate<uint32_t>(wordsPerRow * height);
+        nextCells = automatonArena().allocate<uint32_t>(wordsPerRow * height);
+        wordActive = automatonArena().allocate<bool>(wordsPerRow);
+        wordChanges = automatonArena().allocate<uint32_t>(wordsPerRow);
+        halfRows = automatonArena().allocate<uint32_t>(wordsPerRow * 5);
+        
+        // Memoized engine for long-running patterns, where the grid allows it
+        hashlife = NULL;
+#if GOL_HASHLIFE
+        if (Hashlife::supports(width, height)) {
+            hashlife = automatonArena().create<Hashlife>(width, automatonArena());
+        }
+#endif
+        hashlifeStale = true;
+        hashlifeRetry = 0;
+        
+        // A grid bigger than the display is a world seen through a viewport,
+        // zoomed out at most as far as the display still fits in it
+        world = width > matrix->width() || height > matrix->height();
+        viewBits = NULL;
+        viewCounts = NULL;
+        maxZoom = 1;
+        if (world) {
+            maxZoom = min(width / matrix->width(), height / matrix->height());
+            if (maxZoom < 1) maxZoom = 1;
+            if (maxZoom > GOL_WORLD_SCALE) maxZoom = GOL_WORLD_SCALE; // densityPalette size
+            viewBits = automatonArena().allocate<uint32_t>((matrix->width() * maxZoom + 31) / 32 + 1);
+            viewCounts = automatonArena().allocate<uint8_t>(matrix->width());
+        }
+        zoom = 1;
+        viewX = 0;
+        viewY = 0;
         
         // Set the rule set
         setRuleSet(ruleSet);
         
         // Initialize color palette for different rule sets
         initColorPalette();
-    }
-    
-    ~GameOfLife() {
-        delete[] cells;
-        delete[] nextCells;
+        
+        // Soups burn out into still lifes and blinkers
+        trackActivity();
+        trackPopulation();
     }
     
     void init() override {
         // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        memset(cells, 0, wordsPerRow * height * sizeof(uint32_t));
         
         // Choose initialization method based on rule set
         switch (currentRuleSet) {
@@ -474,7 +1611,7 @@ public:
                 
             case DAY_NIGHT:
                 // Day and Night - higher density of random cells (40-60%)
-                initRandom(random(40, 60));
+                initRandom(fastRandom(40, 60));
                 break;
                 
             case MAZE:
@@ -490,7 +1627,7 @@ public:
                 
             case DIAMOEBA:
                 // Diamoeba - random cells (30-40%)
-                initRandom(random(30, 40));
+                initRandom(fastRandom(30, 40));
                 break;
                 
             default:
@@ -498,65 +1635,54 @@ public:
                 initRandom(25);
                 break;
         }
+        
+        hashlifeStale = true;
+        hashlifeRetry = 0;
+        if (world) {
+            viewX = (uint32_t)fastRandom(width) << 8;
+            viewY = (uint32_t)fastRandom(height) << 8;
+            aimViewport();
+        }
+        markAllDirty();
+        markAllTilesActive();
     }
     
     void update() override {
-        // Calculate the next generation
-        for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                // Count live neighbors (wrap around edges)
-                uint8_t neighbors = 0;
-                for (int8_t dy = -1; dy <= 1; dy++) {
-                    for (int8_t dx = -1; dx <= 1; dx++) {
-                        // Skip the cell itself
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        // Calculate neighbor coordinates with wrapping
-                        uint16_t nx = (x + dx + width) % width;
-                        uint16_t ny = (y + dy + height) % height;
-                        
-                        // Add to neighbor count if alive
-                        neighbors += cells[ny * width + nx];
-                    }
-                }
-                
-                // Apply rules based on birth and survival conditions
-                uint8_t current = cells[y * width + x];
-                uint8_t next = 0;
-                
-                if (current) {
-                    // Cell is alive - check survival conditions
-                    next = (survivalRules & (1 << neighbors)) ? 1 : 0;
-                } else {
-                    // Cell is dead - check birth conditions
-                    next = (birthRules & (1 << neighbors)) ? 1 : 0;
-                }
-                
-                nextCells[y * width + x] = next;
+        // Settled patterns are mostly cache hits; chaotic ones overflow the
+        // cache and run on the dense kernel instead
+        if (!hashlife || !updateHashlife()) {
+            updateDense();
+        }
+        endTileGeneration();
+    }
+    
+    // Hashlife runs the whole batch before writing the grid back once; the
+    // dense kernel does two generations per pass over the grid while most
+    // tiles are busy, and one at a time (skipping the quiet tiles) when not
+    void updateMany(uint16_t generations) override {
+        if (hashlife && updateHashlife(generations)) {
+            endTileGeneration();
+            return;
+        }
+        while (generations > 0) {
+            if (generations >= 2 && (!tileTracking || activeTiles * 2 >= tilesX * tilesY)) {
+                updateDenseTwice();
+                generations -= 2;
+            } else {
+                updateDense();
+                generations--;
             }
+            endTileGeneration();
         }
-        
-        // Swap cell buffers
-        uint8_t* temp = cells;
-        cells = nextCells;
-        nextCells = temp;
     }
     
     void render() override {
-        // Draw all cells using our consistent mapping function
-        for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                if (cells[y * width + x]) {
-                    // Live cells - use color based on rule set
-                    drawMappedPixel(x, y, cellColor);
-                } else {
-                    // Dead cells - black
-                    drawMappedPixel(x, y, 0);
-                }
-            }
+        // Dead cells black, live cells in the rule set color
+        if (world) {
+            renderViewport();
+        } else {
+            renderDirtyTiles(cells, 0, cellColor);
         }
-        
-        matrix->show();
     }
     
     // Set a specific rule set
@@ -608,6 +1734,9 @@ public:
                 break;
         }
         
+        hashlifeStale = true;
+        markAllTilesActive();
+        
         // Update cell color based on rule set
         updateCellColor();
     }
@@ -644,13 +1773,16 @@ public:
         
         // Set current rule set to custom
         currentRuleSet = static_cast<RuleSet>(-1); // Custom rule set
+        hashlifeStale = true;
+        markAllTilesActive();
         
         // Update cell color for custom rules
-        cellColor = matrix->color565(200, 200, 200); // Default gray for custom rules
+        cellColor = rgb565(200, 200, 200); // Default gray for custom rules
+        markAllDirty();
     }
     
     const char* getName() const override {
-        static char name[32];
+        static char name[48];
         
         // Return name based on the current rule set
         switch (currentRuleSet) {
@@ -698,27 +1830,376 @@ public:
                 sprintf(name, "Custom (%s/%s)", birthStr, survStr);
                 break;
         }
+        if (world) {
+            sprintf(name + strlen(name), " %ux%u", width, height);
+        }
         
         return name;
     }
     
+    // 1 on a world (a grid bigger than the display), see createAutomatonOfType()
+    uint8_t snapshotParam() const override { return world; }
+    
 private:
-    uint8_t* cells;          // Current generation
-    uint8_t* nextCells;      // Next generation
+    uint32_t* cells;         // Current generation, one bit per cell
+    uint32_t* nextCells;     // Next generation, one bit per cell
+    uint16_t wordsPerRow;    // 32-cell words in each row
+    bool* wordActive;        // Per word: in an active tile (current tile row)
+    uint32_t* wordChanges;   // Per word: bits changed in the current tile row
+    uint32_t* halfRows;      // Five rows of the generation between, for updateDenseTwice()
     uint16_t birthRules;     // Bit field for birth rules (1 << neighbors)
     uint16_t survivalRules;  // Bit field for survival rules (1 << neighbors)
     RuleSet currentRuleSet;  // Current rule set
     uint16_t cellColor;      // Color for live cells
     uint16_t colorPalette[6]; // Color palette for different rule sets
+    Hashlife* hashlife;      // Memoized engine, or NULL for dense only
+    bool hashlifeStale;      // cells changed outside the engine (reload it)
+    uint16_t hashlifeRetry;  // Dense-only generations left after an overflow
+    
+    // World mode: the grid wraps and the display shows a viewport onto it
+    bool world;
+    uint8_t zoom;            // Cells per pixel across and down
+    uint8_t maxZoom;         // Zoom at which the display covers the most world
+    uint32_t viewX, viewY;   // Viewport's top-left cell, 1/256 cell units
+    int16_t panX, panY;      // Viewport movement per frame, same units
+    uint16_t viewFrames;     // Frames left before the viewport changes course
+    uint16_t densityPalette[GOL_WORLD_SCALE * GOL_WORLD_SCALE + 1]; // Live cells per pixel -> color
+    uint32_t* viewBits;      // One world row from the viewport's left edge on
+    uint8_t* viewCounts;     // Live cells under each pixel of a display row
+    
+    uint32_t hashRow(uint16_t y) const override {
+        return hashWords(cells + y * wordsPerRow, wordsPerRow);
+    }
+    
+    uint16_t rowPopulation(uint16_t y) const override {
+        uint16_t n = 0;
+        for (uint16_t w = 0; w < wordsPerRow; w++) {
+            n += countBits(cells[y * wordsPerRow + w]);
+        }
+        return n;
+    }
+    
+    void snapshotState(Snapshot& s) override {
+        s.bytes(cells, wordsPerRow * height * sizeof(uint32_t));
+        s.value(birthRules);
+        s.value(survivalRules);
+        s.value(currentRuleSet);
+        s.value(cellColor);
+        s.value(zoom);
+        s.value(viewX);
+        s.value(viewY);
+        s.value(panX);
+        s.value(panY);
+        s.value(viewFrames);
+        if (s.isLoading()) {
+            hashlifeStale = true;
+            hashlifeRetry = 0;
+            if (world) updateDensityPalette();
+        }
+    }
+    
+    // Pick the viewport's next zoom and a drift of half a pixel per frame in
+    // one of eight directions, zooming around the viewport's center
+    void aimViewport() {
+        static const int8_t directions[8][2] = {
+            {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}
+        };
+        uint8_t oldZoom = zoom;
+        zoom = fastRandom(1, maxZoom + 1);
+        int32_t shiftX = ((int32_t)oldZoom - zoom) * matrix->width() / 2;
+        int32_t shiftY = ((int32_t)oldZoom - zoom) * matrix->height() / 2;
+        viewX = wrapView(viewX + shiftX * 256, width);
+        viewY = wrapView(viewY + shiftY * 256, height);
+        
+        const int8_t* d = directions[fastRandom(8)];
+        panX = d[0] * 128 * zoom;
+        panY = d[1] * 128 * zoom;
+        viewFrames = GOL_WORLD_VIEW_FRAMES;
+        updateDensityPalette();
+    }
+    
+    // Position p (1/256 cells) wrapped onto a world side of `size` cells
+    static uint32_t wrapView(int32_t p, uint16_t size) {
+        int32_t span = (int32_t)size << 8;
+        p %= span;
+        return p < 0 ? p + span : p;
+    }
+    
+    // Black through cellColor, for 0 to zoom * zoom live cells under a pixel
+    void updateDensityPalette() {
+        Rgb full = {(uint8_t)((cellColor >> 8) & 0xF8), (uint8_t)((cellColor >> 3) & 0xFC),
+                    (uint8_t)(cellColor << 3)};
+        uint8_t levels = zoom * zoom;
+        for (uint8_t n = 0; n <= levels; n++) {
+            densityPalette[n] = rgb565(mix(Rgb{0, 0, 0}, full, n * 255 / levels));
+        }
+    }
+    
+    // Copy count cells of world row y, from cell x on and wrapping around,
+    // into viewBits (bit i & 31 of word i >> 5), plus one word to spare
+    void copyWorldRow(uint16_t y, uint16_t x, uint16_t count) {
+        const uint32_t* row = cells + y * wordsPerRow;
+        uint16_t w = x >> 5;
+        uint8_t shift = x & 31;
+        for (uint16_t i = 0; i <= (count + 31) / 32; i++) {
+            uint16_t next = (w + 1 == wordsPerRow) ? 0 : w + 1;
+            viewBits[i] = shift ? (row[w] >> shift) | (row[next] << (32 - shift)) : row[w];
+            w = next;
+        }
+    }
+    
+    // Move the viewport on, then repaint the whole display from it: one cell
+    // per pixel, or zoomed out, each pixel shaded by how many of the
+    // zoom x zoom cells under it are alive. The view moves every frame, so
+    // the dirty rows are no help here.
+    void renderViewport() {
+        if (--viewFrames == 0) aimViewport();
+        viewX = wrapView(viewX + panX, width);
+        viewY = wrapView(viewY + panY, height);
+        
+        uint16_t displayWidth = matrix->width();
+        uint16_t left = viewX >> 8;
+        uint16_t top = viewY >> 8;
+        if (zoom == 1) {
+            for (uint16_t y = 0; y < matrix->height(); y++) {
+                copyWorldRow((top + y) % height, left, displayWidth);
+                matrix->blitBitmapSpan(y, 0, displayWidth, viewBits, 0, cellColor);
+            }
+        } else {
+            uint32_t mask = (1UL << zoom) - 1;
+            for (uint16_t y = 0; y < matrix->height(); y++) {
+                memset(viewCounts, 0, displayWidth);
+                for (uint8_t r = 0; r < zoom; r++) {
+                    copyWorldRow((top + y * zoom + r) % height, left, displayWidth * zoom);
+                    for (uint16_t x = 0; x < displayWidth; x++) {
+                        // The pixel's cells, which may straddle two words
+                        uint16_t bit = x * zoom;
+                        uint8_t shift = bit & 31;
+                        uint32_t v = viewBits[bit >> 5] >> shift;
+                        if (shift + zoom > 32) v |= viewBits[(bit >> 5) + 1] << (32 - shift);
+                        // The M0+ has no popcount instruction: a nibble at a time
+                        for (v &= mask; v; v >>= 4) viewCounts[x] += (0x4332322132212110ULL >> ((v & 15) * 4)) & 15;
+                    }
+                }
+                matrix->blitIndexedRow(y, viewCounts, densityPalette);
+            }
+        }
+        clearDirty();
+    }
+    
+    // Advance one generation with the dense kernel, visiting only the words
+    // in active tiles
+    void updateDense() {
+        if (isDisplaySized()) {
+            updateDense(Extent<(TOTAL_WIDTH + 31) / 32>{wordsPerRow}, Extent<TOTAL_HEIGHT>{height});
+        } else {
+            updateDense(Extent<0>{wordsPerRow}, Extent<0>{height});
+        }
+    }
+    
+    template <uint16_t Words, uint16_t Rows>
+    void updateDense(Extent<Words> words, Extent<Rows> rows) {
+        // Bit-sliced update: each word holds 32 cells, and the eight neighbor
+        // bits of all 32 are summed in parallel by lifeNext()
+        uint32_t flipped = 0;
+        for (uint16_t y = 0; y < rows.size(); y++) {
+            // Rows above and below, wrapping around the edges
+            const uint32_t* up = cells + rows.prev(y) * words.size();
+            const uint32_t* mid = cells + y * words.size();
+            const uint32_t* down = cells + rows.next(y) * words.size();
+            uint32_t* out = nextCells + y * words.size();
+            uint8_t ty = y >> ACTIVE_TILE_SHIFT;
+            
+            // Look the words' tiles up once per tile row
+            if ((y & (ACTIVE_TILE_SIZE - 1)) == 0) {
+                for (uint16_t w = 0; w < words.size(); w++) {
+                    wordActive[w] = isWordActive(w, ty);
+                    wordChanges[w] = 0;
+                }
+            }
+            
+            uint32_t rowChanges = 0;
+            for (uint16_t w = 0; w < words.size(); w++) {
+                // Nothing near these cells changed last generation, so they
+                // keep their state, which out already holds
+                if (!wordActive[w]) continue;
+                
+                // Neighboring words, wrapping around the edges
+                uint16_t wl = words.prev(w);
+                uint16_t wr = words.next(w);
+                
+                // Bit x of each input is the neighbor of cell x in that direction
+                uint32_t n0 = (up[w] << 1) | (up[wl] >> 31);
+                uint32_t n1 = up[w];
+                uint32_t n2 = (up[w] >> 1) | (up[wr] << 31);
+                uint32_t n3 = (mid[w] << 1) | (mid[wl] >> 31);
+                uint32_t n4 = (mid[w] >> 1) | (mid[wr] << 31);
+                uint32_t n5 = (down[w] << 1) | (down[wl] >> 31);
+                uint32_t n6 = down[w];
+                uint32_t n7 = (down[w] >> 1) | (down[wr] << 31);
+                
+                uint32_t next = lifeNext(n0, n1, n2, n3, n4, n5, n6, n7, mid[w], birthRules, survivalRules);
+                uint32_t diff = next ^ mid[w];
+                rowChanges |= diff;
+                wordChanges[w] |= diff;
+                out[w] = next;
+                if (AUTOMATON_POPULATION && diff) flipped += countBits(diff);
+            }
+            if (rowChanges) markRowDirty(y);
+            
+            // Report the tile row's changes once its last row is done
+            if ((y & (ACTIVE_TILE_SIZE - 1)) == ACTIVE_TILE_SIZE - 1 || y == rows.size() - 1) {
+                for (uint16_t w = 0; w < words.size(); w++) {
+                    if (wordChanges[w]) markWordChanged(w, ty, wordChanges[w]);
+                }
+            }
+        }
+        
+        countFlips(flipped);
+        
+        // Swap cell buffers
+        uint32_t* temp = cells;
+        cells = nextCells;
+        nextCells = temp;
+    }
+    
+    // Two generations in one pass over the grid (temporal blocking): the
+    // generation between is only ever held three rows at a time, in
+    // halfRows, each one computed just before the row after it needs it.
+    // Every word is visited. Tiles are marked with what changed in either
+    // generation, so the next one's active set is the same as two
+    // updateDense() would leave, and rows with what differs at the end.
+    void updateDenseTwice() {
+        uint16_t words = wordsPerRow;
+        uint32_t* first = halfRows;             // Row 0 of the generation between
+        uint32_t* last = halfRows + words;      // Its row height - 1
+        uint32_t* ring[3] = { halfRows + 2 * words, halfRows + 3 * words, halfRows + 4 * words };
+        lifeRow(cells + (height - 2) * words, cells + (height - 1) * words, cells, last);
+        lifeRow(cells + (height - 1) * words, cells, cells + words, first);
+        
+        uint32_t flipped = 0;
+        const uint32_t* up = last;
+        const uint32_t* mid = first;
+        for (uint16_t y = 1; y <= height; y++) {
+            // Row y of the generation between, then row y - 1 of the one after
+            const uint32_t* down;
+            if (y == height) {
+                down = first;
+            } else if (y == height - 1) {
+                down = last;
+            } else {
+                uint32_t* row = ring[y % 3];
+                lifeRow(cells + (y - 1) * words, cells + y * words, cells + (y + 1) * words, row);
+                down = row;
+            }
+            
+            uint16_t r = y - 1;
+            uint32_t* out = nextCells + r * words;
+            const uint32_t* before = cells + r * words;
+            uint8_t ty = r >> ACTIVE_TILE_SHIFT;
+            if ((r & (ACTIVE_TILE_SIZE - 1)) == 0) memset(wordChanges, 0, words * sizeof(uint32_t));
+            lifeRow(up, mid, down, out);
+            
+            uint32_t rowChanges = 0;
+            for (uint16_t w = 0; w < words; w++) {
+                uint32_t diff = out[w] ^ before[w];
+                rowChanges |= diff;
+                wordChanges[w] |= diff | (out[w] ^ mid[w]);
+                if (AUTOMATON_POPULATION && diff) flipped += countBits(diff);
+            }
+            if (rowChanges) markRowDirty(r);
+            if ((r & (ACTIVE_TILE_SIZE - 1)) == ACTIVE_TILE_SIZE - 1 || r == height - 1) {
+                for (uint16_t w = 0; w < words; w++) {
+                    if (wordChanges[w]) markWordChanged(w, ty, wordChanges[w]);
+                }
+            }
+            up = mid;
+            mid = down;
+        }
+        
+        countFlips(flipped);
+        uint32_t* temp = cells;
+        cells = nextCells;
+        nextCells = temp;
+    }
+    
+    // The next generation of every word of row mid, between rows up and
+    // down, into out
+    void lifeRow(const uint32_t* up, const uint32_t* mid, const uint32_t* down, uint32_t* out) const {
+        for (uint16_t w = 0; w < wordsPerRow; w++) {
+            uint16_t wl = w > 0 ? w - 1 : wordsPerRow - 1;
+            uint16_t wr = w + 1 < wordsPerRow ? w + 1 : 0;
+            uint32_t n0 = (up[w] << 1) | (up[wl] >> 31);
+            uint32_t n1 = up[w];
+            uint32_t n2 = (up[w] >> 1) | (up[wr] << 31);
+            uint32_t n3 = (mid[w] << 1) | (mid[wl] >> 31);
+            uint32_t n4 = (mid[w] >> 1) | (mid[wr] << 31);
+            uint32_t n5 = (down[w] << 1) | (down[wl] >> 31);
+            uint32_t n6 = down[w];
+            uint32_t n7 = (down[w] >> 1) | (down[wr] << 31);
+            out[w] = lifeNext(n0, n1, n2, n3, n4, n5, n6, n7, mid[w], birthRules, survivalRules);
+        }
+    }
+    
+    // Whether any tile covered by word w of tile row ty is active
+    bool isWordActive(uint16_t w, uint8_t ty) const {
+        uint8_t tx = (w << 5) >> ACTIVE_TILE_SHIFT;
+        for (uint8_t k = 0; k < (32 >> ACTIVE_TILE_SHIFT); k++) {
+            if (isTileActive(tx + k, ty)) return true;
+        }
+        return false;
+    }
+    
+    // Advance generations through the Hashlife engine, writing only the
+    // last into cells. Returns false (having changed nothing) if the dense
+    // kernel has to do them instead.
+    bool updateHashlife(uint16_t generations = 1) {
+        if (hashlifeRetry > 0) {
+            hashlifeRetry--;
+            return false;
+        }
+        
+        if (hashlifeStale) {
+            hashlife->setRules(birthRules, survivalRules);
+            hashlife->load(cells, wordsPerRow);
+            hashlifeStale = false;
+        }
+        
+        bool stepped = true;
+        for (uint16_t i = 0; i < generations && stepped; i++) stepped = hashlife->step();
+        if (stepped) {
+            // cells still holds the generation stored last; only changed
+            // blocks are rewritten and reported
+            uint32_t flipped = 0;
+            hashlife->store(cells, wordsPerRow, [&](uint16_t x, uint16_t y, uint8_t before, uint8_t after) {
+                markCellChanged(x, y);
+                if (AUTOMATON_POPULATION) flipped += countBits(before ^ after);
+            });
+            countFlips(flipped);
+            return true;
+        }
+        
+        // nextCells fell behind while the engine ran, so the dense kernel
+        // has to visit everything once
+        markAllTilesActive();
+        
+        // Cache full: reload from the dense grid next time, or give the
+        // dense kernel a long turn if the cache barely lasted
+        if (hashlife->getSteps() < GOL_HASHLIFE_MIN_RUN) {
+            hashlifeRetry = GOL_HASHLIFE_RETRY_AFTER;
+        }
+        hashlifeStale = true;
+        return false;
+    }
     
     // Initialize color palette for different rule sets
     void initColorPalette() {
-        colorPalette[CONWAY] = matrix->color565(255, 255, 255);      // White
-        colorPalette[DAY_NIGHT] = matrix->color565(255, 255, 0);     // Yellow
-        colorPalette[MAZE] = matrix->color565(255, 255, 255);        // White
-        colorPalette[MAZECTRIC] = matrix->color565(255, 255, 100);   // Light yellow
-        colorPalette[ANNEAL] = matrix->color565(255, 100, 0);        // Orange
-        colorPalette[DIAMOEBA] = matrix->color565(0, 100, 255);      // Blue
+        colorPalette[CONWAY] = rgb565(255, 255, 255);      // White
+        colorPalette[DAY_NIGHT] = rgb565(255, 255, 0);     // Yellow
+        colorPalette[MAZE] = rgb565(255, 255, 255);        // White
+        colorPalette[MAZECTRIC] = rgb565(255, 255, 100);   // Light yellow
+        colorPalette[ANNEAL] = rgb565(255, 100, 0);        // Orange
+        colorPalette[DIAMOEBA] = rgb565(0, 100, 255);      // Blue
         
         // Set initial cell color
         updateCellColor();
@@ -729,23 +2210,33 @@ private:
         if (currentRuleSet >= 0 && currentRuleSet < 6) {
             cellColor = colorPalette[currentRuleSet];
         } else {
-            cellColor = matrix->color565(200, 200, 200); // Default gray for custom rules
+            cellColor = rgb565(200, 200, 200); // Default gray for custom rules
+        }
+        markAllDirty();
+    }
+    
+    // Set or clear a single cell in the bit-packed grid
+    void setCell(uint16_t x, uint16_t y, bool alive) {
+        uint32_t& word = cells[y * wordsPerRow + (x >> 5)];
+        uint32_t mask = (uint32_t)1 << (x & 31);
+        if (alive) {
+            word |= mask;
+        } else {
+            word &= ~mask;
         }
     }
     
-    // Initialize with random cells
+    // Initialize with random cells, a word at a time
     void initRandom(uint8_t density) {
         for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                cells[y * width + x] = random(100) < density;
-            }
+            fastRandomRowBits(cells + y * wordsPerRow, width, density);
         }
     }
     
     // Initialize with a small random seed in the center
     void initCenterSeed() {
         // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        memset(cells, 0, wordsPerRow * height * sizeof(uint32_t));
         
         // Add random cells in the center
         uint16_t centerX = width / 2;
@@ -759,7 +2250,7 @@ private:
                     int16_t py = centerY + y;
                     
                     if (px >= 0 && px < width && py >= 0 && py < height) {
-                        cells[py * width + px] = random(100) < 50;
+                        setCell(px, py, fastRandom(100) < 50);
                     }
                 }
             }
@@ -769,18 +2260,18 @@ private:
     // Initialize Conway's Game of Life with random cells or patterns
     void initConway() {
         // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        memset(cells, 0, wordsPerRow * height * sizeof(uint32_t));
         
         // Choose initialization method
-        uint8_t method = random(100);
+        uint8_t method = fastRandom(100);
         
         if (method < 40) {
             // 40% chance for random cells (increased density from 25% to 30-35%)
-            initRandom(random(30, 36));
+            initRandom(fastRandom(30, 36));
         } else if (method < 80) {
             // 40% chance for multiple patterns
             // Add 3-5 patterns to ensure more activity
-            uint8_t numPatterns = random(3, 6);
+            uint8_t numPatterns = fastRandom(3, 6);
             for (int i = 0; i < numPatterns; i++) {
                 addPattern();
             }
@@ -790,7 +2281,7 @@ private:
             initRandom(15);
             
             // Add 2-3 patterns
-            uint8_t numPatterns = random(2, 4);
+            uint8_t numPatterns = fastRandom(2, 4);
             for (int i = 0; i < numPatterns; i++) {
                 addPattern();
             }
@@ -798,97 +2289,97 @@ private:
         
         // Always ensure there's at least one oscillator to prevent stagnation
         // Add a blinker in a random location
-        uint16_t bx = random(width - 4) + 2;
-        uint16_t by = random(height - 4) + 2;
-        cells[by * width + bx] = 1;
-        cells[by * width + (bx+1)] = 1;
-        cells[by * width + (bx+2)] = 1;
+        uint16_t bx = fastRandom(width - 4) + 2;
+        uint16_t by = fastRandom(height - 4) + 2;
+        setCell(bx, by, 1);
+        setCell((bx+1), by, 1);
+        setCell((bx+2), by, 1);
     }
     
     // Add a common Game of Life pattern
     void addPattern() {
         // Choose a random pattern
-        uint8_t pattern = random(8);
+        uint8_t pattern = fastRandom(8);
         
         // Calculate a random position for the pattern
-        uint16_t px = random(width - 10) + 5;
-        uint16_t py = random(height - 10) + 5;
+        uint16_t px = fastRandom(width - 10) + 5;
+        uint16_t py = fastRandom(height - 10) + 5;
         
         switch (pattern) {
             case 0: {
                 // Glider
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
-                cells[(py+1) * width + px] = 0;
-                cells[(py+1) * width + (px+1)] = 0;
-                cells[(py+1) * width + (px+2)] = 1;
-                cells[(py+2) * width + px] = 1;
-                cells[(py+2) * width + (px+1)] = 0;
-                cells[(py+2) * width + (px+2)] = 0;
+                setCell(px, py, 1);
+                setCell((px+1), py, 1);
+                setCell((px+2), py, 1);
+                setCell(px, (py+1), 0);
+                setCell((px+1), (py+1), 0);
+                setCell((px+2), (py+1), 1);
+                setCell(px, (py+2), 1);
+                setCell((px+1), (py+2), 0);
+                setCell((px+2), (py+2), 0);
                 break;
             }
             case 1: {
                 // Blinker
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
+                setCell(px, py, 1);
+                setCell((px+1), py, 1);
+                setCell((px+2), py, 1);
                 break;
             }
             case 2: {
                 // Block
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[(py+1) * width + px] = 1;
-                cells[(py+1) * width + (px+1)] = 1;
+                setCell(px, py, 1);
+                setCell((px+1), py, 1);
+                setCell(px, (py+1), 1);
+                setCell((px+1), (py+1), 1);
                 break;
             }
             case 3: {
                 // Gosper glider gun (if there's room)
                 if (px < width - 36 && py < height - 9) {
                     // Block on left
-                    cells[(py+4) * width + (px+0)] = 1;
-                    cells[(py+4) * width + (px+1)] = 1;
-                    cells[(py+5) * width + (px+0)] = 1;
-                    cells[(py+5) * width + (px+1)] = 1;
+                    setCell((px+0), (py+4), 1);
+                    setCell((px+1), (py+4), 1);
+                    setCell((px+0), (py+5), 1);
+                    setCell((px+1), (py+5), 1);
                     
                     // Left structure
-                    cells[(py+2) * width + (px+12)] = 1;
-                    cells[(py+2) * width + (px+13)] = 1;
-                    cells[(py+3) * width + (px+11)] = 1;
-                    cells[(py+3) * width + (px+15)] = 1;
-                    cells[(py+4) * width + (px+10)] = 1;
-                    cells[(py+4) * width + (px+16)] = 1;
-                    cells[(py+5) * width + (px+10)] = 1;
-                    cells[(py+5) * width + (px+14)] = 1;
-                    cells[(py+5) * width + (px+16)] = 1;
-                    cells[(py+5) * width + (px+17)] = 1;
-                    cells[(py+6) * width + (px+10)] = 1;
-                    cells[(py+6) * width + (px+16)] = 1;
-                    cells[(py+7) * width + (px+11)] = 1;
-                    cells[(py+7) * width + (px+15)] = 1;
-                    cells[(py+8) * width + (px+12)] = 1;
-                    cells[(py+8) * width + (px+13)] = 1;
+                    setCell((px+12), (py+2), 1);
+                    setCell((px+13), (py+2), 1);
+                    setCell((px+11), (py+3), 1);
+                    setCell((px+15), (py+3), 1);
+                    setCell((px+10), (py+4), 1);
+                    setCell((px+16), (py+4), 1);
+                    setCell((px+10), (py+5), 1);
+                    setCell((px+14), (py+5), 1);
+                    setCell((px+16), (py+5), 1);
+                    setCell((px+17), (py+5), 1);
+                    setCell((px+10), (py+6), 1);
+                    setCell((px+16), (py+6), 1);
+                    setCell((px+11), (py+7), 1);
+                    setCell((px+15), (py+7), 1);
+                    setCell((px+12), (py+8), 1);
+                    setCell((px+13), (py+8), 1);
                     
                     // Right structure
-                    cells[(py+0) * width + (px+24)] = 1;
-                    cells[(py+1) * width + (px+22)] = 1;
-                    cells[(py+1) * width + (px+24)] = 1;
-                    cells[(py+2) * width + (px+20)] = 1;
-                    cells[(py+2) * width + (px+21)] = 1;
-                    cells[(py+3) * width + (px+20)] = 1;
-                    cells[(py+3) * width + (px+21)] = 1;
-                    cells[(py+4) * width + (px+20)] = 1;
-                    cells[(py+4) * width + (px+21)] = 1;
-                    cells[(py+5) * width + (px+22)] = 1;
-                    cells[(py+5) * width + (px+24)] = 1;
-                    cells[(py+6) * width + (px+24)] = 1;
+                    setCell((px+24), (py+0), 1);
+                    setCell((px+22), (py+1), 1);
+                    setCell((px+24), (py+1), 1);
+                    setCell((px+20), (py+2), 1);
+                    setCell((px+21), (py+2), 1);
+                    setCell((px+20), (py+3), 1);
+                    setCell((px+21), (py+3), 1);
+                    setCell((px+20), (py+4), 1);
+                    setCell((px+21), (py+4), 1);
+                    setCell((px+22), (py+5), 1);
+                    setCell((px+24), (py+5), 1);
+                    setCell((px+24), (py+6), 1);
                     
                     // Block on right
-                    cells[(py+2) * width + (px+34)] = 1;
-                    cells[(py+2) * width + (px+35)] = 1;
-                    cells[(py+3) * width + (px+34)] = 1;
-                    cells[(py+3) * width + (px+35)] = 1;
+                    setCell((px+34), (py+2), 1);
+                    setCell((px+35), (py+2), 1);
+                    setCell((px+34), (py+3), 1);
+                    setCell((px+35), (py+3), 1);
                 }
                 break;
             }
@@ -899,13 +2390,13 @@ private:
                     for (int i = 2; i <= 4; i++) {
                         for (int j = 0; j < 3; j++) {
                             // Top left
-                            cells[(py+i) * width + (px+j+1)] = 1;
+                            setCell((px+j+1), (py+i), 1);
                             // Top right
-                            cells[(py+i) * width + (px+j+8)] = 1;
+                            setCell((px+j+8), (py+i), 1);
                             // Bottom left
-                            cells[(py+i+8) * width + (px+j+1)] = 1;
+                            setCell((px+j+1), (py+i+8), 1);
                             // Bottom right
-                            cells[(py+i+8) * width + (px+j+8)] = 1;
+                            setCell((px+j+8), (py+i+8), 1);
                         }
                     }
                     
@@ -913,13 +2404,13 @@ private:
                     for (int i = 0; i < 3; i++) {
                         for (int j = 2; j <= 4; j++) {
                             // Top left
-                            cells[(py+i+1) * width + (px+j)] = 1;
+                            setCell((px+j), (py+i+1), 1);
                             // Top right
-                            cells[(py+i+1) * width + (px+j+8)] = 1;
+                            setCell((px+j+8), (py+i+1), 1);
                             // Bottom left
-                            cells[(py+i+8) * width + (px+j)] = 1;
+                            setCell((px+j), (py+i+8), 1);
                             // Bottom right
-                            cells[(py+i+8) * width + (px+j+8)] = 1;
+                            setCell((px+j+8), (py+i+8), 1);
                         }
                     }
                 }
@@ -930,35 +2421,35 @@ private:
                 if (px < width - 10 && py < height - 10) {
                     // Main body
                     for (int i = 0; i < 8; i++) {
-                        cells[(py+1) * width + (px+i+1)] = 1;
+                        setCell((px+i+1), (py+1), 1);
                     }
                     
                     // Top and bottom cells
-                    cells[py * width + (px+3)] = 1;
-                    cells[py * width + (px+6)] = 1;
-                    cells[(py+2) * width + (px+3)] = 1;
-                    cells[(py+2) * width + (px+6)] = 1;
+                    setCell((px+3), py, 1);
+                    setCell((px+6), py, 1);
+                    setCell((px+3), (py+2), 1);
+                    setCell((px+6), (py+2), 1);
                 }
                 break;
             }
             case 6: {
                 // R-pentomino (methuselah)
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
-                cells[(py+1) * width + (px)] = 1;
-                cells[(py+1) * width + (px+1)] = 1;
-                cells[(py+2) * width + (px+1)] = 1;
+                setCell((px+1), py, 1);
+                setCell((px+2), py, 1);
+                setCell((px), (py+1), 1);
+                setCell((px+1), (py+1), 1);
+                setCell((px+1), (py+2), 1);
                 break;
             }
             case 7: {
                 // Acorn (methuselah)
-                cells[py * width + (px+1)] = 1;
-                cells[(py+1) * width + (px+3)] = 1;
-                cells[(py+2) * width + (px)] = 1;
-                cells[(py+2) * width + (px+1)] = 1;
-                cells[(py+2) * width + (px+4)] = 1;
-                cells[(py+2) * width + (px+5)] = 1;
-                cells[(py+2) * width + (px+6)] = 1;
+                setCell((px+1), py, 1);
+                setCell((px+3), (py+1), 1);
+                setCell((px), (py+2), 1);
+                setCell((px+1), (py+2), 1);
+                setCell((px+4), (py+2), 1);
+                setCell((px+5), (py+2), 1);
+                setCell((px+6), (py+2), 1);
                 break;
             }
         }
@@ -975,97 +2466,118 @@ private:
  */
 class BriansBrain : public CellularAutomaton {
 public:
-    BriansBrain(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height) 
+    BriansBrain(Display* matrix, uint16_t width, uint16_t height) 
         : CellularAutomaton(matrix, width, height) {
-        cells = new uint8_t[width * height];
-        nextCells = new uint8_t[width * height];
+        // Two bit planes, 32 cells per word (width must be a multiple of 32):
+        // a cell is on, dying, or off when neither bit is set
+        wordsPerRow = (width + 31) / 32;
+        on = automatonArena().allocate<uint32_t>(wordsPerRow * height);
+        dying = automatonArena().allocate<uint32_t>(wordsPerRow * height);
+        nextOn = automatonArena().allocate<uint32_t>(wordsPerRow * height);
+        rowStates = automatonArena().allocate<uint8_t>(width);
         
         // Initialize with random colors
         randomizeColors();
-    }
-    
-    ~BriansBrain() {
-        delete[] cells;
-        delete[] nextCells;
+        
+        // Sparse starts can die out or freeze
+        trackActivity();
+        trackPopulation();
     }
     
     void init() override {
         // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        memset(on, 0, wordsPerRow * height * sizeof(uint32_t));
+        memset(dying, 0, wordsPerRow * height * sizeof(uint32_t));
         
         // Randomly seed cells (about 30% on)
         for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                cells[y * width + x] = random(100) < 30 ? 1 : 0;
-            }
+            fastRandomRowBits(on + y * wordsPerRow, width, 30);
         }
         
         // Randomize colors for variety
         randomizeColors();
+        markAllDirty();
     }
     
     void update() override {
-        // Calculate the next generation
-        for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                uint8_t current = cells[y * width + x];
-                
-                if (current == 2) {
-                    // Dying cells become off
-                    nextCells[y * width + x] = 0;
-                } else if (current == 1) {
-                    // On cells become dying
-                    nextCells[y * width + x] = 2;
-                } else {
-                    // Off cells check for neighbors
-                    uint8_t neighbors = 0;
-                    for (int8_t dy = -1; dy <= 1; dy++) {
-                        for (int8_t dx = -1; dx <= 1; dx++) {
-                            // Skip the cell itself
-                            if (dx == 0 && dy == 0) continue;
-                            
-                            // Calculate neighbor coordinates with wrapping
-                            uint16_t nx = (x + dx + width) % width;
-                            uint16_t ny = (y + dy + height) % height;
-                            
-                            // Count only "on" neighbors
-                            if (cells[ny * width + nx] == 1) neighbors++;
-                        }
-                    }
-                    
-                    // Apply Brian's Brain rule: Off cells become on if exactly 2 neighbors are on
-                    nextCells[y * width + x] = (neighbors == 2) ? 1 : 0;
-                }
+        if (isDisplaySized()) {
+            update(Extent<(TOTAL_WIDTH + 31) / 32>{wordsPerRow}, Extent<TOTAL_HEIGHT>{height});
+        } else {
+            update(Extent<0>{wordsPerRow}, Extent<0>{height});
+        }
+    }
+    
+    template <uint16_t Words, uint16_t Rows>
+    void update(Extent<Words> words, Extent<Rows> rows) {
+        // Bit-sliced like GameOfLife::updateDense(): off cells are born with
+        // exactly two on neighbors, which is lifeNext() with rule B2/S and
+        // every on or dying cell counted as occupied. On cells then start
+        // dying and dying cells go off, which is just a change of planes.
+        uint32_t flipped = 0;
+        for (uint16_t y = 0; y < rows.size(); y++) {
+            // Rows above and below, wrapping around the edges
+            const uint32_t* up = on + rows.prev(y) * words.size();
+            const uint32_t* mid = on + y * words.size();
+            const uint32_t* down = on + rows.next(y) * words.size();
+            const uint32_t* midDying = dying + y * words.size();
+            uint32_t* out = nextOn + y * words.size();
+            
+            uint32_t rowChanges = 0;
+            for (uint16_t w = 0; w < words.size(); w++) {
+                // Neighboring words, wrapping around the edges
+                uint16_t wl = words.prev(w);
+                uint16_t wr = words.next(w);
+                
+                // Bit x of each input is the neighbor of cell x in that direction
+                uint32_t n0 = (up[w] << 1) | (up[wl] >> 31);
+                uint32_t n1 = up[w];
+                uint32_t n2 = (up[w] >> 1) | (up[wr] << 31);
+                uint32_t n3 = (mid[w] << 1) | (mid[wl] >> 31);
+                uint32_t n4 = (mid[w] >> 1) | (mid[wr] << 31);
+                uint32_t n5 = (down[w] << 1) | (down[wl] >> 31);
+                uint32_t n6 = down[w];
+                uint32_t n7 = (down[w] >> 1) | (down[wr] << 31);
+                
+                uint32_t born = lifeNext(n0, n1, n2, n3, n4, n5, n6, n7, mid[w] | midDying[w], 1 << 2, 0);
+                
+                // Every on or dying cell changes state, as does every newborn
+                rowChanges |= born | mid[w] | midDying[w];
+                out[w] = born;
+                
+                // Births, and on cells starting to die (never the same cell)
+                if (AUTOMATON_POPULATION && (born | mid[w])) flipped += countBits(born | mid[w]);
             }
+            if (rowChanges) markRowDirty(y);
         }
+        countFlips(flipped);
         
-        // Swap cell buffers
-        uint8_t* temp = cells;
-        cells = nextCells;
-        nextCells = temp;
+        // The on cells are now dying; the old dying plane (all going off)
+        // takes the next generation's births
+        uint32_t* spare = dying;
+        dying = on;
+        on = nextOn;
+        nextOn = spare;
     }
     
     void render() override {
-        // Optimized rendering using our consistent mapping function
-        
-        // Draw all cells
+        // Expand each dirty row into palette indices: off, on, dying
         for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                uint8_t state = cells[y * width + x];
-                if (state == 1) {
-                    // On cells - use onColor
-                    drawMappedPixel(x, y, onColor);
-                } else if (state == 2) {
-                    // Dying cells - use dyingColor
-                    drawMappedPixel(x, y, dyingColor);
-                } else {
-                    // Off cells - black
-                    drawMappedPixel(x, y, 0);
+            if (!isRowDirty(y)) continue;
+            const uint32_t* onRow = on + y * wordsPerRow;
+            const uint32_t* dyingRow = dying + y * wordsPerRow;
+            for (uint16_t w = 0; w < wordsPerRow; w++) {
+                uint32_t o = onRow[w];
+                uint32_t d = dyingRow[w];
+                uint8_t* state = rowStates + (w << 5);
+                for (uint8_t b = 0; b < 32; b++) {
+                    state[b] = (o & 1) | ((d & 1) << 1);
+                    o >>= 1;
+                    d >>= 1;
                 }
             }
+            matrix->blitIndexedRow(y, rowStates, palette);
         }
-        
-        matrix->show();
+        memset(dirtyRows, 0, (height + 7) / 8);
     }
     
     const char* getName() const override {
@@ -1073,82 +2585,100 @@ public:
     }
     
 private:
-    uint8_t* cells;      // Current generation
-    uint8_t* nextCells;  // Next generation
+    uint32_t* on;        // Cells firing this generation
+    uint32_t* dying;     // Cells that fired last generation
+    uint32_t* nextOn;    // Births of the next generation
+    uint16_t wordsPerRow;
+    uint8_t* rowStates;  // One row of palette indices for render()
     uint16_t onColor;    // Color for on cells
     uint16_t dyingColor; // Color for dying cells
+    uint16_t palette[3]; // Cell state -> color (off, on, dying)
+    
+    uint32_t hashRow(uint16_t y) const override {
+        return hashWords(dying + y * wordsPerRow, wordsPerRow, hashWords(on + y * wordsPerRow, wordsPerRow));
+    }
+    
+    // On cells (dying ones don't count)
+    uint16_t rowPopulation(uint16_t y) const override {
+        uint16_t n = 0;
+        for (uint16_t w = 0; w < wordsPerRow; w++) {
+            n += countBits(on[y * wordsPerRow + w]);
+        }
+        return n;
+    }
+    
+    void snapshotState(Snapshot& s) override {
+        s.bytes(on, wordsPerRow * height * sizeof(uint32_t));
+        s.bytes(dying, wordsPerRow * height * sizeof(uint32_t));
+        s.value(onColor);
+        s.value(dyingColor);
+        s.value(palette);
+    }
     
     // Randomize the colors used for rendering
     void randomizeColors() {
         // Generate a random base hue (0-255)
-        uint8_t baseHue = random(256);
-        uint8_t r, g, b;
+        uint8_t baseHue = fastRandom(256);
         
         // Choose a random color scheme type
-        uint8_t schemeType = random(4);
+        uint8_t schemeType = fastRandom(4);
         
         switch (schemeType) {
             case 0: {
                 // Complementary color scheme
                 // "On" cells - bright, fully saturated color at the base hue
-                hsvToRgb(baseHue, 255, 255, &r, &g, &b);
-                onColor = matrix->color565(r, g, b);
+                onColor = rgb565(hsv(baseHue, 255, 255));
                 
                 // "Dying" cells - complementary color (opposite on color wheel) with lower brightness
-                hsvToRgb((baseHue + 128) % 256, 255, 180, &r, &g, &b);
-                dyingColor = matrix->color565(r, g, b);
+                dyingColor = rgb565(hsv((baseHue + 128) % 256, 255, 180));
                 break;
             }
             
             case 1: {
                 // Analogous color scheme
                 // "On" cells - bright, fully saturated color at the base hue
-                hsvToRgb(baseHue, 255, 255, &r, &g, &b);
-                onColor = matrix->color565(r, g, b);
+                onColor = rgb565(hsv(baseHue, 255, 255));
                 
                 // "Dying" cells - nearby hue with lower brightness
-                hsvToRgb((baseHue + 30) % 256, 255, 180, &r, &g, &b);
-                dyingColor = matrix->color565(r, g, b);
+                dyingColor = rgb565(hsv((baseHue + 30) % 256, 255, 180));
                 break;
             }
             
             case 2: {
                 // Brightness gradient (same hue)
                 // "On" cells - bright, fully saturated color at the base hue
-                hsvToRgb(baseHue, 255, 255, &r, &g, &b);
-                onColor = matrix->color565(r, g, b);
+                onColor = rgb565(hsv(baseHue, 255, 255));
                 
                 // "Dying" cells - same hue but lower brightness
-                hsvToRgb(baseHue, 255, 150, &r, &g, &b);
-                dyingColor = matrix->color565(r, g, b);
+                dyingColor = rgb565(hsv(baseHue, 255, 150));
                 break;
             }
             
             case 3: {
                 // High contrast scheme
                 // Choose one of several high-contrast combinations
-                uint8_t contrastType = random(5);
+                uint8_t contrastType = fastRandom(5);
                 
                 switch (contrastType) {
                     case 0: // White/Blue
-                        onColor = matrix->color565(255, 255, 255);
-                        dyingColor = matrix->color565(0, 0, 255);
+                        onColor = rgb565(255, 255, 255);
+                        dyingColor = rgb565(0, 0, 255);
                         break;
                     case 1: // Yellow/Red
-                        onColor = matrix->color565(255, 255, 0);
-                        dyingColor = matrix->color565(255, 0, 0);
+                        onColor = rgb565(255, 255, 0);
+                        dyingColor = rgb565(255, 0, 0);
                         break;
                     case 2: // Green/Purple
-                        onColor = matrix->color565(0, 255, 0);
-                        dyingColor = matrix->color565(180, 0, 255);
+                        onColor = rgb565(0, 255, 0);
+                        dyingColor = rgb565(180, 0, 255);
                         break;
                     case 3: // Cyan/Blue
-                        onColor = matrix->color565(0, 255, 255);
-                        dyingColor = matrix->color565(0, 80, 255);
+                        onColor = rgb565(0, 255, 255);
+                        dyingColor = rgb565(0, 80, 255);
                         break;
                     case 4: // Orange/Green
-                        onColor = matrix->color565(255, 150, 0);
-                        dyingColor = matrix->color565(0, 180, 0);
+                        onColor = rgb565(255, 150, 0);
+                        dyingColor = rgb565(0, 180, 0);
                         break;
                 }
                 break;
@@ -1157,149 +2687,188 @@ private:
         
         // Ensure the "on" color is always brighter than the "dying" color
         // This maintains the visual distinction between states that is key to Brian's Brain
-        uint8_t r1, g1, b1, r2, g2, b2;
-        r1 = (onColor >> 11) & 0x1F;
-        g1 = (onColor >> 5) & 0x3F;
-        b1 = onColor & 0x1F;
-        
-        r2 = (dyingColor >> 11) & 0x1F;
-        g2 = (dyingColor >> 5) & 0x3F;
-        b2 = dyingColor & 0x1F;
-        
-        // Calculate perceived brightness (rough approximation)
-        uint16_t brightness1 = r1 + g1 + b1;
-        uint16_t brightness2 = r2 + g2 + b2;
-        
-        // If dying color is brighter than on color, swap them
-        if (brightness2 > brightness1) {
+        if (brightness(dyingColor) > brightness(onColor)) {
             uint16_t temp = onColor;
             onColor = dyingColor;
             dyingColor = temp;
         }
-    }
-    
-    // Helper function to convert HSV to RGB
-    void hsvToRgb(uint8_t h, uint8_t s, uint8_t v, uint8_t* r, uint8_t* g, uint8_t* b) {
-        uint8_t region, remainder, p, q, t;
-        
-        if (s == 0) {
-            *r = *g = *b = v;
-            return;
-        }
-        
-        region = h / 43;
-        remainder = (h - (region * 43)) * 6;
         
-        p = (v * (255 - s)) >> 8;
-        q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-        t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
-        
-        switch (region) {
-            case 0: *r = v; *g = t; *b = p; break;
-            case 1: *r = q; *g = v; *b = p; break;
-            case 2: *r = p; *g = v; *b = t; break;
-            case 3: *r = p; *g = q; *b = v; break;
-            case 4: *r = t; *g = p; *b = v; break;
-            default: *r = v; *g = p; *b = q; break;
-        }
+        palette[0] = 0;
+        palette[1] = onColor;
+        palette[2] = dyingColor;
     }
 };
 
 /**
- * Langton's Ant
+ * Langton's Ant, and turmites in general
+ * 
+ * Each cell has one of several colors, and the rule string holds one turn
+ * per color: L(eft), R(ight), N(o turn) or U(-turn). An ant turns as its
+ * cell's letter says, advances the cell to the next color and steps forward.
+ * "RL" is the classic two-color ant.
+ * 
+ * With many steps per frame the ants only touch a few hundred cells per
+ * frame, so update() records them and render() repaints just those cells
+ * instead of whole dirty tiles.
  */
 class LangtonsAnt : public CellularAutomaton {
 public:
     // Direction constants
     enum Direction { UP, RIGHT, DOWN, LEFT };
     
-    LangtonsAnt(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height, uint8_t numAnts = 1)
-        : CellularAutomaton(matrix, width, height), numAnts(numAnts) {
+    LangtonsAnt(Display* matrix, uint16_t width, uint16_t height, uint8_t numAnts = 1)
+        : CellularAutomaton(matrix, width, height), numAnts(numAnts),
+          stepsPerFrame(1), touchedCount(0) {
+        
+        cells = automatonArena().allocate<uint8_t>(width * height);
+        ants = automatonArena().allocate<Ant>(numAnts);
+        touched = automatonArena().allocate<Cell>(LANGTON_MAX_TOUCHED);
+        
+        setRule("RL");
+    }
+    
+    // Use a turmite rule string such as "RLR" or "LLRR" (2 to
+    // LANGTON_MAX_COLORS letters of L, R, N, U). Returns false, keeping the
+    // current rule, if it isn't one. Takes effect from the next init().
+    bool setRule(const char* newRule) {
+        uint8_t length = strlen(newRule);
+        if (length < 2 || length > LANGTON_MAX_COLORS) return false;
+        
+        uint8_t newTurns[LANGTON_MAX_COLORS];
+        for (uint8_t i = 0; i < length; i++) {
+            switch (newRule[i]) {
+                case 'N': newTurns[i] = 0; break;
+                case 'R': newTurns[i] = 1; break;
+                case 'U': newTurns[i] = 2; break;
+                case 'L': newTurns[i] = 3; break;
+                default: return false;
+            }
+        }
+        
+        memcpy(turns, newTurns, length);
+        memcpy(rule, newRule, length + 1);
+        numColors = length;
         
-        cells = new uint8_t[width * height];
-        ants = new Ant[numAnts];
+        // Black for unvisited cells; the classic ant keeps its light gray,
+        // turmites spread their other colors around the hue wheel
+        palette[0] = 0;
+        if (numColors == 2) {
+            palette[1] = rgb565(160, 160, 160);
+        } else {
+            for (uint8_t i = 1; i < numColors; i++) {
+                palette[i] = hueColor((i - 1) * 256 / (numColors - 1));
+            }
+        }
+        return true;
+    }
+    
+    // Move every ant this many cells per frame (at least 1)
+    void setStepsPerFrame(uint16_t steps) {
+        stepsPerFrame = steps > 0 ? steps : 1;
     }
     
-    ~LangtonsAnt() {
-        delete[] cells;
-        delete[] ants;
+    // Pick a random rule and speed: mostly the classic ant, sometimes a
+    // turmite, often fast enough to reach the interesting structures
+    void randomRule() {
+        static const char* const rules[] = {
+            "RL",            // Langton's ant: chaos, then a highway
+            "RLR",           // Chaotic growth
+            "LLRR",          // Symmetric, brain-like growth
+            "LRRRRRLLR",     // Square-filling
+            "LLRRRLRLRLLR",  // Convoluted highway
+            "RRLLLRLLLRRR"   // Growing triangle
+        };
+        static const uint16_t speeds[] = { 1, 16, 200, 1000 };
+        
+        setRule(rules[fastRandom(100) < 50 ? 0 : fastRandom(1, sizeof(rules) / sizeof(rules[0]))]);
+        setStepsPerFrame(speeds[fastRandom(sizeof(speeds) / sizeof(speeds[0]))]);
     }
     
     void init() override {
         // Clear all cells
         memset(cells, 0, width * height * sizeof(uint8_t));
+        touchedCount = 0;
+        
+        // Ant colors, repeating after six ants
+        static constexpr uint16_t antColors[6] = {
+            rgb565(255, 0, 0),    // Red
+            rgb565(0, 255, 0),    // Green
+            rgb565(0, 0, 255),    // Blue
+            rgb565(255, 255, 0),  // Yellow
+            rgb565(255, 0, 255),  // Magenta
+            rgb565(0, 255, 255)   // Cyan
+        };
         
         // Initialize ants at random positions
         for (uint8_t i = 0; i < numAnts; i++) {
-            ants[i].x = random(width);
-            ants[i].y = random(height);
-            ants[i].dir = static_cast<Direction>(random(4));
-            
-            // Assign colors to ants
-            switch (i % 6) {
-                case 0: ants[i].color = matrix->color565(255, 0, 0); break;     // Red
-                case 1: ants[i].color = matrix->color565(0, 255, 0); break;     // Green
-                case 2: ants[i].color = matrix->color565(0, 0, 255); break;     // Blue
-                case 3: ants[i].color = matrix->color565(255, 255, 0); break;   // Yellow
-                case 4: ants[i].color = matrix->color565(255, 0, 255); break;   // Magenta
-                case 5: ants[i].color = matrix->color565(0, 255, 255); break;   // Cyan
-            }
+            ants[i].x = fastRandom(width);
+            ants[i].y = fastRandom(height);
+            ants[i].dir = static_cast<Direction>(fastRandom(4));
+            ants[i].color = antColors[i % 6];
         }
+        markAllDirty();
     }
     
     void update() override {
-        // Move each ant
-        for (uint8_t i = 0; i < numAnts; i++) {
-            Ant& ant = ants[i];
-            
-            // Get current cell state
-            uint8_t cellState = cells[ant.y * width + ant.x];
-            
-            // Toggle cell state
-            cells[ant.y * width + ant.x] = !cellState;
-            
-            // Turn based on cell state (was white or black before toggling)
-            if (cellState) {
-                // Turn left on white cell
-                ant.dir = static_cast<Direction>((ant.dir + 3) % 4);
-            } else {
-                // Turn right on black cell
-                ant.dir = static_cast<Direction>((ant.dir + 1) % 4);
-            }
-            
-            // Move forward
-            switch (ant.dir) {
-                case UP:    ant.y = (ant.y - 1 + height) % height; break;
-                case RIGHT: ant.x = (ant.x + 1) % width; break;
-                case DOWN:  ant.y = (ant.y + 1) % height; break;
-                case LEFT:  ant.x = (ant.x - 1 + width) % width; break;
+        if (isDisplaySized()) {
+            update(Extent<TOTAL_WIDTH>{width}, Extent<TOTAL_HEIGHT>{height});
+        } else {
+            update(Extent<0>{width}, Extent<0>{height});
+        }
+    }
+    
+    template <uint16_t Cols, uint16_t Rows>
+    void update(Extent<Cols> cols, Extent<Rows> rows) {
+        for (uint16_t step = 0; step < stepsPerFrame; step++) {
+            // Move each ant
+            for (uint8_t i = 0; i < numAnts; i++) {
+                Ant& ant = ants[i];
+                uint8_t* cell = cells + ant.y * cols.size() + ant.x;
+                
+                // Turn according to the cell's color, then advance the color
+                uint8_t state = *cell;
+                ant.dir = static_cast<Direction>((ant.dir + turns[state]) & 3);
+                *cell = (state + 1 == numColors) ? 0 : state + 1;
+                touchCell(ant.x, ant.y);
+                
+                // Move forward, wrapping around the edges
+                switch (ant.dir) {
+                    case UP:    ant.y = rows.prev(ant.y); break;
+                    case RIGHT: ant.x = cols.next(ant.x); break;
+                    case DOWN:  ant.y = rows.next(ant.y); break;
+                    case LEFT:  ant.x = cols.prev(ant.x); break;
+                }
             }
         }
     }
     
     void render() override {
-        // Optimized rendering using our consistent mapping function
-        for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                if (cells[y * width + x]) {
-                    drawMappedPixel(x, y, matrix->color565(160, 160, 160));  // Light gray for on cells
-                } else {
-                    drawMappedPixel(x, y, 0);  // Black for off cells
-                }
-            }
+        // Full repaints, and cells that didn't fit the touched list, go
+        // through the dirty tiles
+        renderDirtyTiles(cells, palette);
+        
+        // Then each touched cell on its own (doubles included, which is
+        // cheaper than removing them). The cell an ant was drawn on last
+        // frame is always among them, since the ant changed it on leaving.
+        for (uint16_t i = 0; i < touchedCount; i++) {
+            const Cell& c = touched[i];
+            drawMappedPixel(c.x, c.y, palette[cells[c.y * width + c.x]]);
         }
+        touchedCount = 0;
         
         // Draw all ants on top using our consistent mapping function
         for (uint8_t i = 0; i < numAnts; i++) {
             drawMappedPixel(ants[i].x, ants[i].y, ants[i].color);
         }
-        
-        matrix->show();
     }
     
     const char* getName() const override {
-        static char name[20];
-        sprintf(name, "Langton's Ant (%d)", numAnts);
+        static char name[16 + LANGTON_MAX_COLORS];
+        if (numColors == 2 && rule[0] == 'R') {
+            sprintf(name, "Langton's Ant (%d)", numAnts);
+        } else {
+            sprintf(name, "Turmite %s (%d)", rule, numAnts);
+        }
         return name;
     }
     
@@ -1310,9 +2879,45 @@ private:
         uint16_t color;  // Ant color
     };
     
-    uint8_t* cells;    // Cell states (0 = black, 1 = white)
+    struct Cell {
+        uint16_t x, y;
+    };
+    
+    uint8_t* cells;    // Cell colors (0 = black, unvisited)
     Ant* ants;         // Array of ants
     uint8_t numAnts;   // Number of ants
+    char rule[LANGTON_MAX_COLORS + 1];    // Turn per cell color
+    uint8_t turns[LANGTON_MAX_COLORS];    // Quarter turns clockwise per cell color
+    uint8_t numColors;                    // Length of the rule
+    uint16_t palette[LANGTON_MAX_COLORS]; // Cell color -> display color
+    uint16_t stepsPerFrame; // Ant moves per update()
+    Cell* touched;          // Cells changed since the last render()
+    uint16_t touchedCount;
+    
+    uint8_t snapshotParam() const override { return numAnts; }
+    
+    void snapshotState(Snapshot& s) override {
+        s.bytes(cells, (uint32_t)width * height);
+        s.bytes(ants, numAnts * sizeof(Ant));
+        s.value(rule);
+        s.value(turns);
+        s.value(numColors);
+        s.value(palette);
+        s.value(stepsPerFrame);
+        if (s.isLoading()) touchedCount = 0; // Everything is repainted
+    }
+    
+    // Queue a changed cell for render(), or hand it to the dirty tiles once
+    // the list is full
+    void touchCell(uint16_t x, uint16_t y) {
+        if (touchedCount < LANGTON_MAX_TOUCHED) {
+            touched[touchedCount].x = x;
+            touched[touchedCount].y = y;
+            touchedCount++;
+        } else {
+            markCellDirty(x, y);
+        }
+    }
 };
 
 /**
@@ -1347,55 +2952,48 @@ public:
         SKIP_STATES     // Skip states for discontinuous transitions
     };
     
-    CyclicAutomaton(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height, 
+    CyclicAutomaton(Display* matrix, uint16_t width, uint16_t height, 
                    uint8_t numStates = 16, uint8_t threshold = 2)
         : CellularAutomaton(matrix, width, height), 
-          numStates(numStates), threshold(threshold), 
-          initPattern(RANDOM), colorScheme(0), range(1),
-          variableThreshold(false), stateSkip(1) {
-        
-        cells = new uint8_t[width * height];
-        nextCells = new uint8_t[width * height];
+          cells(width, height, CYCLIC_MAX_RANGE), nextCells(width, height, CYCLIC_MAX_RANGE),
+          numStates(numStates), threshold(threshold), range(1),
+          initPattern(RANDOM), colorScheme(0),
+          variableThreshold(false), stateSkip(1), fixedParameters(false) {
         
         // Initialize color palette
-        colorPalette = new uint16_t[numStates];
         generateColorPalette();
-    }
-    
-    ~CyclicAutomaton() {
-        delete[] cells;
-        delete[] nextCells;
-        delete[] colorPalette;
+        
+        // Only a frozen grid: spirals repeat every few generations too
+        trackActivity(1);
     }
     
     void init() override {
-        // Randomize the color scheme for variety
-        colorScheme = random(5);
-        
-        // Create a new color palette based on the random scheme
-        generateColorPalette();
-        
         // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        cells.clear();
         
+        // A preset or parameters set from outside are kept
+        if (!fixedParameters) {
+            // Randomize the color scheme for variety
+            colorScheme = fastRandom(5);
+            
             // Randomize parameters to create interesting patterns
             
             // Threshold is critical for spiral formation and reactions
             // Lower thresholds (1-2) tend to create more active, spreading patterns with more reactions
             // Higher thresholds (3+) create more stable, structured patterns
-            if (random(100) < 85) {  // Increased from 70% to 85% to favor more dynamic patterns
+            if (fastRandom(100) < 85) {  // Increased from 70% to 85% to favor more dynamic patterns
                 // 85% chance for threshold values that create good spirals and reactions
-                threshold = random(100) < 70 ? 1 : 2;  // Favor threshold 1 more (70% vs 30%) for more reactions
+                threshold = fastRandom(100) < 70 ? 1 : 2;  // Favor threshold 1 more (70% vs 30%) for more reactions
             } else {
                 // 15% chance for other thresholds
-                threshold = random(1, 4);
+                threshold = fastRandom(1, 4);
             }
             
             // Range affects how far the influence spreads
             // Range 1 creates tighter, more detailed patterns
             // Range 2 creates larger, more sweeping patterns
             // Range 3 creates very large influence areas (new option)
-            uint8_t rangeRoll = random(100);
+            uint8_t rangeRoll = fastRandom(100);
             if (rangeRoll < 70) {
                 range = 1;  // 70% chance for detailed patterns
             } else if (rangeRoll < 90) {
@@ -1408,127 +3006,131 @@ public:
             // 8-16 states work well for spiral patterns
             // 3-6 states work well for rock-paper-scissors dynamics
             // 17-32 states create complex, colorful patterns
-            uint8_t stateRoll = random(100);
+            uint8_t stateRoll = fastRandom(100);
             if (stateRoll < 40) {  // Reduced from 60% to 40%
                 // 40% chance for spiral-friendly state counts
-                numStates = random(8, 17);
+                numStates = fastRandom(8, 17);
             } else if (stateRoll < 65) {  // Increased from 20% to 25%
                 // 25% chance for rock-paper-scissors dynamics
-                numStates = random(3, 7);
+                numStates = fastRandom(3, 7);
             } else {  // Increased from 20% to 35%
                 // 35% chance for high state counts (more colorful visuals)
-                numStates = random(17, 33);
+                numStates = fastRandom(17, 33);
             }
             
-            // Reallocate color palette if number of states changed
-            delete[] colorPalette;
-            colorPalette = new uint16_t[numStates];
+            // Regenerate the color palette for the new number of states
             generateColorPalette();
             
             // Variable threshold can create interesting effects
             // but works best with specific state counts
-            variableThreshold = (random(100) < 45) && (numStates >= 8);  // Increased from 30% to 45%
+            variableThreshold = (fastRandom(100) < 45) && (numStates >= 8);  // Increased from 30% to 45%
             
             // State skipping creates discontinuous patterns with more dramatic reactions
             // Works best with higher state counts
             if (numStates >= 8) {
-                uint8_t skipRoll = random(100);
+                uint8_t skipRoll = fastRandom(100);
                 if (skipRoll < 35) {  // Increased from 20% to 35%
                     // 35% chance to skip states with higher state counts
-                    stateSkip = random(2, min(numStates / 3, 4) + 1);
+                    stateSkip = fastRandom(2, min(numStates / 3, 4) + 1);
                 } else if (skipRoll < 45) {  // New 10% chance for larger skips
                     // 10% chance for larger state skips (creates more dramatic transitions)
-                    stateSkip = random(min(numStates / 3, 4) + 1, min(numStates / 2, 8) + 1);
+                    stateSkip = fastRandom(min(numStates / 3, 4) + 1, min(numStates / 2, 8) + 1);
                 } else {
                     stateSkip = 1; // 55% chance for normal sequential states
                 }
             } else {
                 stateSkip = 1; // Normal sequential states for low state counts
             }
+        }
         
         // Choose a random initialization pattern if not specified
-        if (random(100) < 70) {
+        if (fastRandom(100) < 70) {
             // 70% chance to use the current pattern
             initWithPattern(initPattern);
         } else {
             // 30% chance to use a random pattern
-            InitPattern randomPattern = static_cast<InitPattern>(random(5));
+            InitPattern randomPattern = static_cast<InitPattern>(fastRandom(5));
             initWithPattern(randomPattern);
         }
     }
     
     void update() override {
+        // Wrap the edges into the halo so neighbors need no modulo
+        cells.refreshHalo();
+        
+        // Per-state successor and threshold, so the cell loop has no division
+        uint8_t successor[32];
+        uint8_t stateThreshold[32];
+        for (uint8_t state = 0; state < numStates; state++) {
+            // Next state (cyclically) with possible state skipping
+            successor[state] = (state + stateSkip) % numStates;
+            
+            if (variableThreshold) {
+                // Variable threshold based on state
+                // Lower states have lower thresholds, higher states have higher thresholds
+                stateThreshold[state] = 1 + (state * 3) / numStates;
+            } else {
+                stateThreshold[state] = threshold;
+            }
+        }
+        
         // Calculate the next generation
+        const int8_t r = range;
+        const uint8_t span = 2 * r + 1;
         for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                // Get current state
-                uint8_t currentState = cells[y * width + x];
-                
-                // Calculate next state (cyclically) with possible state skipping
-                uint8_t nextState = (currentState + stateSkip) % numStates;
-                
-                // Determine threshold based on settings
-                uint8_t currentThreshold;
-                if (variableThreshold) {
-                    // Variable threshold based on state
-                    // Lower states have lower thresholds, higher states have higher thresholds
-                    currentThreshold = 1 + (currentState * 3) / numStates;
-                } else {
-                    currentThreshold = threshold;
+            const uint8_t* mid = cells.row(y);
+            uint8_t* out = nextCells.row(y);
+            
+            // Per-state counts over the window around the current cell,
+            // seeded for x = 0 and slid one column at a time, so each cell
+            // costs 2 * span updates instead of span * span reads
+            const uint8_t* rows[2 * CYCLIC_MAX_RANGE + 1];
+            uint8_t counts[32];
+            memset(counts, 0, numStates);
+            for (uint8_t i = 0; i < span; i++) {
+                rows[i] = cells.row(y + i - r);
+                for (int8_t dx = -r; dx <= r; dx++) {
+                    counts[rows[i][dx]]++;
                 }
-                
-                // Count neighbors in the next state within the specified range
-                uint8_t neighbors = 0;
-                for (int8_t dy = -range; dy <= range; dy++) {
-                    for (int8_t dx = -range; dx <= range; dx++) {
-                        // Skip the cell itself
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        // Calculate neighbor coordinates with wrapping
-                        uint16_t nx = (x + dx + width) % width;
-                        uint16_t ny = (y + dy + height) % height;
-                        
-                        // Count neighbors in the next state
-                        if (cells[ny * width + nx] == nextState) {
-                            neighbors++;
-                        }
+            }
+            
+            for (uint16_t x = 0; x < width; x++) {
+                if (x > 0) {
+                    // Drop the column that left the window, add the new one
+                    for (uint8_t i = 0; i < span; i++) {
+                        counts[rows[i][x - r - 1]]--;
+                        counts[rows[i][x + r]]++;
                     }
                 }
                 
+                // Get current state
+                uint8_t currentState = mid[x];
+                uint8_t nextState = successor[currentState];
+                
+                // Neighbors in the next state; the window includes the cell itself
+                uint8_t neighbors = counts[nextState] - (currentState == nextState);
+                
                 // Apply rule: change to next state if enough neighbors are in next state
-                if (neighbors >= currentThreshold) {
-                    nextCells[y * width + x] = nextState;
-                } else {
-                    nextCells[y * width + x] = currentState;
-                }
+                out[x] = (neighbors >= stateThreshold[currentState]) ? nextState : currentState;
             }
+            markRowIfChanged(cells, nextCells, y);
         }
         
         // Swap cell buffers
-        uint8_t* temp = cells;
-        cells = nextCells;
-        nextCells = temp;
+        cells.swap(nextCells);
     }
     
     void render() override {
-        // Draw all cells using our consistent mapping function
-        for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                // Get cell state from logical coordinates
-                uint8_t state = cells[y * width + x];
-                
-                // Draw using our common mapping function
-                drawMappedPixel(x, y, colorPalette[state]);
-            }
-        }
-        
-        matrix->show();
+        // Cell states are palette indices; only rows update() changed are sent
+#if AUTOMATON_DITHER
+        renderDitheredRows(cells, colorDither[0], CYCLIC_MAX_STATES);
+#else
+        renderDirtyRows(cells, colorPalette);
+#endif
     }
     
     // Set a specific preset configuration
     void setPreset(Preset preset) {
-        // Store original values to check if we need to reallocate
-        uint8_t oldNumStates = numStates;
         switch (preset) {
             case SPIRAL_WAVES:
                 numStates = 8;
@@ -1591,7 +3193,7 @@ public:
                 break;
                 
             case HIGH_STATE_COUNT:
-                numStates = random(24, 33); // 24-32 states
+                numStates = fastRandom(24, 33); // 24-32 states
                 threshold = 1;
                 range = 1;
                 colorScheme = 0; // Rainbow
@@ -1607,15 +3209,10 @@ public:
                 colorScheme = 0; // Rainbow
                 initPattern = RANDOM;
                 variableThreshold = false;
-                stateSkip = random(2, 5); // Skip 2-4 states
+                stateSkip = fastRandom(2, 5); // Skip 2-4 states
                 break;
         }
-        
-        // Reallocate color palette only if number of states changed
-        if (numStates != oldNumStates) {
-            delete[] colorPalette;
-            colorPalette = new uint16_t[numStates];
-        }
+        fixedParameters = true;
         
         // Generate new color palette and initialize
         generateColorPalette();
@@ -1628,16 +3225,21 @@ public:
         init();
     }
     
+    // Fill the grid with random cells again, keeping the rule init() chose:
+    // the slabs of a wall (WallLink.h) pick the same rule from a shared
+    // seed, then their cells from seeds of their own
+    void scatter() {
+        fixedParameters = true;
+        initWithPattern(RANDOM);
+    }
+    
     // Set the number of states
     void setNumStates(uint8_t states) {
         if (states < 2) states = 2;
-        if (states > 32) states = 32;
+        if (states > CYCLIC_MAX_STATES) states = CYCLIC_MAX_STATES;
         
         numStates = states;
-        
-        // Reallocate color palette
-        delete[] colorPalette;
-        colorPalette = new uint16_t[numStates];
+        fixedParameters = true;
         
         // Generate new color palette and initialize
         generateColorPalette();
@@ -1647,13 +3249,15 @@ public:
     // Set the threshold for state change
     void setThreshold(uint8_t newThreshold) {
         threshold = newThreshold;
+        fixedParameters = true;
     }
     
     // Set the neighborhood range
     void setRange(uint8_t newRange) {
         if (newRange < 1) newRange = 1;
-        if (newRange > 3) newRange = 3;
+        if (newRange > CYCLIC_MAX_RANGE) newRange = CYCLIC_MAX_RANGE;
         range = newRange;
+        fixedParameters = true;
     }
     
     const char* getName() const override {
@@ -1685,21 +3289,44 @@ public:
     }
     
 private:
-    uint8_t* cells;        // Current generation
-    uint8_t* nextCells;    // Next generation
+    HaloGrid cells;        // Current generation (halo of CYCLIC_MAX_RANGE)
+    HaloGrid nextCells;    // Next generation
     uint8_t numStates;     // Number of states
     uint8_t threshold;     // Threshold for state change
     uint8_t range;         // Neighborhood range
     InitPattern initPattern; // Current initialization pattern
     uint8_t colorScheme;   // Current color scheme
-    uint16_t* colorPalette; // Color palette for each state
+    uint16_t colorPalette[CYCLIC_MAX_STATES]; // Color palette for each state
+#if AUTOMATON_DITHER
+    uint16_t colorDither[DITHER_PHASES][CYCLIC_MAX_STATES]; // The same, dithered (setDitherColor())
+#endif
     bool variableThreshold; // Whether to use variable threshold based on state
     uint8_t stateSkip;     // Number of states to skip in transitions (1 = normal)
+    bool fixedParameters;  // Set by setPreset() and the setters, so init() keeps them
+    
+    uint32_t hashRow(uint16_t y) const override {
+        return hashBytes(cells.row(y), width);
+    }
+    
+    void snapshotState(Snapshot& s) override {
+        cells.snapshot(s);
+        s.value(numStates);
+        s.value(threshold);
+        s.value(range);
+        s.value(initPattern);
+        s.value(colorScheme);
+        s.value(colorPalette);
+        s.value(variableThreshold);
+        s.value(stateSkip);
+#if AUTOMATON_DITHER
+        if (s.isLoading()) generateColorPalette(); // The dithered colors aren't saved
+#endif
+    }
     
     // Initialize with a specific pattern
     void initWithPattern(InitPattern pattern) {
         // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        cells.clear();
         
         // Apply the specified pattern
         switch (pattern) {
@@ -1707,7 +3334,7 @@ private:
                 // Random cells throughout
                 for (uint16_t y = 0; y < height; y++) {
                     for (uint16_t x = 0; x < width; x++) {
-                        cells[y * width + x] = random(numStates);
+                        cells.at(x, y) = fastRandom(numStates);
                     }
                 }
                 break;
@@ -1726,7 +3353,7 @@ private:
                                 int16_t py = centerY + y;
                                 
                                 if (px >= 0 && px < width && py >= 0 && py < height) {
-                                    cells[py * width + px] = random(numStates);
+                                    cells.at(px, py) = fastRandom(numStates);
                                 }
                             }
                         }
@@ -1741,10 +3368,10 @@ private:
                     uint16_t halfHeight = height / 2;
                     
                     // Top-left quadrant
-                    uint8_t state1 = random(numStates);
+                    uint8_t state1 = fastRandom(numStates);
                     for (uint16_t y = 0; y < halfHeight; y++) {
                         for (uint16_t x = 0; x < halfWidth; x++) {
-                            cells[y * width + x] = state1;
+                            cells.at(x, y) = state1;
                         }
                     }
                     
@@ -1752,7 +3379,7 @@ private:
                     uint8_t state2 = (state1 + 1) % numStates;
                     for (uint16_t y = 0; y < halfHeight; y++) {
                         for (uint16_t x = halfWidth; x < width; x++) {
-                            cells[y * width + x] = state2;
+                            cells.at(x, y) = state2;
                         }
                     }
                     
@@ -1760,7 +3387,7 @@ private:
                     uint8_t state3 = (state2 + 1) % numStates;
                     for (uint16_t y = halfHeight; y < height; y++) {
                         for (uint16_t x = 0; x < halfWidth; x++) {
-                            cells[y * width + x] = state3;
+                            cells.at(x, y) = state3;
                         }
                     }
                     
@@ -1768,7 +3395,7 @@ private:
                     uint8_t state4 = (state3 + 1) % numStates;
                     for (uint16_t y = halfHeight; y < height; y++) {
                         for (uint16_t x = halfWidth; x < width; x++) {
-                            cells[y * width + x] = state4;
+                            cells.at(x, y) = state4;
                         }
                     }
                 }
@@ -1782,35 +3409,34 @@ private:
                     for (uint16_t y = 0; y < height; y++) {
                         uint8_t state = (y / stripeHeight) % numStates;
                         for (uint16_t x = 0; x < width; x++) {
-                            cells[y * width + x] = state;
+                            cells.at(x, y) = state;
                         }
                     }
                 }
                 break;
                 
             case SPIRAL:
-                // Spiral pattern
+                // Spiral pattern, in Q16.16 fixed point (no FPU on the RP2040)
                 {
-                    uint16_t centerX = width / 2;
-                    uint16_t centerY = height / 2;
-                    float maxDist = sqrt(centerX*centerX + centerY*centerY);
+                    int16_t centerX = width / 2;
+                    int16_t centerY = height / 2;
+                    
+                    // Distances in Q8.8, from the square root of a Q16.16 square
+                    uint32_t maxDist = isqrt(((uint32_t)centerX * centerX + (uint32_t)centerY * centerY) << 16);
                     
                     for (uint16_t y = 0; y < height; y++) {
                         for (uint16_t x = 0; x < width; x++) {
                             // Calculate distance from center
-                            float dx = x - centerX;
-                            float dy = y - centerY;
-                            float dist = sqrt(dx*dx + dy*dy);
-                            
-                            // Calculate angle
-                            float angle = atan2(dy, dx);
-                            if (angle < 0) angle += 2 * PI;
+                            int32_t dx = x - centerX;
+                            int32_t dy = y - centerY;
+                            uint32_t dist = isqrt((uint32_t)(dx * dx + dy * dy) << 16);
                             
-                            // Calculate state based on angle and distance
-                            float spiralFactor = angle / (2 * PI) + dist / maxDist;
-                            uint8_t state = (uint8_t)(spiralFactor * numStates) % numStates;
+                            // Turns around the center plus the fraction of the
+                            // way out to the corners, both Q0.16
+                            uint32_t spiralFactor = atan2Turns(dy, dx) + (dist << 16) / maxDist;
+                            uint8_t state = ((spiralFactor * numStates) >> 16) % numStates;
                             
-                            cells[y * width + x] = state;
+                            cells.at(x, y) = state;
                         }
                     }
                 }
@@ -1821,58 +3447,57 @@ private:
         initPattern = pattern;
     }
     
-    // Generate a color palette
+    // Generate a color palette, gamma-corrected so the steps between states
+    // look even at the panel's bit depth
     void generateColorPalette() {
         switch (colorScheme) {
             case 0:
                 // Rainbow spectrum
                 for (uint8_t i = 0; i < numStates; i++) {
-                    float hue = (float)i / numStates;
-                    colorPalette[i] = hueToRGB565(hue);
+                    setStateColor(i, hue(i * 256 / numStates));
                 }
                 break;
                 
             case 1:
-                // Fire color scheme (black to red to yellow to white)
+                // Fire color scheme (black to red to yellow to white), with
+                // t = 0..1 as Q0.8 (0..255)
                 for (uint8_t i = 0; i < numStates; i++) {
-                    float t = (float)i / (numStates - 1);
-                    uint8_t r = 255 * min(1.0f, t * 4);
-                    uint8_t g = 255 * min(1.0f, max(0.0f, (t - 0.25f) * 4));
-                    uint8_t b = 255 * min(1.0f, max(0.0f, (t - 0.5f) * 4));
-                    colorPalette[i] = matrix->color565(r, g, b);
+                    int16_t t = 255 * i / (numStates - 1);
+                    uint8_t r = clampByte(t * 4);
+                    uint8_t g = clampByte((t - 64) * 4);
+                    uint8_t b = clampByte((t - 128) * 4);
+                    setStateColor(i, Rgb{r, g, b});
                 }
                 break;
                 
             case 2:
                 // Ocean color scheme (deep blue to cyan to white)
                 for (uint8_t i = 0; i < numStates; i++) {
-                    float t = (float)i / (numStates - 1);
-                    uint8_t r = 255 * min(1.0f, max(0.0f, (t - 0.5f) * 2));
-                    uint8_t g = 255 * min(1.0f, t * 2);
-                    uint8_t b = 255 * min(1.0f, 0.5f + t * 0.5f);
-                    colorPalette[i] = matrix->color565(r, g, b);
+                    int16_t t = 255 * i / (numStates - 1);
+                    uint8_t r = clampByte((t - 128) * 2);
+                    uint8_t g = clampByte(t * 2);
+                    uint8_t b = clampByte(128 + t / 2);
+                    setStateColor(i, Rgb{r, g, b});
                 }
                 break;
                 
             case 3:
                 // Grayscale
                 for (uint8_t i = 0; i < numStates; i++) {
-                    uint8_t v = 255 * i / (numStates - 1);
-                    colorPalette[i] = matrix->color565(v, v, v);
+                    setStateColor(i, mix(Rgb{0, 0, 0}, Rgb{255, 255, 255}, 255 * i / (numStates - 1)));
                 }
                 break;
                 
             case 4:
                 // RGB (for Rock-Paper-Scissors)
                 if (numStates == 3) {
-                    colorPalette[0] = matrix->color565(255, 0, 0);    // Red (Rock)
-                    colorPalette[1] = matrix->color565(0, 255, 0);    // Green (Paper)
-                    colorPalette[2] = matrix->color565(0, 0, 255);    // Blue (Scissors)
+                    setStateColor(0, Rgb{255, 0, 0});  // Red (Rock)
+                    setStateColor(1, Rgb{0, 255, 0});  // Green (Paper)
+                    setStateColor(2, Rgb{0, 0, 255});  // Blue (Scissors)
                 } else {
                     // Fall back to rainbow for other state counts
                     for (uint8_t i = 0; i < numStates; i++) {
-                        float hue = (float)i / numStates;
-                        colorPalette[i] = hueToRGB565(hue);
+                        setStateColor(i, hue(i * 256 / numStates));
                     }
                 }
                 break;
@@ -1880,33 +3505,19 @@ private:
             default:
                 // Default to rainbow
                 for (uint8_t i = 0; i < numStates; i++) {
-                    float hue = (float)i / numStates;
-                    colorPalette[i] = hueToRGB565(hue);
+                    setStateColor(i, hue(i * 256 / numStates));
                 }
                 break;
         }
+        markAllDirty();
     }
     
-    // Convert HSV to RGB565
-    uint16_t hueToRGB565(float h) {
-        // Convert hue (0-1) to RGB
-        // Based on HSV with S=1, V=1
-        h = fmod(h, 1.0f) * 6.0f;
-        int i = (int)h;
-        float f = h - i;
-        
-        uint8_t r, g, b;
-        switch (i) {
-            case 0: r = 255; g = 255 * f; b = 0; break;
-            case 1: r = 255 * (1 - f); g = 255; b = 0; break;
-            case 2: r = 0; g = 255; b = 255 * f; break;
-            case 3: r = 0; g = 255 * (1 - f); b = 255; break;
-            case 4: r = 255 * f; g = 0; b = 255; break;
-            case 5: r = 255; g = 0; b = 255 * (1 - f); break;
-            default: r = 0; g = 0; b = 0; break;
-        }
-        
-        return matrix->color565(r, g, b);
+    // State i shows as c, gamma-corrected, and dithered when AUTOMATON_DITHER
+    void setStateColor(uint8_t i, Rgb c) {
+        colorPalette[i] = gammaColor(c);
+#if AUTOMATON_DITHER
+        setDitherColor(colorDither[0], CYCLIC_MAX_STATES, i, c);
+#endif
     }
 };
 
@@ -1921,23 +3532,57 @@ private:
  */
 class BubblingLava : public CellularAutomaton {
 public:
-    BubblingLava(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height) 
-        : CellularAutomaton(matrix, width, height) {
-        // Initialize the cells for both automata
-        cells = new uint8_t[width * height];
-        nextCells = new uint8_t[width * height];
-        ecaRow = new uint8_t[width];
+    BubblingLava(Display* matrix, uint16_t width, uint16_t height) 
+        : CellularAutomaton(matrix, width, height),
+          cells(width, height), nextCells(width, height) {
+        // Packed current and next ECA rows for the lava
+        ecaWords = (width + 31) / 32;
+        ecaBits = automatonArena().allocate<uint32_t>(2 * ecaWords);
         
         // Set up colors - more vibrant colors for better visibility
-        lavaColor = matrix->color565(255, 80, 0);    // Brighter orange-red for lava
-        bgColor = matrix->color565(100, 0, 0);       // Dark maroon background for both halves
+        lavaColor = rgb565(255, 80, 0);    // Brighter orange-red for lava
+        bgColor = rgb565(100, 0, 0);       // Dark maroon background for both halves
         
         // More distinct trail colors with better gradient
-        trailColors[0] = matrix->color565(255, 255, 0);  // Bright yellow for live cells
-        trailColors[1] = matrix->color565(255, 200, 0);  // Yellow-orange for recent trails
-        trailColors[2] = matrix->color565(255, 150, 0);  // Orange for medium trails
-        trailColors[3] = matrix->color565(255, 100, 0);  // Dark orange for older trails
-        trailColors[4] = matrix->color565(255, 50, 0);   // Red-orange for oldest trails
+        const Rgb trails[5] = {
+            {255, 255, 0},  // Bright yellow for live cells
+            {255, 200, 0},  // Yellow-orange for recent trails
+            {255, 150, 0},  // Orange for medium trails
+            {255, 100, 0},  // Dark orange for older trails
+            {255, 50, 0}    // Red-orange for oldest trails
+        };
+        for (uint8_t i = 0; i < 5; i++) trailColors[i] = rgb565(trails[i]);
+        
+        // Bottom half: any active state is lava
+        lavaPalette[0] = bgColor;
+        fillPalette(lavaPalette, 1, 255, lavaColor);
+        
+        // Top half: live cells, then trails fading with age
+        trailPalette[0] = bgColor;
+        trailPalette[1] = trailColors[0];
+        fillPalette(trailPalette, 2, 3, trailColors[1]);
+        fillPalette(trailPalette, 4, 5, trailColors[2]);
+        fillPalette(trailPalette, 6, 8, trailColors[3]);
+        fillPalette(trailPalette, 9, 255, trailColors[4]);
+        
+#if AUTOMATON_DITHER
+        // The same dithered, from the colors as they are (not gamma-corrected)
+        // so the trails look as before on average; ages start a color at
+        // 1, 2, 4, 6 and 9
+        const uint8_t firstAge[5] = {1, 2, 4, 6, 9};
+        uint8_t trail = 0;
+        for (uint16_t age = 0; age < 256; age++) {
+            while (trail < 5 && age >= firstAge[trail]) trail++;
+            setDitherColor(trailDither[0], 256, age, trail ? trails[trail - 1] : Rgb{100, 0, 0}, false);
+        }
+#endif
+        
+        // Game of Life above the middle, lava below; the lava's top row is the
+        // boundary, where an ECA runs and bubbles rise from
+        lifeBand.top = 0;
+        lifeBand.bottom = height / 2;
+        lavaBand.top = height / 2;
+        lavaBand.bottom = height;
         
         // Choose a chaotic rule for the ECA
         ecaRule = 30;  // Rule 30 is chaotic
@@ -1949,30 +3594,24 @@ public:
         lastPatternTime = 0;
     }
     
-    ~BubblingLava() {
-        delete[] cells;
-        delete[] nextCells;
-        delete[] ecaRow;
-    }
-    
     void init() override {
-        // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
+        // Clear all cells (both generations: update() writes every cell of
+        // the next one, but a restart must not see the last run)
+        cells.clear();
+        nextCells.clear();
         
         // Fill the entire bottom half with a complex pattern for the ECA
         // Start already filled up to the middle boundary
         for (uint16_t y = height/2; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                // Create a more dense pattern throughout the bottom half
-                cells[y * width + x] = (random(100) < 40) ? 1 : 0;
-            }
+            // Create a more dense pattern throughout the bottom half
+            fastRandomRowBytes(cells.row(y), width, 40);
         }
         
         // Add some random "hot spots" in the bottom half
         for (int i = 0; i < 15; i++) {  // Increased from 10 to 15
-            uint16_t cx = random(width);
-            uint16_t cy = height/2 + random(height/2);  // Only in bottom half
-            uint16_t radius = random(3, 8);
+            uint16_t cx = fastRandom(width);
+            uint16_t cy = height/2 + fastRandom(height/2);  // Only in bottom half
+            uint16_t radius = fastRandom(3, 8);
             
             for (int16_t y = -radius; y <= radius; y++) {
                 for (int16_t x = -radius; x <= radius; x++) {
@@ -1980,19 +3619,14 @@ public:
                         int16_t px = (cx + x + width) % width;
                         int16_t py = cy + y;
                         
-                        if (py >= height/2 && py < height) {
-                            cells[py * width + px] = 1;
+                        if (lavaBand.contains(py)) {
+                            cells.at(px, py) = 1;
                         }
                     }
                 }
             }
         }
         
-        // Initialize the ECA row at the middle boundary
-        for (uint16_t x = 0; x < width; x++) {
-            ecaRow[x] = cells[height/2 * width + x];
-        }
-        
         // Current ECA row starts at the middle boundary
         currentEcaRow = height/2;
         
@@ -2007,8 +3641,9 @@ public:
     }
     
     void update() override {
-        // Clear the next generation buffer
-        memset(nextCells, 0, width * height * sizeof(uint8_t));
+        // Wrap the columns into the halo so neighbors need no modulo; each
+        // band handles its own vertical edges
+        cells.refreshColumnHalo(0, height);
         
         // Update the ECA in the bottom half
         updateECA();
@@ -2029,52 +3664,19 @@ public:
         }
         
         // Swap cell buffers
-        uint8_t* temp = cells;
-        cells = nextCells;
-        nextCells = temp;
+        cells.swap(nextCells);
     }
     
     void render() override {
-        // Draw all cells
-        for (uint16_t y = 0; y < height; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                uint8_t state = cells[y * width + x];
-                uint16_t color;
-                
-                if (y >= height / 2) {
-                    // Bottom half - ECA (lava)
-                    if (state > 0) {
-                        color = lavaColor;  // Bright lava for active cells
-                    } else {
-                        color = bgColor;    // Dark maroon background for inactive cells
-                    }
-                } else {
-                    // Top half - Game of Life with trails
-                    if (state == 0) {
-                        color = bgColor;  // Dark maroon background for top half too
-                    } else if (state == 1) {
-                        // Live cell
-                        color = trailColors[0];  // Bright yellow
-                    } else if (state <= 3) {
-                        // Recent trail
-                        color = trailColors[1];  // Yellow-orange
-                    } else if (state <= 5) {
-                        // Medium trail
-                        color = trailColors[2];  // Orange
-                    } else if (state <= 8) {
-                        // Older trail
-                        color = trailColors[3];  // Dark orange
-                    } else {
-                        // Oldest trail
-                        color = trailColors[4];  // Red-orange
-                    }
-                }
-                
-                drawMappedPixel(x, y, color);
-            }
-        }
+        // Top half - Game of Life with trails
+#if AUTOMATON_DITHER
+        renderDitheredRegion(cells, trailDither[0], 256, lifeBand.top, lifeBand.bottom);
+#else
+        renderRegion(cells, trailPalette, lifeBand.top, lifeBand.bottom);
+#endif
         
-        matrix->show();
+        // Bottom half - ECA (lava)
+        renderRegion(cells, lavaPalette, lavaBand.top, lavaBand.bottom);
     }
     
     const char* getName() const override {
@@ -2082,82 +3684,87 @@ public:
     }
     
 private:
-    uint8_t* cells;       // Current generation
-    uint8_t* nextCells;   // Next generation
-    uint8_t* ecaRow;      // Current ECA row for computation
+    HaloGrid cells;       // Current generation
+    HaloGrid nextCells;   // Next generation
+    uint32_t* ecaBits;    // Packed current and next ECA rows for ecaNextRow()
+    uint16_t ecaWords;    // 32-cell words in each packed row
     uint16_t currentEcaRow; // Current row for ECA
     uint8_t ecaRule;      // Rule for the ECA
+    RowBand lifeBand;     // Top half: Game of Life with trails
+    RowBand lavaBand;     // Bottom half: lava, with the ECA on its top row
     
     uint16_t lavaColor;   // Color for active lava cells
     uint16_t bgColor;     // Background color for lava
     uint16_t trailColors[5]; // Colors for Game of Life trails (expanded to 5 colors)
+    uint16_t lavaPalette[256];  // Cell state -> color in the bottom half
+    uint16_t trailPalette[256]; // Cell state (trail age) -> color in the top half
+#if AUTOMATON_DITHER
+    uint16_t trailDither[DITHER_PHASES][256]; // The same, dithered (setDitherColor())
+#endif
     
     bool reachedMiddle;   // Flag to track if ECA has reached the middle
     uint16_t bubbleCounter; // Counter for bubble creation
     uint32_t lastBubbleTime; // Time of last bubble creation
     uint32_t lastPatternTime; // Time of last pattern addition
     
+    // nextCells is left out: update() writes all of it before reading it
+    void snapshotState(Snapshot& s) override {
+        cells.snapshot(s);
+        s.value(currentEcaRow);
+        s.value(ecaRule);
+        s.value(reachedMiddle);
+        s.value(bubbleCounter);
+        s.value(lastBubbleTime);
+        s.value(lastPatternTime);
+    }
+    
     // Update the Elementary Cellular Automaton in the bottom half
     void updateECA() {
         // Always calculate a new ECA row at the middle boundary
         // This ensures continuous evolution of the lava
         
-        // Calculate the next ECA row at the middle boundary
-        for (uint16_t x = 0; x < width; x++) {
-            // Get the left, center, and right cells from the current row
-            uint8_t left = cells[height/2 * width + ((x + width - 1) % width)];
-            uint8_t center = cells[height/2 * width + x];
-            uint8_t right = cells[height/2 * width + ((x + 1) % width)];
-            
-            // Compute the pattern index (0-7)
-            uint8_t pattern = (left << 2) | (center << 1) | right;
-            
-            // Apply the rule
-            ecaRow[x] = (ecaRule >> pattern) & 1;
-        }
-        
-        // Apply the calculated row to the middle boundary
-        for (uint16_t x = 0; x < width; x++) {
-            nextCells[height/2 * width + x] = ecaRow[x];
-        }
+        // Calculate the next ECA row at the middle boundary, 32 cells at a
+        // time, and apply it
+        packRow(cells.row(lavaBand.top), ecaBits, width);
+        ecaNextRow(ecaBits, ecaBits + ecaWords, width, ecaRule);
+        unpackRow(ecaBits + ecaWords, nextCells.row(lavaBand.top), width);
         
         // Update the rest of the bottom half with a cellular automaton-like behavior
-        for (uint16_t y = height/2 + 1; y < height; y++) {
+        for (uint16_t y = lavaBand.top + 1; y < lavaBand.bottom; y++) {
+            // Only neighbors in the bottom half count, so the last row has
+            // no row below it (it does not wrap to the top)
+            const uint8_t* up = cells.row(y - 1);
+            const uint8_t* mid = cells.row(y);
+            const uint8_t* down = (y + 1 < lavaBand.bottom) ? cells.row(y + 1) : NULL;
+            uint8_t* next = nextCells.row(y);
+            
+            uint32_t sparks = 0; // Random births (2%) for the next 32 cells
             for (uint16_t x = 0; x < width; x++) {
+                if (!(x & 31)) sparks = fastRandomBits(2);
+                
                 // Count live neighbors
-                uint8_t neighbors = 0;
-                for (int8_t dy = -1; dy <= 1; dy++) {
-                    for (int8_t dx = -1; dx <= 1; dx++) {
-                        // Skip the cell itself
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        // Calculate neighbor coordinates with wrapping
-                        uint16_t nx = (x + dx + width) % width;
-                        uint16_t ny = (y + dy + height) % height;
-                        
-                        // Only count neighbors in the bottom half
-                        if (ny >= height/2 && cells[ny * width + nx] > 0) {
-                            neighbors++;
-                        }
-                    }
+                uint8_t neighbors = (up[x - 1] > 0) + (up[x] > 0) + (up[x + 1] > 0) +
+                                    (mid[x - 1] > 0) + (mid[x + 1] > 0);
+                if (down) {
+                    neighbors += (down[x - 1] > 0) + (down[x] > 0) + (down[x + 1] > 0);
                 }
                 
                 // Apply a lava-like cellular automaton rule
-                if (cells[y * width + x] > 0) {
+                if (mid[x] > 0) {
                     // Cell is alive - stays alive with 2-5 neighbors
-                    nextCells[y * width + x] = (neighbors >= 2 && neighbors <= 5) ? 1 : 0;
+                    next[x] = (neighbors >= 2 && neighbors <= 5) ? 1 : 0;
                 } else {
                     // Cell is dead - becomes alive with 3 neighbors or randomly
-                    nextCells[y * width + x] = (neighbors == 3 || random(100) < 2) ? 1 : 0;
+                    next[x] = (neighbors == 3 || ((sparks >> (x & 31)) & 1)) ? 1 : 0;
                 }
             }
         }
         
         // Occasionally add new hot spots to keep the lava dynamic
-        if (random(100) < 15) { // 15% chance each frame (increased from 10%)
-            uint16_t cx = random(width);
-            uint16_t cy = height/2 + random(height/2);  // Only in bottom half
-            uint16_t radius = random(2, 6);
+        if (fastRandom(100) < 15) { // 15% chance each frame (increased from 10%)
+            uint16_t cx = fastRandom(width);
+            uint16_t cy = height/2 + fastRandom(height/2);  // Only in bottom half
+            uint16_t radius = fastRandom(2, 6);
             
             for (int16_t y = -radius; y <= radius; y++) {
                 for (int16_t x = -radius; x <= radius; x++) {
@@ -2165,8 +3772,8 @@ private:
                         int16_t px = (cx + x + width) % width;
                         int16_t py = cy + y;
                         
-                        if (py >= height/2 && py < height) {
-                            nextCells[py * width + px] = 1;
+                        if (lavaBand.contains(py)) {
+                            nextCells.at(px, py) = 1;
                         }
                     }
                 }
@@ -2181,181 +3788,181 @@ private:
             // For most patterns, concentrate them near the boundary with the bottom ECA
             if (i < 10) {  // 10 out of 15 patterns (67%) will be near the boundary
                 // Place patterns specifically near the boundary with the bottom ECA
-                uint8_t patternType = random(10);  // Same pattern types as addStablePattern
+                uint8_t patternType = fastRandom(10);  // Same pattern types as addStablePattern
                 
                 // Choose a random position near the boundary with the bottom ECA
                 // This is the lower part of the middle section (closer to 2*height/3)
-                uint16_t px = random(width - 12) + 6;  // Ensure more space around patterns
-                uint16_t py = (height/2) + (height/6) - random(height/8);  // Position in the lower part of middle section
+                uint16_t px = fastRandom(width - 12) + 6;  // Ensure more space around patterns
+                uint16_t py = (height/2) + (height/6) - fastRandom(height/8);  // Position in the lower part of middle section
                 
                 // Now add the pattern at this position using the same logic as addStablePattern
                 switch (patternType) {
                     case 0:
                         // Block (2x2 square) - stable
-                        cells[py * width + px] = 1;
-                        cells[py * width + (px+1)] = 1;
-                        cells[(py+1) * width + px] = 1;
-                        cells[(py+1) * width + (px+1)] = 1;
+                        cells.at(px, py) = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px, py+1) = 1;
+                        cells.at(px+1, (py+1)) = 1;
                         break;
                         
                     case 1:
                         // Blinker (3 cells in a row) - period 2 oscillator
-                        cells[py * width + px] = 1;
-                        cells[py * width + (px+1)] = 1;
-                        cells[py * width + (px+2)] = 1;
+                        cells.at(px, py) = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px+2, py) = 1;
                         break;
                         
                     case 2:
                         // Glider - moves diagonally
-                        cells[py * width + px] = 1;
-                        cells[py * width + (px+1)] = 1;
-                        cells[py * width + (px+2)] = 1;
-                        cells[(py+1) * width + px] = 0;
-                        cells[(py+1) * width + (px+1)] = 0;
-                        cells[(py+1) * width + (px+2)] = 1;
-                        cells[(py+2) * width + px] = 1;
-                        cells[(py+2) * width + (px+1)] = 0;
-                        cells[(py+2) * width + (px+2)] = 0;
+                        cells.at(px, py) = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px+2, py) = 1;
+                        cells.at(px, py+1) = 0;
+                        cells.at(px+1, (py+1)) = 0;
+                        cells.at(px+2, (py+1)) = 1;
+                        cells.at(px, py+2) = 1;
+                        cells.at(px+1, (py+2)) = 0;
+                        cells.at(px+2, (py+2)) = 0;
                         break;
                         
                     case 3:
                         // Beehive - stable
-                        cells[py * width + (px+1)] = 1;
-                        cells[py * width + (px+2)] = 1;
-                        cells[(py+1) * width + px] = 1;
-                        cells[(py+1) * width + (px+3)] = 1;
-                        cells[(py+2) * width + (px+1)] = 1;
-                        cells[(py+2) * width + (px+2)] = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px+2, py) = 1;
+                        cells.at(px, py+1) = 1;
+                        cells.at(px+3, (py+1)) = 1;
+                        cells.at(px+1, (py+2)) = 1;
+                        cells.at(px+2, (py+2)) = 1;
                         break;
                         
                     case 4:
                         // Toad - period 2 oscillator
-                        cells[py * width + (px+1)] = 1;
-                        cells[py * width + (px+2)] = 1;
-                        cells[py * width + (px+3)] = 1;
-                        cells[(py+1) * width + px] = 1;
-                        cells[(py+1) * width + (px+1)] = 1;
-                        cells[(py+1) * width + (px+2)] = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px+2, py) = 1;
+                        cells.at(px+3, py) = 1;
+                        cells.at(px, py+1) = 1;
+                        cells.at(px+1, (py+1)) = 1;
+                        cells.at(px+2, (py+1)) = 1;
                         break;
                         
                     case 5:
                         // Beacon - period 2 oscillator
-                        cells[py * width + px] = 1;
-                        cells[py * width + (px+1)] = 1;
-                        cells[(py+1) * width + px] = 1;
-                        cells[(py+1) * width + (px+1)] = 1;
-                        cells[(py+2) * width + (px+2)] = 1;
-                        cells[(py+2) * width + (px+3)] = 1;
-                        cells[(py+3) * width + (px+2)] = 1;
-                        cells[(py+3) * width + (px+3)] = 1;
+                        cells.at(px, py) = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px, py+1) = 1;
+                        cells.at(px+1, (py+1)) = 1;
+                        cells.at(px+2, (py+2)) = 1;
+                        cells.at(px+3, (py+2)) = 1;
+                        cells.at(px+2, (py+3)) = 1;
+                        cells.at(px+3, (py+3)) = 1;
                         break;
                         
                     case 6:
                         // Pulsar - period 3 oscillator (simplified version)
                         // Top row
-                        cells[(py) * width + (px+2)] = 1;
-                        cells[(py) * width + (px+3)] = 1;
-                        cells[(py) * width + (px+4)] = 1;
-                        cells[(py) * width + (px+8)] = 1;
-                        cells[(py) * width + (px+9)] = 1;
-                        cells[(py) * width + (px+10)] = 1;
+                        cells.at(px+2, (py)) = 1;
+                        cells.at(px+3, (py)) = 1;
+                        cells.at(px+4, (py)) = 1;
+                        cells.at(px+8, (py)) = 1;
+                        cells.at(px+9, (py)) = 1;
+                        cells.at(px+10, (py)) = 1;
                         
                         // 5 cells down
-                        cells[(py+5) * width + (px+2)] = 1;
-                        cells[(py+5) * width + (px+3)] = 1;
-                        cells[(py+5) * width + (px+4)] = 1;
-                        cells[(py+5) * width + (px+8)] = 1;
-                        cells[(py+5) * width + (px+9)] = 1;
-                        cells[(py+5) * width + (px+10)] = 1;
+                        cells.at(px+2, (py+5)) = 1;
+                        cells.at(px+3, (py+5)) = 1;
+                        cells.at(px+4, (py+5)) = 1;
+                        cells.at(px+8, (py+5)) = 1;
+                        cells.at(px+9, (py+5)) = 1;
+                        cells.at(px+10, (py+5)) = 1;
                         
                         // 7 cells down
-                        cells[(py+7) * width + (px+2)] = 1;
-                        cells[(py+7) * width + (px+3)] = 1;
-                        cells[(py+7) * width + (px+4)] = 1;
-                        cells[(py+7) * width + (px+8)] = 1;
-                        cells[(py+7) * width + (px+9)] = 1;
-                        cells[(py+7) * width + (px+10)] = 1;
+                        cells.at(px+2, (py+7)) = 1;
+                        cells.at(px+3, (py+7)) = 1;
+                        cells.at(px+4, (py+7)) = 1;
+                        cells.at(px+8, (py+7)) = 1;
+                        cells.at(px+9, (py+7)) = 1;
+                        cells.at(px+10, (py+7)) = 1;
                         
                         // 12 cells down
-                        cells[(py+12) * width + (px+2)] = 1;
-                        cells[(py+12) * width + (px+3)] = 1;
-                        cells[(py+12) * width + (px+4)] = 1;
-                        cells[(py+12) * width + (px+8)] = 1;
-                        cells[(py+12) * width + (px+9)] = 1;
-                        cells[(py+12) * width + (px+10)] = 1;
+                        cells.at(px+2, (py+12)) = 1;
+                        cells.at(px+3, (py+12)) = 1;
+                        cells.at(px+4, (py+12)) = 1;
+                        cells.at(px+8, (py+12)) = 1;
+                        cells.at(px+9, (py+12)) = 1;
+                        cells.at(px+10, (py+12)) = 1;
                         
                         // Left column
-                        cells[(py+2) * width + (px)] = 1;
-                        cells[(py+3) * width + (px)] = 1;
-                        cells[(py+4) * width + (px)] = 1;
-                        cells[(py+8) * width + (px)] = 1;
-                        cells[(py+9) * width + (px)] = 1;
-                        cells[(py+10) * width + (px)] = 1;
+                        cells.at(px, (py+2)) = 1;
+                        cells.at(px, (py+3)) = 1;
+                        cells.at(px, (py+4)) = 1;
+                        cells.at(px, (py+8)) = 1;
+                        cells.at(px, (py+9)) = 1;
+                        cells.at(px, (py+10)) = 1;
                         
                         // 5 cells right
-                        cells[(py+2) * width + (px+5)] = 1;
-                        cells[(py+3) * width + (px+5)] = 1;
-                        cells[(py+4) * width + (px+5)] = 1;
-                        cells[(py+8) * width + (px+5)] = 1;
-                        cells[(py+9) * width + (px+5)] = 1;
-                        cells[(py+10) * width + (px+5)] = 1;
+                        cells.at(px+5, (py+2)) = 1;
+                        cells.at(px+5, (py+3)) = 1;
+                        cells.at(px+5, (py+4)) = 1;
+                        cells.at(px+5, (py+8)) = 1;
+                        cells.at(px+5, (py+9)) = 1;
+                        cells.at(px+5, (py+10)) = 1;
                         
                         // 7 cells right
-                        cells[(py+2) * width + (px+7)] = 1;
-                        cells[(py+3) * width + (px+7)] = 1;
-                        cells[(py+4) * width + (px+7)] = 1;
-                        cells[(py+8) * width + (px+7)] = 1;
-                        cells[(py+9) * width + (px+7)] = 1;
-                        cells[(py+10) * width + (px+7)] = 1;
+                        cells.at(px+7, (py+2)) = 1;
+                        cells.at(px+7, (py+3)) = 1;
+                        cells.at(px+7, (py+4)) = 1;
+                        cells.at(px+7, (py+8)) = 1;
+                        cells.at(px+7, (py+9)) = 1;
+                        cells.at(px+7, (py+10)) = 1;
                         
                         // 12 cells right
-                        cells[(py+2) * width + (px+12)] = 1;
-                        cells[(py+3) * width + (px+12)] = 1;
-                        cells[(py+4) * width + (px+12)] = 1;
-                        cells[(py+8) * width + (px+12)] = 1;
-                        cells[(py+9) * width + (px+12)] = 1;
-                        cells[(py+10) * width + (px+12)] = 1;
+                        cells.at(px+12, (py+2)) = 1;
+                        cells.at(px+12, (py+3)) = 1;
+                        cells.at(px+12, (py+4)) = 1;
+                        cells.at(px+12, (py+8)) = 1;
+                        cells.at(px+12, (py+9)) = 1;
+                        cells.at(px+12, (py+10)) = 1;
                         break;
                         
                     case 7:
                         // Pentadecathlon - period 15 oscillator
                         for (int i = 0; i < 8; i++) {
-                            cells[(py+1) * width + (px+i+1)] = 1;
+                            cells.at(px+i+1, (py+1)) = 1;
                         }
-                        cells[(py) * width + (px+3)] = 1;
-                        cells[(py) * width + (px+6)] = 1;
-                        cells[(py+2) * width + (px+3)] = 1;
-                        cells[(py+2) * width + (px+6)] = 1;
+                        cells.at(px+3, (py)) = 1;
+                        cells.at(px+6, (py)) = 1;
+                        cells.at(px+3, (py+2)) = 1;
+                        cells.at(px+6, (py+2)) = 1;
                         break;
                         
                     case 8:
                         // Clock - period 2 oscillator
-                        cells[py * width + (px+1)] = 1;
-                        cells[py * width + (px+2)] = 1;
-                        cells[(py+1) * width + px] = 1;
-                        cells[(py+1) * width + (px+3)] = 1;
-                        cells[(py+2) * width + px] = 1;
-                        cells[(py+2) * width + (px+3)] = 1;
-                        cells[(py+3) * width + (px+1)] = 1;
-                        cells[(py+3) * width + (px+2)] = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px+2, py) = 1;
+                        cells.at(px, py+1) = 1;
+                        cells.at(px+3, (py+1)) = 1;
+                        cells.at(px, py+2) = 1;
+                        cells.at(px+3, (py+2)) = 1;
+                        cells.at(px+1, (py+3)) = 1;
+                        cells.at(px+2, (py+3)) = 1;
                         break;
                         
                     case 9:
                         // Multiple blinkers for more activity
                         // First blinker
-                        cells[py * width + px] = 1;
-                        cells[py * width + (px+1)] = 1;
-                        cells[py * width + (px+2)] = 1;
+                        cells.at(px, py) = 1;
+                        cells.at(px+1, py) = 1;
+                        cells.at(px+2, py) = 1;
                         
                         // Second blinker (vertical)
-                        cells[(py+3) * width + (px+4)] = 1;
-                        cells[(py+4) * width + (px+4)] = 1;
-                        cells[(py+5) * width + (px+4)] = 1;
+                        cells.at(px+4, (py+3)) = 1;
+                        cells.at(px+4, (py+4)) = 1;
+                        cells.at(px+4, (py+5)) = 1;
                         
                         // Third blinker
-                        cells[(py+7) * width + (px)] = 1;
-                        cells[(py+7) * width + (px+1)] = 1;
-                        cells[(py+7) * width + (px+2)] = 1;
+                        cells.at(px, (py+7)) = 1;
+                        cells.at(px+1, (py+7)) = 1;
+                        cells.at(px+2, (py+7)) = 1;
                         break;
                 }
             } else {
@@ -2368,235 +3975,207 @@ private:
     // Add a stable Game of Life pattern at a random location in the top half
     void addStablePattern() {
         // Choose a random pattern type - now with more oscillator patterns
-        uint8_t patternType = random(10);  // Increased from 5 to 10 pattern types
+        uint8_t patternType = fastRandom(10);  // Increased from 5 to 10 pattern types
         
         // Choose a random position in the top half
-        uint16_t px = random(width - 12) + 6;  // Ensure more space around patterns
-        uint16_t py = random(height/2 - 12) + 6;
+        uint16_t px = fastRandom(width - 12) + 6;  // Ensure more space around patterns
+        uint16_t py = fastRandom(height/2 - 12) + 6;
         
         switch (patternType) {
             case 0:
                 // Block (2x2 square) - stable
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[(py+1) * width + px] = 1;
-                cells[(py+1) * width + (px+1)] = 1;
+                cells.at(px, py) = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px, py+1) = 1;
+                cells.at(px+1, (py+1)) = 1;
                 break;
                 
             case 1:
                 // Blinker (3 cells in a row) - period 2 oscillator
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
+                cells.at(px, py) = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px+2, py) = 1;
                 break;
                 
             case 2:
                 // Glider - moves diagonally
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
-                cells[(py+1) * width + px] = 0;
-                cells[(py+1) * width + (px+1)] = 0;
-                cells[(py+1) * width + (px+2)] = 1;
-                cells[(py+2) * width + px] = 1;
-                cells[(py+2) * width + (px+1)] = 0;
-                cells[(py+2) * width + (px+2)] = 0;
+                cells.at(px, py) = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px+2, py) = 1;
+                cells.at(px, py+1) = 0;
+                cells.at(px+1, (py+1)) = 0;
+                cells.at(px+2, (py+1)) = 1;
+                cells.at(px, py+2) = 1;
+                cells.at(px+1, (py+2)) = 0;
+                cells.at(px+2, (py+2)) = 0;
                 break;
                 
             case 3:
                 // Beehive - stable
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
-                cells[(py+1) * width + px] = 1;
-                cells[(py+1) * width + (px+3)] = 1;
-                cells[(py+2) * width + (px+1)] = 1;
-                cells[(py+2) * width + (px+2)] = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px+2, py) = 1;
+                cells.at(px, py+1) = 1;
+                cells.at(px+3, (py+1)) = 1;
+                cells.at(px+1, (py+2)) = 1;
+                cells.at(px+2, (py+2)) = 1;
                 break;
                 
             case 4:
                 // Toad - period 2 oscillator
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
-                cells[py * width + (px+3)] = 1;
-                cells[(py+1) * width + px] = 1;
-                cells[(py+1) * width + (px+1)] = 1;
-                cells[(py+1) * width + (px+2)] = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px+2, py) = 1;
+                cells.at(px+3, py) = 1;
+                cells.at(px, py+1) = 1;
+                cells.at(px+1, (py+1)) = 1;
+                cells.at(px+2, (py+1)) = 1;
                 break;
                 
             case 5:
                 // Beacon - period 2 oscillator
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[(py+1) * width + px] = 1;
-                cells[(py+1) * width + (px+1)] = 1;
-                cells[(py+2) * width + (px+2)] = 1;
-                cells[(py+2) * width + (px+3)] = 1;
-                cells[(py+3) * width + (px+2)] = 1;
-                cells[(py+3) * width + (px+3)] = 1;
+                cells.at(px, py) = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px, py+1) = 1;
+                cells.at(px+1, (py+1)) = 1;
+                cells.at(px+2, (py+2)) = 1;
+                cells.at(px+3, (py+2)) = 1;
+                cells.at(px+2, (py+3)) = 1;
+                cells.at(px+3, (py+3)) = 1;
                 break;
                 
             case 6:
                 // Pulsar - period 3 oscillator (simplified version)
                 // Top row
-                cells[(py) * width + (px+2)] = 1;
-                cells[(py) * width + (px+3)] = 1;
-                cells[(py) * width + (px+4)] = 1;
-                cells[(py) * width + (px+8)] = 1;
-                cells[(py) * width + (px+9)] = 1;
-                cells[(py) * width + (px+10)] = 1;
+                cells.at(px+2, (py)) = 1;
+                cells.at(px+3, (py)) = 1;
+                cells.at(px+4, (py)) = 1;
+                cells.at(px+8, (py)) = 1;
+                cells.at(px+9, (py)) = 1;
+                cells.at(px+10, (py)) = 1;
                 
                 // 5 cells down
-                cells[(py+5) * width + (px+2)] = 1;
-                cells[(py+5) * width + (px+3)] = 1;
-                cells[(py+5) * width + (px+4)] = 1;
-                cells[(py+5) * width + (px+8)] = 1;
-                cells[(py+5) * width + (px+9)] = 1;
-                cells[(py+5) * width + (px+10)] = 1;
+                cells.at(px+2, (py+5)) = 1;
+                cells.at(px+3, (py+5)) = 1;
+                cells.at(px+4, (py+5)) = 1;
+                cells.at(px+8, (py+5)) = 1;
+                cells.at(px+9, (py+5)) = 1;
+                cells.at(px+10, (py+5)) = 1;
                 
                 // 7 cells down
-                cells[(py+7) * width + (px+2)] = 1;
-                cells[(py+7) * width + (px+3)] = 1;
-                cells[(py+7) * width + (px+4)] = 1;
-                cells[(py+7) * width + (px+8)] = 1;
-                cells[(py+7) * width + (px+9)] = 1;
-                cells[(py+7) * width + (px+10)] = 1;
+                cells.at(px+2, (py+7)) = 1;
+                cells.at(px+3, (py+7)) = 1;
+                cells.at(px+4, (py+7)) = 1;
+                cells.at(px+8, (py+7)) = 1;
+                cells.at(px+9, (py+7)) = 1;
+                cells.at(px+10, (py+7)) = 1;
                 
                 // 12 cells down
-                cells[(py+12) * width + (px+2)] = 1;
-                cells[(py+12) * width + (px+3)] = 1;
-                cells[(py+12) * width + (px+4)] = 1;
-                cells[(py+12) * width + (px+8)] = 1;
-                cells[(py+12) * width + (px+9)] = 1;
-                cells[(py+12) * width + (px+10)] = 1;
+                cells.at(px+2, (py+12)) = 1;
+                cells.at(px+3, (py+12)) = 1;
+                cells.at(px+4, (py+12)) = 1;
+                cells.at(px+8, (py+12)) = 1;
+                cells.at(px+9, (py+12)) = 1;
+                cells.at(px+10, (py+12)) = 1;
                 
                 // Left column
-                cells[(py+2) * width + (px)] = 1;
-                cells[(py+3) * width + (px)] = 1;
-                cells[(py+4) * width + (px)] = 1;
-                cells[(py+8) * width + (px)] = 1;
-                cells[(py+9) * width + (px)] = 1;
-                cells[(py+10) * width + (px)] = 1;
+                cells.at(px, (py+2)) = 1;
+                cells.at(px, (py+3)) = 1;
+                cells.at(px, (py+4)) = 1;
+                cells.at(px, (py+8)) = 1;
+                cells.at(px, (py+9)) = 1;
+                cells.at(px, (py+10)) = 1;
                 
                 // 5 cells right
-                cells[(py+2) * width + (px+5)] = 1;
-                cells[(py+3) * width + (px+5)] = 1;
-                cells[(py+4) * width + (px+5)] = 1;
-                cells[(py+8) * width + (px+5)] = 1;
-                cells[(py+9) * width + (px+5)] = 1;
-                cells[(py+10) * width + (px+5)] = 1;
+                cells.at(px+5, (py+2)) = 1;
+                cells.at(px+5, (py+3)) = 1;
+                cells.at(px+5, (py+4)) = 1;
+                cells.at(px+5, (py+8)) = 1;
+                cells.at(px+5, (py+9)) = 1;
+                cells.at(px+5, (py+10)) = 1;
                 
                 // 7 cells right
-                cells[(py+2) * width + (px+7)] = 1;
-                cells[(py+3) * width + (px+7)] = 1;
-                cells[(py+4) * width + (px+7)] = 1;
-                cells[(py+8) * width + (px+7)] = 1;
-                cells[(py+9) * width + (px+7)] = 1;
-                cells[(py+10) * width + (px+7)] = 1;
+                cells.at(px+7, (py+2)) = 1;
+                cells.at(px+7, (py+3)) = 1;
+                cells.at(px+7, (py+4)) = 1;
+                cells.at(px+7, (py+8)) = 1;
+                cells.at(px+7, (py+9)) = 1;
+                cells.at(px+7, (py+10)) = 1;
                 
                 // 12 cells right
-                cells[(py+2) * width + (px+12)] = 1;
-                cells[(py+3) * width + (px+12)] = 1;
-                cells[(py+4) * width + (px+12)] = 1;
-                cells[(py+8) * width + (px+12)] = 1;
-                cells[(py+9) * width + (px+12)] = 1;
-                cells[(py+10) * width + (px+12)] = 1;
+                cells.at(px+12, (py+2)) = 1;
+                cells.at(px+12, (py+3)) = 1;
+                cells.at(px+12, (py+4)) = 1;
+                cells.at(px+12, (py+8)) = 1;
+                cells.at(px+12, (py+9)) = 1;
+                cells.at(px+12, (py+10)) = 1;
                 break;
                 
             case 7:
                 // Pentadecathlon - period 15 oscillator
                 for (int i = 0; i < 8; i++) {
-                    cells[(py+1) * width + (px+i+1)] = 1;
+                    cells.at(px+i+1, (py+1)) = 1;
                 }
-                cells[(py) * width + (px+3)] = 1;
-                cells[(py) * width + (px+6)] = 1;
-                cells[(py+2) * width + (px+3)] = 1;
-                cells[(py+2) * width + (px+6)] = 1;
+                cells.at(px+3, (py)) = 1;
+                cells.at(px+6, (py)) = 1;
+                cells.at(px+3, (py+2)) = 1;
+                cells.at(px+6, (py+2)) = 1;
                 break;
                 
             case 8:
                 // Clock - period 2 oscillator
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
-                cells[(py+1) * width + px] = 1;
-                cells[(py+1) * width + (px+3)] = 1;
-                cells[(py+2) * width + px] = 1;
-                cells[(py+2) * width + (px+3)] = 1;
-                cells[(py+3) * width + (px+1)] = 1;
-                cells[(py+3) * width + (px+2)] = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px+2, py) = 1;
+                cells.at(px, py+1) = 1;
+                cells.at(px+3, (py+1)) = 1;
+                cells.at(px, py+2) = 1;
+                cells.at(px+3, (py+2)) = 1;
+                cells.at(px+1, (py+3)) = 1;
+                cells.at(px+2, (py+3)) = 1;
                 break;
                 
             case 9:
                 // Multiple blinkers for more activity
                 // First blinker
-                cells[py * width + px] = 1;
-                cells[py * width + (px+1)] = 1;
-                cells[py * width + (px+2)] = 1;
+                cells.at(px, py) = 1;
+                cells.at(px+1, py) = 1;
+                cells.at(px+2, py) = 1;
                 
                 // Second blinker (vertical)
-                cells[(py+3) * width + (px+4)] = 1;
-                cells[(py+4) * width + (px+4)] = 1;
-                cells[(py+5) * width + (px+4)] = 1;
+                cells.at(px+4, (py+3)) = 1;
+                cells.at(px+4, (py+4)) = 1;
+                cells.at(px+4, (py+5)) = 1;
                 
                 // Third blinker
-                cells[(py+7) * width + (px)] = 1;
-                cells[(py+7) * width + (px+1)] = 1;
-                cells[(py+7) * width + (px+2)] = 1;
+                cells.at(px, (py+7)) = 1;
+                cells.at(px+1, (py+7)) = 1;
+                cells.at(px+2, (py+7)) = 1;
                 break;
         }
     }
     
     // Update the Game of Life in the top half
     void updateGameOfLife() {
-        // First, age all cells in the top half (for trails)
-        for (uint16_t y = 0; y < height / 2; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                if (cells[y * width + x] > 0) {
-                    // Age the cell (increase the value)
-                    nextCells[y * width + x] = cells[y * width + x] + 1;
-                    
-                    // If it's too old, remove it
-                    if (nextCells[y * width + x] > 12) {  // Longer trails for better visibility
-                        nextCells[y * width + x] = 0;
-                    }
-                }
-            }
-        }
-        
-        // Then apply Game of Life rules to create new live cells
-        for (uint16_t y = 0; y < height / 2; y++) {
+        for (uint16_t y = lifeBand.top; y < lifeBand.bottom; y++) {
+            // The top half wraps onto itself vertically; columns wrap via the halo
+            const uint8_t* up = cells.row(y == lifeBand.top ? lifeBand.bottom - 1 : y - 1);
+            const uint8_t* mid = cells.row(y);
+            const uint8_t* down = cells.row(y + 1 == lifeBand.bottom ? lifeBand.top : y + 1);
+            uint8_t* next = nextCells.row(y);
+            
             for (uint16_t x = 0; x < width; x++) {
-                // Count live neighbors (cells with state 1)
-                uint8_t neighbors = 0;
-                for (int8_t dy = -1; dy <= 1; dy++) {
-                    for (int8_t dx = -1; dx <= 1; dx++) {
-                        // Skip the cell itself
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        // Calculate neighbor coordinates with wrapping
-                        uint16_t nx = (x + dx + width) % width;
-                        uint16_t ny = (y + dy + height / 2) % (height / 2);
-                        
-                        // Count only live cells (state 1)
-                        if (cells[ny * width + nx] == 1) {
-                            neighbors++;
-                        }
-                    }
-                }
+                uint8_t state = mid[x];
                 
-                // Apply Conway's Game of Life rules
-                if (cells[y * width + x] == 1) {
-                    // Cell is alive
-                    if (neighbors < 2 || neighbors > 3) {
-                        // Cell dies - but leave the trail
-                        nextCells[y * width + x] = 2;  // Start trail
-                    }
-                    // If the cell survives, we already set it to 1 above
-                } else if (cells[y * width + x] == 0) {
-                    // Cell is dead
-                    if (neighbors == 3) {
-                        // Cell becomes alive
-                        nextCells[y * width + x] = 1;
-                    }
+                if (state > 0) {
+                    // Live cells (1) and trails (2 and up) age by one, so a
+                    // live cell leaves a trail whatever its neighbors, and
+                    // trails that get too old disappear
+                    next[x] = (state < 12) ? state + 1 : 0;  // Longer trails for better visibility
+                } else {
+                    // Dead cells come alive with exactly 3 live neighbors
+                    // (state 1; trails don't count)
+                    uint8_t neighbors = (up[x - 1] == 1) + (up[x] == 1) + (up[x + 1] == 1) +
+                                        (mid[x - 1] == 1) + (mid[x + 1] == 1) +
+                                        (down[x - 1] == 1) + (down[x] == 1) + (down[x + 1] == 1);
+                    next[x] = (neighbors == 3) ? 1 : 0;
                 }
             }
         }
@@ -2612,10 +4191,11 @@ private:
             lastBubbleTime = frameCount;
             
             // Find active cells at the boundary
+            const uint8_t* boundary = cells.row(lavaBand.top);
             for (uint16_t x = 0; x < width; x++) {
-                if (cells[height / 2 * width + x] == 1) {
+                if (boundary[x] == 1) {
                     // 40% chance to create a bubble from each active cell (increased from 30%)
-                    if (random(100) < 40) {
+                    if (fastRandom(100) < 40) {
                         // Create a bubble that rises up
                         createBubbleColumn(x);
                     }
@@ -2623,8 +4203,8 @@ private:
             }
             
             // Occasionally create random bubbles
-            if (random(100) < 25) { // 25% chance each bubble cycle (increased from 20%)
-                createBubbleColumn(random(width));
+            if (fastRandom(100) < 25) { // 25% chance each bubble cycle (increased from 20%)
+                createBubbleColumn(fastRandom(width));
             }
         }
     }
@@ -2632,38 +4212,38 @@ private:
     // Create a column of bubbles rising from a specific x position
     void createBubbleColumn(uint16_t x) {
         // Choose a pattern type for the bubble
-        uint8_t patternType = random(3);
+        uint8_t patternType = fastRandom(3);
         
         // Calculate y position - start near the middle and go up
-        uint16_t y = height / 2 - 1 - random(3);
+        uint16_t y = height / 2 - 1 - fastRandom(3);
         
         // Make sure we're still in the top half
         if (y < height / 2) {
             switch (patternType) {
                 case 0:
                     // Single bubble
-                    nextCells[y * width + x] = 1;
+                    nextCells.at(x, y) = 1;
                     // Add some neighboring cells for stability
-                    if (random(100) < 70) {
-                        int8_t dx = random(-1, 2); // -1, 0, or 1
+                    if (fastRandom(100) < 70) {
+                        int8_t dx = fastRandom(-1, 2); // -1, 0, or 1
                         uint16_t nx = (x + dx + width) % width;
-                        nextCells[y * width + nx] = 1;
+                        nextCells.at(nx, y) = 1;
                     }
                     break;
                     
                 case 1:
                     // Small cluster (more stable)
-                    nextCells[y * width + x] = 1;
-                    nextCells[y * width + ((x + 1) % width)] = 1;
-                    nextCells[((y + 1) % (height/2)) * width + x] = 1;
-                    nextCells[((y + 1) % (height/2)) * width + ((x + 1) % width)] = 1;
+                    nextCells.at(x, y) = 1;
+                    nextCells.at(((x + 1) % width), y) = 1;
+                    nextCells.at(x, ((y + 1) % (height/2))) = 1;
+                    nextCells.at(((x + 1) % width), ((y + 1) % (height/2))) = 1;
                     break;
                     
                 case 2:
                     // Blinker (oscillator)
-                    nextCells[y * width + x] = 1;
-                    nextCells[y * width + ((x + 1) % width)] = 1;
-                    nextCells[y * width + ((x + 2) % width)] = 1;
+                    nextCells.at(x, y) = 1;
+                    nextCells.at(((x + 1) % width), y) = 1;
+                    nextCells.at(((x + 2) % width), y) = 1;
                     break;
             }
         }
@@ -2680,187 +4260,132 @@ private:
  */
 class OrderAndChaos : public CellularAutomaton {
 public:
-    OrderAndChaos(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height) 
-        : CellularAutomaton(matrix, width, height) {
-        // Initialize the cells
-        cells = new uint8_t[width * height];
-        nextCells = new uint8_t[width * height];
+    OrderAndChaos(Display* matrix, uint16_t width, uint16_t height) 
+        : CellularAutomaton(matrix, width, height),
+          cells(width, height), nextCells(width, height), cellOrigins(width, height) {
+        // Three bands: the top ECA grows down from the top edge, the bottom
+        // ECA grows up from the bottom edge, and the Game of Life runs in
+        // between, seeded from the rows where the ECAs meet it
+        topBand.rows.top = 0;
+        topBand.rows.bottom = height / 3;
+        topBand.grow = 1;
+        topBand.runs = false;
+        
+        lifeBand.top = height / 3;
+        lifeBand.bottom = 2 * height / 3;
+        
+        bottomBand.rows.top = 2 * height / 3;
+        bottomBand.rows.bottom = height;
+        bottomBand.grow = -1;
+        bottomBand.runs = true;
         
         // Set up the ECA rules
-        topRule = 90;    // Rule 90 creates symmetric patterns (Sierpinski triangle)
-        bottomRule = 30; // Rule 30 creates chaotic patterns
+        topBand.rule = 90;    // Rule 90 creates symmetric patterns (Sierpinski triangle)
+        bottomBand.rule = 30; // Rule 30 creates chaotic patterns
         
         // Set up colors - more vibrant colors for better visibility
-        topColor = matrix->color565(0, 150, 255);    // Brighter blue for order
-        topBgColor = matrix->color565(0, 0, 100);    // Dark blue background for order
-        bottomColor = matrix->color565(255, 100, 0); // Orange-red for chaos
-        bottomBgColor = matrix->color565(100, 0, 0); // Dark red background for chaos
-        middleColor = matrix->color565(255, 0, 255); // Magenta for collision
-        neutralColor = matrix->color565(200, 200, 200); // Light gray for neutral cells
+        topColor = rgb565(0, 150, 255);    // Brighter blue for order
+        topBgColor = rgb565(0, 0, 100);    // Dark blue background for order
+        bottomColor = rgb565(255, 100, 0); // Orange-red for chaos
+        bottomBgColor = rgb565(100, 0, 0); // Dark red background for chaos
+        middleColor = rgb565(255, 0, 255); // Magenta for collision
+        neutralColor = rgb565(200, 200, 200); // Light gray for neutral cells
         
-        // Initialize the current rows for ECAs
-        topCurrentRow = 0;
-        bottomCurrentRow = height - 1;
+        // Top and bottom thirds: any active state takes the band color
+        topPalette[0] = topBgColor;
+        fillPalette(topPalette, 1, 255, topColor);
+        bottomPalette[0] = bottomBgColor;
+        fillPalette(bottomPalette, 1, 255, bottomColor);
         
-        // Initialize state variables
-        topReachedBoundary = false;
-        bottomReachedBoundary = false;
+        // Middle third: dead, then live cells by origin (see render())
+        middlePalette[0] = 0;             // Black for dead cells
+        middlePalette[1] = neutralColor;  // Neutral
+        middlePalette[2] = topColor;      // From top (order)
+        middlePalette[3] = bottomColor;   // From bottom (chaos)
+        middlePalette[4] = middleColor;   // Collision point
+        
+        middleRow = automatonArena().allocate<uint8_t>(width);
+        
+        // Packed current and next rows for both ECAs
+        ecaWords = (width + 31) / 32;
+        ecaBits = automatonArena().allocate<uint32_t>(2 * ecaWords);
+        
+        // Initialize the ECA fronts
+        resetBand(topBand);
+        resetBand(bottomBand);
         lastCollisionCheck = 0;
     }
     
-    ~OrderAndChaos() {
-        delete[] cells;
-        delete[] nextCells;
-    }
-    
     void init() override {
-        // Clear all cells
-        memset(cells, 0, width * height * sizeof(uint8_t));
-        
-        // Initialize the top row with a random but continuous pattern
-        // Create a smooth, continuous pattern with some randomness
-        uint8_t prevState = random(2); // Start with either 0 or 1
-        for (uint16_t x = 0; x < width; x++) {
-            // 70% chance to keep the same state, 30% chance to change
-            if (random(100) < 30) {
-                prevState = 1 - prevState; // Flip the state
-            }
-            cells[x] = prevState;
-            
-            // Mark as coming from top
-            if (cells[x] > 0) {
-                cellOrigins[x] = 1;
-            }
-        }
-        
-        // Initialize the bottom row with a different random but continuous pattern
-        // Use a different approach for variety
-        prevState = random(2);
-        uint8_t runLength = random(3, 8); // Run length of 3-7 cells
-        uint8_t currentRun = 0;
+        // Clear all cells (both generations: update() writes every cell of
+        // the next one, but a restart must not see the last run)
+        cells.clear();
+        nextCells.clear();
         
-        for (uint16_t x = 0; x < width; x++) {
-            if (currentRun >= runLength) {
-                prevState = 1 - prevState; // Flip the state
-                runLength = random(3, 8); // New run length
-                currentRun = 0;
-            }
-            
-            cells[(height - 1) * width + x] = prevState;
-            
-            // Mark as coming from bottom
-            if (cells[(height - 1) * width + x] > 0) {
-                cellOrigins[(height - 1) * width + x] = 2;
-            }
-            
-            currentRun++;
-        }
+        // Initialize the top row with a random but continuous pattern, and
+        // the bottom row with a different one for variety
+        randomEdgeRow(cells.row(topBand.edge()), topBand.runs);
+        randomEdgeRow(cells.row(bottomBand.edge()), bottomBand.runs);
         
         // Add some random cells in the middle section to start the action
-        for (uint16_t y = height / 3; y < 2 * height / 3; y++) {
-            for (uint16_t x = 0; x < width; x++) {
-                // Sparse random cells (about 5%)
-                cells[y * width + x] = (random(100) < 5) ? 1 : 0;
-            }
+        for (uint16_t y = lifeBand.top; y < lifeBand.bottom; y++) {
+            // Sparse random cells (about 5%)
+            fastRandomRowBytes(cells.row(y), width, 5);
         }
         
-        // Reset the current rows
-        topCurrentRow = 0;
-        bottomCurrentRow = height - 1;
-        
-        // Reset state variables
-        topReachedBoundary = false;
-        bottomReachedBoundary = false;
+        // Reset the ECA fronts
+        resetBand(topBand);
+        resetBand(bottomBand);
         lastCollisionCheck = frameCount;
         
         // Store cell origins for collision detection
-        memset(cellOrigins, 0, width * height * sizeof(uint8_t));
-        
-        // Re-mark the origins for the top and bottom rows
-        for (uint16_t x = 0; x < width; x++) {
-            if (cells[x] > 0) {
-                cellOrigins[x] = 1; // From top
-            }
-            if (cells[(height - 1) * width + x] > 0) {
-                cellOrigins[(height - 1) * width + x] = 2; // From bottom
-            }
-        }
+        cellOrigins.clear();
     }
     
     void update() override {
-        // Clear the next generation buffer
-        memset(nextCells, 0, width * height * sizeof(uint8_t));
+        // Wrap the Life band's columns into the halo so neighbors need no
+        // modulo; the ECA bands wrap inside ecaNextRow()
+        cells.refreshColumnHalo(lifeBand.top, lifeBand.bottom);
+        cellOrigins.refreshColumnHalo(lifeBand.top, lifeBand.bottom);
         
         // Update the top ECA (order)
-        updateTopECA();
+        updateBand(topBand);
         
         // Update the bottom ECA (chaos)
-        updateBottomECA();
-        
-        // Update the Game of Life in the middle
-        updateGameOfLife();
+        updateBand(bottomBand);
         
-        // Check for collisions periodically
-        if (frameCount - lastCollisionCheck > 5) {
-            checkCollisions();
+        // Update the Game of Life in the middle, checking for collisions
+        // periodically
+        bool checkCollisions = frameCount - lastCollisionCheck > 5;
+        if (checkCollisions) {
             lastCollisionCheck = frameCount;
         }
+        updateGameOfLife(checkCollisions);
+        
+        // Seed the Game of Life from the ECAs at the boundaries
+        seedFromBand(topBand, 1);     // From top
+        seedFromBand(bottomBand, 2);  // From bottom
         
         // Swap cell buffers
-        uint8_t* temp = cells;
-        cells = nextCells;
-        nextCells = temp;
+        cells.swap(nextCells);
     }
     
     void render() override {
-        // Draw all cells
-        for (uint16_t y = 0; y < height; y++) {
+        // Top third - Order (blue)
+        renderRegion(cells, topPalette, topBand.rows.top, topBand.rows.bottom);
+        
+        // Middle third - Game of Life, colored by where each live cell came from
+        for (uint16_t y = lifeBand.top; y < lifeBand.bottom; y++) {
+            const uint8_t* state = cells.row(y);
+            const uint8_t* origin = cellOrigins.row(y);
             for (uint16_t x = 0; x < width; x++) {
-                uint16_t color;
-                uint8_t state = cells[y * width + x];
-                uint8_t origin = cellOrigins[y * width + x];
-                
-                if (y < height / 3) {
-                    // Top third - Order (blue)
-                    if (state > 0) {
-                        color = topColor;  // Bright blue for active cells
-                    } else {
-                        color = topBgColor;  // Dark blue background
-                    }
-                } else if (y >= 2 * height / 3) {
-                    // Bottom third - Chaos (orange-red)
-                    if (state > 0) {
-                        color = bottomColor;  // Orange-red for active cells
-                    } else {
-                        color = bottomBgColor;  // Dark red background
-                    }
-                } else {
-                    // Middle third - Game of Life
-                    if (state == 0) {
-                        color = 0;  // Black for dead cells
-                    } else {
-                        // Use color based on cell origin
-                        if (origin == 1) {
-                            // From top (order)
-                            color = topColor;  // Blue
-                        } else if (origin == 2) {
-                            // From bottom (chaos)
-                            color = bottomColor;  // Orange-red
-                        } else if (origin == 3) {
-                            // Collision point
-                            color = middleColor;  // Magenta
-                        } else {
-                            // Default middle color
-                            color = neutralColor;  // Light gray
-                        }
-                    }
-                }
-                
-                drawMappedPixel(x, y, color);
+                middleRow[x] = (state[x] != 0) * (origin[x] + 1);
             }
+            matrix->blitIndexedRow(y, middleRow, middlePalette);
         }
         
-        matrix->show();
+        // Bottom third - Chaos (orange-red)
+        renderRegion(cells, bottomPalette, bottomBand.rows.top, bottomBand.rows.bottom);
     }
     
     const char* getName() const override {
@@ -2868,12 +4393,30 @@ public:
     }
     
 private:
-    uint8_t* cells;       // Current generation
-    uint8_t* nextCells;   // Next generation
-    uint8_t topRule;      // Rule for the top ECA (order)
-    uint8_t bottomRule;   // Rule for the bottom ECA (chaos)
-    uint16_t topCurrentRow;    // Current row for top ECA
-    uint16_t bottomCurrentRow; // Current row for bottom ECA
+    // One of the two ECA bands. It starts as a single random row at its
+    // screen edge and grows one row per frame toward the Life band; once it
+    // touches the Life band it scrolls away from it instead, with a fresh
+    // random row coming in at the edge.
+    struct EcaBand {
+        RowBand rows;
+        int8_t grow;       // Direction of growth: +1 down (top band), -1 up (bottom band)
+        uint8_t rule;      // Rule the band grows by
+        bool runs;         // Random rows are runs of 3-7 cells rather than coin flips
+        uint16_t front;    // Newest grown row
+        bool full;         // Reached the Life band
+        
+        // Screen edge row the band grows from
+        uint16_t edge() const { return grow > 0 ? rows.top : rows.bottom - 1; }
+        
+        // Row next to the Life band
+        uint16_t inner() const { return grow > 0 ? rows.bottom - 1 : rows.top; }
+    };
+    
+    HaloGrid cells;       // Current generation
+    HaloGrid nextCells;   // Next generation
+    EcaBand topBand;      // Top third: order
+    EcaBand bottomBand;   // Bottom third: chaos
+    RowBand lifeBand;     // Middle third: Game of Life
     
     uint16_t topColor;    // Color for top ECA (order) active cells
     uint16_t topBgColor;  // Background color for top ECA
@@ -2881,225 +4424,143 @@ private:
     uint16_t bottomBgColor; // Background color for bottom ECA
     uint16_t middleColor; // Color for collision points
     uint16_t neutralColor; // Color for neutral cells in middle
+    uint16_t topPalette[256];    // Cell state -> color in the top third
+    uint16_t bottomPalette[256]; // Cell state -> color in the bottom third
+    uint16_t middlePalette[5];   // Middle third: dead, or live by origin + 1
+    uint8_t* middleRow;          // Palette indices for one middle-third row
+    uint32_t* ecaBits;           // Packed current and next ECA rows for ecaNextRow()
+    uint16_t ecaWords;           // 32-cell words in each packed row
     
-    bool topReachedBoundary;    // Flag to track if top ECA reached boundary
-    bool bottomReachedBoundary; // Flag to track if bottom ECA reached boundary
     uint32_t lastCollisionCheck; // Time of last collision check
-    
-    // Cell origins for tracking where cells came from:
-    // 0 = neutral/original
-    // 1 = from top (order)
-    // 2 = from bottom (chaos)
-    // 3 = collision point
-    uint8_t cellOrigins[128*128]; // Assuming max size, will only use width*height
-    
-    // Update the top ECA (order)
-    void updateTopECA() {
-        // Move the ECA down one row if not at the boundary
-        if (topCurrentRow < height / 3 - 1) {
-            topCurrentRow++;
-            
-            // Calculate the next ECA row
-            for (uint16_t x = 0; x < width; x++) {
-                // Get the left, center, and right cells from the row above
-                uint8_t left = cells[(topCurrentRow - 1) * width + ((x + width - 1) % width)];
-                uint8_t center = cells[(topCurrentRow - 1) * width + x];
-                uint8_t right = cells[(topCurrentRow - 1) * width + ((x + 1) % width)];
-                
-                // Compute the pattern index (0-7)
-                uint8_t pattern = (left << 2) | (center << 1) | right;
-                
-                // Apply the rule
-                nextCells[topCurrentRow * width + x] = (topRule >> pattern) & 1;
-                
-                // Mark this cell as coming from the top
-                if (nextCells[topCurrentRow * width + x] > 0) {
-                    cellOrigins[topCurrentRow * width + x] = 1;
-                }
-            }
-            
-            // Copy the previous rows of the top ECA
-            for (uint16_t y = 0; y < topCurrentRow; y++) {
-                for (uint16_t x = 0; x < width; x++) {
-                    nextCells[y * width + x] = cells[y * width + x];
-                    
-                    // Preserve cell origins
-                    if (nextCells[y * width + x] > 0) {
-                        cellOrigins[y * width + x] = 1;
-                    }
-                }
-            }
-            
-            // Check if we've reached the boundary
-            if (topCurrentRow == height / 3 - 1) {
-                topReachedBoundary = true;
-            }
-        } else {
-            // At the boundary - just copy the top ECA part
-            for (uint16_t y = 0; y < height / 3; y++) {
-                for (uint16_t x = 0; x < width; x++) {
-                    nextCells[y * width + x] = cells[y * width + x];
-                    
-                    // Preserve cell origins
-                    if (nextCells[y * width + x] > 0) {
-                        cellOrigins[y * width + x] = 1;
-                    }
-                }
-            }
-            
-            // Keep the top ECA moving by shifting all rows down
-            for (uint16_t y = height / 3 - 1; y > 0; y--) {
-                for (uint16_t x = 0; x < width; x++) {
-                    nextCells[y * width + x] = cells[(y - 1) * width + x];
-                    
-                    // Preserve cell origins
-                    if (nextCells[y * width + x] > 0) {
-                        cellOrigins[y * width + x] = 1;
-                    }
-                }
-            }
-            
-            // Generate a new top row with a random but continuous pattern
-            uint8_t prevState = random(2); // Start with either 0 or 1
+    
+    // Cell origins for tracking where cells came from, kept for the Life
+    // band only (the ECA bands are colored by band):
+    // 0 = neutral/original
+    // 1 = from top (order)
+    // 2 = from bottom (chaos)
+    // 3 = collision point
+    HaloGrid cellOrigins;
+    
+    // nextCells is left out: update() writes all of it before reading it
+    void snapshotState(Snapshot& s) override {
+        cells.snapshot(s);
+        cellOrigins.snapshot(s);
+        s.value(topBand);
+        s.value(bottomBand);
+        s.value(lastCollisionCheck);
+    }
+    
+    // Put a band back to its single edge row
+    void resetBand(EcaBand& band) {
+        band.front = band.edge();
+        band.full = (band.front == band.inner());
+    }
+    
+    // Fill a row with a random but continuous pattern
+    void randomEdgeRow(uint8_t* row, bool runs) {
+        uint8_t prevState = fastRandom(2); // Start with either 0 or 1
+        
+        if (!runs) {
             for (uint16_t x = 0; x < width; x++) {
                 // 70% chance to keep the same state, 30% chance to change
-                if (random(100) < 30) {
+                if (fastRandom(100) < 30) {
                     prevState = 1 - prevState; // Flip the state
                 }
-                nextCells[x] = prevState;
-                
-                // Mark as coming from top
-                if (nextCells[x] > 0) {
-                    cellOrigins[x] = 1;
-                }
+                row[x] = prevState;
             }
-            
-            // Maintain the boundary state
-            topReachedBoundary = true;
+            return;
+        }
+        
+        // Run-length pattern
+        uint8_t runLength = fastRandom(3, 8); // Run length of 3-7 cells
+        uint8_t currentRun = 0;
+        
+        for (uint16_t x = 0; x < width; x++) {
+            if (currentRun >= runLength) {
+                prevState = 1 - prevState; // Flip the state
+                runLength = fastRandom(3, 8); // New run length
+                currentRun = 0;
+            }
+            row[x] = prevState;
+            currentRun++;
         }
     }
     
-    // Update the bottom ECA (chaos)
-    void updateBottomECA() {
-        // Move the ECA up one row if not at the boundary
-        if (bottomCurrentRow > 2 * height / 3) {
-            bottomCurrentRow--;
+    // Write the next generation of one ECA band, and only of that band
+    void updateBand(EcaBand& band) {
+        if (!band.full) {
+            // Grow one row toward the Life band from the newest row, 32
+            // cells at a time; every other row (grown or still clear) stays
+            uint16_t from = band.front;
+            band.front += band.grow;
             
-            // Calculate the next ECA row
-            for (uint16_t x = 0; x < width; x++) {
-                // Get the left, center, and right cells from the row below
-                uint8_t left = cells[(bottomCurrentRow + 1) * width + ((x + width - 1) % width)];
-                uint8_t center = cells[(bottomCurrentRow + 1) * width + x];
-                uint8_t right = cells[(bottomCurrentRow + 1) * width + ((x + 1) % width)];
-                
-                // Compute the pattern index (0-7)
-                uint8_t pattern = (left << 2) | (center << 1) | right;
-                
-                // Apply the rule
-                nextCells[bottomCurrentRow * width + x] = (bottomRule >> pattern) & 1;
-                
-                // Mark this cell as coming from the bottom
-                if (nextCells[bottomCurrentRow * width + x] > 0) {
-                    cellOrigins[bottomCurrentRow * width + x] = 2;
-                }
-            }
+            packRow(cells.row(from), ecaBits, width);
+            ecaNextRow(ecaBits, ecaBits + ecaWords, width, band.rule);
+            unpackRow(ecaBits + ecaWords, nextCells.row(band.front), width);
             
-            // Copy the previous rows of the bottom ECA
-            for (uint16_t y = bottomCurrentRow + 1; y < height; y++) {
-                for (uint16_t x = 0; x < width; x++) {
-                    nextCells[y * width + x] = cells[y * width + x];
-                    
-                    // Preserve cell origins
-                    if (nextCells[y * width + x] > 0) {
-                        cellOrigins[y * width + x] = 2;
-                    }
+            for (uint16_t y = band.rows.top; y < band.rows.bottom; y++) {
+                if (y != band.front) {
+                    memcpy(nextCells.row(y), cells.row(y), width);
                 }
             }
             
             // Check if we've reached the boundary
-            if (bottomCurrentRow == 2 * height / 3) {
-                bottomReachedBoundary = true;
-            }
+            band.full = (band.front == band.inner());
         } else {
-            // At the boundary - just copy the bottom ECA part
-            for (uint16_t y = 2 * height / 3; y < height; y++) {
-                for (uint16_t x = 0; x < width; x++) {
-                    nextCells[y * width + x] = cells[y * width + x];
-                    
-                    // Preserve cell origins
-                    if (nextCells[y * width + x] > 0) {
-                        cellOrigins[y * width + x] = 2;
-                    }
-                }
-            }
-            
-            // Keep the bottom ECA moving by shifting all rows up
-            for (uint16_t y = 2 * height / 3; y < height - 1; y++) {
-                for (uint16_t x = 0; x < width; x++) {
-                    nextCells[y * width + x] = cells[(y + 1) * width + x];
-                    
-                    // Preserve cell origins
-                    if (nextCells[y * width + x] > 0) {
-                        cellOrigins[y * width + x] = 2;
-                    }
-                }
-            }
-            
-            // Generate a new bottom row with a random but continuous pattern
-            // Use a run-length encoding approach for variety
-            uint8_t prevState = random(2);
-            uint8_t runLength = random(3, 8); // Run length of 3-7 cells
-            uint8_t currentRun = 0;
-            
-            for (uint16_t x = 0; x < width; x++) {
-                if (currentRun >= runLength) {
-                    prevState = 1 - prevState; // Flip the state
-                    runLength = random(3, 8); // New run length
-                    currentRun = 0;
-                }
-                
-                nextCells[(height - 1) * width + x] = prevState;
-                
-                // Mark as coming from bottom
-                if (nextCells[(height - 1) * width + x] > 0) {
-                    cellOrigins[(height - 1) * width + x] = 2;
+            // Keep the ECA moving by shifting all rows away from the edge,
+            // then generate a new edge row
+            for (uint16_t y = band.rows.top; y < band.rows.bottom; y++) {
+                if (y != band.edge()) {
+                    memcpy(nextCells.row(y), cells.row(y - band.grow), width);
                 }
-                
-                currentRun++;
             }
-            
-            // Maintain the boundary state
-            bottomReachedBoundary = true;
+            randomEdgeRow(nextCells.row(band.edge()), band.runs);
         }
     }
     
-    // Update the Game of Life in the middle
-    void updateGameOfLife() {
+    // Update the Game of Life in the middle. With checkCollisions, live cells
+    // that have neighbors from both the top and the bottom become collision
+    // points; the neighbor counts by origin are needed for the update anyway,
+    // so this costs no extra pass over the band.
+    void updateGameOfLife(bool checkCollisions) {
         // Apply Game of Life rules to the middle section
-        for (uint16_t y = height / 3; y < 2 * height / 3; y++) {
+        for (uint16_t y = lifeBand.top; y < lifeBand.bottom; y++) {
+            // Only neighbors in the middle section count; columns wrap
+            // through the halo
+            const uint8_t* cellRows[3] = {
+                lifeBand.contains(y - 1) ? cells.row(y - 1) : NULL,
+                cells.row(y),
+                lifeBand.contains(y + 1) ? cells.row(y + 1) : NULL
+            };
+            const uint8_t* originRows[3] = {
+                cellOrigins.row(y - 1), cellOrigins.row(y), cellOrigins.row(y + 1)
+            };
+            const uint8_t* mid = cells.row(y);
+            uint8_t* next = nextCells.row(y);
+            uint8_t* origin = cellOrigins.row(y);
+            
             for (uint16_t x = 0; x < width; x++) {
                 // Count live neighbors
                 uint8_t neighbors = 0;
                 uint8_t topNeighbors = 0;
                 uint8_t bottomNeighbors = 0;
                 
-                for (int8_t dy = -1; dy <= 1; dy++) {
-                    for (int8_t dx = -1; dx <= 1; dx++) {
+                for (uint8_t dy = 0; dy < 3; dy++) {
+                    const uint8_t* cellRow = cellRows[dy];
+                    if (!cellRow) continue;
+                    
+                    const uint8_t* originRow = originRows[dy];
+                    for (int16_t nx = x - 1; nx <= x + 1; nx++) {
                         // Skip the cell itself
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        // Calculate neighbor coordinates with wrapping
-                        uint16_t nx = (x + dx + width) % width;
-                        uint16_t ny = (y + dy + height) % height;
+                        if (dy == 1 && nx == x) continue;
                         
-                        // Count only if the neighbor is in the middle section
-                        if (ny >= height / 3 && ny < 2 * height / 3 && cells[ny * width + nx] > 0) {
+                        if (cellRow[nx] > 0) {
                             neighbors++;
                             
                             // Count neighbors by origin
-                            if (cellOrigins[ny * width + nx] == 1) {
+                            if (originRow[nx] == 1) {
                                 topNeighbors++;
-                            } else if (cellOrigins[ny * width + nx] == 2) {
+                            } else if (originRow[nx] == 2) {
                                 bottomNeighbors++;
                             }
                         }
@@ -3107,131 +4568,678 @@ private:
                 }
                 
                 // Apply Conway's Game of Life rules
-                if (cells[y * width + x] > 0) {
+                if (mid[x] > 0) {
                     // Cell is alive
                     if (neighbors == 2 || neighbors == 3) {
                         // Cell survives
-                        nextCells[y * width + x] = 1;
+                        next[x] = 1;
                         
                         // Determine cell origin based on neighbors
                         if (topNeighbors > bottomNeighbors) {
-                            cellOrigins[y * width + x] = 1; // From top
+                            origin[x] = 1; // From top
                         } else if (bottomNeighbors > topNeighbors) {
-                            cellOrigins[y * width + x] = 2; // From bottom
+                            origin[x] = 2; // From bottom
                         }
                         // If equal, keep current origin
                     } else {
                         // Cell dies
-                        nextCells[y * width + x] = 0;
+                        next[x] = 0;
                     }
-                } else {
-                    // Cell is dead
-                    if (neighbors == 3) {
-                        // Cell becomes alive
-                        nextCells[y * width + x] = 1;
-                        
-                        // Determine cell origin based on neighbors
-                        if (topNeighbors > bottomNeighbors) {
-                            cellOrigins[y * width + x] = 1; // From top
-                        } else if (bottomNeighbors > topNeighbors) {
-                            cellOrigins[y * width + x] = 2; // From bottom
-                        } else {
-                            cellOrigins[y * width + x] = 0; // Neutral
-                        }
+                    
+                    // Neighbors from both top and bottom make it a collision point
+                    if (checkCollisions && topNeighbors > 0 && bottomNeighbors > 0) {
+                        origin[x] = 3;
+                    }
+                } else if (neighbors == 3) {
+                    // Dead cell becomes alive
+                    next[x] = 1;
+                    
+                    // Determine cell origin based on neighbors
+                    if (topNeighbors > bottomNeighbors) {
+                        origin[x] = 1; // From top
+                    } else if (bottomNeighbors > topNeighbors) {
+                        origin[x] = 2; // From bottom
+                    } else {
+                        origin[x] = 0; // Neutral
                     }
+                } else {
+                    // Dead cell stays dead
+                    next[x] = 0;
                 }
+                
+                // Origins are updated in place, so the last cell in the row
+                // must see this row's new origin for x = 0 through the halo
+                if (x == 0) origin[width] = origin[0];
             }
+            
+            // Rows below read this row's finished origins across the seam
+            cellOrigins.refreshRowHalo(y);
         }
+    }
+    
+    // Seed the Life band's boundary row next to a full ECA band from the
+    // ECA's innermost row
+    void seedFromBand(const EcaBand& band, uint8_t fromOrigin) {
+        if (!band.full) return;
         
-        // Seed the Game of Life from the ECAs at the boundaries
-        // From top ECA
-        if (topReachedBoundary) {
-            for (uint16_t x = 0; x < width; x++) {
-                if (cells[(height / 3 - 1) * width + x] > 0) {
-                    // Create a live cell in the Game of Life
-                    nextCells[height / 3 * width + x] = 1;
-                    cellOrigins[height / 3 * width + x] = 1; // From top
-                    
-                    // Also create some neighboring cells for more activity
-                    if (random(100) < 30) {
-                        int8_t dx = random(-1, 2);  // -1, 0, or 1
-                        uint16_t nx = (x + dx + width) % width;
-                        nextCells[height / 3 * width + nx] = 1;
-                        cellOrigins[height / 3 * width + nx] = 1; // From top
-                    }
+        const uint8_t* ecaRow = cells.row(band.inner());
+        uint16_t y = band.inner() + band.grow;
+        uint8_t* next = nextCells.row(y);
+        uint8_t* origin = cellOrigins.row(y);
+        
+        for (uint16_t x = 0; x < width; x++) {
+            if (ecaRow[x] > 0) {
+                // Create a live cell in the Game of Life
+                next[x] = 1;
+                origin[x] = fromOrigin;
+                
+                // Also create some neighboring cells for more activity
+                if (fastRandom(100) < 30) {
+                    int8_t dx = fastRandom(-1, 2);  // -1, 0, or 1
+                    uint16_t nx = (x + dx + width) % width;
+                    next[nx] = 1;
+                    origin[nx] = fromOrigin;
                 }
             }
         }
+    }
+};
+
+/**
+ * Larger than Life
+ * 
+ * Life-like rules over a bigger neighborhood: a cell counts the live cells
+ * in the (2R + 1) x (2R + 1) box around it, R up to LTL_MAX_RANGE. Rules
+ * use Evans' notation, e.g. Bosco's Rule "R5,C0,M1,S34..58,B34..45,NM":
+ * range R, states C (0 or 2 for live and dead; more adds decaying states
+ * that a dying cell steps through before it is dead, as in Generations
+ * rules, and that don't count as alive), M1 if the cell counts itself, and
+ * the S(urvival) and B(irth) count ranges. Only the N(eighborhood) M(oore)
+ * box is supported.
+ * 
+ * The counts are running sums, so each cell costs the same few adds at any
+ * range instead of (2R + 1)^2 reads: per column, the live cells in the
+ * 2R + 1 rows around the current row, moved down a row by adding the row
+ * that enters and subtracting the one that leaves, and along the row a
+ * window over those column counts that slides the same way.
+ */
+class LargerThanLife : public CellularAutomaton {
+public:
+    // Known rules that keep going on the display from a few random patches
+    enum Preset {
+        BOSCO,         // R5,C0,M1,S34..58,B34..45,NM - Bosco's Rule, "bugs" that glide and settle
+        BOSCO_TRAILS,  // R5,C3,M1,S34..58,B34..45,NM - the same with a decaying state, never settles
+        WAFFLE,        // R7,C0,M1,S100..200,B75..170,NM - Waffle, a boiling lattice
+        GLOBE,         // R8,C0,M0,S163..223,B74..252,NM - Globe, churning blobs
+        NUM_PRESETS
+    };
+    
+    LargerThanLife(Display* matrix, uint16_t width, uint16_t height, Preset preset = BOSCO)
+        : CellularAutomaton(matrix, width, height),
+          cells(width, height, 0), nextCells(width, height, 0), hueBase(0) {
+        // Column counts, with LTL_MAX_RANGE wrapped entries on each side
+        columnCounts = automatonArena().allocate<uint16_t>(width + 2 * LTL_MAX_RANGE);
+        setPreset(preset);
+        trackActivity();
+        trackPopulation();
+    }
+    
+    void init() override {
+        hueBase = fastRandom(256);
+        updatePalette();
         
-        // From bottom ECA
-        if (bottomReachedBoundary) {
-            for (uint16_t x = 0; x < width; x++) {
-                if (cells[(2 * height / 3) * width + x] > 0) {
-                    // Create a live cell in the Game of Life
-                    nextCells[(2 * height / 3 - 1) * width + x] = 1;
-                    cellOrigins[(2 * height / 3 - 1) * width + x] = 2; // From bottom
-                    
-                    // Also create some neighboring cells for more activity
-                    if (random(100) < 30) {
-                        int8_t dx = random(-1, 2);  // -1, 0, or 1
-                        uint16_t nx = (x + dx + width) % width;
-                        nextCells[(2 * height / 3 - 1) * width + nx] = 1;
-                        cellOrigins[(2 * height / 3 - 1) * width + nx] = 2; // From bottom
+        // Square patches of random soup at random places (wrapping), the
+        // sizes and density the rule does best from; a soup over the whole
+        // grid mostly dies out or fills it
+        const PresetSeed& seed = presetSeed(preset < NUM_PRESETS ? preset : BOSCO);
+        uint16_t size = min(width, height) * seed.size / 100;
+        cells.clear();
+        for (uint8_t i = 0; i < seed.patches; i++) {
+            uint16_t px = fastRandom(width);
+            uint16_t py = fastRandom(height);
+            for (uint16_t y = 0; y < size; y++) {
+                uint8_t* row = cells.row(wrapRow(py + y));
+                for (uint16_t x = 0; x < size; x += 32) {
+                    uint32_t bits = fastRandomBits(seed.density);
+                    uint16_t n = min((uint16_t)(size - x), (uint16_t)32);
+                    for (uint16_t k = 0; k < n; k++) {
+                        uint16_t cx = px + x + k;
+                        row[cx < width ? cx : cx - width] |= (bits >> k) & 1;
                     }
                 }
             }
         }
+        markAllDirty();
     }
     
-    // Check for collisions between cells from top and bottom
-    void checkCollisions() {
-        for (uint16_t y = height / 3; y < 2 * height / 3; y++) {
+    void update() override {
+        const int16_t r = range;
+        uint16_t* counts = columnCounts + LTL_MAX_RANGE;
+        
+        // Live cells in rows -r..r of each column (wrapping), for row 0
+        memset(counts, 0, width * sizeof(uint16_t));
+        for (int16_t dy = -r; dy <= r; dy++) {
+            const uint8_t* in = cells.row(wrapRow(dy));
             for (uint16_t x = 0; x < width; x++) {
-                // Skip dead cells
-                if (cells[y * width + x] == 0) continue;
-                
-                // Check if this cell has neighbors from both top and bottom
-                bool hasTopNeighbor = false;
-                bool hasBottomNeighbor = false;
+                counts[x] += in[x] == 1;
+            }
+        }
+        
+        uint32_t flipped = 0;
+        for (uint16_t y = 0; y < height; y++) {
+            if (y > 0) {
+                // Move the column boxes down a row
+                const uint8_t* enter = cells.row(wrapRow(y + r));
+                const uint8_t* leave = cells.row(wrapRow(y - r - 1));
+                for (uint16_t x = 0; x < width; x++) {
+                    counts[x] += (enter[x] == 1) - (leave[x] == 1);
+                }
+            }
+            
+            // Wrap the row's ends into the border, then slide the window
+            for (int16_t k = 1; k <= r; k++) {
+                counts[-k] = counts[width - k];
+                counts[width - 1 + k] = counts[k - 1];
+            }
+            uint16_t box = 0;
+            for (int16_t dx = -r; dx <= r; dx++) {
+                box += counts[dx];
+            }
+            
+            const uint8_t* in = cells.row(y);
+            uint8_t* out = nextCells.row(y);
+            for (uint16_t x = 0; x < width; x++) {
+                if (x > 0) box += counts[x + r] - counts[x - r - 1];
                 
-                for (int8_t dy = -1; dy <= 1; dy++) {
-                    for (int8_t dx = -1; dx <= 1; dx++) {
-                        // Skip the cell itself
-                        if (dx == 0 && dy == 0) continue;
-                        
-                        // Calculate neighbor coordinates with wrapping
-                        uint16_t nx = (x + dx + width) % width;
-                        uint16_t ny = (y + dy + height) % height;
-                        
-                        // Only check neighbors in the middle section
-                        if (ny >= height / 3 && ny < 2 * height / 3 && cells[ny * width + nx] > 0) {
-                            if (cellOrigins[ny * width + nx] == 1) {
-                                hasTopNeighbor = true;
-                            } else if (cellOrigins[ny * width + nx] == 2) {
-                                hasBottomNeighbor = true;
-                            }
-                        }
+                // Unsigned differences, so a count below the range is out too
+                uint8_t state = in[x];
+                if (state == 0) {
+                    uint8_t next = (uint16_t)(box - birthMin) <= birthSpan;
+                    out[x] = next;
+                    flipped += next;
+                } else if (state == 1) {
+                    bool survives = (uint16_t)(box - survivalMin) <= survivalSpan;
+                    out[x] = survives ? 1 : successor[1];
+                    flipped += !survives;
+                } else {
+                    out[x] = successor[state];
+                }
+            }
+            markRowIfChanged(cells, nextCells, y);
+        }
+        countFlips(flipped);
+        
+        cells.swap(nextCells);
+    }
+    
+    void render() override {
+        // Cell states are palette indices; only rows update() changed are sent
+        renderDirtyRows(cells, colorPalette);
+    }
+    
+    // Set one of the known rules
+    void setPreset(Preset newPreset) {
+        setRule(presetSeed(newPreset).rule);
+        preset = newPreset;
+    }
+    
+    // Pick one of the known rules
+    void randomRule() {
+        setPreset(static_cast<Preset>(fastRandom(NUM_PRESETS)));
+    }
+    
+    // Set a rule in Evans' notation ("R5,C0,M1,S34..58,B34..45,NM"). Missing
+    // fields keep their defaults (R1,C0,M0,S2..3,B3..3, the Game of Life).
+    // Returns false, and keeps the current rule, if the range or state count
+    // is out of bounds.
+    bool setRule(const char* rule) {
+        uint16_t r = 1, c = 0, m = 0;
+        uint16_t sLo = 2, sHi = 3, bLo = 3, bHi = 3;
+        
+        const char* p = rule;
+        while (*p) {
+            char key = *p++;
+            uint16_t lo = parseNumber(p);
+            uint16_t hi = lo;
+            if (p[0] == '.' && p[1] == '.') {
+                p += 2;
+                hi = parseNumber(p);
+            }
+            switch (key) {
+                case 'R': r = lo; break;
+                case 'C': c = lo; break;
+                case 'M': m = lo; break;
+                case 'S': sLo = lo; sHi = hi; break;
+                case 'B': bLo = lo; bHi = hi; break;
+                default: break; // N: the box is the only neighborhood
+            }
+            while (*p && *p != ',') p++;
+            if (*p == ',') p++;
+        }
+        if (r < 1 || r > LTL_MAX_RANGE || c > LTL_MAX_STATES || sHi < sLo || bHi < bLo) {
+            return false;
+        }
+        
+        range = r;
+        states = c < 2 ? 2 : c;
+        middle = m != 0;
+        // The window always holds the cell itself (0 when it was dead, so
+        // only survival needs shifting)
+        survivalMin = sLo + !middle;
+        survivalSpan = sHi - sLo;
+        birthMin = bLo;
+        birthSpan = bHi - bLo;
+        preset = NUM_PRESETS;
+        
+        // A live cell that doesn't survive starts decaying (straight to dead
+        // with two states); the last decaying state dies
+        for (uint8_t s = 1; s < LTL_MAX_STATES; s++) {
+            successor[s] = s + 1 < states ? s + 1 : 0;
+        }
+        successor[0] = 0;
+        updatePalette();
+        return true;
+    }
+    
+    const char* getName() const override {
+        static char name[64];
+        
+        // The rule back in Evans' notation
+        const uint16_t sLo = survivalMin - !middle;
+        sprintf(name, "%s (R%u,C%u,M%u,S%u..%u,B%u..%u)",
+                preset < NUM_PRESETS ? presetSeed(preset).name : "Larger than Life",
+                range, states == 2 ? 0 : states, middle, sLo, sLo + survivalSpan,
+                birthMin, birthMin + birthSpan);
+        return name;
+    }
+    
+private:
+    HaloGrid cells;            // Current generation (no border, the sums wrap)
+    HaloGrid nextCells;        // Next generation
+    uint16_t* columnCounts;    // Live cells in a column's box, plus wrapped ends
+    uint8_t range;             // Box radius R
+    uint8_t states;            // Live, dead and decaying states
+    bool middle;               // Whether survival counts the cell itself
+    uint16_t survivalMin;      // Survival window counts, the cell included
+    uint16_t survivalSpan;
+    uint16_t birthMin;         // Birth window counts
+    uint16_t birthSpan;
+    uint8_t successor[LTL_MAX_STATES]; // Next state of a dying or decaying cell
+    Preset preset;             // Known rule in use, or NUM_PRESETS (seeded as BOSCO)
+    uint8_t hueBase;           // Live cell hue
+    uint16_t colorPalette[LTL_MAX_STATES]; // State -> color
+    
+    uint32_t hashRow(uint16_t y) const override {
+        return hashBytes(cells.row(y), width);
+    }
+    
+    // Live cells; decaying ones don't count
+    uint16_t rowPopulation(uint16_t y) const override {
+        const uint8_t* row = cells.row(y);
+        uint16_t n = 0;
+        for (uint16_t x = 0; x < width; x++) {
+            n += row[x] == 1;
+        }
+        return n;
+    }
+    
+    void snapshotState(Snapshot& s) override {
+        cells.snapshot(s);
+        s.value(range);
+        s.value(states);
+        s.value(middle);
+        s.value(survivalMin);
+        s.value(survivalSpan);
+        s.value(birthMin);
+        s.value(birthSpan);
+        s.value(successor);
+        s.value(preset);
+        s.value(hueBase);
+        s.value(colorPalette);
+    }
+    
+    // A known rule and how init() seeds it: patches squares of random soup,
+    // size percent of the shorter grid side across, density percent alive
+    struct PresetSeed {
+        const char* rule;
+        const char* name;
+        uint8_t patches;
+        uint8_t size;
+        uint8_t density;
+    };
+    
+    static const PresetSeed& presetSeed(Preset p) {
+        static const PresetSeed seeds[NUM_PRESETS] = {
+            { "R5,C0,M1,S34..58,B34..45,NM", "Bosco's Rule", 16, 10, 60 },
+            { "R5,C3,M1,S34..58,B34..45,NM", "Bosco's Rule", 6, 19, 60 },
+            { "R7,C0,M1,S100..200,B75..170,NM", "Waffle", 1, 38, 50 },
+            { "R8,C0,M0,S163..223,B74..252,NM", "Globe", 6, 19, 60 }
+        };
+        return seeds[p];
+    }
+    
+    // Row y wrapped onto the grid, for y within a range of it
+    int16_t wrapRow(int16_t y) const {
+        if (y < 0) return y + height;
+        if (y >= height) return y - height;
+        return y;
+    }
+    
+    // Decimal digits at p, moving p past them
+    static uint16_t parseNumber(const char*& p) {
+        uint16_t n = 0;
+        while (*p >= '0' && *p <= '9') {
+            n = n * 10 + (*p++ - '0');
+        }
+        return n;
+    }
+    
+    // Dead black, live in the run's hue, decaying states fading from a
+    // dimmer, shifted hue toward black
+    void updatePalette() {
+        colorPalette[0] = 0;
+        colorPalette[1] = hueColor(hueBase);
+        if (states > 2) {
+            Rgb from = mix(Rgb{0, 0, 0}, hue(hueBase + 40), 160);
+            fillGradient(colorPalette, 2, states - 1, from, Rgb{0, 0, 24});
+        }
+        markAllDirty();
+    }
+};
+
+/**
+ * SmoothLife
+ * 
+ * A continuous Game of Life (after Rafler): each cell is a fill level from
+ * 0 to 255 instead of alive or dead, set each generation from how full the
+ * disk of radius SMOOTH_LIFE_RADIUS / 3 around it is (m) and how full the
+ * ring from there out to SMOOTH_LIFE_RADIUS is (n). Birth and survival are
+ * intervals of n whose ends slide between the two with m, with soft edges.
+ * With these parameters it grows gliders with soft edges that cross the
+ * grid a pixel or so per generation.
+ * 
+ * The disk and the ring's outer edge are octagons, each a wide rectangle
+ * plus a tall one minus the square they share. Each rectangle sum is a
+ * running column sum slid down the grid and a window slid along it, as in
+ * LargerThanLife, so a cell costs about twenty adds at any radius. The
+ * transition is a table of next fill levels over m (5 bits) and n (8
+ * bits), built in fixed point with smoothsteps in place of SmoothLife's
+ * logistic sigmoids, so the cell loop only multiplies to turn the sums into
+ * m and n. Fill levels are shown through 16 palette steps.
+ */
+class SmoothLife : public CellularAutomaton {
+public:
+    SmoothLife(Display* matrix, uint16_t width, uint16_t height)
+        : CellularAutomaton(matrix, width, height),
+          cells(width, height, 0), nextCells(width, height, 0), hueBase(0) {
+        // Half the side of each octagon's rectangles across their short way,
+        // about 0.55 of the radius so the octagon's area is near the disk's
+        outerRadius = SMOOTH_LIFE_RADIUS;
+        outerSide = (outerRadius * 5 + 4) / 9;
+        innerRadius = (outerRadius + 1) / 3;
+        innerSide = (innerRadius * 5 + 4) / 9;
+        
+        // Column sums with SMOOTH_LIFE_RADIUS wrapped entries on each side
+        for (uint8_t i = 0; i < 4; i++) {
+            columns[i] = automatonArena().allocate<uint16_t>(width + 2 * SMOOTH_LIFE_RADIUS) + SMOOTH_LIFE_RADIUS;
+        }
+        transition = automatonArena().allocate<uint8_t>(32 * 256);
+        
+        // m and n as 0..255 from the sums, by multiplying with a 2^20
+        // reciprocal of the cell counts
+        uint32_t innerArea = octagonArea(innerRadius, innerSide);
+        uint32_t ringArea = octagonArea(outerRadius, outerSide) - innerArea;
+        innerScale = (1UL << 20) / innerArea;
+        ringScale = (1UL << 20) / ringArea;
+        
+        buildTransition();
+        trackActivity();
+    }
+    
+    void init() override {
+        hueBase = fastRandom(256);
+        updatePalette();
+        
+        // Full squares scattered over a quarter of the grid; the rest
+        // starts empty
+        cells.clear();
+        scatterSquares(4);
+        markAllDirty();
+    }
+    
+    void update() override {
+        // Columns of 2h + 1 rows for the four rectangle heights
+        const int16_t heights[4] = { innerRadius, innerSide, outerRadius, outerSide };
+        uint16_t* innerTall = columns[0];
+        uint16_t* innerShort = columns[1];
+        uint16_t* outerTall = columns[2];
+        uint16_t* outerShort = columns[3];
+        
+        // Sums for row 0, wrapping around the top and bottom
+        for (uint8_t i = 0; i < 4; i++) {
+            memset(columns[i], 0, width * sizeof(uint16_t));
+            for (int16_t dy = -heights[i]; dy <= heights[i]; dy++) {
+                const uint8_t* in = cells.row(wrapRow(dy));
+                for (uint16_t x = 0; x < width; x++) {
+                    columns[i][x] += in[x];
+                }
+            }
+        }
+        
+        const int16_t ri = innerRadius, si = innerSide;
+        const int16_t ra = outerRadius, sa = outerSide;
+        bool changed = false;
+        for (uint16_t y = 0; y < height; y++) {
+            if (y > 0) {
+                // Move every column down a row
+                for (uint8_t i = 0; i < 4; i++) {
+                    const uint8_t* enter = cells.row(wrapRow(y + heights[i]));
+                    const uint8_t* leave = cells.row(wrapRow(y - heights[i] - 1));
+                    uint16_t* column = columns[i];
+                    for (uint16_t x = 0; x < width; x++) {
+                        column[x] += enter[x] - leave[x];
                     }
                 }
+            }
+            for (uint8_t i = 0; i < 4; i++) {
+                wrapColumns(columns[i]);
+            }
+            
+            // Windows at x = 0: the wide rectangle (short columns, long
+            // window), the tall one and their shared square, for each octagon
+            uint32_t innerWide = windowSum(innerShort, ri);
+            uint32_t innerHigh = windowSum(innerTall, si);
+            uint32_t innerMid = windowSum(innerShort, si);
+            uint32_t outerWide = windowSum(outerShort, ra);
+            uint32_t outerHigh = windowSum(outerTall, sa);
+            uint32_t outerMid = windowSum(outerShort, sa);
+            
+            const uint8_t* in = cells.row(y);
+            uint8_t* out = nextCells.row(y);
+            for (uint16_t x = 0; x < width; x++) {
+                if (x > 0) {
+                    innerWide += innerShort[x + ri] - innerShort[x - ri - 1];
+                    innerHigh += innerTall[x + si] - innerTall[x - si - 1];
+                    innerMid += innerShort[x + si] - innerShort[x - si - 1];
+                    outerWide += outerShort[x + ra] - outerShort[x - ra - 1];
+                    outerHigh += outerTall[x + sa] - outerTall[x - sa - 1];
+                    outerMid += outerShort[x + sa] - outerShort[x - sa - 1];
+                }
+                uint32_t inner = innerWide + innerHigh - innerMid;
+                uint32_t ring = outerWide + outerHigh - outerMid - inner;
+                uint8_t m = (inner * innerScale) >> 20;
+                uint8_t n = (ring * ringScale) >> 20;
                 
-                // If this cell has neighbors from both top and bottom, mark it as a collision point
-                if (hasTopNeighbor && hasBottomNeighbor) {
-                    cellOrigins[y * width + x] = 3; // Collision point
+                out[x] = transition[(m >> 3) << 8 | n];
+            }
+            if (memcmp(in, out, width) != 0) {
+                markRowDirty(y);
+                changed = true;
+            }
+        }
+        
+        cells.swap(nextCells);
+        
+        // Gliders that collide often wipe each other out, leaving an empty
+        // or frozen grid: drop in a few new squares
+        if (!changed) scatterSquares(16);
+    }
+    
+    void render() override {
+        // Fill levels are palette indices; only rows update() changed are sent
+        renderDirtyRows(cells, colorPalette);
+    }
+    
+    const char* getName() const override {
+        static char name[32];
+        sprintf(name, "SmoothLife (r=%u)", outerRadius);
+        return name;
+    }
+    
+private:
+    HaloGrid cells;            // Current fill levels (no border, the sums wrap)
+    HaloGrid nextCells;        // Next generation
+    uint8_t innerRadius;       // Disk octagon half-width
+    uint8_t innerSide;         // Its rectangles' short half-side
+    uint8_t outerRadius;       // Ring's outer octagon half-width
+    uint8_t outerSide;
+    uint16_t* columns[4];      // Column sums: inner tall and short, outer tall and short
+    uint32_t innerScale;       // 2^20 / cells in the disk
+    uint32_t ringScale;        // 2^20 / cells in the ring
+    uint8_t* transition;       // [m >> 3][n] -> next fill level
+    uint8_t hueBase;           // Hue of full cells
+    uint16_t colorPalette[256]; // Fill level -> color, in 16 steps
+    
+    uint32_t hashRow(uint16_t y) const override {
+        return hashBytes(cells.row(y), width);
+    }
+    
+    void snapshotState(Snapshot& s) override {
+        cells.snapshot(s);
+        s.value(hueBase);
+        s.value(colorPalette);
+    }
+    
+    // Fill squares about the size of the disk at random places (wrapping),
+    // covering 1 / fraction of the grid between them
+    void scatterSquares(uint8_t fraction) {
+        uint16_t side = 2 * innerRadius + 2;
+        uint16_t count = (uint32_t)width * height / (fraction * side * side);
+        if (count == 0) count = 1;
+        for (uint16_t i = 0; i < count; i++) {
+            uint16_t px = fastRandom(width);
+            uint16_t py = fastRandom(height);
+            for (uint16_t y = 0; y < side; y++) {
+                uint8_t* row = cells.row(wrapRow(py + y));
+                for (uint16_t x = 0; x < side; x++) {
+                    uint16_t cx = px + x;
+                    row[cx < width ? cx : cx - width] = 255;
                 }
+                markRowDirty(wrapRow(py + y));
+            }
+        }
+    }
+    
+    // Cells in the octagon of wide and tall rectangles with half-sides
+    // radius and side
+    static uint32_t octagonArea(uint8_t radius, uint8_t side) {
+        uint32_t across = 2 * radius + 1;
+        uint32_t short_ = 2 * side + 1;
+        return 2 * across * short_ - short_ * short_;
+    }
+    
+    // Copy the ends of a column sum row into its border
+    void wrapColumns(uint16_t* column) const {
+        for (int16_t k = 1; k <= SMOOTH_LIFE_RADIUS; k++) {
+            column[-k] = column[width - k];
+            column[width - 1 + k] = column[k - 1];
+        }
+    }
+    
+    // Columns -reach..reach of a column sum row
+    static uint32_t windowSum(const uint16_t* column, int16_t reach) {
+        uint32_t sum = 0;
+        for (int16_t dx = -reach; dx <= reach; dx++) {
+            sum += column[dx];
+        }
+        return sum;
+    }
+    
+    int16_t wrapRow(int16_t y) const {
+        if (y < 0) return y + height;
+        if (y >= height) return y - height;
+        return y;
+    }
+    
+    // SmoothLife's sigma: 0 well below a, 1 well above, in Q15. A smoothstep
+    // with the logistic's slope of 1 / alpha at a stands in for it.
+    static int32_t sigmoid(int32_t x, int32_t a, int32_t alpha) {
+        int32_t t = (x - a) * 21845 / alpha + 16384; // 2/3 of 32768
+        if (t <= 0) return 0;
+        if (t >= 32768) return 32768;
+        uint32_t u = t;
+        return ((u * u) >> 15) * (3 * 32768 - 2 * u) >> 15;
+    }
+    
+    // The transition table, from Rafler's "SmoothLife L" parameters (in
+    // Q15) in discrete time: birth for n in b1..b2, survival for n in
+    // d1..d2, blended by m
+    void buildTransition() {
+        const int32_t b1 = 9110, b2 = 11960;   // 0.278, 0.365
+        const int32_t d1 = 8749, d2 = 14582;   // 0.267, 0.445
+        const int32_t alphaN = 918;            // 0.028
+        const int32_t alphaM = 4817;           // 0.147
+        
+        for (uint8_t i = 0; i < 32; i++) {
+            int32_t m = ((int32_t)i * 8 + 4) * 32768 / 255;
+            int32_t alive = sigmoid(m, 16384, alphaM);
+            int32_t lo = b1 + (((d1 - b1) * alive) >> 15);
+            int32_t hi = b2 + (((d2 - b2) * alive) >> 15);
+            for (uint16_t j = 0; j < 256; j++) {
+                int32_t n = (int32_t)j * 32768 / 255;
+                int32_t s = (sigmoid(n, lo, alphaN) * (32768 - sigmoid(n, hi, alphaN))) >> 15;
+                transition[i << 8 | j] = (s * 255) >> 15;
             }
         }
     }
+    
+    // Black through the run's hue, in 16 gamma-corrected steps of 16 levels
+    void updatePalette() {
+        uint16_t levels[16];
+        fillGradient(levels, 0, 15, Rgb{0, 0, 0}, hue(hueBase));
+        for (uint16_t i = 0; i < 256; i++) {
+            colorPalette[i] = levels[i >> 4];
+        }
+        markAllDirty();
+    }
 };
 
 /**
- * Factory function to create a random automaton
+ * Build an automaton of the given type (the numbering of
+ * createRandomAutomaton()) for a snapshot to load into, with the
+ * snapshotParam() it was saved with. NULL for an unknown type.
  */
+CellularAutomaton* createAutomatonOfType(uint8_t type, uint8_t param, Display* matrix, uint16_t width, uint16_t height) {
+    switch (type) {
+        case 0: return new ElementaryAutomaton(matrix, width, height);
+        case 1: return param ? new GameOfLife(matrix, width * GOL_WORLD_SCALE, height * GOL_WORLD_SCALE)
+                             : new GameOfLife(matrix, width, height);
+        case 2: return new BriansBrain(matrix, width, height);
+        case 3: return param ? new LangtonsAnt(matrix, width, height, param) : NULL;
+        case 4: return new CyclicAutomaton(matrix, width, height);
+        case 5: return new BubblingLava(matrix, width, height);
+        case 6: return new OrderAndChaos(matrix, width, height);
+        case 7: return new LargerThanLife(matrix, width, height);
+        case 8: return new SmoothLife(matrix, width, height);
+        default: return NULL;
+    }
+}
 
 /**
  * Factory function to create a random automaton
  */
-CellularAutomaton* createRandomAutomaton(Adafruit_Protomatter* matrix, uint16_t width, uint16_t height) {
-    uint8_t type = random(NUM_AUTOMATA);
+CellularAutomaton* createRandomAutomaton(Display* matrix, uint16_t width, uint16_t height) {
+    uint8_t type = fastRandom(NUM_AUTOMATA);
     
     switch (type) {
         case 0: {
@@ -3244,19 +5252,21 @@ CellularAutomaton* createRandomAutomaton(Adafruit_Protomatter* matrix, uint16_t
         case 2:
             return new BriansBrain(matrix, width, height);
         case 3: {
-            uint8_t antCount = random(7, 13);  // 7-12 ants
-            return new LangtonsAnt(matrix, width, height, antCount);
+            uint8_t antCount = fastRandom(7, 13);  // 7-12 ants
+            LangtonsAnt* automaton = new LangtonsAnt(matrix, width, height, antCount);
+            automaton->randomRule();
+            return automaton;
         }
         case 4: {
             CyclicAutomaton* automaton = new CyclicAutomaton(matrix, width, height);
             
             // Randomize the cyclic automaton parameters for more variety
-            if (random(100) < 60) {
+            if (fastRandom(100) < 60) {
                 // 60% chance to use a preset known to create interesting patterns
                 CyclicAutomaton::Preset preset;
                 
                 // Choose from presets that create the most interesting visual effects
-                uint8_t presetChoice = random(100);
+                uint8_t presetChoice = fastRandom(100);
                 if (presetChoice < 35) {
                     // 35% chance for spiral waves - the most visually appealing
                     preset = CyclicAutomaton::SPIRAL_WAVES;
@@ -3285,12 +5295,12 @@ CellularAutomaton* createRandomAutomaton(Adafruit_Protomatter* matrix, uint16_t
                 // 40% chance for custom parameters optimized for interesting patterns
                 
                 // Choose a pattern type
-                uint8_t patternType = random(100);
+                uint8_t patternType = fastRandom(100);
                 
                 if (patternType < 50) {
                     // 50% chance for spiral-generating parameters
-                    uint8_t states = random(8, 17);  // 8-16 states work well for spirals
-                    uint8_t thresh = random(100) < 70 ? 1 : 2;  // Threshold 1-2 works best for spirals
+                    uint8_t states = fastRandom(8, 17);  // 8-16 states work well for spirals
+                    uint8_t thresh = fastRandom(100) < 70 ? 1 : 2;  // Threshold 1-2 works best for spirals
                     uint8_t rng = 1;  // Range 1 for tight spirals
                     
                     automaton->setNumStates(states);
@@ -3302,8 +5312,8 @@ CellularAutomaton* createRandomAutomaton(Adafruit_Protomatter* matrix, uint16_t
                     
                 } else if (patternType < 75) {
                     // 25% chance for rock-paper-scissors dynamics
-                    uint8_t states = random(3, 7);  // 3-6 states
-                    uint8_t thresh = random(2, 4);  // Higher threshold (2-3)
+                    uint8_t states = fastRandom(3, 7);  // 3-6 states
+                    uint8_t thresh = fastRandom(2, 4);  // Higher threshold (2-3)
                     uint8_t rng = 1;  // Range 1
                     
                     automaton->setNumStates(states);
@@ -3315,9 +5325,9 @@ CellularAutomaton* createRandomAutomaton(Adafruit_Protomatter* matrix, uint16_t
                     
                 } else {
                     // 25% chance for crystal/labyrinth patterns
-                    uint8_t states = random(4, 9);  // 4-8 states
+                    uint8_t states = fastRandom(4, 9);  // 4-8 states
                     uint8_t thresh = 2;  // Threshold 2 works well for these
-                    uint8_t rng = random(100) < 70 ? 1 : 2;  // Mostly range 1, sometimes 2
+                    uint8_t rng = fastRandom(100) < 70 ? 1 : 2;  // Mostly range 1, sometimes 2
                     
                     automaton->setNumStates(states);
                     automaton->setThreshold(thresh);
@@ -3334,6 +5344,13 @@ CellularAutomaton* createRandomAutomaton(Adafruit_Protomatter* matrix, uint16_t
             return new BubblingLava(matrix, width, height);
         case 6:
             return new OrderAndChaos(matrix, width, height);
+        case 7: {
+            LargerThanLife* automaton = new LargerThanLife(matrix, width, height);
+            automaton->randomRule();
+            return automaton;
+        }
+        case 8:
+            return new SmoothLife(matrix, width, height);
         default:
             return new ElementaryAutomaton(matrix, width, height);
     }
@@ -0,0 +1,67 @@
+#ifndef COLORS_H
+#define COLORS_H
+
+#include <stdint.h>
+
+// Color helpers for building palettes
+//
+// Everything here is integer-only and constexpr, so constant colors fold
+// into literals at compile time, and palettes built at runtime (once, in a
+// constructor or init()) cost a few multiplies per entry. Nothing in here is
+// meant to run per pixel: automata render through palettes.
+
+// 8-bit per channel color, for colors that are still blended or gamma
+// corrected before they become RGB565
+struct Rgb {
+    uint8_t r, g, b;
+};
+
+// RGB888 -> RGB565
+constexpr uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+constexpr uint16_t rgb565(Rgb c) {
+    return rgb565(c.r, c.g, c.b);
+}
+
+// HSV -> RGB, every component 0-255 (hue 0 = red, 85 = green, 170 = blue)
+constexpr Rgb hsv(uint8_t h, uint8_t s, uint8_t v) {
+    if (s == 0) return Rgb{v, v, v};
+
+    uint8_t region = h / 43;
+    uint8_t remainder = (h - region * 43) * 6;
+    uint8_t p = (v * (255 - s)) >> 8;
+    uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 0: return Rgb{v, t, p};
+        case 1: return Rgb{q, v, p};
+        case 2: return Rgb{p, v, t};
+        case 3: return Rgb{p, q, v};
+        case 4: return Rgb{t, p, v};
+        default: return Rgb{v, p, q};
+    }
+}
+
+// Fully saturated, full brightness hue
+constexpr Rgb hue(uint8_t h) {
+    return hsv(h, 255, 255);
+}
+
+// Linear blend from `from` (t = 0) to `to` (t = 255)
+constexpr Rgb mix(Rgb from, Rgb to, uint8_t t) {
+    return Rgb{
+        (uint8_t)(from.r + ((to.r - from.r) * t) / 255),
+        (uint8_t)(from.g + ((to.g - from.g) * t) / 255),
+        (uint8_t)(from.b + ((to.b - from.b) * t) / 255)
+    };
+}
+
+// Rough perceived brightness, for comparing two colors
+constexpr uint16_t brightness(uint16_t color565) {
+    return ((color565 >> 11) & 0x1F) + ((color565 >> 5) & 0x3F) + (color565 & 0x1F);
+}
+
+#endif // COLORS_H
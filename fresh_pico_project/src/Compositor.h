@@ -0,0 +1,244 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <Arduino.h>
+#include <MatrixController.h>
+#include "Arena.h"
+#include "PanelConfig.h"
+
+// Most layers over the automaton
+#define COMPOSITOR_LAYERS 4
+
+// Arena the layers and their pixels come from: the title (a panel, 4 KB),
+// the perf HUD and room for a small layer more
+#define COMPOSITOR_ARENA_BYTES 6144
+
+// Colors in a layer's palette
+#define LAYER_COLORS 8
+
+// Index of a keyed layer's transparent pixels
+#define LAYER_CLEAR 0
+
+/**
+ * Rows and columns [x0, x1) x [y0, y1) of something, empty when x0 >= x1
+ */
+struct DirtyRect {
+    int16_t x0, y0, x1, y1;
+
+    DirtyRect() { clear(); }
+
+    void clear() { x0 = y0 = INT16_MAX; x1 = y1 = INT16_MIN; }
+    bool empty() const { return x0 >= x1 || y0 >= y1; }
+
+    void add(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+        if (w == 0 || h == 0) return;
+        x0 = min(x0, x);
+        y0 = min(y0, y);
+        x1 = max(x1, (int16_t)(x + w));
+        y1 = max(y1, (int16_t)(y + h));
+    }
+};
+
+/**
+ * One picture over the automaton: a w x h image of palette indices at a
+ * logical position
+ *
+ * A keyed layer leaves the automaton showing through its LAYER_CLEAR
+ * pixels; an opaque one covers its whole rectangle. Drawing into it only
+ * records the rows changed (changed); the compositor paints them onto the
+ * canvas at the next flatten().
+ */
+class Layer {
+public:
+    Layer(uint8_t* pixels, int16_t x, int16_t y, uint16_t w, uint16_t h, bool keyed)
+        : pixels(pixels), x(x), y(y), w(w), h(h), keyed(keyed), visible(false) {
+        memset(pixels, LAYER_CLEAR, (uint32_t)w * h);
+        memset(palette, 0, sizeof(palette));
+    }
+
+    Layer(const Layer&) = delete;
+    Layer& operator=(const Layer&) = delete;
+
+    uint16_t width() const { return w; }
+    uint16_t height() const { return h; }
+    int16_t left() const { return x; }
+    int16_t top() const { return y; }
+    bool isKeyed() const { return keyed; }
+    bool isVisible() const { return visible; }
+
+    void setColor(uint8_t index, uint16_t color) {
+        palette[index] = color;
+        touchAll();
+    }
+
+    // Showing a layer paints all of it at the next flatten(); hiding one
+    // leaves the automaton to repaint what it covered (see Compositor)
+    void setVisible(bool on) {
+        if (on == visible) return;
+        visible = on;
+        if (on) {
+            touchAll();
+        } else {
+            uncovered = true;
+        }
+    }
+
+    // Row r of the image, to draw into directly: call touch() after
+    uint8_t* row(uint16_t r) { return pixels + (uint32_t)r * w; }
+
+    void setPixel(uint16_t px, uint16_t py, uint8_t index) {
+        if (px >= w || py >= h) return;
+        uint8_t& p = pixels[(uint32_t)py * w + px];
+        if (p == index) return;
+        if (keyed && index == LAYER_CLEAR) uncovered = true;
+        p = index;
+        changed.add(px, py, 1, 1);
+    }
+
+    void fill(uint8_t index) {
+        memset(pixels, index, (uint32_t)w * h);
+        if (keyed) uncovered = true;
+        touchAll();
+    }
+
+    // Rows [first, first + count) were drawn into through row(); with a
+    // keyed layer they may have cleared pixels too
+    void touch(uint16_t first, uint16_t count) {
+        changed.add(0, first, w, count);
+        if (keyed) uncovered = true;
+    }
+
+private:
+    friend class Compositor;
+
+    void touchAll() { changed.add(0, 0, w, h); }
+
+    uint8_t* pixels;
+    int16_t x, y;                  // Logical position of the top-left corner
+    uint16_t w, h;
+    bool keyed;                    // LAYER_CLEAR pixels transparent
+    bool visible;
+    bool uncovered = false;        // Something under it needs repainting
+    DirtyRect changed;             // In layer coordinates
+    uint16_t palette[LAYER_COLORS];
+};
+
+/**
+ * Layers drawn over the automaton, flattened into the display's canvas
+ * once a frame, just before it is shown
+ *
+ * The automaton stays the bottom layer and keeps drawing into the canvas
+ * itself, only the rows it changed. flatten() then paints each visible
+ * layer, bottom to top, only where it is out of date: rows of it that
+ * changed, and rows the automaton or a lower layer painted over since the
+ * last frame (MatrixController::getDrawnRows()). A layer that stays put
+ * over a still picture costs nothing.
+ *
+ * Where a layer went away or cleared keyed pixels, the automaton has to
+ * repaint what was under it: takeDamage() hands that area on to
+ * CellularAutomaton::markAreaDirty(), so only those rows are redrawn
+ * rather than the whole wall.
+ *
+ * Layers are created once and live for the whole run, in an arena of
+ * their own.
+ */
+class Compositor {
+public:
+    Compositor(MatrixController& display)
+        : display(display), arena(buffer, sizeof(buffer)), count(0) {}
+
+    Compositor(const Compositor&) = delete;
+    Compositor& operator=(const Compositor&) = delete;
+
+    // A new layer above the ones so far, hidden until setVisible(); NULL
+    // when the arena or the layer table is full
+    Layer* addLayer(int16_t x, int16_t y, uint16_t w, uint16_t h, bool keyed) {
+        if (count == COMPOSITOR_LAYERS) return NULL;
+        uint8_t* pixels = arena.allocate<uint8_t>((uint32_t)w * h);
+        if (pixels == NULL) return NULL;
+        Layer* layer = arena.create<Layer>(pixels, x, y, w, h, keyed);
+        if (layer == NULL) return NULL;
+        layers[count++] = layer;
+        return layer;
+    }
+
+    // Paint the out-of-date rows of every visible layer into the canvas.
+    // Call after the automaton's draw() (and any cross-fade), before
+    // present().
+    void flatten() {
+        uint16_t rows = display.height();
+        uint8_t drawn[(TOTAL_HEIGHT + 7) / 8];
+        uint8_t bytes = (rows + 7) / 8;
+        if (bytes > sizeof(drawn)) bytes = sizeof(drawn);
+        memcpy(drawn, display.getDrawnRows(), bytes);
+
+        for (uint8_t i = 0; i < count; i++) {
+            Layer& layer = *layers[i];
+            if (layer.uncovered) {
+                damage.add(layer.x, layer.y, layer.w, layer.h);
+                layer.uncovered = false;
+            }
+            if (!layer.visible) {
+                layer.changed.clear();
+                continue;
+            }
+
+            for (uint16_t r = 0; r < layer.h; r++) {
+                int16_t py = layer.y + r;
+                if ((uint16_t)py >= rows || (uint16_t)py >= bytes * 8) continue;
+                bool under = drawn[py >> 3] & (1 << (py & 7));
+                bool stale = r >= layer.changed.y0 && r < layer.changed.y1;
+                if (!under && !stale) continue;
+                paintRow(layer, r, py);
+                drawn[py >> 3] |= 1 << (py & 7); // Layers above repaint over it
+            }
+            layer.changed.clear();
+        }
+        display.clearDrawnRows();
+    }
+
+    // The area the automaton has to repaint since the last call, because a
+    // layer no longer covers it; false if there is none
+    bool takeDamage(int16_t& x, int16_t& y, uint16_t& w, uint16_t& h) {
+        if (damage.empty()) return false;
+        x = damage.x0;
+        y = damage.y0;
+        w = damage.x1 - damage.x0;
+        h = damage.y1 - damage.y0;
+        damage.clear();
+        return true;
+    }
+
+    uint32_t getArenaUsed() const { return arena.getUsed(); }
+    uint32_t getArenaSize() const { return arena.getSize(); }
+
+private:
+    // Layer row r onto logical row py, clipped to the display; keyed layers
+    // a run of opaque pixels at a time
+    void paintRow(Layer& layer, uint16_t r, int16_t py) {
+        int16_t first = layer.x < 0 ? -layer.x : 0;
+        int16_t end = min((int16_t)layer.w, (int16_t)(display.width() - layer.x));
+        const uint8_t* src = layer.row(r);
+        if (!layer.keyed) {
+            if (first < end) display.blitIndexedSpan(py, layer.x + first, end - first, src + first, layer.palette);
+            return;
+        }
+        int16_t c = first;
+        while (c < end) {
+            while (c < end && src[c] == LAYER_CLEAR) c++;
+            int16_t run = c;
+            while (run < end && src[run] != LAYER_CLEAR) run++;
+            if (run > c) display.blitIndexedSpan(py, layer.x + c, run - c, src + c, layer.palette);
+            c = run;
+        }
+    }
+
+    MatrixController& display;
+    alignas(ARENA_ALIGN) uint8_t buffer[COMPOSITOR_ARENA_BYTES];
+    Arena arena;
+    Layer* layers[COMPOSITOR_LAYERS]; // Bottom to top
+    uint8_t count;
+    DirtyRect damage;                 // Logical area to hand to the automaton
+};
+
+#endif
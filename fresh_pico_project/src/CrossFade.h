@@ -0,0 +1,56 @@
+#ifndef CROSS_FADE_H
+#define CROSS_FADE_H
+
+#include <Arduino.h>
+#include <MatrixController.h>
+
+// Cross-fade from the current picture into the next one
+// begin() leaves the canvas as it is and points the display at an offscreen
+// frame, so the incoming automaton renders there. composite() then moves the
+// canvas toward that frame by 1/remaining of the way each frame: for a still
+// picture that is a linear fade over `frames` frames, and a moving one is
+// followed as it goes. The last frame copies the offscreen frame, which
+// leaves the canvas exactly where the automaton's own partial redraws expect
+// it, and hands drawing back to the canvas.
+class CrossFade {
+public:
+    // frame must hold display.width() * display.height() pixels
+    CrossFade(MatrixController& display, uint16_t* frame, uint16_t frames)
+        : display(display), frame(frame), frames(frames), remaining(0) {}
+
+    // Start a fade; the next draws go to the offscreen frame
+    void begin() {
+        if (frames == 0) return;
+        remaining = frames;
+        display.setTarget(frame);
+    }
+
+    // Blend one frame step into the canvas. Call between an automaton's
+    // draw() and present().
+    void composite() {
+        if (remaining == 0) return;
+        display.blendFrame(frame, 256 / remaining);
+        if (--remaining == 0) {
+            display.setTarget(NULL);
+        }
+    }
+
+    // Stop a fade where it is; draws go back to the canvas
+    void cancel() {
+        remaining = 0;
+        display.setTarget(NULL);
+    }
+
+    // Whether a fade is in progress
+    bool active() const {
+        return remaining > 0;
+    }
+
+private:
+    MatrixController& display;
+    uint16_t* frame;     // Offscreen target for the incoming automaton
+    uint16_t frames;     // Length of a fade (0 = cut straight over)
+    uint16_t remaining;  // Frames left in the current fade
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+// The display backend this build draws through (see DisplayBackend.h),
+// chosen at compile time so the automata call it directly:
+//
+//   default                   MatrixController: Protomatter, or the PIO
+//                             refresh with -D MATRIX_PIO
+//   -D DISPLAY_RGBMATRIXPANEL RGBmatrixDisplay over RGBmatrixPanel
+//                             (Arduino_Mega_RGB_Matrix_64x64, e.g. on ESP32)
+//   -D DISPLAY_MOCK           MockDisplay, a plain frame buffer on the host
+//                             (bench/mock)
+#if defined(DISPLAY_RGBMATRIXPANEL)
+#include <RGBmatrixDisplay.h>
+typedef RGBmatrixDisplay Display;
+#elif defined(DISPLAY_MOCK)
+#include <MockDisplay.h>
+typedef MockDisplay Display;
+#else
+#include <MatrixController.h>
+typedef MatrixController Display;
+#endif
+
+#endif
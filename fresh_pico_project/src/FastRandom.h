@@ -0,0 +1,98 @@
+#ifndef FAST_RANDOM_H
+#define FAST_RANDOM_H
+
+#include <stdint.h>
+
+// Random numbers for the automata: a xorshift32 generator with the same
+// calling conventions as Arduino's random(), in its place.
+//
+// Arduino's random() goes through the C library's rand() and a division on
+// every call, and its sequence depends on the core and libc, so a seed
+// doesn't give the same automaton on the Pico and in the host benchmark.
+// This is three shifts and XORs per number, ranges are scaled with a
+// multiply instead of a modulo, and a seed means the same sequence
+// everywhere.
+
+// Generator state, shared by everything that draws from it
+inline uint32_t& fastRandomState() {
+    static uint32_t state = 2463534242UL;
+    return state;
+}
+
+// Restart the sequence. The seed is mixed first so that nearby seeds (1, 2,
+// 3, ...) don't start out alike; any value, 0 included, is fine.
+inline void fastRandomSeed(uint32_t seed) {
+    uint32_t z = seed + 0x9E3779B9UL;
+    z = (z ^ (z >> 16)) * 0x85EBCA6BUL;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35UL;
+    z ^= z >> 16;
+    fastRandomState() = z ? z : 2463534242UL; // xorshift never leaves 0
+}
+
+// 32 random bits
+inline uint32_t fastRandom() {
+    uint32_t x = fastRandomState();
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    fastRandomState() = x;
+    return x;
+}
+
+// 0 .. howbig - 1 (0 if howbig is 0), like random(howbig)
+inline int32_t fastRandom(uint32_t howbig) {
+    return (int32_t)(((uint64_t)fastRandom() * howbig) >> 32);
+}
+
+// howsmall .. howbig - 1 (howsmall if the range is empty), like
+// random(howsmall, howbig)
+inline int32_t fastRandom(int32_t howsmall, int32_t howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return howsmall + fastRandom((uint32_t)(howbig - howsmall));
+}
+
+// 32 random bits, each set with probability percent / 100 (to the nearest
+// 1/256). Each bit of that fraction in 1/256ths, from the lowest set one
+// up, ORs in a random word for a 1 or ANDs one in for a 0, halving the odds
+// so far and adding the bit: at most 8 words for 32 cells, 1 for 50%.
+inline uint32_t fastRandomBits(uint8_t percent) {
+    if (percent == 0) return 0;
+    if (percent >= 100) return 0xFFFFFFFFUL;
+    uint8_t p = (percent * 256 + 50) / 100;
+    uint8_t n = 8;
+    while (!(p & 1)) {
+        p >>= 1;
+        n--;
+    }
+    uint32_t bits = 0;
+    for (; n > 0; n--, p >>= 1) {
+        bits = (p & 1) ? (bits | fastRandom()) : (bits & fastRandom());
+    }
+    return bits;
+}
+
+// Fill count cells of a bit-packed row (cell x is bit x & 31 of word x >> 5)
+// at random, each alive with probability percent / 100. Bits past count in
+// the last word are cleared.
+inline void fastRandomRowBits(uint32_t* row, uint16_t count, uint8_t percent) {
+    uint16_t words = count >> 5;
+    for (uint16_t w = 0; w < words; w++) {
+        row[w] = fastRandomBits(percent);
+    }
+    if (count & 31) {
+        row[words] = fastRandomBits(percent) & ((1UL << (count & 31)) - 1);
+    }
+}
+
+// Same for a row of one byte per cell, 1 alive and 0 not
+inline void fastRandomRowBytes(uint8_t* row, uint16_t count, uint8_t percent) {
+    for (uint16_t x = 0; x < count; x += 32) {
+        uint32_t bits = fastRandomBits(percent);
+        uint16_t n = count - x < 32 ? count - x : 32;
+        for (uint16_t i = 0; i < n; i++) {
+            row[x + i] = (bits >> i) & 1;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef FIXED_MATH_H
+#define FIXED_MATH_H
+
+#include <stdint.h>
+
+// Integer stand-ins for the float math used to set up patterns and palettes.
+// The RP2040 has no FPU, so sqrt(), atan2() and float arithmetic all go
+// through soft-float routines costing hundreds of cycles each; these need a
+// handful of integer operations instead.
+//
+// Fractions are fixed point: Q0.8 for 0..1 in a byte (255 = 1), and angles
+// as Q0.16 turns (65536 = 360 degrees).
+
+// Clamp to 0..255
+inline uint8_t clampByte(int32_t v) {
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+// Integer square root: floor(sqrt(v))
+inline uint16_t isqrt(uint32_t v) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// Angle of (x, y) from the positive x axis in the same sense as atan2(y, x),
+// in Q0.16 turns: 0..65535. Accurate to about a quarter of a degree, plenty
+// for laying out patterns. Components must fit in 16 bits.
+inline uint16_t atan2Turns(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return 0;
+
+    uint32_t ax = x < 0 ? -x : x;
+    uint32_t ay = y < 0 ? -y : y;
+
+    // Ratio of the smaller to the larger component, Q0.16 in 0..1, folds
+    // the angle into the first octant
+    bool steep = ay > ax;
+    uint32_t r = steep ? (ax << 16) / ay : (ay << 16) / ax;
+
+    // atan(r) / 2pi ~= r / 8 + 0.0435 r (1 - r) on 0..1 (Q0.16 turns)
+    uint32_t arc = (r >> 3) + ((((r >> 8) * ((65536 - r) >> 8)) * 2847) >> 16);
+
+    // Unfold to the full circle
+    if (steep) arc = 16384 - arc;
+    if (x < 0) arc = 32768 - arc;
+    if (y < 0) arc = 65536 - arc;
+    return arc & 0xFFFF;
+}
+
+#endif // FIXED_MATH_H
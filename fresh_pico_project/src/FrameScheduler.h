@@ -0,0 +1,132 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+#include "SerialLog.h"
+
+// Consecutive late frames before the target rate is lowered
+#define FRAME_DROP_AFTER_MISSES 8
+
+// Consecutive frames with spare time before the rate is raised again
+#define FRAME_RECOVER_AFTER 120
+
+// How often missed deadlines are logged (milliseconds)
+#define FRAME_REPORT_INTERVAL 5000
+
+// Frame-deadline scheduler
+// Call endFrame() once per frame. It sleeps only for whatever is left of the
+// frame period after the work already done, so light and heavy automata run
+// at the same rate. If an automaton keeps missing the deadline the period is
+// stretched (down to maxPeriodMs), and it is tightened again once the work
+// fits comfortably.
+class FrameScheduler {
+public:
+    FrameScheduler(uint16_t targetPeriodMs, uint16_t maxPeriodMs)
+        : targetPeriod(targetPeriodMs * 1000UL), maxPeriod(maxPeriodMs * 1000UL) {
+        reset();
+    }
+
+    // Start over at the target rate, e.g. when a new automaton is selected
+    void reset() {
+        period = targetPeriod;
+        frameStart = micros();
+        missStreak = 0;
+        spareStreak = 0;
+        windowFrames = 0;
+        windowMissed = 0;
+        windowStart = millis();
+    }
+
+    // Finish the current frame: sleep off the rest of the period, adapt the
+    // rate and report missed deadlines
+    void endFrame() {
+        uint32_t elapsed = micros() - frameStart;
+        windowFrames++;
+
+        if (elapsed < period) {
+            uint32_t remaining = period - elapsed;
+            if (remaining >= 1000) delay(remaining / 1000);
+            delayMicroseconds(remaining % 1000);
+
+            // Stay phase-locked to the frame grid while on time
+            frameStart += period;
+            missStreak = 0;
+
+            // Raise the rate again once the work would fit a shorter period
+            if (period > targetPeriod && elapsed < period - period / 4) {
+                if (++spareStreak >= FRAME_RECOVER_AFTER) {
+                    setPeriod(max(targetPeriod, period * 4 / 5));
+                }
+            } else {
+                spareStreak = 0;
+            }
+        } else {
+            // Late: start the next frame now instead of trying to catch up
+            frameStart = micros();
+            windowMissed++;
+            spareStreak = 0;
+
+            if (++missStreak >= FRAME_DROP_AFTER_MISSES && period < maxPeriod) {
+                setPeriod(min(maxPeriod, period * 5 / 4));
+            }
+        }
+
+        report();
+    }
+
+    // Current frame period in microseconds
+    uint32_t getPeriod() const {
+        return period;
+    }
+
+    // Aim for a different frame period from now on (the slowest fallback
+    // stretches to it if need be)
+    void setTargetPeriod(uint16_t targetPeriodMs) {
+        targetPeriod = targetPeriodMs * 1000UL;
+        if (maxPeriod < targetPeriod) maxPeriod = targetPeriod;
+        reset();
+    }
+
+private:
+    void setPeriod(uint32_t newPeriod) {
+        period = newPeriod;
+        missStreak = 0;
+        spareStreak = 0;
+
+        Print& out = logOut();
+        out.print("Frame period now ");
+        out.print(period / 1000.0f, 1);
+        out.println(" ms");
+    }
+
+    void report() {
+        if (millis() - windowStart < FRAME_REPORT_INTERVAL) return;
+
+        if (windowMissed > 0) {
+            Print& out = logOut();
+            out.print("Missed ");
+            out.print(windowMissed);
+            out.print(" of ");
+            out.print(windowFrames);
+            out.print(" frame deadlines (");
+            out.print(period / 1000.0f, 1);
+            out.println(" ms period)");
+        }
+
+        windowFrames = 0;
+        windowMissed = 0;
+        windowStart = millis();
+    }
+
+    uint32_t targetPeriod;  // Requested frame period (us)
+    uint32_t maxPeriod;     // Slowest period we will drop to (us)
+    uint32_t period;        // Current frame period (us)
+    uint32_t frameStart;    // micros() at the start of this frame
+    uint8_t missStreak;     // Consecutive late frames
+    uint8_t spareStreak;    // Consecutive frames with time to spare
+    uint32_t windowFrames;  // Frames in the current report window
+    uint32_t windowMissed;  // Late frames in the current report window
+    uint32_t windowStart;   // millis() at the start of the report window
+};
+
+#endif
@@ -0,0 +1,315 @@
+#ifndef FRAME_STREAM_H
+#define FRAME_STREAM_H
+
+#include <Arduino.h>
+#include <MatrixController.h>
+
+// Receive ring (bytes, a power of two): holds what arrives over USB while a
+// decoded frame waits for the panel to take the previous one
+#define STREAM_RING_BYTES 8192
+
+// Streaming stops counting as active this long after the last frame (ms)
+#define STREAM_TIMEOUT 1000
+
+// Frame header: 'F' 'S', a type byte, then width and height as 16-bit
+// little-endian values
+#define STREAM_RAW 'R'       // width * height RGB565 pixels, little-endian
+#define STREAM_INDEXED 'P'   // Palette size (0 = 256), that many RGB565
+                             // colors, then one index byte per pixel
+#define STREAM_DELTA 'D'     // Changes to the previous frame, see below
+
+// A delta frame is a rectangle count byte, then for each rectangle its x,
+// y, width and height (16-bit little-endian) and runs covering its pixels
+// in raster order, rows running on into the next. Each run is a control
+// byte c and XORs the previous frame's pixels:
+//   0x00-0x7F  leave c + 1 pixels alone
+//   0x80-0xBF  (c & 0x3F) + 1 XOR words follow, one per pixel
+//   0xC0-0xFF  one XOR word follows, applied to (c & 0x3F) + 1 pixels
+// The first frame, and the first after one was lost, must be a raw or
+// indexed key frame; deltas until the next key frame are skipped.
+
+// Frames pushed by a host over a serial port (USB CDC) straight into the
+// display canvas
+// poll() moves whatever the port has into a receive ring and decodes from
+// there into the canvas as it goes, so no frame-sized buffer is needed.
+// Delta frames XOR the canvas in place, which still holds the frame before
+// them. When a frame is complete it is shown with tryShow(); while the
+// panel hasn't taken the previous one yet, decoding waits but receiving
+// carries on into the ring, so the transfer overlaps the display. Frames
+// of another size are clipped to the display, bytes outside a frame are
+// skipped until the next header, and a frame the host stops sending
+// halfway is dropped after STREAM_TIMEOUT, so a host can start and stop at
+// any time (see tools/stream_frames.py).
+class FrameStream {
+public:
+    FrameStream(MatrixController& display, Stream& port)
+        : display(display), port(port), head(0), tail(0), state(SYNC),
+          pendingShow(false), started(false), haveBase(false), shown(0),
+          skipped(0) {}
+
+    // Receive, decode and show what has come in. Returns active().
+    bool poll() {
+        receive();
+        if (state != SYNC && millis() - lastData > STREAM_TIMEOUT) {
+            state = SYNC; // The host gave up mid-frame
+            haveBase = false;
+        }
+        if (pendingShow) present();
+        if (!pendingShow) {
+            decode();
+            if (pendingShow) present();
+            receive(); // Decoding made room
+        }
+        return active();
+    }
+
+    // Whether a host is streaming: inside a frame, or one began or ended
+    // less than STREAM_TIMEOUT ago
+    bool active() const {
+        return started && (state != SYNC || millis() - lastFrame < STREAM_TIMEOUT);
+    }
+
+    // Frames shown since the last call
+    uint32_t takeFrameCount() {
+        uint32_t n = shown;
+        shown = 0;
+        return n;
+    }
+
+    // Delta frames skipped for want of a key frame since the last call
+    uint32_t takeSkippedCount() {
+        uint32_t n = skipped;
+        skipped = 0;
+        return n;
+    }
+
+private:
+    enum State { SYNC, MAGIC, TYPE, SIZE, PALETTE_SIZE, PALETTE, PIXELS,
+                 RECT_COUNT, RECT, RUN, RUN_WORD };
+
+    static const uint16_t RING_MASK = STREAM_RING_BYTES - 1;
+
+    // Copy what the port has into the ring, up to its free space
+    void receive() {
+        int available;
+        while ((available = port.available()) > 0) {
+            uint16_t used = (head - tail) & RING_MASK;
+            uint16_t space = RING_MASK - used;
+            if (space == 0) return;
+            uint16_t n = STREAM_RING_BYTES - head; // Contiguous up to the wrap
+            if (n > space) n = space;
+            if (n > (uint16_t)available) n = available;
+            port.readBytes(&ring[head], n);
+            head = (head + n) & RING_MASK;
+            lastData = millis();
+        }
+    }
+
+    void present() {
+        if (!display.tryShow()) return;
+        pendingShow = false;
+        shown++;
+    }
+
+    // Run the ring through the header / pixel state machine until it is
+    // empty or a frame is complete
+    void decode() {
+        while (tail != head && !pendingShow) {
+            uint8_t b = ring[tail];
+            tail = (tail + 1) & RING_MASK;
+
+            switch (state) {
+                case SYNC:
+                    if (b == 'F') state = MAGIC;
+                    break;
+                case MAGIC:
+                    state = (b == 'S') ? TYPE : (b == 'F') ? MAGIC : SYNC;
+                    break;
+                case TYPE:
+                    type = b;
+                    count = 0;
+                    state = (b == STREAM_RAW || b == STREAM_INDEXED || b == STREAM_DELTA) ? SIZE : SYNC;
+                    break;
+                case SIZE:
+                    header[count++] = b;
+                    if (count == 4) beginFrame();
+                    break;
+                case PALETTE_SIZE:
+                    paletteBytes = (b ? b : 256) * 2;
+                    count = 0;
+                    state = PALETTE;
+                    break;
+                case PALETTE:
+                    ((uint8_t*)palette)[count++] = b; // Little-endian, as the RP2040
+                    if (count == paletteBytes) state = PIXELS;
+                    break;
+                case PIXELS:
+                    if (type == STREAM_INDEXED) {
+                        pixel(palette[b]);
+                    } else if (lowHalf) {
+                        lowHalf = false;
+                        pixel(low | (b << 8));
+                    } else {
+                        low = b;
+                        lowHalf = true;
+                    }
+                    break;
+                case RECT_COUNT:
+                    rectsLeft = b;
+                    nextRect();
+                    break;
+                case RECT:
+                    header[count++] = b;
+                    if (count == 8) beginRect();
+                    break;
+                case RUN:
+                    if (b < 0x80) {
+                        // Unchanged pixels: step over them, stopping early if
+                        // the rectangle ends
+                        for (uint8_t n = b + 1; n > 0 && state == RUN; n--) advance();
+                    } else {
+                        run = (b & 0x3F) + 1;
+                        literal = b < 0xC0;
+                        state = RUN_WORD;
+                    }
+                    break;
+                case RUN_WORD:
+                    if (!lowHalf) {
+                        low = b;
+                        lowHalf = true;
+                        break;
+                    }
+                    lowHalf = false;
+                    if (literal) {
+                        // One word per pixel of the run
+                        xorPixel(low | (b << 8));
+                        if (--run > 0) break;
+                    } else {
+                        uint16_t bits = low | (b << 8);
+                        for (; run > 0 && state == RUN_WORD; run--) xorPixel(bits);
+                    }
+                    if (state == RUN_WORD) state = RUN;
+                    break;
+            }
+        }
+    }
+
+    void beginFrame() {
+        frameWidth = header[0] | (header[1] << 8);
+        frameHeight = header[2] | (header[3] << 8);
+        if (frameWidth == 0 || frameHeight == 0) {
+            state = SYNC;
+            return;
+        }
+        // After a pause the canvas has moved on: deltas need a new key frame
+        if (!started || millis() - lastFrame >= STREAM_TIMEOUT) haveBase = false;
+        lowHalf = false;
+        started = true;
+        lastFrame = millis();
+        display.setTarget(NULL); // A cross-fade may have it drawing offscreen
+
+        if (type == STREAM_DELTA) {
+            state = RECT_COUNT;
+            return;
+        }
+        // A key frame is one rectangle covering the frame
+        rectX = 0;
+        rectY = 0;
+        rectRight = frameWidth;
+        rectBottom = frameHeight;
+        rectsLeft = 0;
+        x = 0;
+        y = 0;
+        state = (type == STREAM_INDEXED) ? PALETTE_SIZE : PIXELS;
+    }
+
+    void beginRect() {
+        rectX = header[0] | (header[1] << 8);
+        rectY = header[2] | (header[3] << 8);
+        rectRight = rectX + (header[4] | (header[5] << 8));
+        rectBottom = rectY + (header[6] | (header[7] << 8));
+        if (rectRight == rectX || rectBottom == rectY) {
+            nextRect();
+            return;
+        }
+        x = rectX;
+        y = rectY;
+        state = RUN;
+    }
+
+    // On to the next rectangle of a delta frame, or the end of the frame
+    void nextRect() {
+        if (rectsLeft == 0) {
+            endFrame();
+            return;
+        }
+        rectsLeft--;
+        count = 0;
+        state = RECT;
+    }
+
+    void endFrame() {
+        state = SYNC;
+        lastFrame = millis();
+        if (type != STREAM_DELTA) {
+            haveBase = true;
+        } else if (!haveBase) {
+            skipped++;
+            return;
+        }
+        pendingShow = true;
+    }
+
+    // Step to the next pixel of the rectangle (for a key frame, of the frame)
+    void advance() {
+        if (++x < rectRight) return;
+        x = rectX;
+        if (++y < rectBottom) return;
+        nextRect();
+    }
+
+    // Store the next pixel of a key frame (drawMappedPixel() clips it)
+    void pixel(uint16_t color) {
+        display.drawMappedPixel(x, y, color);
+        advance();
+    }
+
+    // Apply the next XOR word of a delta frame, if there is a frame under it
+    void xorPixel(uint16_t bits) {
+        if (haveBase) display.xorMappedPixel(x, y, bits);
+        advance();
+    }
+
+    MatrixController& display;
+    Stream& port;
+
+    uint8_t ring[STREAM_RING_BYTES];
+    uint16_t head;            // Next byte received goes here
+    uint16_t tail;            // Next byte to decode
+
+    State state;
+    uint8_t type;             // STREAM_RAW, STREAM_INDEXED or STREAM_DELTA
+    uint8_t header[8];        // Frame size or a rectangle as they arrive
+    uint16_t count;           // Bytes of header or palette so far
+    uint16_t paletteBytes;
+    uint16_t palette[256];
+    uint16_t frameWidth, frameHeight;
+    uint16_t rectX, rectY;    // Rectangle being written, and its far edges
+    uint16_t rectRight, rectBottom;
+    uint8_t rectsLeft;        // Rectangles of the frame after this one
+    uint16_t x, y;            // Next pixel of the rectangle
+    uint8_t run;              // Pixels left in a delta run
+    bool literal;             // The run has a word per pixel
+    uint8_t low;              // First byte of a 16-bit word
+    bool lowHalf;             // low holds half a word
+
+    bool pendingShow;         // A complete frame waits for tryShow()
+    bool started;             // A frame header has been seen
+    bool haveBase;            // The canvas holds the last frame, for deltas
+    uint32_t lastFrame;       // millis() at the last frame start or end
+    uint32_t lastData;        // millis() when bytes last arrived
+    uint32_t shown;
+    uint32_t skipped;
+};
+
+#endif
@@ -0,0 +1,373 @@
+#ifndef HASHLIFE_H
+#define HASHLIFE_H
+
+#include <Arduino.h>
+#include "Arena.h"
+
+// Nodes in the Hashlife cache (14 bytes each). Sized so the cache, the
+// canvas and the Protomatter buffers fit in the RP2040's 264 KB of SRAM.
+#define HASHLIFE_MAX_NODES 5120
+
+// Hash buckets for the node cache (power of two)
+#define HASHLIFE_HASH_SIZE 4096
+
+/**
+ * Next state of 32 Life-like cells at once
+ *
+ * n0..n7 hold the eight neighbors of each cell (bit x of every plane belongs
+ * to cell x). They are summed in parallel by a full-adder tree into four
+ * count planes (ones, twos, fours, eights), which are then matched against
+ * the Bx/Sy rule masks (bit n set = n neighbors).
+ */
+inline uint32_t lifeNext(uint32_t n0, uint32_t n1, uint32_t n2, uint32_t n3,
+                         uint32_t n4, uint32_t n5, uint32_t n6, uint32_t n7,
+                         uint32_t alive, uint16_t birthRules, uint16_t survivalRules) {
+    // First layer: two full adders and a half adder
+    uint32_t s1 = n0 ^ n1 ^ n2;
+    uint32_t c1 = (n0 & n1) | (n2 & (n0 ^ n1));
+    uint32_t s2 = n3 ^ n4 ^ n5;
+    uint32_t c2 = (n3 & n4) | (n5 & (n3 ^ n4));
+    uint32_t s3 = n6 ^ n7;
+    uint32_t c3 = n6 & n7;
+
+    // Ones bit, plus a fourth carry of weight two
+    uint32_t ones = s1 ^ s2 ^ s3;
+    uint32_t c4 = (s1 & s2) | (s3 & (s1 ^ s2));
+
+    // Sum the four weight-two carries
+    uint32_t t = c1 ^ c2 ^ c3;
+    uint32_t c5 = (c1 & c2) | (c3 & (c1 ^ c2));
+    uint32_t twos = t ^ c4;
+    uint32_t c6 = t & c4;
+    uint32_t fours = c5 ^ c6;
+    uint32_t eights = c5 & c6;
+
+    // Collect the lanes whose count is in the birth/survival sets
+    uint32_t born = 0;
+    uint32_t stay = 0;
+    for (uint8_t n = 0; n <= 8; n++) {
+        uint16_t bit = 1 << n;
+        if (!((birthRules | survivalRules) & bit)) continue;
+
+        uint32_t eq = ((n & 1) ? ones : ~ones) & ((n & 2) ? twos : ~twos) &
+                      ((n & 4) ? fours : ~fours) & ((n & 8) ? eights : ~eights);
+        if (birthRules & bit) born |= eq;
+        if (survivalRules & bit) stay |= eq;
+    }
+
+    return (alive & stay) | (~alive & born);
+}
+
+/**
+ * Memoized quadtree (Hashlife) engine for a square, wrap-around Life grid
+ *
+ * The grid is stored as a quadtree of hash-consed nodes: identical blocks
+ * anywhere on the grid, and in any earlier generation, share one node. Each
+ * node remembers its own next generation, so still lifes, oscillators and
+ * other repeating regions are looked up instead of recomputed, and only the
+ * leaves that actually changed are written back to the caller's bitmap.
+ *
+ * Nodes of level 3 are 8x8 leaves holding their cells directly; a node of
+ * level k > 3 covers 2^k x 2^k cells with four level k-1 children. The
+ * cache never frees individual nodes. When it fills up step() fails, and
+ * the caller falls back to its dense kernel and reloads later.
+ */
+class Hashlife {
+public:
+    // size must be a power of two between 32 and 128 (see supports()). The
+    // node cache is taken from arena and lives as long as it does.
+    Hashlife(uint16_t size, Arena& arena) : levels(0) {
+        while ((1 << levels) < size) levels++;
+        nodes = arena.allocate<Node>(HASHLIFE_MAX_NODES);
+        buckets = arena.allocate<uint16_t>(HASHLIFE_HASH_SIZE);
+        birthRules = 0;
+        survivalRules = 0;
+        clear();
+    }
+
+    Hashlife(const Hashlife&) = delete;
+    Hashlife& operator=(const Hashlife&) = delete;
+
+    // Arena bytes taken by the node cache
+    static constexpr uint32_t storageBytes() {
+        return HASHLIFE_MAX_NODES * sizeof(Node) + HASHLIFE_HASH_SIZE * sizeof(uint16_t) + 2 * ARENA_ALIGN;
+    }
+
+    // Whether a width x height grid can be run by this engine
+    static bool supports(uint16_t width, uint16_t height) {
+        return width == height && width >= 32 && width <= 128 && (width & (width - 1)) == 0;
+    }
+
+    // Rule masks as in GameOfLife (bit n set = n neighbors)
+    void setRules(uint16_t birth, uint16_t survival) {
+        birthRules = birth;
+        survivalRules = survival;
+    }
+
+    // Drop the cache and rebuild the grid from a bit-packed bitmap (bit x & 31
+    // of word x >> 5 in each row, wordsPerRow words per row)
+    bool load(const uint32_t* bits, uint16_t wordsPerRow) {
+        clear();
+        root = build(levels, 0, 0, bits, wordsPerRow);
+        return !overflowed;
+    }
+
+    // Advance the grid one generation. Returns false if the cache overflowed,
+    // in which case the grid is lost and must be reload()ed.
+    bool step() {
+        if (overflowed) return false;
+
+        // Rotating the grid by half its size just reorders the quadrants.
+        // Four copies of the rotated grid form a node twice the size whose
+        // centre is the original grid with a full wrap-around border, and
+        // the result of that node is exactly the next wrapped generation.
+        const Node& n = nodes[root];
+        uint16_t rotated = make(levels, n.child[3], n.child[2], n.child[1], n.child[0]);
+        uint16_t outer = make(levels + 1, rotated, rotated, rotated, rotated);
+        uint16_t next = result(outer, levels + 1);
+        if (overflowed) return false;
+
+        root = next;
+        steps++;
+        return true;
+    }
+
+    // Write the current generation into the bitmap that holds the one
+    // stored (or loaded) last, however many step()s ago, skipping every
+    // block that did not change since. changed(x, y, before, after) is
+    // called for each 8-cell run (x a multiple of 8) that was rewritten,
+    // with its cells before and after (bit i is cell x + i).
+    template <typename OnChange>
+    void store(uint32_t* bits, uint16_t wordsPerRow, OnChange changed) {
+        storeNode(root, previous, levels, 0, 0, bits, wordsPerRow, changed);
+        previous = root;
+    }
+
+    // Generations advanced since the last load()
+    uint32_t getSteps() const {
+        return steps;
+    }
+
+    // Nodes currently in the cache
+    uint16_t getNodeCount() const {
+        return nodeCount;
+    }
+
+private:
+    // Four child indices, or for a leaf its 8x8 cells (bit 8 * y + x)
+    struct Node {
+        uint16_t child[4];  // nw, ne, sw, se
+        uint16_t next;      // Next node in the same hash bucket
+        uint16_t result;    // Centre half one generation on, or NIL
+        uint8_t level;
+    };
+
+    static const uint16_t NIL = 0;
+
+    Node* nodes;
+    uint16_t* buckets;
+    uint16_t nodeCount;      // Slots in use, including NIL
+    bool overflowed;         // The cache ran out during load() or step()
+    uint8_t levels;          // log2 of the grid size
+    uint16_t root;           // Current generation
+    uint16_t previous;       // Generation the bitmap holds (NIL after load())
+    uint32_t steps;          // Generations since load()
+    uint16_t birthRules;
+    uint16_t survivalRules;
+
+    void clear() {
+        memset(buckets, 0, HASHLIFE_HASH_SIZE * sizeof(uint16_t));
+        memset(&nodes[NIL], 0, sizeof(Node));
+        nodeCount = 1;
+        overflowed = false;
+        root = NIL;
+        previous = NIL;
+        steps = 0;
+    }
+
+    // Find or create the node with these children (or leaf cells)
+    uint16_t make(uint8_t level, uint16_t nw, uint16_t ne, uint16_t sw, uint16_t se) {
+        uint32_t h = (nw * 0x9E37U) ^ (ne * 0x85EBU) ^ (sw * 0xC2B3U) ^ (se * 0x27D5U) ^ (level * 0x1657U);
+        h = (h ^ (h >> 13)) & (HASHLIFE_HASH_SIZE - 1);
+
+        for (uint16_t i = buckets[h]; i != NIL; i = nodes[i].next) {
+            const Node& n = nodes[i];
+            if (n.level == level && n.child[0] == nw && n.child[1] == ne &&
+                n.child[2] == sw && n.child[3] == se) {
+                return i;
+            }
+        }
+
+        if (nodeCount >= HASHLIFE_MAX_NODES) {
+            overflowed = true;
+            return NIL;
+        }
+
+        uint16_t i = nodeCount++;
+        Node& n = nodes[i];
+        n.child[0] = nw;
+        n.child[1] = ne;
+        n.child[2] = sw;
+        n.child[3] = se;
+        n.level = level;
+        n.result = NIL;
+        n.next = buckets[h];
+        buckets[h] = i;
+        return i;
+    }
+
+    uint16_t makeLeaf(uint64_t cells) {
+        return make(3, cells, cells >> 16, cells >> 32, cells >> 48);
+    }
+
+    uint64_t leafCells(uint16_t i) const {
+        const uint16_t* c = nodes[i].child;
+        return (uint64_t)c[0] | ((uint64_t)c[1] << 16) | ((uint64_t)c[2] << 32) | ((uint64_t)c[3] << 48);
+    }
+
+    // One 8-cell row of a leaf
+    uint8_t leafRow(uint16_t i, uint8_t y) const {
+        return nodes[i].child[y >> 1] >> ((y & 1) * 8);
+    }
+
+    // Centre leaf of four leaves laid out as a 16x16 block
+    uint16_t centreLeaf(uint16_t nw, uint16_t ne, uint16_t sw, uint16_t se) {
+        uint64_t cells = 0;
+        for (uint8_t y = 0; y < 8; y++) {
+            uint8_t sy = (y + 4) & 7;
+            uint16_t left = (y < 4) ? nw : sw;
+            uint16_t right = (y < 4) ? ne : se;
+            uint8_t row = (leafRow(left, sy) >> 4) | (leafRow(right, sy) << 4);
+            cells |= (uint64_t)row << (8 * y);
+        }
+        return makeLeaf(cells);
+    }
+
+    // Centre half of a level-k node made of four level-k nodes, as a node
+    // of level k
+    uint16_t centre(uint8_t level, uint16_t nw, uint16_t ne, uint16_t sw, uint16_t se) {
+        if (level == 3) return centreLeaf(nw, ne, sw, se);
+        return make(level, nodes[nw].child[3], nodes[ne].child[2], nodes[sw].child[1], nodes[se].child[0]);
+    }
+
+    // Centre half of node i (level >= 4) one generation on, memoized
+    uint16_t result(uint16_t i, uint8_t level) {
+        if (overflowed) return NIL;
+        if (nodes[i].result != NIL) return nodes[i].result;
+
+        uint16_t r;
+        if (level == 4) {
+            r = baseResult(i);
+        } else {
+            uint16_t nw = nodes[i].child[0], ne = nodes[i].child[1];
+            uint16_t sw = nodes[i].child[2], se = nodes[i].child[3];
+            const uint16_t* a = nodes[nw].child;
+            const uint16_t* b = nodes[ne].child;
+            const uint16_t* c = nodes[sw].child;
+            const uint16_t* d = nodes[se].child;
+            uint8_t sub = level - 1;
+
+            // Nine overlapping sub-squares of half the size, stepped one
+            // generation each (results are a quarter of the size)
+            uint16_t n01 = make(sub, a[1], b[0], a[3], b[2]);
+            uint16_t n10 = make(sub, a[2], a[3], c[0], c[1]);
+            uint16_t n11 = make(sub, a[3], b[2], c[1], d[0]);
+            uint16_t n12 = make(sub, b[2], b[3], d[0], d[1]);
+            uint16_t n21 = make(sub, c[1], d[0], c[3], d[2]);
+
+            uint16_t r00 = result(nw, sub);
+            uint16_t r01 = result(n01, sub);
+            uint16_t r02 = result(ne, sub);
+            uint16_t r10 = result(n10, sub);
+            uint16_t r11 = result(n11, sub);
+            uint16_t r12 = result(n12, sub);
+            uint16_t r20 = result(sw, sub);
+            uint16_t r21 = result(n21, sub);
+            uint16_t r22 = result(se, sub);
+            if (overflowed) return NIL;
+
+            // Stitch the centres of each 2x2 group into the result
+            uint8_t part = level - 2;
+            r = make(sub,
+                     centre(part, r00, r01, r10, r11),
+                     centre(part, r01, r02, r11, r12),
+                     centre(part, r10, r11, r20, r21),
+                     centre(part, r11, r12, r21, r22));
+        }
+
+        if (overflowed) return NIL;
+        nodes[i].result = r;
+        return r;
+    }
+
+    // Level-4 node (four leaves, 16x16) to its centre leaf one generation on
+    uint16_t baseResult(uint16_t i) {
+        const uint16_t* q = nodes[i].child;
+        uint32_t rows[16];
+        for (uint8_t y = 0; y < 8; y++) {
+            rows[y] = leafRow(q[0], y) | (leafRow(q[1], y) << 8);
+            rows[y + 8] = leafRow(q[2], y) | (leafRow(q[3], y) << 8);
+        }
+
+        uint64_t cells = 0;
+        for (uint8_t y = 4; y < 12; y++) {
+            uint32_t up = rows[y - 1];
+            uint32_t mid = rows[y];
+            uint32_t down = rows[y + 1];
+            uint32_t next = lifeNext(up << 1, up, up >> 1, mid << 1, mid >> 1,
+                                     down << 1, down, down >> 1,
+                                     mid, birthRules, survivalRules);
+            cells |= (uint64_t)((next >> 4) & 0xFF) << (8 * (y - 4));
+        }
+        return makeLeaf(cells);
+    }
+
+    // Quadtree for the size x size block of the bitmap at (x, y)
+    uint16_t build(uint8_t level, uint16_t x, uint16_t y, const uint32_t* bits, uint16_t wordsPerRow) {
+        if (level == 3) {
+            uint64_t cells = 0;
+            for (uint8_t r = 0; r < 8; r++) {
+                uint8_t row = bits[(uint32_t)(y + r) * wordsPerRow + (x >> 5)] >> (x & 31);
+                cells |= (uint64_t)row << (8 * r);
+            }
+            return makeLeaf(cells);
+        }
+
+        uint16_t half = 1 << (level - 1);
+        uint16_t nw = build(level - 1, x, y, bits, wordsPerRow);
+        uint16_t ne = build(level - 1, x + half, y, bits, wordsPerRow);
+        uint16_t sw = build(level - 1, x, y + half, bits, wordsPerRow);
+        uint16_t se = build(level - 1, x + half, y + half, bits, wordsPerRow);
+        return make(level, nw, ne, sw, se);
+    }
+
+    template <typename OnChange>
+    void storeNode(uint16_t i, uint16_t old, uint8_t level, uint16_t x, uint16_t y,
+                   uint32_t* bits, uint16_t wordsPerRow, OnChange& changed) const {
+        if (i == old) return;
+
+        if (level == 3) {
+            for (uint8_t r = 0; r < 8; r++) {
+                uint32_t& word = bits[(uint32_t)(y + r) * wordsPerRow + (x >> 5)];
+                uint32_t row = (uint32_t)leafRow(i, r) << (x & 31);
+                uint32_t mask = (uint32_t)0xFF << (x & 31);
+                if ((word & mask) != row) {
+                    uint8_t before = (word & mask) >> (x & 31);
+                    word = (word & ~mask) | row;
+                    changed(x, y + r, before, (uint8_t)(row >> (x & 31)));
+                }
+            }
+            return;
+        }
+
+        uint16_t half = 1 << (level - 1);
+        const uint16_t* c = nodes[i].child;
+        const uint16_t* o = nodes[old].child;
+        storeNode(c[0], o[0], level - 1, x, y, bits, wordsPerRow, changed);
+        storeNode(c[1], o[1], level - 1, x + half, y, bits, wordsPerRow, changed);
+        storeNode(c[2], o[2], level - 1, x, y + half, bits, wordsPerRow, changed);
+        storeNode(c[3], o[3], level - 1, x + half, y + half, bits, wordsPerRow, changed);
+    }
+};
+
+#endif
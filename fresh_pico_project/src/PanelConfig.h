@@ -12,22 +12,66 @@
 #define PANEL_HEIGHT 64
 #endif
 
+// Panels across and down the wall. Logical panel n is the one in column
+// n % PANEL_COLUMNS of row n / PANEL_COLUMNS, counted from the top left.
+#ifndef PANEL_COLUMNS
+#define PANEL_COLUMNS 2
+#endif
+
+#ifndef PANEL_ROWS
+#define PANEL_ROWS 2
+#endif
+
 #ifndef PANEL_COUNT
-#define PANEL_COUNT 4
+#define PANEL_COUNT (PANEL_COLUMNS * PANEL_ROWS)
+#endif
+
+#define TOTAL_WIDTH (PANEL_WIDTH * PANEL_COLUMNS)
+#define TOTAL_HEIGHT (PANEL_HEIGHT * PANEL_ROWS)
+
+// Number of parallel chains, one per RGB pin group. With 1 every panel sits
+// on a single chain that is folded into tiles; with 2 the rows of panels
+// are split between two chains, so a row takes half as long to shift out.
+#ifndef PANEL_CHAINS
+#define PANEL_CHAINS 1
+#endif
+
+#define PANELS_PER_CHAIN (PANEL_COUNT / PANEL_CHAINS)
+
+// Rows of panels each chain is folded into (Protomatter's tile count)
+#define CHAIN_TILES (PANEL_ROWS / PANEL_CHAINS)
+
+// 1 if every other row of panels along a chain is mounted upside down, so
+// the cable can snake back without a long return run (Protomatter's
+// serpentine tiling). The driver turns those rows round itself: the canvas
+// and PANEL_CONFIGS below still see every row the right way up.
+#ifndef PANEL_SERPENTINE
+#define PANEL_SERPENTINE 0
 #endif
 
-// Assume a 2x2 grid layout by default - modify based on your arrangement
-#define TOTAL_WIDTH (PANEL_WIDTH * 2)
-#define TOTAL_HEIGHT (PANEL_HEIGHT * 2)
+// Tile argument for Protomatter (and Hub75Pio): rows of panels per chain,
+// negative for a serpentine chain
+#define PANEL_TILE_MODE (PANEL_SERPENTINE ? -CHAIN_TILES : CHAIN_TILES)
+
+static_assert(PANEL_COUNT == PANEL_COLUMNS * PANEL_ROWS, "PANEL_COUNT must be PANEL_COLUMNS * PANEL_ROWS");
+static_assert(PANEL_CHAINS == 1 || PANEL_CHAINS == 2, "PANEL_CHAINS must be 1 or 2");
+static_assert(PANEL_ROWS % PANEL_CHAINS == 0, "each parallel chain must cover whole rows of panels");
+static_assert((uint32_t)TOTAL_WIDTH * TOTAL_HEIGHT <= 65536, "PanelMap offsets are 16-bit");
 
 // Panel layout configuration
 // Change these values to match your specific panel arrangement
 typedef struct {
     uint8_t logicalPosition;  // Position in the logical grid (0-3 for a 2x2 grid)
-    uint8_t physicalPosition; // Position in the physical chain (0-3 for 4 panels)
+    uint8_t physicalPosition; // Slot in its chain (0-3 for 4 panels on one chain, 0-1 on two)
     uint8_t rotation;         // 0=normal, 1=90° CW, 2=180°, 3=270° CW
+    uint8_t chain;            // RGB pin group driving the panel (0 unless PANEL_CHAINS > 1)
 } PanelConfig;
 
+// A chain's slots are where Protomatter puts its panels in the canvas:
+// PANEL_COLUMNS to a row, left to right, then the next row down, CHAIN_TILES
+// rows in all. Chain 1's rows follow chain 0's.
+//
+#if PANEL_COLUMNS == 2 && PANEL_ROWS == 2
 // CORRECTED configuration based on observed panel layout in image
 // The logical panel layout (how we want to address them in code):
 //  ┌─────┬─────┐
@@ -51,15 +95,94 @@ typedef struct {
 //  │     │     │
 //  └─────┴─────┘
 //
-// Signal flow: Pico sends signal to TR panel first (Physical position 1),
-// then the chain continues through the other panels.
+// Signal flow: Pico sends signal to TR panel first, then the chain
+// continues through the other panels.
 //
-const PanelConfig PANEL_CONFIGS[PANEL_COUNT] = {
-    {0, 3, 0},  // Logical position 0 (TL) -> Physical position 3 (bottom-left)
-    {1, 1, 0},  // Logical position 1 (TR) -> Physical position 1 (top-right)
-    {2, 2, 0},  // Logical position 2 (BL) -> Physical position 2 (bottom-right)
-    {3, 0, 0}   // Logical position 3 (BR) -> Physical position 0 (top-left)
+#if PANEL_CHAINS == 1
+constexpr PanelConfig PANEL_CONFIGS[PANEL_COUNT] = {
+    {0, 2, 0, 0},  // Logical position 0 (TL) -> Slot 2 (bottom-left)
+    {1, 1, 0, 0},  // Logical position 1 (TR) -> Slot 1 (top-right)
+    {2, 3, 0, 0},  // Logical position 2 (BL) -> Slot 3 (bottom-right)
+    {3, 0, 0, 0}   // Logical position 3 (BR) -> Slot 0 (top-left)
+};
+#else
+// Two chains: the first RGB pin group drives the physical top row, the
+// second the bottom row. Same panels in the same places as above.
+constexpr PanelConfig PANEL_CONFIGS[PANEL_COUNT] = {
+    {0, 0, 0, 1},  // Logical position 0 (TL) -> Chain 1, first panel (bottom-left)
+    {1, 1, 0, 0},  // Logical position 1 (TR) -> Chain 0, second panel (top-right)
+    {2, 1, 0, 1},  // Logical position 2 (BL) -> Chain 1, second panel (bottom-right)
+    {3, 0, 0, 0}   // Logical position 3 (BR) -> Chain 0, first panel (top-left)
 };
+#endif
+#else
+// Any other wall starts out with every panel in the slot where it shows
+// up the right way round, unrotated. Run the panel test pattern and write
+// a table like the 2x2 one above for the panels that land elsewhere.
+struct PanelLayout {
+    PanelConfig panels[PANEL_COUNT];
+};
+
+constexpr PanelLayout straightLayout() {
+    PanelLayout layout = {};
+    for (uint8_t i = 0; i < PANEL_COUNT; i++) {
+        uint8_t row = i / PANEL_COLUMNS;
+        layout.panels[i] = {i, (uint8_t)(row % CHAIN_TILES * PANEL_COLUMNS + i % PANEL_COLUMNS), 0,
+                            (uint8_t)(row / CHAIN_TILES)};
+    }
+    return layout;
+}
+
+constexpr PanelLayout STRAIGHT_LAYOUT = straightLayout();
+constexpr const PanelConfig* PANEL_CONFIGS = STRAIGHT_LAYOUT.panels;
+#endif
+
+// Every logical panel listed once, each in a slot of its own, and quarter
+// turns only on square panels
+constexpr bool validLayout(const PanelConfig* panels) {
+    for (uint8_t i = 0; i < PANEL_COUNT; i++) {
+        const PanelConfig& p = panels[i];
+        if (p.logicalPosition >= PANEL_COUNT || p.physicalPosition >= PANELS_PER_CHAIN ||
+            p.chain >= PANEL_CHAINS || p.rotation > 3) return false;
+        if ((p.rotation & 1) && PANEL_WIDTH != PANEL_HEIGHT) return false;
+        for (uint8_t j = 0; j < i; j++) {
+            if (panels[j].logicalPosition == p.logicalPosition) return false;
+            if (panels[j].chain == p.chain && panels[j].physicalPosition == p.physicalPosition) return false;
+        }
+    }
+    return true;
+}
+
+static_assert(validLayout(PANEL_CONFIGS), "PANEL_CONFIGS must place each panel once, in a slot of its own");
+
+// Canvas position of the top-left corner of a panel's slot
+inline void slotOrigin(const PanelConfig* config, int16_t* x, int16_t* y) {
+    uint8_t row = config->chain * CHAIN_TILES + config->physicalPosition / PANEL_COLUMNS;
+    *x = (config->physicalPosition % PANEL_COLUMNS) * PANEL_WIDTH;
+    *y = row * PANEL_HEIGHT;
+}
+
+// Pixel (x, y) of a panel, as the panel is turned in its slot
+inline void rotatePanelPixel(uint8_t rotation, int16_t x, int16_t y, int16_t* rotated_x, int16_t* rotated_y) {
+    switch (rotation) {
+        case 1:  // 90° clockwise
+            *rotated_x = PANEL_WIDTH - 1 - y;
+            *rotated_y = x;
+            break;
+        case 2:  // 180°
+            *rotated_x = PANEL_WIDTH - 1 - x;
+            *rotated_y = PANEL_HEIGHT - 1 - y;
+            break;
+        case 3:  // 270° clockwise
+            *rotated_x = y;
+            *rotated_y = PANEL_HEIGHT - 1 - x;
+            break;
+        default: // Normal
+            *rotated_x = x;
+            *rotated_y = y;
+            break;
+    }
+}
 
 // Function to map a logical panel number to a physical panel configuration
 inline const PanelConfig* getPanelConfig(uint8_t logicalPanel) {
@@ -74,74 +197,106 @@ inline const PanelConfig* getPanelConfig(uint8_t logicalPanel) {
 
 // Custom mapping function
 inline void mapCoordinates(int16_t x, int16_t y, int16_t* mapped_x, int16_t* mapped_y) {
-    const int16_t PANEL_W = PANEL_WIDTH;
-    const int16_t PANEL_H = PANEL_HEIGHT;
-    
     // Determine which logical panel the coordinates are in
-    // This assumes a 2x2 arrangement
-    int panel_x = x / PANEL_W;
-    int panel_y = y / PANEL_H;
-    
-    // Get the logical panel number (0-3 for a 2x2 grid)
-    int logical_panel = panel_y * 2 + panel_x;
+    int panel_x = x / PANEL_WIDTH;
+    int panel_y = y / PANEL_HEIGHT;
+    int logical_panel = panel_y * PANEL_COLUMNS + panel_x;
     
     // Local coordinates within the panel
-    int local_x = x % PANEL_W;
-    int local_y = y % PANEL_H;
+    int local_x = x % PANEL_WIDTH;
+    int local_y = y % PANEL_HEIGHT;
     
-    // Get panel configuration
+    // Place the panel's pixel in its slot, turned as it is mounted
     const PanelConfig* config = getPanelConfig(logical_panel);
+    int16_t slot_x, slot_y, rotated_x, rotated_y;
+    slotOrigin(config, &slot_x, &slot_y);
+    rotatePanelPixel(config->rotation, local_x, local_y, &rotated_x, &rotated_y);
     
-    // Apply rotation based on panel configuration
-    int rotated_x = local_x;
-    int rotated_y = local_y;
+    // Final coordinates
+    *mapped_x = slot_x + rotated_x;
+    *mapped_y = slot_y + rotated_y;
+}
+
+// Precomputed logical-to-physical pixel map
+//
+// mapCoordinates() is the reference mapping, but it is far too slow to run
+// for every pixel of every frame. PanelMap evaluates it once for each logical
+// pixel at startup and stores the linear offset of the physical pixel
+// (mapped_y * TOTAL_WIDTH + mapped_x) in a table, so remapping on the render
+// path becomes a single indexed load. The offset can be used directly as an
+// index into the Protomatter canvas buffer. The table is two bytes a pixel
+// and a lookup one load whatever the size of the wall (up to 65536 pixels).
+//
+// Call PanelMap::begin() once in setup() before drawing anything.
+class PanelMap {
+public:
+    // Build the table from PANEL_CONFIGS (safe to call more than once)
+    static void begin() {
+        if (ready()) return;
+        
+        // A panel at a time, so each pixel costs the same however many
+        // panels there are
+        uint16_t* lut = table();
+        for (uint8_t i = 0; i < PANEL_COUNT; i++) {
+            const PanelConfig* config = &PANEL_CONFIGS[i];
+            int16_t left = config->logicalPosition % PANEL_COLUMNS * PANEL_WIDTH;
+            int16_t top = config->logicalPosition / PANEL_COLUMNS * PANEL_HEIGHT;
+            int16_t slot_x, slot_y;
+            slotOrigin(config, &slot_x, &slot_y);
+            for (int16_t y = 0; y < PANEL_HEIGHT; y++) {
+                uint16_t* row = lut + (top + y) * TOTAL_WIDTH + left;
+                for (int16_t x = 0; x < PANEL_WIDTH; x++) {
+                    int16_t rotated_x, rotated_y;
+                    rotatePanelPixel(config->rotation, x, y, &rotated_x, &rotated_y);
+                    row[x] = (slot_y + rotated_y) * TOTAL_WIDTH + slot_x + rotated_x;
+                }
+            }
+        }
+        ready() = true;
+    }
     
-    switch (config->rotation) {
-        case 0:  // Normal
-            rotated_x = local_x;
-            rotated_y = local_y;
-            break;
-        case 1:  // 90° clockwise
-            rotated_x = PANEL_W - 1 - local_y;
-            rotated_y = local_x;
-            break;
-        case 2:  // 180°
-            rotated_x = PANEL_W - 1 - local_x;
-            rotated_y = PANEL_H - 1 - local_y;
-            break;
-        case 3:  // 270° clockwise
-            rotated_x = local_y;
-            rotated_y = PANEL_H - 1 - local_x;
-            break;
+    // True if the logical coordinates are inside the display
+    static inline bool contains(int16_t x, int16_t y) {
+        return (uint16_t)x < TOTAL_WIDTH && (uint16_t)y < TOTAL_HEIGHT;
     }
     
-    // Calculate physical panel position based on its position in the chain
-    // Physical positions according to the actual hardware arrangement:
-    // Physical positions: 0=top-left, 1=top-right, 2=bottom-right, 3=bottom-left
-    int physical_x, physical_y;
+    // Physical buffer offset for an in-range logical pixel
+    static inline uint16_t offset(int16_t x, int16_t y) {
+        return table()[y * TOTAL_WIDTH + x];
+    }
     
-    switch (config->physicalPosition) {
-        case 0:  // Top-left
-            physical_x = 0;
-            physical_y = 0;
-            break;
-        case 1:  // Top-right
-            physical_x = PANEL_W;
-            physical_y = 0;
-            break;
-        case 2:  // Bottom-right
-            physical_x = PANEL_W;
-            physical_y = PANEL_H;
-            break;
-        case 3:  // Bottom-left
-            physical_x = 0;
-            physical_y = PANEL_H;
-            break;
+    // Physical buffer offset for a logical pixel index (y * TOTAL_WIDTH + x)
+    static inline uint16_t offset(uint16_t index) {
+        return table()[index];
     }
     
-    // Final coordinates
-    *mapped_x = physical_x + rotated_x;
-    *mapped_y = physical_y + rotated_y;
-}
+    // Drop-in replacement for mapCoordinates(). Out-of-range coordinates
+    // (e.g. text cursors) fall back to the reference function.
+    static inline void map(int16_t x, int16_t y, int16_t* mapped_x, int16_t* mapped_y) {
+        if (!contains(x, y)) {
+            mapCoordinates(x, y, mapped_x, mapped_y);
+            return;
+        }
+        uint16_t physical = offset(x, y);
+        *mapped_x = physical % TOTAL_WIDTH;
+        *mapped_y = physical / TOTAL_WIDTH;
+    }
+    
+    // Raw table of TOTAL_WIDTH * TOTAL_HEIGHT offsets
+    static const uint16_t* data() {
+        return table();
+    }
+    
+private:
+    static uint16_t* table() {
+        static uint16_t lut[TOTAL_WIDTH * TOTAL_HEIGHT];
+        return lut;
+    }
+    
+    static bool& ready() {
+        static bool built = false;
+        return built;
+    }
+};
 
 #endif // PANEL_CONFIG_H
\ No newline at end of file
@@ -0,0 +1,178 @@
+#ifndef PERF_HUD_H
+#define PERF_HUD_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Fonts/TomThumb.h>
+#include "Colors.h"
+#include "Compositor.h"
+
+// HUD layout (pixels): a line of TomThumb text over two graphs of the last
+// HUD_WIDTH frames, one column each
+#define HUD_WIDTH 32
+#define HUD_TEXT_ROWS 6       // TomThumb cell, descender included
+#define HUD_GRAPH_ROWS 6      // Full height is a whole frame period
+#define HUD_HEIGHT (HUD_TEXT_ROWS + 2 * HUD_GRAPH_ROWS + 1)
+
+// How often the frame rate on the text line is recomputed (ms)
+#define HUD_TEXT_INTERVAL 500
+
+// Characters the HUD prints, decoded from TomThumb once
+#define HUD_GLYPHS "0123456789fps "
+
+/**
+ * Frame-time overlay in a corner of the wall, for when no serial monitor
+ * is attached
+ *
+ * The top line shows frames per second. Below it, one column per frame,
+ * are the update times (top graph) and render times (bottom graph) of the
+ * last HUD_WIDTH frames. Each is scaled so that the full graph height is
+ * the frame period, and a column that reaches it turns red. With the
+ * dual-core pipeline the two run side by side, so either graph filling up
+ * is what costs frames.
+ *
+ * The HUD is an opaque compositor layer of palette indices. Columns are
+ * redrawn as frames come in and the text when it changes, from glyphs
+ * decoded out of TomThumb at start-up, and the compositor paints just the
+ * rows that changed (the graph columns touch them all) plus any the
+ * automaton drew over, one blitIndexedSpan() each, rather than a redraw
+ * through Adafruit GFX.
+ */
+class PerfHud {
+public:
+    // The HUD's top-left corner goes at logical (x, y)
+    PerfHud(Compositor& compositor, int16_t x, int16_t y)
+        : layer(compositor.addLayer(x, y, HUD_WIDTH, HUD_HEIGHT, false)), visible(false),
+          column(0), frames(0), windowStart(0), fps(0) {
+        decodeGlyphs();
+    }
+
+    // Turning the HUD off has the automaton repaint the corner
+    void show(bool on) {
+        if (layer == NULL) return;
+        if (on && !visible) {
+            layer->setColor(0, rgb565(0, 0, 0));
+            layer->setColor(1, rgb565(255, 255, 255));
+            layer->setColor(2, rgb565(0, 200, 255));   // Update
+            layer->setColor(3, rgb565(255, 200, 0));   // Render
+            layer->setColor(4, rgb565(255, 0, 0));     // A whole period
+            layer->setColor(5, rgb565(40, 40, 40));    // Graph background
+            layer->fill(0);
+            for (uint8_t r = HUD_TEXT_ROWS; r < HUD_HEIGHT; r++) {
+                if (r != HUD_TEXT_ROWS + HUD_GRAPH_ROWS) memset(layer->row(r), 5, HUD_WIDTH);
+            }
+            windowStart = millis();
+            frames = 0;
+            drawText("  fps");
+        }
+        layer->setVisible(on);
+        visible = on;
+    }
+
+    bool isVisible() const { return visible; }
+
+    // Record one frame's update and render time against the frame period
+    void addFrame(uint32_t updateUs, uint32_t renderUs, uint32_t periodUs) {
+        if (!visible) return;
+        drawBar(column, HUD_TEXT_ROWS, updateUs, periodUs, 2);
+        drawBar(column, HUD_TEXT_ROWS + HUD_GRAPH_ROWS + 1, renderUs, periodUs, 3);
+        column = (column + 1) % HUD_WIDTH;
+
+        frames++;
+        uint32_t elapsed = millis() - windowStart;
+        if (elapsed >= HUD_TEXT_INTERVAL) {
+            uint16_t rate = (frames * 1000UL + elapsed / 2) / elapsed;
+            windowStart += elapsed;
+            frames = 0;
+            if (rate != fps) {
+                fps = rate;
+                char text[8];
+                snprintf(text, sizeof(text), "%3ufps", rate > 999 ? 999 : rate);
+                drawText(text);
+            }
+        }
+        // The column after the newest is blanked so the sweep shows
+        clearColumn(column);
+    }
+
+private:
+    // One glyph as HUD_TEXT_ROWS rows of up to three pixels (bit 2 leftmost)
+    struct Glyph {
+        uint8_t rows[HUD_TEXT_ROWS];
+        uint8_t advance;
+    };
+
+    // Copy the HUD_GLYPHS characters out of TomThumb's packed bitmaps: each
+    // glyph is width x height bits, MSB first, its top yOffset rows above
+    // the baseline, which sits on the last text row but one
+    void decodeGlyphs() {
+        const GFXfont& font = TomThumb;
+        for (uint8_t i = 0; i < sizeof(glyphs) / sizeof(glyphs[0]); i++) {
+            Glyph& g = glyphs[i];
+            memset(g.rows, 0, sizeof(g.rows));
+            const GFXglyph& src = font.glyph[(uint8_t)HUD_GLYPHS[i] - font.first];
+            g.advance = src.xAdvance;
+            const uint8_t* bits = font.bitmap + src.bitmapOffset;
+            uint16_t bit = 0;
+            for (uint8_t gy = 0; gy < src.height; gy++) {
+                int8_t row = HUD_TEXT_ROWS - 1 + src.yOffset + gy;
+                for (uint8_t gx = 0; gx < src.width; gx++, bit++) {
+                    bool on = bits[bit >> 3] & (0x80 >> (bit & 7));
+                    uint8_t px = src.xOffset + gx;
+                    if (on && row >= 0 && row < HUD_TEXT_ROWS && px < 3) g.rows[row] |= 4 >> px;
+                }
+            }
+        }
+    }
+
+    // Replace the text line, left-aligned, with unknown characters as gaps
+    void drawText(const char* text) {
+        for (uint8_t r = 0; r < HUD_TEXT_ROWS; r++) memset(layer->row(r), 0, HUD_WIDTH);
+        uint8_t px = 0;
+        for (; *text && px + 3 <= HUD_WIDTH; text++) {
+            const char* found = strchr(HUD_GLYPHS, *text);
+            if (!found) {
+                px += 4;
+                continue;
+            }
+            const Glyph& g = glyphs[found - HUD_GLYPHS];
+            for (uint8_t r = 0; r < HUD_TEXT_ROWS; r++) {
+                for (uint8_t c = 0; c < 3; c++) {
+                    if (g.rows[r] & (4 >> c)) layer->row(r)[px + c] = 1;
+                }
+            }
+            px += g.advance;
+        }
+        layer->touch(0, HUD_TEXT_ROWS);
+    }
+
+    // Column c of the graph whose top row is top: us out of periodUs, as
+    // many pixels from the bottom (at least one for any time at all)
+    void drawBar(uint8_t c, uint8_t top, uint32_t us, uint32_t periodUs, uint8_t color) {
+        uint8_t filled = HUD_GRAPH_ROWS;
+        if (us < periodUs) {
+            filled = (us * HUD_GRAPH_ROWS + periodUs - 1) / periodUs;
+        } else {
+            color = 4;
+        }
+        for (uint8_t r = 0; r < HUD_GRAPH_ROWS; r++) {
+            layer->setPixel(c, top + r, r >= HUD_GRAPH_ROWS - filled ? color : 5);
+        }
+    }
+
+    void clearColumn(uint8_t c) {
+        for (uint8_t r = HUD_TEXT_ROWS; r < HUD_HEIGHT; r++) {
+            layer->setPixel(c, r, 0);
+        }
+    }
+
+    Layer* layer;              // Palette indices, NULL if it didn't fit
+    bool visible;
+    uint8_t column;            // Graph column the next frame goes in
+    uint32_t frames;           // Counted since windowStart
+    uint32_t windowStart;      // millis() the frame rate is counted from
+    uint16_t fps;              // Rate on the text line now
+    Glyph glyphs[sizeof(HUD_GLYPHS) - 1];
+};
+
+#endif
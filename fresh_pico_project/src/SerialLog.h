@@ -0,0 +1,273 @@
+#ifndef SERIAL_LOG_H
+#define SERIAL_LOG_H
+
+#include <Arduino.h>
+#ifdef ARDUINO_ARCH_RP2040
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+#include <hardware/uart.h>
+#endif
+
+// Ring for lines logged by core 0 outside interrupts, where nearly all of
+// them come from (automaton stats, telemetry), and for each other context.
+// Powers of two. At 115200 baud the UART sends about 11.5 bytes a
+// millisecond, so LOG_BUFFER holds some 180 ms of output.
+#define LOG_BUFFER 2048
+#define LOG_SIDE_BUFFER 256
+
+// The UART behind Serial1
+#define LOG_UART uart0
+
+// Core 0 and core 1, each in and out of interrupt handlers
+#define LOG_RINGS 4
+
+/**
+ * Ring buffer of log lines written by one context, read by another
+ *
+ * The writer appends bytes past the published end and publishes them when a
+ * line ends (or on flush()), so the reader only ever sees whole lines and
+ * neither side takes a lock: the writer alone moves head and the reader
+ * alone moves tail. A line that doesn't fit in the free space is dropped
+ * rather than waited for, and counted.
+ */
+class LogRing : public Print {
+public:
+    LogRing(uint8_t* buffer, uint32_t size)
+        : buffer(buffer), mask(size - 1), head(0), tail(0), pending(0),
+          discarding(false), dropped(0) {}
+
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* data, size_t n) override {
+        uint32_t limit = tail + mask + 1;
+        for (size_t i = 0; i < n; i++) {
+            uint8_t c = data[i];
+            if (discarding) {
+                if (c == '\n') discarding = false;
+                continue;
+            }
+            if (pending == limit) {
+                limit = tail + mask + 1; // The reader may have caught up
+                if (pending == limit) {
+                    pending = head;
+                    discarding = c != '\n';
+                    dropped++;
+                    continue;
+                }
+            }
+            buffer[pending & mask] = c;
+            pending++;
+            if (c == '\n') publish();
+        }
+        return n;
+    }
+
+    // A binary record, in one piece or not at all: its bytes are copied as
+    // they are (a 0x0A in it doesn't end anything) and published together
+    size_t writeRecord(const uint8_t* data, size_t n) {
+        if (tail + mask + 1 - pending < n) {
+            dropped++;
+            return 0;
+        }
+        for (size_t i = 0; i < n; i++) {
+            buffer[(pending + i) & mask] = data[i];
+        }
+        pending += n;
+        publish();
+        return n;
+    }
+
+    // End a record that isn't a text line (it is published as it stands)
+    void flush() override {
+        if (discarding) {
+            discarding = false;
+        } else {
+            publish();
+        }
+    }
+
+    // Lines (and records) that didn't fit
+    uint32_t getDropped() const { return dropped; }
+
+    // Reader side. Positions count bytes since the start and wrap around
+    // at 2^32, like head and tail.
+    uint32_t published() const { return head; }
+    uint32_t consumed() const { return tail; }
+
+    // Bytes from tail up to end that sit one after another in the buffer
+    uint32_t readable(uint32_t end, const uint8_t*& data) const {
+        uint32_t offset = tail & mask;
+        data = buffer + offset;
+        return min(end - tail, mask + 1 - offset);
+    }
+
+    void consume(uint32_t n) {
+        __sync_synchronize(); // Done reading before the space is reused
+        tail = tail + n;
+    }
+
+private:
+    void publish() {
+        __sync_synchronize(); // The bytes land before the reader sees them
+        head = pending;
+    }
+
+    uint8_t* buffer;
+    uint32_t mask;
+    volatile uint32_t head;    // End of the published lines (writer)
+    volatile uint32_t tail;    // Start of the unread ones (reader)
+    uint32_t pending;          // End of the line being written (writer)
+    bool discarding;           // Rest of a dropped line is skipped (writer)
+    uint32_t dropped;
+};
+
+/**
+ * Log output to Serial1 that never waits for the UART
+ *
+ * Printing to Serial1 directly holds the frame up while the bytes go out,
+ * about 87 us each at 115200 baud. Print to out() instead: each core, in
+ * and out of interrupt handlers, has its own LogRing, so every ring has a
+ * single writer and can be written from anywhere without a lock (one
+ * interrupt priority per core may log). A DMA channel paced by the UART
+ * sends the rings' lines, a run at a time, and its completion interrupt,
+ * at the lowest priority, starts the next run; service() starts one when
+ * the channel is idle. Lines from different rings are never interleaved.
+ *
+ * Without the RP2040 (the host benchmark) service() writes the lines to
+ * Serial1 directly.
+ */
+class SerialLog {
+public:
+    SerialLog()
+        : rings{LogRing(mainBuffer, LOG_BUFFER), LogRing(sideBuffers[0], LOG_SIDE_BUFFER),
+                LogRing(sideBuffers[1], LOG_SIDE_BUFFER), LogRing(sideBuffers[2], LOG_SIDE_BUFFER)},
+          channel(-1), current(0), sweepEnd(0), inFlight(0) {}
+
+    SerialLog(const SerialLog&) = delete;
+    SerialLog& operator=(const SerialLog&) = delete;
+
+    // Start sending, after Serial1.begin(). Lines logged before wait in the
+    // rings. The completion interrupt runs on the calling core, which must
+    // also be the one calling service().
+    void begin() {
+#ifdef ARDUINO_ARCH_RP2040
+        channel = dma_claim_unused_channel(false);
+        if (channel < 0) return; // Lines will pile up and be dropped
+        dma_channel_config c = dma_channel_get_default_config(channel);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, uart_get_dreq(LOG_UART, true));
+        dma_channel_configure(channel, &c, &uart_get_hw(LOG_UART)->dr, NULL, 0, false);
+        dma_channel_set_irq0_enabled(channel, true);
+        irq_add_shared_handler(DMA_IRQ_0, onTransferDone, PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
+        irq_set_priority(DMA_IRQ_0, PICO_LOWEST_IRQ_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+        service();
+#endif
+    }
+
+    // Start sending if lines are waiting and nothing is going out. Once a
+    // frame is plenty: while there is more, each run starts the next.
+    void service() {
+#ifdef ARDUINO_ARCH_RP2040
+        if (channel < 0) return;
+        uint32_t state = save_and_disable_interrupts(); // The handler reads too
+        if (inFlight == 0) next();
+        restore_interrupts(state);
+#else
+        do {
+            next();
+        } while (inFlight > 0);
+#endif
+    }
+
+    // The ring of the calling core and context
+    LogRing& out() {
+#ifdef ARDUINO_ARCH_RP2040
+        return rings[get_core_num() * 2 + (__get_current_exception() != 0)];
+#else
+        return rings[0];
+#endif
+    }
+
+    // Lines dropped for lack of room, all rings together
+    uint32_t getDropped() const {
+        uint32_t total = 0;
+        for (uint8_t i = 0; i < LOG_RINGS; i++) {
+            total += rings[i].getDropped();
+        }
+        return total;
+    }
+
+private:
+    // Retire the run that was going out, if any, and start the next. Only
+    // from the completion interrupt or with it masked.
+    void next() {
+        if (inFlight > 0) {
+            rings[current].consume(inFlight);
+            inFlight = 0;
+        }
+        // Finish the lines the current ring had published when its turn
+        // came (two runs where they wrap), then go round the others
+        for (uint8_t tries = 0; tries <= LOG_RINGS; tries++) {
+            LogRing& ring = rings[current];
+            if (ring.consumed() != sweepEnd) {
+                const uint8_t* data;
+                inFlight = ring.readable(sweepEnd, data);
+                send(data, inFlight);
+                return;
+            }
+            current = (current + 1) % LOG_RINGS;
+            sweepEnd = rings[current].published();
+        }
+    }
+
+    void send(const uint8_t* data, uint32_t n) {
+#ifdef ARDUINO_ARCH_RP2040
+        dma_channel_transfer_from_buffer_now(channel, data, n);
+#else
+        Serial1.write(data, n);
+#endif
+    }
+
+#ifdef ARDUINO_ARCH_RP2040
+    static void onTransferDone();
+#endif
+
+    uint8_t mainBuffer[LOG_BUFFER];
+    uint8_t sideBuffers[LOG_RINGS - 1][LOG_SIDE_BUFFER];
+    LogRing rings[LOG_RINGS];
+    int channel;               // DMA channel, -1 until begin()
+    uint8_t current;           // Ring being sent
+    uint32_t sweepEnd;         // Its published end when its turn came
+    volatile uint32_t inFlight; // Bytes of the run going out, 0 when idle
+};
+
+// The log everything prints to, shared by both cores
+inline SerialLog& serialLog() {
+    static SerialLog instance;
+    return instance;
+}
+
+// Where to print a log line from the calling core and context
+inline LogRing& logOut() {
+    return serialLog().out();
+}
+
+#ifdef ARDUINO_ARCH_RP2040
+inline void SerialLog::onTransferDone() {
+    SerialLog& self = serialLog();
+    if (self.channel < 0 || !dma_channel_get_irq0_status(self.channel)) return;
+    dma_channel_acknowledge_irq0(self.channel);
+    self.next();
+}
+#endif
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <Arduino.h>
+#include "Arena.h"
+
+// Flash page size (FLASH_PAGE_SIZE, checked in SnapshotStore.h), known here
+// so automatonArena() can be sized without the flash headers
+#define SNAPSHOT_PAGE 256
+
+// Arena bytes SnapshotStore::begin() stages a snapshot of the given length
+// in: a header page, the snapshot in whole pages, and the alignment
+#define SNAPSHOT_STAGING_BYTES(length) \
+    (SNAPSHOT_PAGE + ((uint32_t)(length) + SNAPSHOT_PAGE - 1) / SNAPSHOT_PAGE * SNAPSHOT_PAGE + ARENA_ALIGN)
+
+/**
+ * Serializer for an automaton's running state
+ *
+ * One snapshot() function per automaton both saves and restores: it passes
+ * each field to value() or bytes(), which copy it into the buffer when
+ * saving (or only count it, with no buffer) and back out of it when
+ * loading. Save and load therefore always agree on the layout. The layout
+ * is the in-memory one, so a snapshot only restores on the same build of
+ * the firmware (see SNAPSHOT_VERSION in SnapshotStore.h).
+ */
+class Snapshot {
+public:
+    enum Mode { SAVE, LOAD };
+    
+    // Count the bytes a save would take
+    Snapshot() : data(NULL), capacity(0xFFFFFFFF), pos(0), loading(false), ok(true) {}
+
+    // Save into buffer (capacity bytes), or load from a saved snapshot of
+    // that length
+    Snapshot(Mode mode, const uint8_t* buffer, uint32_t capacity)
+        : data(const_cast<uint8_t*>(buffer)), capacity(capacity), pos(0),
+          loading(mode == LOAD), ok(true) {}
+
+    bool isLoading() const { return loading; }
+
+    // Copy a block of memory in or out
+    void bytes(void* p, uint32_t n) {
+        if (!ok || n > capacity - pos) {
+            ok = false;
+            return;
+        }
+        if (loading) {
+            memcpy(p, data + pos, n);
+        } else if (data) {
+            memcpy(data + pos, p, n);
+        }
+        pos += n;
+    }
+
+    // Same for one plain variable
+    template<typename T>
+    void value(T& v) {
+        bytes(&v, sizeof(T));
+    }
+
+    // Bytes saved, counted or loaded so far
+    uint32_t size() const { return pos; }
+
+    // Whether everything fitted, and a load used up the whole snapshot
+    bool good() const {
+        return ok && (!loading || pos == capacity);
+    }
+
+private:
+    uint8_t* data;
+    uint32_t capacity;
+    uint32_t pos;
+    bool loading;
+    bool ok;
+};
+
+#endif
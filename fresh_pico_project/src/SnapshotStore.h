@@ -0,0 +1,250 @@
+#ifndef SNAPSHOT_STORE_H
+#define SNAPSHOT_STORE_H
+
+#include <Arduino.h>
+#include <hardware/flash.h>
+#include "CellularAutomata.h"
+
+// Bump when any automaton's snapshotState() or member layout changes, so
+// old snapshots are ignored instead of misread
+#define SNAPSHOT_VERSION 2
+
+// Flash pages programmed per step() (each takes well under a millisecond)
+#define SNAPSHOT_PAGES_PER_STEP 4
+
+#define SNAPSHOT_MAGIC 0x50414E53 // "SNAP"
+
+static_assert(FLASH_PAGE_SIZE == SNAPSHOT_PAGE, "SNAPSHOT_STAGING_BYTES assumes the flash page size");
+
+// The filesystem region of the flash layout (board_build.filesystem_size in
+// platformio.ini), which nothing else here uses
+extern uint8_t _FS_start;
+extern uint8_t _FS_end;
+
+/**
+ * Log of automaton snapshots in flash, to resume the last one at boot
+ *
+ * Each record starts on a sector: a header page (type, constructor
+ * parameter, run time, length and CRCs), then the snapshot. Records go one
+ * after another through the region and wrap to its start, so every sector
+ * is erased in turn rather than the same one each time; the newest record
+ * with a valid header and CRC wins at boot.
+ *
+ * Flash can't be read while it is erased or programmed, so both cores stop
+ * for it (core 1 through idleOtherCore(), interrupts off on core 0). To
+ * keep that out of the frame time, begin() only copies the snapshot into
+ * RAM, and step() writes the copy one sector erase or a few pages at a
+ * time, once a frame. The header goes last, so a record cut short by a
+ * reset has none and is skipped. The copy lives at the free end of
+ * automatonArena(), which is sized to leave room for it beside any
+ * automaton: cancel() before the automaton is deleted.
+ */
+class SnapshotStore {
+public:
+    // What a record holds besides the snapshot itself
+    struct Header {
+        uint32_t magic;
+        uint32_t sequence;  // Higher is newer
+        uint32_t length;    // Snapshot bytes after the header page
+        uint32_t crc;       // CRC-32 of those bytes
+        uint32_t runMs;     // How long the automaton had been running
+        uint16_t width, height;
+        uint8_t type;       // As in createAutomatonOfType()
+        uint8_t param;
+        uint8_t version;    // SNAPSHOT_VERSION
+        uint8_t reserved;
+        uint32_t headerCrc; // CRC-32 of the fields above
+    };
+
+    SnapshotStore()
+        : start((uint32_t)&_FS_start - XIP_BASE), end((uint32_t)&_FS_end - XIP_BASE),
+          writeOffset(start), sequence(0), staging(NULL) {}
+
+    // Whether the flash layout leaves room for at least one sector
+    bool available() const {
+        return end >= start + FLASH_SECTOR_SIZE;
+    }
+
+    // Find the newest valid record. Returns false if there is none; either
+    // way, later records go after the newest one seen.
+    bool findLatest(Header& header, const uint8_t*& snapshot) {
+        if (!available()) return false;
+        bool found = false;
+        uint32_t newest = 0;
+        uint32_t below = 0xFFFFFFFF; // Only records older than this are left
+        while (!found) {
+            // Newest header below the last one whose snapshot was bad
+            const Header* best = NULL;
+            for (uint32_t offset = start; offset + FLASH_SECTOR_SIZE <= end; offset += FLASH_SECTOR_SIZE) {
+                const Header* h = (const Header*)flash(offset);
+                if (!headerValid(*h, offset) || h->sequence >= below) continue;
+                if (!best || h->sequence > best->sequence) best = h;
+            }
+            if (!best) break;
+            if (below == 0xFFFFFFFF) {
+                uint32_t offset = (const uint8_t*)best - flash(0);
+                newest = best->sequence;
+                writeOffset = offset + recordBytes(best->length);
+                if (writeOffset + FLASH_SECTOR_SIZE > end) writeOffset = start;
+            }
+            const uint8_t* data = (const uint8_t*)best + FLASH_PAGE_SIZE;
+            if (crc32(0, data, best->length) == best->crc) {
+                header = *best;
+                snapshot = data;
+                found = true;
+            }
+            below = best->sequence;
+        }
+        sequence = newest + 1;
+        return found;
+    }
+
+    // Copy automaton's snapshot into RAM and start writing it. False if a
+    // write is still going, there is no room, or the snapshot is bigger
+    // than the region.
+    bool begin(CellularAutomaton* automaton, uint8_t type, uint32_t runMs,
+               uint16_t width, uint16_t height) {
+        if (busy() || !available()) return false;
+        Snapshot measure;
+        automaton->snapshot(measure);
+        uint32_t length = measure.size();
+        if (recordBytes(length) > end - start) return false;
+
+        // Whole pages, so the last one can be programmed as it is
+        uint32_t bytes = SNAPSHOT_STAGING_BYTES(length) - ARENA_ALIGN;
+        Arena& arena = automatonArena();
+        if (SNAPSHOT_STAGING_BYTES(length) > arena.getFree()) return false;
+        arenaMark = arena.mark();
+        staging = arena.allocate<uint8_t>(bytes);
+        memset(staging, 0xFF, bytes);
+        Snapshot save(Snapshot::SAVE, staging + FLASH_PAGE_SIZE, length);
+        automaton->snapshot(save);
+
+        Header& h = *(Header*)staging;
+        h.magic = SNAPSHOT_MAGIC;
+        h.sequence = sequence;
+        h.length = length;
+        h.crc = 0; // Filled in as the pages are written
+        h.runMs = runMs;
+        h.width = width;
+        h.height = height;
+        h.type = type;
+        h.param = automaton->snapshotParam();
+        h.version = SNAPSHOT_VERSION;
+        h.reserved = 0;
+
+        if (writeOffset + recordBytes(length) > end) writeOffset = start;
+        pages = bytes / FLASH_PAGE_SIZE;
+        nextPage = 1;
+        erasedSectors = 0;
+        return true;
+    }
+
+    bool busy() const { return staging != NULL; }
+
+    // Do the next piece of the write started by begin(): erase one sector or
+    // program up to SNAPSHOT_PAGES_PER_STEP pages. Returns true when this
+    // step finished the record.
+    bool step() {
+        if (!busy()) return false;
+        if (nextPage < pages) {
+            uint32_t sector = nextPage * FLASH_PAGE_SIZE / FLASH_SECTOR_SIZE;
+            if (sector >= erasedSectors) {
+                erase(writeOffset + sector * FLASH_SECTOR_SIZE);
+                erasedSectors++;
+                return false;
+            }
+            // Up to the end of the erased sectors
+            uint32_t last = erasedSectors * (FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE);
+            uint32_t n = min((uint32_t)SNAPSHOT_PAGES_PER_STEP, min(pages, last) - nextPage);
+            Header& h = *(Header*)staging;
+            uint32_t done = (nextPage - 1) * FLASH_PAGE_SIZE;
+            uint32_t crcBytes = min(n * FLASH_PAGE_SIZE, h.length - done);
+            h.crc = crc32(h.crc, staging + nextPage * FLASH_PAGE_SIZE, crcBytes);
+            program(writeOffset + nextPage * FLASH_PAGE_SIZE, staging + nextPage * FLASH_PAGE_SIZE,
+                    n * FLASH_PAGE_SIZE);
+            nextPage += n;
+            return false;
+        }
+
+        // Everything else is in place: the header makes the record valid
+        Header& h = *(Header*)staging;
+        h.headerCrc = crc32(0, (const uint8_t*)&h, offsetof(Header, headerCrc));
+        program(writeOffset, staging, FLASH_PAGE_SIZE);
+        writeOffset += recordBytes(h.length);
+        if (writeOffset + FLASH_SECTOR_SIZE > end) writeOffset = start;
+        sequence++;
+        release();
+        return true;
+    }
+
+    // Drop a write in progress (the part written is never valid)
+    void cancel() {
+        if (busy()) release();
+    }
+
+private:
+    // Flash bytes through the XIP window
+    static const uint8_t* flash(uint32_t offset) {
+        return (const uint8_t*)(XIP_BASE + offset);
+    }
+
+    // Whole sectors a record of length snapshot bytes takes
+    static uint32_t recordBytes(uint32_t length) {
+        uint32_t bytes = FLASH_PAGE_SIZE + length;
+        return (bytes + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE * FLASH_SECTOR_SIZE;
+    }
+
+    bool headerValid(const Header& h, uint32_t offset) const {
+        return h.magic == SNAPSHOT_MAGIC && h.version == SNAPSHOT_VERSION &&
+               h.length <= end - offset - FLASH_PAGE_SIZE &&
+               crc32(0, (const uint8_t*)&h, offsetof(Header, headerCrc)) == h.headerCrc;
+    }
+
+    // CRC-32 (IEEE), continuing from crc
+    static uint32_t crc32(uint32_t crc, const uint8_t* data, uint32_t n) {
+        crc = ~crc;
+        while (n--) {
+            crc ^= *data++;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+            }
+        }
+        return ~crc;
+    }
+
+    // The flash can't be read meanwhile, not even to fetch code, so the other
+    // core and this core's interrupts wait
+    static void erase(uint32_t offset) {
+        rp2040.idleOtherCore();
+        noInterrupts();
+        flash_range_erase(offset, FLASH_SECTOR_SIZE);
+        interrupts();
+        rp2040.resumeOtherCore();
+    }
+
+    static void program(uint32_t offset, const uint8_t* data, uint32_t bytes) {
+        rp2040.idleOtherCore();
+        noInterrupts();
+        flash_range_program(offset, data, bytes);
+        interrupts();
+        rp2040.resumeOtherCore();
+    }
+
+    void release() {
+        automatonArena().rewind(arenaMark);
+        staging = NULL;
+    }
+
+    uint32_t start, end;      // Region, as flash offsets
+    uint32_t writeOffset;     // Where the next record goes
+    uint32_t sequence;        // For the next record
+
+    uint8_t* staging;         // Header page and snapshot being written, or NULL
+    uint32_t arenaMark;       // Arena fill level before staging
+    uint32_t pages;           // Pages of staging
+    uint32_t nextPage;        // Next snapshot page to program (0 = header, last)
+    uint32_t erasedSectors;   // Sectors of the record erased so far
+};
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "CellularAutomata.h"
+#include "SerialLog.h"
+
+// Record framing: TELEMETRY_SYNC, the payload length, the payload, then a
+// CRC-8 (polynomial 0x07) of the payload. The sync byte never occurs in the
+// ASCII the rest of Serial1 carries, so a reader can pick records out of
+// the log text. The length doubles as the layout version: fields are only
+// ever added at the end.
+#define TELEMETRY_SYNC 0xA5
+
+// Payload, little-endian:
+//   u8  sequence       +1 per record, gaps are records lost
+//   u8  type           As in createAutomatonOfType()
+//   u8  flags          TELEMETRY_POPULATION, TELEMETRY_ACTIVITY, TELEMETRY_TILES
+//   u32 generation     Frames the automaton has drawn
+//   u16 generations    Generations since the last record
+//   u32 population     Live cells
+//   u32 births         Cells born since the last record
+//   u32 deaths         Cells died since the last record
+//   u16 changedRows    Rows that changed in the last generation
+//   u16 activeTiles    Tiles the next generation updates
+//   u16 tiles          Tiles in the grid
+//   u16 quiet          Generations the grid has repeated itself, up to 65535
+#define TELEMETRY_PAYLOAD 29
+#define TELEMETRY_RECORD (TELEMETRY_PAYLOAD + 3)
+
+// Which fields the automaton fills in (the others are 0)
+#define TELEMETRY_POPULATION 1  // population, births, deaths
+#define TELEMETRY_ACTIVITY 2    // changedRows, quiet (see trackActivity())
+#define TELEMETRY_TILES 4       // activeTiles
+
+/**
+ * Binary activity records on a serial port, for dashboards
+ *
+ * update() runs once a frame, after the frame's generations were computed:
+ * it reads the counters the automaton keeps while it updates and adds up
+ * births and deaths, and every interval milliseconds sends a record of them. Records go into the
+ * log (logOut(), see SerialLog.h), each in one piece between the text
+ * lines; they are 32 bytes, the size of the RP2040 UART's transmit FIFO.
+ * tools/telemetry.py decodes them.
+ */
+class Telemetry {
+public:
+    Telemetry(LogRing& port, uint32_t interval)
+        : port(port), interval(interval), lastSent(0), sequence(0),
+          generations(0), births(0), deaths(0) {}
+
+    // Send every interval ms; 0 stops sending
+    void setInterval(uint32_t ms) {
+        interval = ms;
+        lastSent = millis();
+    }
+
+    uint32_t getInterval() const { return interval; }
+
+    // Start over for a new automaton
+    void reset() {
+        generations = 0;
+        births = 0;
+        deaths = 0;
+        lastSent = millis();
+    }
+
+    // Count the generations the automaton just computed (one compute() or
+    // computeMany()), and send a record if one is due
+    void update(const CellularAutomaton& automaton, uint8_t type, uint16_t computed) {
+        generations += computed;
+        births += automaton.getBirths();
+        deaths += automaton.getDeaths();
+        if (interval == 0 || millis() - lastSent < interval) return;
+        lastSent = millis();
+
+        uint8_t record[TELEMETRY_RECORD];
+        uint8_t* p = record;
+        *p++ = TELEMETRY_SYNC;
+        *p++ = TELEMETRY_PAYLOAD;
+        uint8_t flags = (automaton.tracksPopulation() ? TELEMETRY_POPULATION : 0) |
+                        (automaton.tracksActivity() ? TELEMETRY_ACTIVITY : 0) |
+                        (automaton.tracksTiles() ? TELEMETRY_TILES : 0);
+        uint32_t quiet = automaton.getQuietGenerations();
+        p = put(p, sequence++);
+        p = put(p, type);
+        p = put(p, flags);
+        p = put(p, automaton.getFrameCount());
+        p = put(p, (uint16_t)min(generations, (uint32_t)0xFFFF));
+        p = put(p, automaton.getPopulation());
+        p = put(p, births);
+        p = put(p, deaths);
+        p = put(p, automaton.getChangedRows());
+        p = put(p, automaton.getActiveTiles());
+        p = put(p, automaton.getTileCount());
+        p = put(p, (uint16_t)min(quiet, (uint32_t)0xFFFF));
+        *p = crc8(record + 2, TELEMETRY_PAYLOAD);
+
+        port.writeRecord(record, TELEMETRY_RECORD);
+
+        generations = 0;
+        births = 0;
+        deaths = 0;
+    }
+
+private:
+    // Little-endian, whatever the type's size
+    template <typename T>
+    static uint8_t* put(uint8_t* p, T v) {
+        for (uint8_t i = 0; i < sizeof(T); i++) {
+            *p++ = (uint8_t)(v >> (8 * i));
+        }
+        return p;
+    }
+
+    static uint8_t crc8(const uint8_t* data, uint8_t n) {
+        uint8_t crc = 0;
+        while (n--) {
+            crc ^= *data++;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+            }
+        }
+        return crc;
+    }
+
+    LogRing& port;
+    uint32_t interval;      // ms between records, 0 = off
+    uint32_t lastSent;      // millis() of the last record (or reset())
+    uint8_t sequence;       // Of the next record
+    uint32_t generations;   // Counted since the last record
+    uint32_t births;
+    uint32_t deaths;
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "PanelConfig.h"
 #include <Adafruit_GFX.h>
+#include "TextLayout.h"
 
 // Collection of test patterns for RGB LED matrix
 class TestPatterns {
@@ -18,47 +19,30 @@ public:
         matrix = m;
         color565 = colorFn;
         showDisplay = showFn;
+        
+        // Make sure the pixel map is ready before any pattern is drawn
+        PanelMap::begin();
     }
 
     // Panel identification test
     void panelIdentification(uint16_t duration = 5000) {
         matrix->fillScreen(0);
         
-        // Draw different colors on each panel to identify panel order
-        
-        // Panel 0 (top-left) - Red
-        for (int y = 0; y < PANEL_HEIGHT; y++) {
-            for (int x = 0; x < PANEL_WIDTH; x++) {
-                int16_t mapped_x, mapped_y;
-                mapCoordinates(x, y, &mapped_x, &mapped_y);
-                matrix->drawPixel(mapped_x, mapped_y, color565(255, 0, 0));
-            }
-        }
-        
-        // Panel 1 (top-right) - Green
-        for (int y = 0; y < PANEL_HEIGHT; y++) {
-            for (int x = 0; x < PANEL_WIDTH; x++) {
-                int16_t mapped_x, mapped_y;
-                mapCoordinates(PANEL_WIDTH + x, y, &mapped_x, &mapped_y);
-                matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
-            }
-        }
-        
-        // Panel 2 (bottom-left) - Blue
-        for (int y = 0; y < PANEL_HEIGHT; y++) {
-            for (int x = 0; x < PANEL_WIDTH; x++) {
-                int16_t mapped_x, mapped_y;
-                mapCoordinates(x, PANEL_HEIGHT + y, &mapped_x, &mapped_y);
-                matrix->drawPixel(mapped_x, mapped_y, color565(0, 0, 255));
-            }
-        }
-        
-        // Panel 3 (bottom-right) - Yellow
-        for (int y = 0; y < PANEL_HEIGHT; y++) {
-            for (int x = 0; x < PANEL_WIDTH; x++) {
-                int16_t mapped_x, mapped_y;
-                mapCoordinates(PANEL_WIDTH + x, PANEL_HEIGHT + y, &mapped_x, &mapped_y);
-                matrix->drawPixel(mapped_x, mapped_y, color565(255, 255, 0));
+        // Draw different colors on each panel to identify panel order:
+        // red, green, blue, yellow, then round again, a shade dimmer
+        static const uint8_t colors[4][3] = {{255, 0, 0}, {0, 255, 0}, {0, 0, 255}, {255, 255, 0}};
+        for (int panel = 0; panel < PANEL_COUNT; panel++) {
+            const uint8_t* c = colors[panel % 4];
+            uint8_t shift = panel / 4 % 4;
+            uint16_t color = color565(c[0] >> shift, c[1] >> shift, c[2] >> shift);
+            int16_t left = panel % PANEL_COLUMNS * PANEL_WIDTH;
+            int16_t top = panel / PANEL_COLUMNS * PANEL_HEIGHT;
+            for (int y = 0; y < PANEL_HEIGHT; y++) {
+                for (int x = 0; x < PANEL_WIDTH; x++) {
+                    int16_t mapped_x, mapped_y;
+                    PanelMap::map(left + x, top + y, &mapped_x, &mapped_y);
+                    matrix->drawPixel(mapped_x, mapped_y, color);
+                }
             }
         }
         
@@ -70,11 +54,10 @@ public:
     void panelNumbers(uint16_t duration = 5000) {
         matrix->fillScreen(0);
         
-        // Draw panel numbers on each panel
-        drawNumber(0, 0, 1);                    // Panel 0 - Top Left
-        drawNumber(PANEL_WIDTH, 0, 2);           // Panel 1 - Top Right
-        drawNumber(0, PANEL_HEIGHT, 3);          // Panel 2 - Bottom Left
-        drawNumber(PANEL_WIDTH, PANEL_HEIGHT, 4); // Panel 3 - Bottom Right
+        // Draw panel numbers on each panel, 1 at the top left, in reading order
+        for (int panel = 0; panel < PANEL_COUNT; panel++) {
+            drawNumber(panel % PANEL_COLUMNS * PANEL_WIDTH, panel / PANEL_COLUMNS * PANEL_HEIGHT, panel + 1);
+        }
         
         showDisplay();
         delay(duration);
@@ -88,7 +71,7 @@ public:
         for (int x = 0; x < TOTAL_WIDTH; x += 8) {
             for (int y = 0; y < TOTAL_HEIGHT; y++) {
                 int16_t mapped_x, mapped_y;
-                mapCoordinates(x, y, &mapped_x, &mapped_y);
+                PanelMap::map(x, y, &mapped_x, &mapped_y);
                 matrix->drawPixel(mapped_x, mapped_y, color565(64, 64, 64));
             }
         }
@@ -96,32 +79,36 @@ public:
         for (int y = 0; y < TOTAL_HEIGHT; y += 8) {
             for (int x = 0; x < TOTAL_WIDTH; x++) {
                 int16_t mapped_x, mapped_y;
-                mapCoordinates(x, y, &mapped_x, &mapped_y);
+                PanelMap::map(x, y, &mapped_x, &mapped_y);
                 matrix->drawPixel(mapped_x, mapped_y, color565(64, 64, 64));
             }
         }
         
         // Draw panel boundaries in a different color
-        for (int x = 0; x < TOTAL_WIDTH; x++) {
-            int16_t mapped_x, mapped_y;
-            
-            // Horizontal panel boundaries
-            mapCoordinates(x, PANEL_HEIGHT-1, &mapped_x, &mapped_y);
-            matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
-            
-            mapCoordinates(x, PANEL_HEIGHT, &mapped_x, &mapped_y);
-            matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
+        for (int edge = PANEL_HEIGHT; edge < TOTAL_HEIGHT; edge += PANEL_HEIGHT) {
+            for (int x = 0; x < TOTAL_WIDTH; x++) {
+                int16_t mapped_x, mapped_y;
+                
+                // Horizontal panel boundaries
+                PanelMap::map(x, edge-1, &mapped_x, &mapped_y);
+                matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
+                
+                PanelMap::map(x, edge, &mapped_x, &mapped_y);
+                matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
+            }
         }
         
-        for (int y = 0; y < TOTAL_HEIGHT; y++) {
-            int16_t mapped_x, mapped_y;
-            
-            // Vertical panel boundaries
-            mapCoordinates(PANEL_WIDTH-1, y, &mapped_x, &mapped_y);
-            matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
-            
-            mapCoordinates(PANEL_WIDTH, y, &mapped_x, &mapped_y);
-            matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
+        for (int edge = PANEL_WIDTH; edge < TOTAL_WIDTH; edge += PANEL_WIDTH) {
+            for (int y = 0; y < TOTAL_HEIGHT; y++) {
+                int16_t mapped_x, mapped_y;
+                
+                // Vertical panel boundaries
+                PanelMap::map(edge-1, y, &mapped_x, &mapped_y);
+                matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
+                
+                PanelMap::map(edge, y, &mapped_x, &mapped_y);
+                matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
+            }
         }
         
         showDisplay();
@@ -136,20 +123,20 @@ public:
         for (int i = 0; i < TOTAL_WIDTH; i++) {
             int y = i * TOTAL_HEIGHT / TOTAL_WIDTH;
             int16_t mapped_x, mapped_y;
-            mapCoordinates(i, y, &mapped_x, &mapped_y);
+            PanelMap::map(i, y, &mapped_x, &mapped_y);
             matrix->drawPixel(mapped_x, mapped_y, color565(255, 255, 255));
         }
         
         // Draw cross in the center
         for (int x = 0; x < TOTAL_WIDTH; x++) {
             int16_t mapped_x, mapped_y;
-            mapCoordinates(x, TOTAL_HEIGHT/2, &mapped_x, &mapped_y);
+            PanelMap::map(x, TOTAL_HEIGHT/2, &mapped_x, &mapped_y);
             matrix->drawPixel(mapped_x, mapped_y, color565(255, 0, 0));
         }
         
         for (int y = 0; y < TOTAL_HEIGHT; y++) {
             int16_t mapped_x, mapped_y;
-            mapCoordinates(TOTAL_WIDTH/2, y, &mapped_x, &mapped_y);
+            PanelMap::map(TOTAL_WIDTH/2, y, &mapped_x, &mapped_y);
             matrix->drawPixel(mapped_x, mapped_y, color565(0, 255, 0));
         }
         
@@ -164,13 +151,16 @@ public:
         matrix->setTextSize(1);
         matrix->setTextColor(color565(255, 255, 255));
         
-        // First map the text start position to physical coordinates
+        // Center the text across the whole display, then map its start
+        // position to physical coordinates
+        TextLayout layout;
+        layout.wrap("RGB MATRIX", TOTAL_WIDTH, 0, 1);
         int16_t mapped_x, mapped_y;
-        mapCoordinates(TOTAL_WIDTH/2 - 30, TOTAL_HEIGHT/2 - 4, &mapped_x, &mapped_y);
+        PanelMap::map(layout.lines[0].x, TOTAL_HEIGHT/2 - 4, &mapped_x, &mapped_y);
         
         // Position text to span across panels
         matrix->setCursor(mapped_x, mapped_y);
-        matrix->print("RGB MATRIX");
+        matrix->write((const uint8_t*)layout.text + layout.lines[0].start, layout.lines[0].length);
         
         showDisplay();
         delay(duration);
@@ -215,7 +205,7 @@ public:
                     
                     // Animate the wave based on frame number
                     if ((distance + frame) % 16 < 8) {
-                        mapCoordinates(x, y, &mapped_x, &mapped_y);
+                        PanelMap::map(x, y, &mapped_x, &mapped_y);
                         
                         // Create a rainbow color based on angle
                         float angle = atan2(dy, dx) * 180 / 3.14159;
@@ -242,7 +232,7 @@ private:
         int16_t y = panel_y + PANEL_HEIGHT/2 - 4;
         
         int16_t mapped_x, mapped_y;
-        mapCoordinates(x, y, &mapped_x, &mapped_y);
+        PanelMap::map(x, y, &mapped_x, &mapped_y);
         
         matrix->setTextSize(1);
         matrix->setTextColor(color565(255, 255, 255));
@@ -253,20 +243,20 @@ private:
         for (int i = 0; i < PANEL_WIDTH; i++) {
             int16_t mx1, my1, mx2, my2;
             
-            mapCoordinates(panel_x + i, panel_y, &mx1, &my1);
+            PanelMap::map(panel_x + i, panel_y, &mx1, &my1);
             matrix->drawPixel(mx1, my1, color565(255, 255, 255));
             
-            mapCoordinates(panel_x + i, panel_y + PANEL_HEIGHT - 1, &mx2, &my2);
+            PanelMap::map(panel_x + i, panel_y + PANEL_HEIGHT - 1, &mx2, &my2);
             matrix->drawPixel(mx2, my2, color565(255, 255, 255));
         }
         
         for (int i = 0; i < PANEL_HEIGHT; i++) {
             int16_t mx1, my1, mx2, my2;
             
-            mapCoordinates(panel_x, panel_y + i, &mx1, &my1);
+            PanelMap::map(panel_x, panel_y + i, &mx1, &my1);
             matrix->drawPixel(mx1, my1, color565(255, 255, 255));
             
-            mapCoordinates(panel_x + PANEL_WIDTH - 1, panel_y + i, &mx2, &my2);
+            PanelMap::map(panel_x + PANEL_WIDTH - 1, panel_y + i, &mx2, &my2);
             matrix->drawPixel(mx2, my2, color565(255, 255, 255));
         }
     }
@@ -0,0 +1,96 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#define TEXT_LAYOUT_MAX_LINES 6   // Lines kept per layout
+#define TEXT_LAYOUT_CACHE 8       // Layouts kept (one per automaton name)
+#define TEXT_CHAR_WIDTH 6         // Advance of the built-in 5x7 font at size 1
+
+// A string word-wrapped to a width: where each line starts in the string,
+// how many characters it has and where it is drawn, so drawing it again
+// takes no measuring.
+struct TextLayout {
+    struct Line {
+        uint8_t start;    // Offset into the text
+        uint8_t length;   // Characters on the line, trailing spaces dropped
+        int16_t x;        // Left edge that centers the line in the area
+    };
+
+    const char* text;     // The string laid out (not copied)
+    uint16_t width;       // Area width it was laid out for
+    uint8_t count;        // Lines used
+    Line lines[TEXT_LAYOUT_MAX_LINES];
+
+    // Word-wrap text into lines of at most (width - 2 * margin) pixels of
+    // the built-in font: as many whole words as fit, or a hard break inside
+    // a word longer than a line. Each line is centered in width.
+    void wrap(const char* text, uint16_t width, uint8_t margin, uint8_t maxLines) {
+        this->text = text;
+        this->width = width;
+        count = 0;
+        if (maxLines > TEXT_LAYOUT_MAX_LINES) maxLines = TEXT_LAYOUT_MAX_LINES;
+
+        uint8_t maxChars = (width - 2 * margin + 1) / TEXT_CHAR_WIDTH;
+        if (maxChars == 0) return;
+        const char* p = text;
+
+        while (count < maxLines) {
+            while (*p == ' ') p++;
+            if (*p == '\0') break;
+
+            uint8_t n = strnlen(p, maxChars + 1);
+            if (n > maxChars) {
+                n = maxChars;
+                while (n > 0 && p[n] != ' ') n--;
+                if (n == 0) n = maxChars;
+            }
+            uint8_t next = n;
+            while (n > 0 && p[n - 1] == ' ') n--;
+
+            Line& line = lines[count++];
+            line.start = p - text;
+            line.length = n;
+            line.x = (int16_t)(width - (n * TEXT_CHAR_WIDTH - 1)) / 2;
+            p += next;
+        }
+    }
+
+    // Draw the lines with the built-in font: the first with its top at y,
+    // each next one lineHeight below. Uses gfx's text size 1 and color as
+    // they are set.
+    void draw(Adafruit_GFX& gfx, int16_t x, int16_t y, uint8_t lineHeight) const {
+        for (uint8_t i = 0; i < count; i++) {
+            gfx.setCursor(x + lines[i].x, y + i * lineHeight);
+            gfx.write((const uint8_t*)text + lines[i].start, lines[i].length);
+        }
+    }
+};
+
+// The layouts of the last few strings shown. Strings are told apart by
+// address, so they must stay put while cached: getName() literals and other
+// constants, not stack buffers.
+class TextLayoutCache {
+public:
+    TextLayoutCache() : next(0) {
+        for (uint8_t i = 0; i < TEXT_LAYOUT_CACHE; i++) entries[i].text = NULL;
+    }
+
+    // The layout of text, wrapped on first use and reused after that
+    const TextLayout& get(const char* text, uint16_t width, uint8_t margin, uint8_t maxLines) {
+        for (uint8_t i = 0; i < TEXT_LAYOUT_CACHE; i++) {
+            if (entries[i].text == text && entries[i].width == width) return entries[i];
+        }
+        TextLayout& layout = entries[next];
+        next = (next + 1) % TEXT_LAYOUT_CACHE;
+        layout.wrap(text, width, margin, maxLines);
+        return layout;
+    }
+
+private:
+    TextLayout entries[TEXT_LAYOUT_CACHE];
+    uint8_t next;     // Entry replaced on the next miss (oldest first)
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef TITLE_OVERLAY_H
+#define TITLE_OVERLAY_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "Colors.h"
+#include "Compositor.h"
+#include "TextLayout.h"
+
+// Title layout inside its area (pixels)
+#define TITLE_MARGIN 5        // Left and right margin
+#define TITLE_TOP 15          // Top of the first line
+#define TITLE_LINE_HEIGHT 9   // Distance between lines
+
+// Layer colors
+#define TITLE_TEXT 1
+#define TITLE_SHADOW 2
+
+// Automaton title drawn over the running animation
+// show() draws the name, word-wrapped the first time it is shown and from
+// the cached layout after that, into a 1-bit canvas and from there, with a
+// one-pixel drop shadow so it stays readable over bright cells, into a
+// keyed compositor layer. The compositor paints it over the automaton's
+// changed rows until update() finds it expired. Nothing blocks, so the
+// automaton keeps animating underneath.
+class TitleOverlay {
+public:
+    // The title covers the w x h logical area at (x, y)
+    TitleOverlay(Compositor& compositor, int16_t x, int16_t y, uint16_t w, uint16_t h)
+        : text(w, h), layer(compositor.addLayer(x, y, w, h, true)), visible(false) {
+        text.setTextSize(1);
+        text.setTextWrap(false);
+        text.setTextColor(1);
+    }
+
+    // Lay out name and show it for durationMs
+    void show(const char* name, uint32_t durationMs) {
+        text.fillScreen(0);
+        uint8_t maxLines = (text.height() - TITLE_TOP) / TITLE_LINE_HEIGHT;
+        layouts.get(name, text.width(), TITLE_MARGIN, maxLines).draw(text, 0, TITLE_TOP, TITLE_LINE_HEIGHT);
+        if (layer == NULL) return;
+
+        // Shadows first, so the text lands on top where they overlap
+        layer->fill(LAYER_CLEAR);
+        const uint8_t* bits = text.getBuffer();
+        uint16_t bytesPerRow = (text.width() + 7) / 8;
+        for (uint8_t pass = 0; pass < 2; pass++) {
+            for (uint16_t j = 0; j < text.height(); j++) {
+                const uint8_t* row = bits + j * bytesPerRow;
+                for (uint16_t i = 0; i < text.width(); i++) {
+                    if (!(row[i >> 3] & (0x80 >> (i & 7)))) continue;
+                    if (pass == 0) {
+                        layer->setPixel(i + 1, j + 1, TITLE_SHADOW);
+                    } else {
+                        layer->setPixel(i, j, TITLE_TEXT);
+                    }
+                }
+            }
+        }
+        layer->setColor(TITLE_TEXT, rgb565(255, 255, 255));
+        layer->setColor(TITLE_SHADOW, rgb565(0, 0, 0));
+        layer->setVisible(true);
+
+        duration = durationMs;
+        shownAt = millis();
+        visible = true;
+    }
+
+    // Take the title down once it has been up for its duration; the
+    // compositor then has the automaton repaint what it covered
+    void update() {
+        if (!visible || millis() - shownAt < duration) return;
+        visible = false;
+        layer->setVisible(false);
+    }
+
+private:
+    GFXcanvas1 text;     // Laid-out title, one bit per pixel
+    TextLayoutCache layouts; // Wrapped names shown so far
+    Layer* layer;        // The title with its shadow, NULL if it didn't fit
+    bool visible;
+    uint32_t duration;   // How long the title stays up (ms)
+    uint32_t shownAt;    // millis() when show() was called
+};
+
+#endif
@@ -0,0 +1,414 @@
+#ifndef WALL_LINK_H
+#define WALL_LINK_H
+
+#include <Arduino.h>
+#include <hardware/gpio.h>
+#include "PanelConfig.h"
+#include "CellularAutomata.h"
+#include "SerialLog.h"
+
+// Controllers the wall is split between, each driving a horizontal slab of
+// TOTAL_WIDTH x TOTAL_HEIGHT pixels (its own panels), stacked top to
+// bottom. This one is WALL_NODE, 0 at the top; node 0 picks the automata.
+#ifndef WALL_NODES
+#define WALL_NODES 1
+#endif
+#ifndef WALL_NODE
+#define WALL_NODE 0
+#endif
+
+// PIO UART links to the node above and the node below (TX of one to RX of
+// the other; the top and bottom nodes are linked too, the grid wraps), and
+// the frame sync line, wired to every node with a pull-up. The defaults are
+// GPIOs the display leaves free on one chain (6 is R3, used with two).
+#ifndef WALL_UP_TX
+#define WALL_UP_TX 26
+#endif
+#ifndef WALL_UP_RX
+#define WALL_UP_RX 27
+#endif
+#ifndef WALL_DOWN_TX
+#define WALL_DOWN_TX 28
+#endif
+#ifndef WALL_DOWN_RX
+#define WALL_DOWN_RX 21
+#endif
+#ifndef WALL_SYNC_PIN
+#define WALL_SYNC_PIN 6
+#endif
+
+#if WALL_NODES > 1 && PANEL_CHAINS == 2 && WALL_SYNC_PIN == 6
+#error "GPIO 6 is R3_PIN with PANEL_CHAINS 2: set WALL_SYNC_PIN to a free GPIO"
+#endif
+
+// The automaton a wall runs, the one built on HaloGrid (Cyclic, type 4 in
+// createAutomatonOfType()); the others don't exchange rows yet
+#define WALL_AUTOMATON 4
+
+#define WALL_BAUD 2000000
+#define WALL_FIFO 2048        // Receive buffer per link, a couple of frames of rows
+
+// How long to wait for a neighbor's rows (ms) before wrapping that edge
+// round locally for the generation, and for the others at the sync line
+#define WALL_LINK_TIMEOUT 10
+#define WALL_SYNC_TIMEOUT 20
+
+// Time the sync line is left released once it goes high, so every node
+// waiting on it sees it before the first one holds it low again (us)
+#define WALL_SYNC_HOLD 50
+
+// Generations a neighbor may keep sending rows that don't fit (another
+// automaton, another generation) before the wall is started over, and how
+// often that may be asked for at most (ms)
+#define WALL_RESYNC_AFTER 8
+#define WALL_RESYNC_INTERVAL 1000
+
+// Frames: WALL_FRAME_SYNC, kind, epoch, u16 generation, u16 payload length,
+// the payload, then a CRC-8 (polynomial 0x07) of everything after the sync
+// byte. Multi-byte fields are little-endian.
+#define WALL_FRAME_SYNC 0xC3
+#define WALL_HEADER 6
+#define WALL_MAX_PAYLOAD 1024
+
+#define WALL_ROWS 1           // Halo rows of a generation
+#define WALL_START 2          // u8 type, u32 seed: start an automaton (downward)
+#define WALL_RESYNC 3         // Ask node 0 to start the wall over (upward)
+
+/**
+ * One controller of a wall several of them drive together
+ *
+ * A single RP2040 refreshes only so many panels, so a bigger wall is split
+ * into horizontal slabs, one per Pico, running one automaton between them.
+ * Each node computes its own slab; once a generation, HaloGrid's
+ * refreshHalo() hands this class (as the haloExchange()) the slab's first
+ * and last rows, which go to the nodes above and below while theirs come
+ * back into the halo. Waiting on the neighbors' rows keeps the nodes a
+ * generation apart at most, and syncFrame() before show() lines the frames
+ * up: every node holds the open-drain sync line low until it is ready, so
+ * the line only rises when the last one is.
+ *
+ * Node 0 chooses each automaton and announce()s its type and seed; the
+ * START frame is passed down the chain and every node builds the same
+ * automaton from it. An epoch number, moved on with each start, tells rows
+ * of the old automaton from the new. A node that boots late, or finds a
+ * neighbor out of step, sends RESYNC up to node 0, which starts the wall
+ * over. Rows that don't arrive in time are wrapped locally for that
+ * generation, so a missing neighbor slows the wall down but doesn't stop it.
+ *
+ * Rows are exchanged on the core computing the generation (core 1 with the
+ * pipeline); everything else on core 0 while core 1 is idle.
+ */
+class WallLink {
+public:
+    WallLink()
+        : epoch(0), generation(0), startPending(false), resyncPending(false),
+          startType(0), startSeed(0), lastResync(0), rowsMissed(0), syncMissed(0) {}
+
+    WallLink(const WallLink&) = delete;
+    WallLink& operator=(const WallLink&) = delete;
+
+    // Open the links and take over the grids' halo rows; nothing with one node
+    void begin() {
+        if (WALL_NODES < 2) return;
+        up.serial = new SerialPIO(WALL_UP_TX, WALL_UP_RX, WALL_FIFO);
+        down.serial = new SerialPIO(WALL_DOWN_TX, WALL_DOWN_RX, WALL_FIFO);
+        up.serial->begin(WALL_BAUD);
+        down.serial->begin(WALL_BAUD);
+
+        // Open drain: driven low while busy, an input (pulled up) when ready
+        gpio_init(WALL_SYNC_PIN);
+        gpio_put(WALL_SYNC_PIN, 0);
+        gpio_pull_up(WALL_SYNC_PIN);
+        gpio_set_dir(WALL_SYNC_PIN, GPIO_IN);
+
+        haloExchange() = exchangeRows;
+        lastResync = millis() - WALL_RESYNC_INTERVAL;
+    }
+
+    // Every node but node 0 runs the automata node 0 starts
+    bool isFollower() const { return WALL_NODES > 1 && WALL_NODE > 0; }
+
+    // Seed this node's cells from, given the seed the wall shares
+    static uint32_t slabSeed(uint32_t seed) {
+        return seed ^ (0x9E3779B9UL * (WALL_NODE + 1));
+    }
+
+    // Node 0: tell the others to start automaton type from seed
+    void announce(uint8_t type, uint32_t seed) {
+        if (WALL_NODES < 2 || isFollower()) return;
+        epoch++;
+        generation = 0;
+        uint8_t payload[5] = {type, (uint8_t)seed, (uint8_t)(seed >> 8), (uint8_t)(seed >> 16), (uint8_t)(seed >> 24)};
+        send(down, WALL_START, payload, sizeof(payload));
+        down.serial->flush();
+    }
+
+    // A follower with no automaton yet: read what has come in, and ask
+    // node 0 for a start now and then. Its sync line is left released, so
+    // the running nodes don't wait on it.
+    void poll() {
+        if (WALL_NODES < 2) return;
+        gpio_set_dir(WALL_SYNC_PIN, GPIO_IN);
+        pump(up);
+        pump(down);
+        requestResync();
+    }
+
+    // A follower told to start an automaton: its type and seed
+    bool takeStart(uint8_t& type, uint32_t& seed) {
+        if (!startPending) return false;
+        startPending = false;
+        type = startType;
+        seed = startSeed;
+        return true;
+    }
+
+    // Node 0 asked to start the wall over
+    bool takeResync() {
+        bool pending = resyncPending;
+        resyncPending = false;
+        return pending;
+    }
+
+    // Wait until every node is ready to show its frame (or the timeout
+    // passes), then hold the line low again for the next one. False on a
+    // timeout.
+    bool syncFrame() {
+        if (WALL_NODES < 2) return true;
+        gpio_set_dir(WALL_SYNC_PIN, GPIO_IN);
+        uint32_t start = micros();
+        bool synced = true;
+        while (!gpio_get(WALL_SYNC_PIN)) {
+            if (micros() - start > WALL_SYNC_TIMEOUT * 1000UL) {
+                synced = false;
+                syncMissed++;
+                break;
+            }
+        }
+        if (synced) delayMicroseconds(WALL_SYNC_HOLD);
+        gpio_set_dir(WALL_SYNC_PIN, GPIO_OUT);
+        return synced;
+    }
+
+    void printStats(Print& out) const {
+        if (WALL_NODES < 2) return;
+        out.print("  wall node ");
+        out.print(WALL_NODE);
+        out.print(" of ");
+        out.print(WALL_NODES);
+        out.print(": ");
+        out.print(rowsMissed);
+        out.print(" halo edges wrapped locally, ");
+        out.print(syncMissed);
+        out.println(" frame syncs timed out");
+    }
+
+private:
+    // One link and the frame being read off it
+    struct Port {
+        enum State { SEEK, HEADER, PAYLOAD, CHECK };
+
+        SerialPIO* serial = nullptr;
+        State state = SEEK;
+        uint8_t header[WALL_HEADER];
+        uint8_t at = 0;             // Header bytes so far
+        uint16_t length = 0;
+        uint16_t read = 0;          // Payload bytes so far
+        uint8_t crc = 0;
+        uint8_t* target = nullptr;  // Where the payload goes, NULL to skip it
+        uint8_t small[5];           // START payload
+
+        // The rows this generation waits for
+        uint8_t* rows = nullptr;
+        uint16_t rowBytes = 0;
+        uint16_t rowGeneration = 0;
+        bool received = false;
+        bool dropped = false;       // Rows that didn't fit came in meanwhile
+        uint8_t mismatches = 0;     // Generations in a row that only had those
+    };
+
+    static uint8_t exchangeRows(const uint8_t* first, const uint8_t* last,
+                                uint8_t* above, uint8_t* below, uint16_t bytes);
+
+    // Send this slab's edge rows both ways and wait for the neighbors'
+    uint8_t exchange(const uint8_t* first, const uint8_t* last,
+                     uint8_t* above, uint8_t* below, uint16_t bytes) {
+        generation++;
+        send(up, WALL_ROWS, first, bytes);
+        send(down, WALL_ROWS, last, bytes);
+        expect(up, above, bytes);
+        expect(down, below, bytes);
+
+        uint32_t start = millis();
+        while ((!up.received || !down.received) && !startPending &&
+               millis() - start < WALL_LINK_TIMEOUT) {
+            pump(up);
+            pump(down);
+        }
+        settle(up);
+        settle(down);
+        return (up.received ? HALO_ABOVE : 0) | (down.received ? HALO_BELOW : 0);
+    }
+
+    void expect(Port& p, uint8_t* rows, uint16_t bytes) {
+        p.rows = rows;
+        p.rowBytes = bytes;
+        p.rowGeneration = generation;
+        p.received = false;
+        p.dropped = false;
+    }
+
+    // After the wait: count the edge if it never came, and ask for a start
+    // over if the neighbor has been sending the wrong rows for a while
+    void settle(Port& p) {
+        p.rows = nullptr;
+        if (p.received) {
+            p.mismatches = 0;
+            return;
+        }
+        rowsMissed++;
+        if (p.dropped && ++p.mismatches >= WALL_RESYNC_AFTER) {
+            p.mismatches = 0;
+            requestResync();
+        }
+    }
+
+    void requestResync() {
+        if (millis() - lastResync < WALL_RESYNC_INTERVAL) return;
+        lastResync = millis();
+        if (isFollower()) {
+            send(up, WALL_RESYNC, nullptr, 0);
+        } else {
+            resyncPending = true;
+        }
+    }
+
+    // Read what has arrived, stopping once this generation's rows are in
+    // (the next generation's may follow right behind)
+    void pump(Port& p) {
+        while (!p.received && p.serial->available()) {
+            feed(p, p.serial->read());
+        }
+    }
+
+    void feed(Port& p, uint8_t c) {
+        switch (p.state) {
+            case Port::SEEK:
+                if (c == WALL_FRAME_SYNC) {
+                    p.state = Port::HEADER;
+                    p.at = 0;
+                    p.crc = 0;
+                }
+                break;
+
+            case Port::HEADER:
+                p.header[p.at++] = c;
+                p.crc = crc8(p.crc, c);
+                if (p.at == WALL_HEADER) beginPayload(p);
+                break;
+
+            case Port::PAYLOAD:
+                if (p.target) p.target[p.read] = c;
+                p.crc = crc8(p.crc, c);
+                if (++p.read == p.length) p.state = Port::CHECK;
+                break;
+
+            case Port::CHECK:
+                if (c == p.crc) finish(p);
+                p.state = Port::SEEK;
+                break;
+        }
+    }
+
+    // Header in: decide where the payload goes
+    void beginPayload(Port& p) {
+        uint8_t kind = p.header[0];
+        uint8_t frameEpoch = p.header[1];
+        uint16_t frameGeneration = p.header[2] | (p.header[3] << 8);
+        p.length = p.header[4] | (p.header[5] << 8);
+        p.read = 0;
+        p.target = nullptr;
+        if (p.length > WALL_MAX_PAYLOAD) {
+            p.state = Port::SEEK; // Not a frame after all
+            return;
+        }
+        if (kind == WALL_ROWS) {
+            if (p.rows && frameEpoch == epoch && frameGeneration == p.rowGeneration &&
+                p.length == p.rowBytes) {
+                p.target = p.rows;
+            } else {
+                p.dropped = true;
+            }
+        } else if (kind == WALL_START && p.length == sizeof(p.small)) {
+            p.target = p.small;
+        }
+        p.state = p.length > 0 ? Port::PAYLOAD : Port::CHECK;
+    }
+
+    // A whole frame with a good CRC
+    void finish(Port& p) {
+        uint8_t kind = p.header[0];
+        if (kind == WALL_ROWS && p.target == p.rows && p.rows != nullptr) {
+            p.received = true;
+        } else if (kind == WALL_START && p.target == p.small && isFollower() && &p == &up) {
+            epoch = p.header[1];
+            generation = 0;
+            startType = p.small[0];
+            startSeed = p.small[1] | (p.small[2] << 8) | ((uint32_t)p.small[3] << 16) |
+                        ((uint32_t)p.small[4] << 24);
+            startPending = true;
+            if (WALL_NODE + 1 < WALL_NODES) send(down, WALL_START, p.small, sizeof(p.small));
+        } else if (kind == WALL_RESYNC && &p == &down) {
+            if (isFollower()) {
+                send(up, WALL_RESYNC, nullptr, 0);
+            } else {
+                resyncPending = true;
+            }
+        }
+    }
+
+    void send(Port& p, uint8_t kind, const uint8_t* payload, uint16_t length) {
+        uint8_t header[WALL_HEADER + 1] = {WALL_FRAME_SYNC, kind, epoch, (uint8_t)generation,
+                                           (uint8_t)(generation >> 8), (uint8_t)length,
+                                           (uint8_t)(length >> 8)};
+        uint8_t crc = 0;
+        for (uint8_t i = 1; i <= WALL_HEADER; i++) crc = crc8(crc, header[i]);
+        for (uint16_t i = 0; i < length; i++) crc = crc8(crc, payload[i]);
+        p.serial->write(header, sizeof(header));
+        if (length > 0) p.serial->write(payload, length);
+        p.serial->write(crc);
+    }
+
+    static uint8_t crc8(uint8_t crc, uint8_t c) {
+        crc ^= c;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+        return crc;
+    }
+
+    Port up;                   // To the node above (node WALL_NODES - 1 for node 0)
+    Port down;                 // To the node below (node 0 for the last)
+    uint8_t epoch;             // Of the automaton running, +1 per start
+    uint16_t generation;       // Of it, counted by exchanges
+    volatile bool startPending;
+    volatile bool resyncPending;
+    uint8_t startType;
+    uint32_t startSeed;
+    uint32_t lastResync;       // millis() of the last RESYNC asked for
+    uint32_t rowsMissed;
+    uint32_t syncMissed;
+};
+
+// The link of this node
+inline WallLink& wallLink() {
+    static WallLink instance;
+    return instance;
+}
+
+inline uint8_t WallLink::exchangeRows(const uint8_t* first, const uint8_t* last,
+                                      uint8_t* above, uint8_t* below, uint16_t bytes) {
+    return wallLink().exchange(first, last, above, below, bytes);
+}
+
+#endif
@@ -1,8 +1,21 @@
 #include <Arduino.h>
+#include <malloc.h>
 #include <Adafruit_GFX.h>
-#include <Adafruit_Protomatter.h>
+#include <MatrixController.h>
+#include <PanelDriver.h>
 #include "PanelConfig.h"
 #include "CellularAutomata.h"
+#include "FrameScheduler.h"
+#include "CrossFade.h"
+#include "TitleOverlay.h"
+#include "FrameStream.h"
+#include "SnapshotStore.h"
+#include "Telemetry.h"
+#include "SerialLog.h"
+#include "BenchmarkSweep.h"
+#include "PerfHud.h"
+#include "Compositor.h"
+#include "WallLink.h"
 
 // RGB Matrix pinout for Raspberry Pi Pico
 #define R1_PIN 2
@@ -12,6 +25,14 @@
 #define G2_PIN 8
 #define B2_PIN 9
 
+// Second RGB pin group, only used with PANEL_CHAINS 2 (bottom row of panels)
+#define R3_PIN 6
+#define G3_PIN 7
+#define B3_PIN 14
+#define R4_PIN 15
+#define G4_PIN 17
+#define B4_PIN 19
+
 #define A_PIN 10
 #define B_PIN 16
 #define C_PIN 18
@@ -22,123 +43,160 @@
 #define LAT_PIN 12
 #define OE_PIN 13
 
-// Panel dimensions
-#define PANEL_WIDTH 64
-#define PANEL_HEIGHT 64
-#define PANEL_COUNT 4
-#define TOTAL_WIDTH (PANEL_WIDTH * 2)
-#define TOTAL_HEIGHT (PANEL_HEIGHT * 2)
-
 // Animation speed settings
-#define FRAME_DELAY 20      // Milliseconds between frames (reduced for faster animation)
+#define FRAME_PERIOD 20     // Target milliseconds per frame (50 FPS)
+#define MAX_FRAME_PERIOD 100  // Slowest frame period to fall back to when an automaton can't keep up
+#define GENERATIONS_PER_FRAME 1  // Generations computed for each frame shown (see CellularAutomaton::computeMany())
+#define STATS_INTERVAL 30000  // Dump stage timing over Serial1 this often (0 = only on request)
+#define BENCH_GENERATIONS 300  // Generations a 'b' console command times when given no count
+#define SWEEP_GENERATIONS 200  // Generations per case of a 'w' benchmark sweep when given no count
+#define TELEMETRY_INTERVAL 250  // Send a binary population/activity record over Serial1 this often (ms, 0 = off)
 #define AUTOMATON_DURATION 180000  // Run each automaton for 3 minutes before switching
+#define STAGNANT_GENERATIONS 250   // Switch early once the grid has only repeated itself this long (0 = never)
+#define TRANSITION_FRAMES 50  // Cross-fade into each new automaton over this many frames (0 = cut straight over)
+#define TITLE_DURATION 4000   // Show each automaton's name over it for this long (ms)
+#define WARMUP_GENERATIONS 300  // Fast-forward each new automaton this far under its title before it fades in (0 = none)
+#define WARMUP_MS 2000          // but for no longer than this (ms)
+#define GOL_WORLD_CHANCE 50   // Percent of Game of Life runs on a world bigger than the display (GOL_WORLD_SCALE)
+#define STREAM_BAUD 2000000   // USB serial for frames from a host (the rate is nominal over USB CDC)
+#define SNAPSHOT_DELAY 10000      // Save each new automaton to flash this long after it starts (ms)
+#define SNAPSHOT_INTERVAL 300000  // and again this often while it runs, to resume from at boot
+
+// Compute the next generation on core 1 while core 0 shows the current one
+#define DUAL_CORE_PIPELINE 1
+
+// Repeatable runs, e.g. for comparing frame times (-D in platformio.ini, or
+// over Serial1, see runCommand()). With a seed, the n-th automaton after boot is
+// set up from seed + n, so the same seed replays the same automata, and
+// nothing is restored from or saved to flash.
+#ifndef AUTOMATON_SEED
+#define AUTOMATON_SEED 0      // 0 = seed each automaton from noise
+#endif
+#ifndef AUTOMATON_TYPE
+#define AUTOMATON_TYPE 255    // Only run this type (0 to NUM_AUTOMATA - 1), 255 = any
+#endif
+
+// Show the frame-time HUD (src/PerfHud.h) from boot; 'o' over Serial1
+// toggles it either way
+#ifndef PERF_HUD
+#define PERF_HUD 0
+#endif
+
+// Run the benchmark sweep (src/BenchmarkSweep.h) at boot, this many
+// generations per case, before the display starts as usual
+#ifndef BENCHMARK
+#define BENCHMARK 0
+#endif
 
 // Global variables
+#if PANEL_CHAINS == 2
+uint8_t rgbPins[] = {R1_PIN, G1_PIN, B1_PIN, R2_PIN, G2_PIN, B2_PIN,
+                     R3_PIN, G3_PIN, B3_PIN, R4_PIN, G4_PIN, B4_PIN};
+#else
 uint8_t rgbPins[] = {R1_PIN, G1_PIN, B1_PIN, R2_PIN, G2_PIN, B2_PIN};
+#endif
 uint8_t addrPins[] = {A_PIN, B_PIN, C_PIN, D_PIN, E_PIN};
 
-// Create the matrix object with explicit width parameter for multiple panels
-Adafruit_Protomatter matrix(
-  PANEL_WIDTH * 2,  // CRITICAL: Width must be total width (2 panels wide)
-  4,                // Bit depth (4 = 4096 colors)
-  1, rgbPins,       // Number of RGB pins, RGB pins
-  5, addrPins,      // Number of address pins, address pins
+// Create the matrix controller with explicit width parameter for multiple panels
+MatrixController display(
+  rgbPins, addrPins,         // RGB pins, address pins
   CLK_PIN, LAT_PIN, OE_PIN,  // Other pins
-  true,             // Double-buffering
-  2                 // 2 vertical tiles (2x2 grid)
+  TOTAL_WIDTH,               // CRITICAL: Width must be total width (a whole row of panels)
+  TOTAL_HEIGHT,              // Total height (every row of panels)
+  1,                         // Width already covers the whole chain
+  true,                      // Double-buffering
+  PANEL_TILE_MODE,           // Rows of panels per chain, negative if serpentine
+  PANEL_CHAINS               // Parallel chains (RGB pin groups)
 );
 
+// FM6126A control registers, written before the display starts and again
+// on request over Serial1 ('r') to recover panels without a restart
+PanelDriver panelDriver(rgbPins, sizeof(rgbPins), CLK_PIN, LAT_PIN, OE_PIN,
+                        PANELS_PER_CHAIN * PANEL_WIDTH);
+
+// Underlying display (Protomatter or Hub75Pio), used directly for text and GFX primitives
+MatrixDisplay& matrix = *display.getDisplay();
+
 // Global pointer to the current cellular automaton
 CellularAutomaton* currentAutomaton = nullptr;
 unsigned long lastAutomatonChange = 0;
+unsigned long lastStatsReport = 0;
+uint32_t statsInterval = STATS_INTERVAL;
+uint16_t generationsPerFrame = GENERATIONS_PER_FRAME;
+uint16_t frameGenerations = GENERATIONS_PER_FRAME; // Computed this frame: fewer to end a benchmark
 
-// Hardware initialization for matrix panels
-void Reginit() {
-  pinMode(R1_PIN, OUTPUT);
-  pinMode(G1_PIN, OUTPUT);
-  pinMode(B1_PIN, OUTPUT);
-  pinMode(R2_PIN, OUTPUT);
-  pinMode(G2_PIN, OUTPUT);
-  pinMode(B2_PIN, OUTPUT);
-  pinMode(CLK_PIN, OUTPUT);
-  pinMode(OE_PIN, OUTPUT);
-  pinMode(LAT_PIN, OUTPUT);
-
-  digitalWrite(OE_PIN, HIGH);
-  digitalWrite(LAT_PIN, LOW);
-  digitalWrite(CLK_PIN, LOW);
-  
-  int MaxLed = 64;
-  int C12[16] = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
-  int C13[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0};
-
-  for (int l = 0; l < MaxLed; l++) {
-    int y = l % 16;
-    digitalWrite(R1_PIN, LOW);
-    digitalWrite(G1_PIN, LOW);
-    digitalWrite(B1_PIN, LOW);
-    digitalWrite(R2_PIN, LOW);
-    digitalWrite(G2_PIN, LOW);
-    digitalWrite(B2_PIN, LOW);
-    if (C12[y] == 1) {
-      digitalWrite(R1_PIN, HIGH);
-      digitalWrite(G1_PIN, HIGH);
-      digitalWrite(B1_PIN, HIGH);
-      digitalWrite(R2_PIN, HIGH);
-      digitalWrite(G2_PIN, HIGH);
-      digitalWrite(B2_PIN, HIGH);
-    }
-    if (l > MaxLed - 12) {
-      digitalWrite(LAT_PIN, HIGH);
-    } else {
-      digitalWrite(LAT_PIN, LOW);
-    }
-    digitalWrite(CLK_PIN, HIGH);
-    delayMicroseconds(2);
-    digitalWrite(CLK_PIN, LOW);
-  }
-  digitalWrite(LAT_PIN, LOW);
-  digitalWrite(CLK_PIN, LOW);
-
-  // Send Data to control register 12
-  for (int l = 0; l < MaxLed; l++) {
-    int y = l % 16;
-    digitalWrite(R1_PIN, LOW);
-    digitalWrite(G1_PIN, LOW);
-    digitalWrite(B1_PIN, LOW);
-    digitalWrite(R2_PIN, LOW);
-    digitalWrite(G2_PIN, LOW);
-    digitalWrite(B2_PIN, LOW);
-    if (C13[y] == 1) {
-      digitalWrite(R1_PIN, HIGH);
-      digitalWrite(G1_PIN, HIGH);
-      digitalWrite(B1_PIN, HIGH);
-      digitalWrite(R2_PIN, HIGH);
-      digitalWrite(G2_PIN, HIGH);
-      digitalWrite(B2_PIN, HIGH);
-    }
-    if (l > MaxLed - 13) {
-      digitalWrite(LAT_PIN, HIGH);
-    } else {
-      digitalWrite(LAT_PIN, LOW);
-    }
-    digitalWrite(CLK_PIN, HIGH);
-    delayMicroseconds(2);
-    digitalWrite(CLK_PIN, LOW);
-  }
-  digitalWrite(LAT_PIN, LOW);
-  digitalWrite(CLK_PIN, LOW);
+// Console commands over Serial1 (see runCommand()) for loop() to act on
+bool statsRequested = false;
+bool restartRequested = false;
+
+// Benchmark started from the console: generations still to time, out of
+// how many, since when
+uint32_t benchRemaining = 0;
+uint32_t benchGenerations = 0;
+unsigned long benchStart = 0;
+uint32_t sweepRequested = 0;  // Generations per case of a requested sweep
+
+// Frames that reached the panel, counted at the swap (in the DMA interrupt
+// with MATRIX_PIO) rather than when show() was called
+volatile uint32_t framesSwapped = 0;
+void onFrameSwapped() {
+  framesSwapped++;
 }
 
+// Paces the main loop to FRAME_PERIOD regardless of how long a step takes
+FrameScheduler frameScheduler(FRAME_PERIOD, MAX_FRAME_PERIOD);
+
+#if TRANSITION_FRAMES > 0
+// Offscreen frame the incoming automaton renders into while it fades in
+uint16_t transitionFrame[TOTAL_WIDTH * TOTAL_HEIGHT];
+CrossFade crossFade(display, transitionFrame, TRANSITION_FRAMES);
+#else
+CrossFade crossFade(display, NULL, 0);
+#endif
+
+// Layers over the automaton, painted into the canvas before each show()
+Compositor compositor(display);
+
+// Name of the current automaton, drawn over the top-right panel
+TitleOverlay titleOverlay(compositor, PANEL_WIDTH, 0, PANEL_WIDTH, PANEL_HEIGHT);
+
+// Frame rate and stage times in the bottom-left corner, above the title
+PerfHud perfHud(compositor, 0, TOTAL_HEIGHT - HUD_HEIGHT);
+
+// Frames sent by a host over USB serial take over the display while they
+// keep coming (tools/stream_frames.py)
+FrameStream frameStream(display, Serial);
+bool streaming = false;
+
+// Snapshots of the running automaton in flash, so a reboot carries on
+// where it was instead of starting a new one
+SnapshotStore snapshotStore;
+unsigned long lastSnapshot = 0;
+unsigned long snapshotWait = SNAPSHOT_DELAY;
+
+// Population and activity records between the log lines on Serial1
+// (tools/telemetry.py)
+Telemetry telemetry(logOut(), TELEMETRY_INTERVAL);
+
+// Replay settings (AUTOMATON_SEED, AUTOMATON_TYPE)
+uint32_t replaySeed = AUTOMATON_SEED;
+uint32_t replaySwitches = 0;  // Automata set up since replaySeed was set
+uint8_t onlyType = AUTOMATON_TYPE;
+uint32_t automatonSeed = 0;   // What the current automaton was seeded with
+
+// Generations the new automaton still has to fast-forward before its first
+// frame is drawn (see warmUpFrame()), and since when it has been at it
+uint32_t warmupRemaining = 0;
+uint32_t warmupDone = 0;
+unsigned long warmupStart = 0;
+
 // Function to draw a pixel with proper panel mapping
-void drawMappedPixel(Adafruit_Protomatter* matrix, int16_t x, int16_t y, uint16_t color) {
-  int16_t mapped_x, mapped_y;
-  mapCoordinates(x, y, &mapped_x, &mapped_y);
-  matrix->drawPixel(mapped_x, mapped_y, color);
+void drawMappedPixel(MatrixController* display, int16_t x, int16_t y, uint16_t color) {
+  display->drawMappedPixel(x, y, color);
 }
 
 // Function to draw text using mapped coordinates
-void drawMappedText(Adafruit_Protomatter* matrix, const char* text, int16_t x, int16_t y, uint16_t color) {
+void drawMappedText(MatrixDisplay* matrix, const char* text, int16_t x, int16_t y, uint16_t color) {
   // Save current text settings
   int16_t x1, y1;
   uint16_t w, h;
@@ -148,7 +206,7 @@ void drawMappedText(Adafruit_Protomatter* matrix, const char* text, int16_t x, i
   
   // Map the starting position
   int16_t mapped_x, mapped_y;
-  mapCoordinates(x, y, &mapped_x, &mapped_y);
+  PanelMap::map(x, y, &mapped_x, &mapped_y);
   
   // Set cursor to mapped position and color
   matrix->setCursor(mapped_x, mapped_y);
@@ -158,151 +216,140 @@ void drawMappedText(Adafruit_Protomatter* matrix, const char* text, int16_t x, i
   matrix->print(text);
 }
 
-// Function to display automaton name on the top-right panel only
-void displayAutomatonName(const char* name) {
-  // Clear everything
-  matrix.fillScreen(0);
-  
-  // Define colors
-  uint16_t WHITE = matrix.color565(255, 255, 255);
-  uint16_t RED = matrix.color565(255, 0, 0);
-  
-  // Log the name to serial
-  Serial1.print("Selected automaton: ");
-  Serial1.println(name);
-  
-  // CRITICAL: Explicitly clear the bottom-right panel
-  for (int x = PANEL_WIDTH; x < PANEL_WIDTH * 2; x++) {
-    for (int y = PANEL_HEIGHT; y < PANEL_HEIGHT * 2; y++) {
-      matrix.drawPixel(x, y, 0); // Black
-    }
-  }
-  
-  // Draw a red border around the top-right panel to make it clear
-  for (int x = PANEL_WIDTH; x < PANEL_WIDTH * 2; x++) {
-    matrix.drawPixel(x, 0, RED);
-    matrix.drawPixel(x, PANEL_HEIGHT - 1, RED);
-  }
-  for (int y = 0; y < PANEL_HEIGHT; y++) {
-    matrix.drawPixel(PANEL_WIDTH, y, RED);
-    matrix.drawPixel(PANEL_WIDTH * 2 - 1, y, RED);
-  }
-  
-  // Set text size and color - use smallest possible text
-  matrix.setTextSize(1); // Default size is about 8 pixels tall
-  matrix.setTextColor(WHITE);
-  
-  // Define the text area for the top-right panel only
-  const int TEXT_AREA_WIDTH = PANEL_WIDTH - 10; // 5 pixel margin on each side
-  const int TEXT_AREA_X = PANEL_WIDTH + 5; // Top-right panel starts at PANEL_WIDTH
-  const int TEXT_AREA_Y = 15; // Position from top
-  const int LINE_HEIGHT = 9; // Reduced space between lines
-  
-  // Split the text into words
-  char words[32][32]; // Assuming no more than 32 words, each no longer than 31 chars
-  int wordCount = 0;
-  
-  // Copy the name to a temporary buffer we can modify
-  char tempName[256];
-  strncpy(tempName, name, 255);
-  tempName[255] = '\0';
-  
-  // Split the string into words
-  char* word = strtok(tempName, " ");
-  while (word != NULL && wordCount < 32) {
-    strcpy(words[wordCount], word);
-    wordCount++;
-    word = strtok(NULL, " ");
-  }
-  
-  // Now arrange words into lines that fit the width
-  char lines[8][64]; // Up to 8 lines, each up to 63 chars
-  int lineCount = 0;
-  int currentLine = 0;
-  uint16_t currentLineWidth = 0;
-  
-  lines[0][0] = '\0'; // Start with empty first line
-  
-  for (int i = 0; i < wordCount; i++) {
-    // Calculate width of this word
-    int16_t x1, y1;
-    uint16_t wordWidth, h;
-    matrix.getTextBounds(words[i], 0, 0, &x1, &y1, &wordWidth, &h);
-    
-    // Calculate width if we add this word to the current line
-    char testLine[64];
-    if (strlen(lines[currentLine]) > 0) {
-      // Add a space before the word if the line isn't empty
-      sprintf(testLine, "%s %s", lines[currentLine], words[i]);
-    } else {
-      strcpy(testLine, words[i]);
-    }
-    
-    uint16_t testWidth;
-    matrix.getTextBounds(testLine, 0, 0, &x1, &y1, &testWidth, &h);
-    
-    // Check if adding this word would exceed the line width
-    if (testWidth <= TEXT_AREA_WIDTH) {
-      // Word fits, add it to the current line
-      strcpy(lines[currentLine], testLine);
-      currentLineWidth = testWidth;
-    } else {
-      // Word doesn't fit, start a new line
-      currentLine++;
-      if (currentLine >= 8) break; // Maximum 8 lines
-      
-      // Start the new line with this word
-      strcpy(lines[currentLine], words[i]);
-      
-      // Calculate the width of the new line
-      matrix.getTextBounds(lines[currentLine], 0, 0, &x1, &y1, &currentLineWidth, &h);
-    }
-  }
-  
-  // Update line count
-  lineCount = currentLine + 1;
-  
-  // Display each line centered
-  for (int i = 0; i < lineCount; i++) {
-    // Calculate width for centering
-    int16_t x1, y1;
-    uint16_t lineWidth, h;
-    matrix.getTextBounds(lines[i], 0, 0, &x1, &y1, &lineWidth, &h);
-    
-    // Center and display this line
-    int centerX = TEXT_AREA_X + (TEXT_AREA_WIDTH - lineWidth) / 2;
-    matrix.setCursor(centerX, TEXT_AREA_Y + i * LINE_HEIGHT);
-    matrix.print(lines[i]);
-  }
-  
-  // Show the display
-  matrix.show();
-  delay(5000); // Show name for 5 seconds as requested
+// Report how often the panels were refreshed since the last report.
+// Protomatter's refresh ISR cost grows with MATRIX_BIT_DEPTH; compare this
+// figure and the show/update times across depths to pick one.
+void printRefreshRate() {
+  unsigned long elapsed = millis() - lastStatsReport;
+  if (elapsed == 0) return;
+  Print& out = logOut();
+  out.print("  refresh ");
+  out.print(display.getRefreshCount() * 1000UL / elapsed);
+  out.print(" Hz at bit depth ");
+  out.print(MATRIX_BIT_DEPTH);
+  out.print(", ");
+  out.print(framesSwapped * 1000UL / elapsed);
+  out.println(" frames/s on the panel");
+  framesSwapped = 0;
 }
 
+// Heap in use and the most it has taken so far: newlib doesn't give the
+// top of the heap back, so mallinfo().arena is its high-water mark. Then
+// the current automaton's share of its arena, the most the arena has held
+// (the hungriest automaton so far, snapshot staging included), and the
+// layers' arena.
+void printMemory() {
+  struct mallinfo heap = mallinfo();
+  Print& out = logOut();
+  out.print("  memory: heap ");
+  out.print(heap.uordblks);
+  out.print(" used, ");
+  out.print(heap.arena);
+  out.print(" high-water, of ");
+  out.print(rp2040.getTotalHeap());
+  out.print("; automaton ");
+  out.print(currentAutomaton != nullptr ? currentAutomaton->footprint() : 0);
+  out.print(" of ");
+  out.print(automatonArena().getSize());
+  out.print(" (peak ");
+  out.print(automatonArena().getPeak());
+  out.print("); layers ");
+  out.print(compositor.getArenaUsed());
+  out.print(" of ");
+  out.println(compositor.getArenaSize());
+}
+
+// The big statically allocated buffers, once at boot (the Protomatter or
+// PIO frame buffers and the canvas are on the heap, see printMemory()).
+// `pio run -t memory` lists every symbol from the linked firmware.
+void printStaticMemory() {
+  Print& out = logOut();
+  out.print("Static buffers: automaton arena ");
+  out.print(automatonArena().getSize());
+#if TRANSITION_FRAMES > 0
+  out.print(", cross-fade frame ");
+  out.print(sizeof(transitionFrame));
+#endif
+  out.print(", compositor ");
+  out.print(sizeof(compositor));
+  out.print(", frame stream ");
+  out.print(sizeof(frameStream));
+  out.print(", log ");
+  out.print(sizeof(serialLog()));
+  out.print(", wall link ");
+  out.print(sizeof(wallLink()));
+  out.println(" bytes");
+}
 
 // Keep track of the last automaton type to avoid repeating
 static uint8_t lastAutomatonType = 255; // Initialize to an invalid value
 
-// Function to select a random automaton
-void selectRandomAutomaton() {
-  // Delete any existing automaton
-  if (currentAutomaton != nullptr) {
-    delete currentAutomaton;
-    currentAutomaton = nullptr;
+// Delete the current automaton, if any; this rewinds the automaton arena,
+// so the next one reuses the same memory without touching the heap
+void deleteAutomaton() {
+  if (currentAutomaton == nullptr) return;
+  // Final timing summary for the outgoing automaton
+  currentAutomaton->printStats(logOut());
+  if (benchRemaining > 0) {
+    logOut().println("Benchmark cut short by the switch");
+    benchRemaining = 0;
   }
-  
-  // Seed the random number generator with multiple sources of entropy
-  // Use a combination of time, analog noise, and a rotating value
-  static uint32_t seedRotator = 0;
-  seedRotator = (seedRotator * 1664525) + 1013904223; // Simple LCG for additional entropy
-  randomSeed(millis() ^ analogRead(A0) ^ seedRotator);
+  snapshotStore.cancel(); // Its copy is in the arena too
+  delete currentAutomaton;
+  currentAutomaton = nullptr;
+}
+
+// Time every automaton and preset (see BenchmarkSweep), with the display
+// showing each as it runs. The arena is the sweep's meanwhile, so the
+// current automaton goes; start another one afterwards.
+void runBenchmarkSweep(uint32_t generations) {
+  deleteAutomaton();
+  crossFade.cancel();
+  BenchmarkSweep sweep(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
+  HaloExchange exchange = haloExchange(); // Each case runs on this node alone
+  haloExchange() = NULL;
+  sweep.run(generations, logOut());
+  haloExchange() = exchange;
+}
+
+// Function to select a random automaton, or automaton type from seed (the
+// one node 0 of a wall started, see WallLink.h)
+void selectRandomAutomaton(uint8_t type = 255, uint32_t seed = 0) {
+  deleteAutomaton();
+  
+  // Time building the next automaton, up to the point its first frame can
+  // be drawn
+  uint32_t switchStart = micros();
+  
+  // Seed the random number generator: from the replay seed, or with
+  // multiple sources of entropy (time, analog noise and a rotating value).
+  // On a wall A0 is GPIO 26, WALL_UP_TX: analogRead() would take the pin
+  // from the up link, so the ring oscillator stands in for the noise there.
+  if (type < NUM_AUTOMATA) {
+    automatonSeed = seed;
+  } else if (replaySeed != 0) {
+    automatonSeed = replaySeed + replaySwitches++;
+  } else {
+    static uint32_t seedRotator = 0;
+    seedRotator = (seedRotator * 1664525) + 1013904223; // Simple LCG for additional entropy
+    uint32_t noise = WALL_NODES > 1 ? rp2040.hwrand32() : analogRead(A0);
+    automatonSeed = millis() ^ noise ^ seedRotator;
+  }
+  fastRandomSeed(automatonSeed);
   
   // Select a random automaton type, ensuring it's different from the last one
   uint8_t newType;
-  do {
-    newType = random(NUM_AUTOMATA);
-  } while (newType == lastAutomatonType && NUM_AUTOMATA > 1);
+  if (type < NUM_AUTOMATA) {
+    newType = type;
+  } else if (WALL_NODES > 1) {
+    newType = WALL_AUTOMATON; // The one that spans the nodes
+  } else if (onlyType < NUM_AUTOMATA) {
+    newType = onlyType;
+  } else {
+    do {
+      newType = fastRandom(NUM_AUTOMATA);
+    } while (newType == lastAutomatonType && NUM_AUTOMATA > 1);
+  }
   
   // Remember this type to avoid repeating next time
   lastAutomatonType = newType;
@@ -310,47 +357,281 @@ void selectRandomAutomaton() {
   // Create the new automaton of the selected type
   switch (newType) {
     case 0: {
-      ElementaryAutomaton* automaton = new ElementaryAutomaton(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT);
+      ElementaryAutomaton* automaton = new ElementaryAutomaton(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
       automaton->randomRule();
       currentAutomaton = automaton;
       break;
     }
     case 1:
-      currentAutomaton = new GameOfLife(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT);
+      if (fastRandom(100) < GOL_WORLD_CHANCE) {
+        // Panned and zoomed onto the display, see GameOfLife
+        currentAutomaton = new GameOfLife(&display, TOTAL_WIDTH * GOL_WORLD_SCALE, TOTAL_HEIGHT * GOL_WORLD_SCALE);
+      } else {
+        currentAutomaton = new GameOfLife(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
+      }
       break;
     case 2:
-      currentAutomaton = new BriansBrain(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT);
+      currentAutomaton = new BriansBrain(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
       break;
     case 3: {
-      uint8_t antCount = random(1, 6);  // 1-5 ants
-      currentAutomaton = new LangtonsAnt(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT, antCount);
+      uint8_t antCount = fastRandom(1, 6);  // 1-5 ants
+      LangtonsAnt* automaton = new LangtonsAnt(&display, TOTAL_WIDTH, TOTAL_HEIGHT, antCount);
+      automaton->randomRule();
+      currentAutomaton = automaton;
       break;
     }
     case 4:
-      currentAutomaton = new CyclicAutomaton(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT);
+      currentAutomaton = new CyclicAutomaton(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
       break;
     case 5:
-      currentAutomaton = new BubblingLava(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT);
+      currentAutomaton = new BubblingLava(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
       break;
     case 6:
-      currentAutomaton = new OrderAndChaos(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT);
+      currentAutomaton = new OrderAndChaos(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
+      break;
+    case 7: {
+      LargerThanLife* automaton = new LargerThanLife(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
+      automaton->randomRule();
+      currentAutomaton = automaton;
+      break;
+    }
+    case 8:
+      currentAutomaton = new SmoothLife(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
       break;
     default:
-      currentAutomaton = new ElementaryAutomaton(&matrix, TOTAL_WIDTH, TOTAL_HEIGHT);
+      currentAutomaton = new ElementaryAutomaton(&display, TOTAL_WIDTH, TOTAL_HEIGHT);
       break;
   }
   
   // Initialize the automaton
   currentAutomaton->init();
   
-  // Display the name of the automaton
-  displayAutomatonName(currentAutomaton->getName());
+  // On a wall every node has the same rule from the same seed, then cells
+  // of its own, and node 0 has the others start it too
+  if (WALL_NODES > 1 && newType == WALL_AUTOMATON) {
+    fastRandomSeed(WallLink::slabSeed(automatonSeed));
+    static_cast<CyclicAutomaton*>(currentAutomaton)->scatter();
+    wallLink().announce(newType, automatonSeed);
+  }
+  
+  // Put its name up for a while (on node 0 of a wall, whose slab it is on)
+  // over the outgoing automaton's last frame, still on the canvas. The new
+  // one first skips the grey mush of its first few hundred generations
+  // there (warmUpFrame()), then fades in from that frame. A wall starts
+  // straight away: its nodes would have to agree on how far to skip.
+  if (!wallLink().isFollower()) titleOverlay.show(currentAutomaton->getName(), TITLE_DURATION);
+  crossFade.cancel();
+  warmupRemaining = WALL_NODES > 1 ? 0 : WARMUP_GENERATIONS;
+  warmupDone = 0;
+  warmupStart = millis();
+  if (warmupRemaining == 0) crossFade.begin();
+  
+  // The first frame repaints everything, over the old picture or into the
+  // empty offscreen frame
+  currentAutomaton->markAllDirty();
   
   // Reset the timer
   lastAutomatonChange = millis();
-  
-  Serial1.print("Selected automaton: ");
-  Serial1.println(currentAutomaton->getName());
+  lastSnapshot = lastAutomatonChange;
+  snapshotWait = SNAPSHOT_DELAY;
+  frameScheduler.reset();
+  telemetry.reset();
+  
+  Print& out = logOut();
+  out.print("Selected automaton: ");
+  out.print(currentAutomaton->getName());
+  out.print(" (seed ");
+  out.print(automatonSeed);
+  out.print(", set up in ");
+  out.print(micros() - switchStart);
+  out.println(" us)");
+  printMemory();
+}
+
+// Carry on with the automaton saved in flash last, from where it was
+// saved. False if there is none that fits this build and display.
+bool restoreAutomaton() {
+  SnapshotStore::Header header;
+  const uint8_t* saved;
+  if (!snapshotStore.findLatest(header, saved)) return false;
+  if (header.width != TOTAL_WIDTH || header.height != TOTAL_HEIGHT) return false;
+  
+  uint32_t restoreStart = micros();
+  CellularAutomaton* automaton = createAutomatonOfType(header.type, header.param, &display, TOTAL_WIDTH, TOTAL_HEIGHT);
+  if (automaton == nullptr) return false;
+  Snapshot load(Snapshot::LOAD, saved, header.length);
+  automaton->snapshot(load);
+  if (!load.good()) {
+    delete automaton;
+    return false;
+  }
+  currentAutomaton = automaton;
+  lastAutomatonType = header.type;
+  titleOverlay.show(currentAutomaton->getName(), TITLE_DURATION);
+  
+  // Its remaining run time carries over too
+  lastAutomatonChange = millis() - min(header.runMs, (uint32_t)AUTOMATON_DURATION);
+  lastSnapshot = millis();
+  snapshotWait = SNAPSHOT_INTERVAL;
+  frameScheduler.reset();
+  telemetry.reset();
+  
+  Print& out = logOut();
+  out.print("Resumed automaton: ");
+  out.print(currentAutomaton->getName());
+  out.print(" after ");
+  out.print(header.runMs / 1000);
+  out.print(" s (restored in ");
+  out.print(micros() - restoreStart);
+  out.println(" us)");
+  printMemory();
+  return true;
+}
+
+// Switch the current automaton to its preset (or rule) number n, for the
+// automata that have numbered ones. False if it has none or n is too big.
+bool applyPreset(uint32_t n) {
+  switch (lastAutomatonType) {
+    case 0:
+      if (n > 255) return false;
+      static_cast<ElementaryAutomaton*>(currentAutomaton)->setRule(n);
+      break;
+    case 1:
+      if (n > GameOfLife::DIAMOEBA) return false;
+      static_cast<GameOfLife*>(currentAutomaton)->setRuleSet((GameOfLife::RuleSet)n);
+      break;
+    case 4:
+      if (n > CyclicAutomaton::SKIP_STATES) return false;
+      static_cast<CyclicAutomaton*>(currentAutomaton)->setPreset((CyclicAutomaton::Preset)n);
+      break;
+    case 7:
+      if (n >= LargerThanLife::NUM_PRESETS) return false;
+      static_cast<LargerThanLife*>(currentAutomaton)->setPreset((LargerThanLife::Preset)n);
+      break;
+    default:
+      return false;
+  }
+  currentAutomaton->markAllDirty();
+  telemetry.reset();
+  return true;
+}
+
+// Report the benchmark that just timed its last generation
+void finishBenchmark() {
+  unsigned long elapsed = millis() - benchStart;
+  currentAutomaton->printStats(logOut());
+  Print& out = logOut();
+  out.print("Benchmark: ");
+  out.print(benchGenerations);
+  out.print(" generations in ");
+  out.print(elapsed);
+  out.print(" ms, ");
+  out.print(elapsed > 0 ? benchGenerations * 1000.0f / elapsed : 0.0f, 1);
+  out.println(" per second");
+}
+
+void printHelp() {
+  Print& out = logOut();
+  out.println("Commands (a number, then a letter):");
+  out.println("  t  stage timing now      <s>i  timing every s seconds, 0 off");
+  out.println("  <n>a  run automaton type n only (9 or more: any)");
+  out.println("  <n>p  preset or rule n of the current automaton");
+  out.println("  <seed>s  replay from seed (0: random)");
+  out.println("  <fps>f  target frame rate (0: default)");
+  out.println("  <n>g  generations per frame (0: default)");
+  out.println("  <ms>m  telemetry every ms (0 off)");
+  out.println("  <n>b  time the next n generations");
+  out.println("  <n>w  benchmark every automaton and preset, n generations each");
+  out.println("  o  frame-time overlay on/off");
+  out.println("  r  rewrite the panel registers   h  this help");
+}
+
+// Act on one console command: its letter and the number typed before it
+// (0 if none). Core 1 is idle, so the automaton can be changed directly.
+void runCommand(char c, uint32_t n) {
+  Print& out = logOut();
+  switch (c) {
+    case 't':
+      statsRequested = true;
+      break;
+    case 'i':
+      statsInterval = n * 1000;
+      lastStatsReport = millis();
+      break;
+    case 'r':
+      panelDriver.write();
+      break;
+    case 's':
+      replaySeed = n;
+      replaySwitches = 0;
+      restartRequested = true;
+      break;
+    case 'a':
+      onlyType = n < NUM_AUTOMATA ? n : 255;
+      restartRequested = true;
+      break;
+    case 'p':
+      if (applyPreset(n)) {
+        out.print("Preset now ");
+        out.println(currentAutomaton->getName());
+      } else {
+        out.print("No preset ");
+        out.print(n);
+        out.print(" for ");
+        out.println(currentAutomaton->getName());
+      }
+      break;
+    case 'f':
+      // Past 1000 fps the period would round down to 0 ms
+      frameScheduler.setTargetPeriod(n > 0 ? max(1000 / n, (uint32_t)1) : FRAME_PERIOD);
+      out.print("Target frame period ");
+      out.print(frameScheduler.getPeriod() / 1000);
+      out.println(" ms");
+      break;
+    case 'g':
+      generationsPerFrame = n > 0 ? min(n, (uint32_t)UINT16_MAX) : GENERATIONS_PER_FRAME;
+      out.print("Generations per frame ");
+      out.println(generationsPerFrame);
+      break;
+    case 'm':
+      telemetry.setInterval(n);
+      break;
+    case 'w':
+      sweepRequested = n > 0 ? n : SWEEP_GENERATIONS;
+      break;
+    case 'b':
+      benchGenerations = n > 0 ? n : BENCH_GENERATIONS;
+      benchRemaining = benchGenerations;
+      benchStart = millis();
+      currentAutomaton->resetStats();
+      out.print("Timing the next ");
+      out.print(benchGenerations);
+      out.println(" generations");
+      break;
+    case 'o':
+      perfHud.show(!perfHud.isVisible());
+      break;
+    case 'h':
+    case '?':
+      printHelp();
+      break;
+  }
+}
+
+// Read console commands from Serial1: only the bytes that have arrived,
+// each acted on as soon as its letter is in, so nothing waits for the rest
+// of a line. The number typed so far carries over to the next frame.
+void pollConsole() {
+  static uint32_t number = 0;
+  while (Serial1.available()) {
+    char c = Serial1.read();
+    if (c >= '0' && c <= '9') {
+      number = number * 10 + (c - '0');
+      continue;
+    }
+    if (c != '\r' && c != '\n' && c != ' ') runCommand(c, number);
+    number = 0;
+  }
 }
 
 // Function to display test pattern with position labels
@@ -393,7 +674,7 @@ void displayTestPattern() {
   
   // Map the logical coordinates to physical coordinates
   int16_t physicalTextX, physicalTextY;
-  mapCoordinates(logicalTextX, logicalTextY, &physicalTextX, &physicalTextY);
+  PanelMap::map(logicalTextX, logicalTextY, &physicalTextX, &physicalTextY);
   
   // Set cursor to the mapped position
   matrix.setCursor(physicalTextX, physicalTextY);
@@ -408,7 +689,7 @@ void displayTestPattern() {
   for (int y = -10; y <= 10; y++) {
     for (int x = -10; x <= 10; x++) {
       if (x*x + y*y <= 100) { // Circle with radius 10
-        drawMappedPixel(&matrix, PANEL_WIDTH/2 + x, PANEL_HEIGHT/2 + y, RED);
+        drawMappedPixel(&display, PANEL_WIDTH/2 + x, PANEL_HEIGHT/2 + y, RED);
       }
     }
   }
@@ -416,7 +697,7 @@ void displayTestPattern() {
   // Green square in top right quadrant
   for (int y = -10; y <= 10; y++) {
     for (int x = -10; x <= 10; x++) {
-      drawMappedPixel(&matrix, PANEL_WIDTH + PANEL_WIDTH/2 + x, PANEL_HEIGHT/2 + y, GREEN);
+      drawMappedPixel(&display, PANEL_WIDTH + PANEL_WIDTH/2 + x, PANEL_HEIGHT/2 + y, GREEN);
     }
   }
   
@@ -425,49 +706,89 @@ void displayTestPattern() {
     for (int x = -10; x <= 10; x++) {
       // Simple triangle check
       if (y <= 0 && y >= -x && y >= x) {
-        drawMappedPixel(&matrix, PANEL_WIDTH/2 + x, PANEL_HEIGHT + PANEL_HEIGHT/2 + y, BLUE);
+        drawMappedPixel(&display, PANEL_WIDTH/2 + x, PANEL_HEIGHT + PANEL_HEIGHT/2 + y, BLUE);
       }
     }
   }
   
   // White X in bottom right quadrant
   for (int i = -10; i <= 10; i++) {
-    drawMappedPixel(&matrix, PANEL_WIDTH + PANEL_WIDTH/2 + i, PANEL_HEIGHT + PANEL_HEIGHT/2 + i, WHITE);
-    drawMappedPixel(&matrix, PANEL_WIDTH + PANEL_WIDTH/2 + i, PANEL_HEIGHT + PANEL_HEIGHT/2 - i, WHITE);
+    drawMappedPixel(&display, PANEL_WIDTH + PANEL_WIDTH/2 + i, PANEL_HEIGHT + PANEL_HEIGHT/2 + i, WHITE);
+    drawMappedPixel(&display, PANEL_WIDTH + PANEL_WIDTH/2 + i, PANEL_HEIGHT + PANEL_HEIGHT/2 - i, WHITE);
   }
   
   // Show the pattern
   matrix.show();
   
   // Log the panel configuration
-  Serial1.println("Panel configuration test pattern displayed");
-  Serial1.println("Panel mapping (logical to physical):");
+  Print& out = logOut();
+  out.println("Panel configuration test pattern displayed");
+  out.println("Panel mapping (logical to physical):");
   for (int i = 0; i < PANEL_COUNT; i++) {
-    Serial1.print("Logical ");
-    Serial1.print(i);
-    Serial1.print(" -> Physical ");
-    Serial1.print(PANEL_CONFIGS[i].physicalPosition);
-    Serial1.print(", Rotation: ");
-    Serial1.println(PANEL_CONFIGS[i].rotation);
+    out.print("Logical ");
+    out.print(i);
+    out.print(" -> Physical ");
+    out.print(PANEL_CONFIGS[i].physicalPosition);
+    out.print(" on chain ");
+    out.print(PANEL_CONFIGS[i].chain);
+    out.print(", Rotation: ");
+    out.println(PANEL_CONFIGS[i].rotation);
   }
 }
 
+// One frame of a new automaton's warm-up: it runs generations undrawn for
+// most of the frame period (on core 1 with the pipeline, while this core
+// puts the title up), and the panels keep the title over the old picture.
+// Once WARMUP_GENERATIONS or WARMUP_MS are reached, the cross-fade starts
+// from the generation it got to.
+void warmUpFrame() {
+  uint32_t budgetUs = frameScheduler.getPeriod() * 3 / 4; // The rest is the show
+#if DUAL_CORE_PIPELINE
+  rp2040.fifo.push(budgetUs);
+  titleOverlay.update();
+  compositor.flatten();
+  display.show();
+  uint32_t ran = rp2040.fifo.pop();
+#else
+  uint32_t ran = currentAutomaton->advance(warmupRemaining, budgetUs);
+  titleOverlay.update();
+  compositor.flatten();
+  display.show();
+#endif
+  warmupRemaining -= min(ran, warmupRemaining);
+  warmupDone += ran;
+  
+  if (warmupRemaining > 0 && millis() - warmupStart < WARMUP_MS) return;
+  warmupRemaining = 0;
+  crossFade.begin();
+  Print& out = logOut();
+  out.print("Warmed up ");
+  out.print(warmupDone);
+  out.print(" generations in ");
+  out.print(millis() - warmupStart);
+  out.println(" ms");
+}
+
 void setup() {
   Serial1.begin(115200);
-  Serial1.println("LED Matrix Panel Animation");
+  serialLog().begin(); // Log lines go out by DMA from here on
+  Serial.begin(STREAM_BAUD);
+  logOut().println("LED Matrix Panel Animation");
   
   pinMode(LED_BUILTIN, OUTPUT);
   digitalWrite(LED_BUILTIN, HIGH); // LED on during setup
   
-  // Initialize random seed from an unconnected analog pin
-  randomSeed(analogRead(A0));
+  // Initialize random seed from an unconnected analog pin (before
+  // wallLink().begin() claims GPIO 26 on a wall)
+  fastRandomSeed(analogRead(A0));
   
   // Initialize the panels
-  Reginit();
+  panelDriver.begin();
   
-  if (matrix.begin() != PROTOMATTER_OK) {
-    Serial1.println("Matrix initialization failed!");
+  if (!display.begin(logOut())) {
+    logOut().println("Matrix initialization failed!");
     while (1) {
+      serialLog().service();
       digitalWrite(LED_BUILTIN, LOW);
       delay(100);
       digitalWrite(LED_BUILTIN, HIGH);
@@ -475,22 +796,198 @@ void setup() {
     }
   }
   
-  Serial1.println("Matrix initialized successfully");
+  logOut().println("Matrix initialized successfully");
+  
+  // Precompute the logical-to-physical pixel map before anything is drawn
+  PanelMap::begin();
+  display.setPixelMap(PanelMap::data());
+  display.setSwapCallback(onFrameSwapped); // For the stats report
+  printStaticMemory();
+  printMemory(); // The display's buffers are on the heap by now
+  perfHud.show(PERF_HUD);
   digitalWrite(LED_BUILTIN, LOW); // LED off when ready
   
-  // Start with a random cellular automaton
-  selectRandomAutomaton();
+  if (BENCHMARK > 0) runBenchmarkSweep(BENCHMARK);
+  wallLink().begin();
+  
+  // Resume the automaton that was running, or start with a random one
+  // (always a new one when replaying a seed, or on a wall, where the
+  // other nodes wait for node 0 to start one)
+  if (wallLink().isFollower()) {
+    logOut().println("Wall node waiting for node 0 to start an automaton");
+  } else if (replaySeed != 0 || WALL_NODES > 1 || !restoreAutomaton()) {
+    selectRandomAutomaton();
+  }
 }
 
 void loop() {
+  // Send whatever was logged since the last frame
+  serialLog().service();
+  
+  // A host streaming frames has the display to itself. Core 1 waits on the
+  // FIFO meanwhile, and the automaton picks up where it was afterwards.
+  if (frameStream.poll()) {
+    if (!streaming) {
+      streaming = true;
+      crossFade.cancel();
+      logOut().println("Streaming frames from USB");
+    }
+    return;
+  }
+  if (streaming) {
+    streaming = false;
+    Print& out = logOut();
+    out.print("Stream ended, ");
+    out.print(frameStream.takeFrameCount());
+    out.print(" frames shown, ");
+    out.print(frameStream.takeSkippedCount());
+    out.println(" deltas skipped waiting for a key frame");
+    if (currentAutomaton != nullptr) currentAutomaton->markAllDirty();
+    lastAutomatonChange = millis();
+    frameScheduler.reset();
+  }
+  
+  // A new automaton fast-forwarding under its title
+  if (currentAutomaton != nullptr && warmupRemaining > 0) {
+    warmUpFrame();
+    frameScheduler.endFrame();
+    pollConsole();
+    return;
+  }
+  
   // Update the current automaton
   if (currentAutomaton != nullptr) {
-    currentAutomaton->step();
-    delay(FRAME_DELAY); // Wait between frames
+    frameGenerations = benchRemaining > 0 ? min((uint32_t)generationsPerFrame, benchRemaining)
+                                          : generationsPerFrame;
+#if DUAL_CORE_PIPELINE
+    // Generation N is ready: draw it into the canvas, then hand the automaton
+    // to core 1 for generation N+1 while this core converts and shows N.
+    // render() and update() never overlap, so the cell buffers need no lock;
+    // the SIO FIFO push/pop is the handoff.
+    currentAutomaton->draw();
+    rp2040.fifo.push(0);
+    crossFade.composite();
+    titleOverlay.update();
+    compositor.flatten();
+    wallLink().syncFrame(); // Every node of a wall shows the frame at once
+    currentAutomaton->present();
+    rp2040.fifo.pop();  // Core 1 has finished generation N+1
+#else
+    currentAutomaton->computeMany(frameGenerations);
+    currentAutomaton->draw();
+    crossFade.composite();
+    titleOverlay.update();
+    compositor.flatten();
+    wallLink().syncFrame(); // Every node of a wall shows the frame at once
+    currentAutomaton->present();
+#endif
+    
+    // A layer taken down uncovered pixels the automaton only redraws when
+    // they change. Core 1 is idle again, so the dirty flags are safe to touch.
+    int16_t damageX, damageY;
+    uint16_t damageW, damageH;
+    if (compositor.takeDamage(damageX, damageY, damageW, damageH)) {
+      currentAutomaton->markAreaDirty(damageX, damageY, damageW, damageH);
+    }
+    
+    // The counters now describe the generation core 1 just computed
+    telemetry.update(*currentAutomaton, lastAutomatonType, frameGenerations);
+    perfHud.addFrame(currentAutomaton->getLastUpdateUs(), currentAutomaton->getLastRenderUs(),
+                     frameScheduler.getPeriod());
+    
+    // Take a snapshot now and then and write it out a piece per frame; the
+    // copy is taken here because core 1 is idle (see SnapshotStore.h)
+    if (replaySeed == 0 && WALL_NODES < 2 && !snapshotStore.busy() && millis() - lastSnapshot > snapshotWait) {
+      lastSnapshot = millis();
+      if (snapshotStore.begin(currentAutomaton, lastAutomatonType, millis() - lastAutomatonChange,
+                              TOTAL_WIDTH, TOTAL_HEIGHT)) {
+        snapshotWait = SNAPSHOT_INTERVAL;
+      } else {
+        // The flash keeps the last automaton's snapshot, which a reboot
+        // would resume, so try again soon rather than at the interval
+        Print& out = logOut();
+        out.print("Snapshot not saved (");
+        out.print(automatonArena().getFree());
+        out.println(" bytes free in the arena)");
+        snapshotWait = SNAPSHOT_DELAY;
+      }
+    }
+    snapshotStore.step();
+    frameScheduler.endFrame(); // Sleep off the rest of the frame period
+    
+    // Console commands, a few bytes at most per frame
+    pollConsole();
+    if (benchRemaining > 0) {
+      benchRemaining -= frameGenerations;
+      if (benchRemaining == 0) finishBenchmark();
+    }
+    if (statsRequested || (statsInterval > 0 && millis() - lastStatsReport > statsInterval)) {
+      statsRequested = false;
+      currentAutomaton->printStats(logOut());
+      printRefreshRate();
+      printMemory();
+      wallLink().printStats(logOut());
+      if (serialLog().getDropped() > 0) {
+        Print& out = logOut();
+        out.print("  log ");
+        out.print(serialLog().getDropped());
+        out.println(" lines dropped for lack of room so far");
+      }
+      lastStatsReport = millis();
+    }
     
-    // Check if it's time to switch to a new automaton (after 3 minutes)
-    if (millis() - lastAutomatonChange > AUTOMATON_DURATION) {
+    // Check if it's time to switch to a new automaton (after 3 minutes, or
+    // as soon as it has died out or settled into a short cycle)
+    // Core 1 is idle here, so the old automaton can be deleted safely
+    bool stagnant = STAGNANT_GENERATIONS > 0 &&
+                    currentAutomaton->getQuietGenerations() >= STAGNANT_GENERATIONS;
+    if (stagnant) {
+      Print& out = logOut();
+      out.print("Stagnant after ");
+      out.print((millis() - lastAutomatonChange) / 1000);
+      out.println(" s");
+    }
+    if (sweepRequested > 0) {
+      runBenchmarkSweep(sweepRequested);
+      sweepRequested = 0;
+      restartRequested = true;
+    }
+    // The other nodes of a wall only ever switch when node 0 says so, and
+    // node 0 also starts over when one of them has fallen out of step
+    uint8_t startType;
+    uint32_t startSeed;
+    if (wallLink().isFollower()) {
+      restartRequested = false;
+      if (wallLink().takeStart(startType, startSeed)) selectRandomAutomaton(startType, startSeed);
+    } else if (restartRequested || stagnant || wallLink().takeResync() ||
+               millis() - lastAutomatonChange > AUTOMATON_DURATION) {
+      restartRequested = false;
       selectRandomAutomaton();
     }
+  } else {
+    // A wall node that hasn't been started yet
+    uint8_t startType;
+    uint32_t startSeed;
+    wallLink().poll();
+    if (wallLink().takeStart(startType, startSeed)) selectRandomAutomaton(startType, startSeed);
+  }
+}
+
+#if DUAL_CORE_PIPELINE
+// Core 1: a 0 token from core 0 means "compute the next frame's
+// generations", any other a warm-up budget in microseconds to advance() for,
+// answered with the generations run. currentAutomaton only changes while
+// core 1 is waiting here.
+void setup1() {
+}
+
+void loop1() {
+  uint32_t budgetUs = rp2040.fifo.pop();
+  if (budgetUs == 0) {
+    currentAutomaton->computeMany(frameGenerations);
+    rp2040.fifo.push(1);
+  } else {
+    rp2040.fifo.push(currentAutomaton->advance(warmupRemaining, budgetUs));
   }
 }
+#endif
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Summarize where the firmware's RAM and flash go.
+
+Reads the linked ELF with the toolchain's size and nm: RAM and flash used
+by section against the RP2040's 264 KB of SRAM and the board's flash, then
+the largest statically allocated symbols in RAM (the automaton arena, the
+cross-fade frame, the compositor and so on). What isn't static is the heap,
+which the firmware itself reports at each automaton switch (printMemory()
+in src/main.cpp).
+
+As a PlatformIO extra script (see platformio.ini) it also has the linker
+write a map file next to the ELF and adds a target that runs the report:
+
+    pio run -t memory
+
+It runs on its own too, for an ELF built elsewhere:
+
+    memory_report.py .pio/build/pico/firmware.elf --top 40
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+RAM_START, RAM_BYTES = 0x20000000, 264 * 1024
+FLASH_START, FLASH_BYTES = 0x10000000, 2 * 1024 * 1024
+
+# Sections that only reserve address space rather than hold anything
+RESERVED = ('.heap', '.stack_dummy', '.stack1_dummy', '.flash_end')
+
+
+def in_ram(addr):
+    return RAM_START <= addr < RAM_START + RAM_BYTES
+
+
+def in_flash(addr):
+    return FLASH_START <= addr < FLASH_START + FLASH_BYTES
+
+
+def sections(size_tool, elf):
+    """(name, size, address) of every allocated section"""
+    out = subprocess.run([size_tool, '-A', '-d', elf], check=True,
+                         capture_output=True, text=True).stdout
+    result = []
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) == 3 and parts[0].startswith('.') and parts[1].isdigit():
+            name, size, addr = parts[0], int(parts[1]), int(parts[2])
+            if size > 0 and addr > 0:
+                result.append((name, size, addr))
+    return result
+
+
+def ram_symbols(nm_tool, elf):
+    """(size, name) of every symbol in RAM, biggest first: variables, local
+    statics of inline functions (nm type u) and code run from RAM alike"""
+    out = subprocess.run([nm_tool, '-S', '-C', '--size-sort', elf], check=True,
+                         capture_output=True, text=True).stdout
+    result = []
+    for line in out.splitlines():
+        parts = line.split(maxsplit=3)
+        if len(parts) < 4:
+            continue
+        addr, size = int(parts[0], 16), int(parts[1], 16)
+        if in_ram(addr):
+            result.append((size, parts[3]))
+    result.sort(reverse=True)
+    return result
+
+
+def report(elf, size_tool, nm_tool, top, out=sys.stdout):
+    ram = flash = 0
+    out.write(f'{elf}\n\n{"section":<24} {"bytes":>8}  where\n')
+    for name, size, addr in sections(size_tool, elf):
+        if in_ram(addr):
+            where = 'RAM, reserved' if name in RESERVED else 'RAM'
+            if name not in RESERVED:
+                ram += size
+            if name == '.data':
+                flash += size  # Its initial values are copied from flash
+                where += ' (and flash)'
+        elif in_flash(addr):
+            where = 'flash'
+            if name not in RESERVED:
+                flash += size
+        else:
+            continue
+        out.write(f'{name:<24} {size:>8}  {where}\n')
+
+    out.write(f'\nRAM   {ram:>8} of {RAM_BYTES} static, {RAM_BYTES - ram} left for the heap and stacks\n')
+    out.write(f'flash {flash:>8} of {FLASH_BYTES}\n\n')
+
+    symbols = ram_symbols(nm_tool, elf)
+    out.write(f'Largest of {len(symbols)} static symbols in RAM:\n')
+    for size, name in symbols[:top]:
+        out.write(f'{size:>8}  {name}\n')
+
+
+def tool(cc, name):
+    """The toolchain's `name` next to its compiler (arm-none-eabi-gcc)"""
+    if cc.endswith('gcc'):
+        return cc[:-3] + name
+    return name
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RAM and flash used by a firmware ELF')
+    parser.add_argument('elf')
+    parser.add_argument('--top', type=int, default=25, help='symbols to list (default 25)')
+    parser.add_argument('--prefix', default='arm-none-eabi-', help='toolchain prefix')
+    args = parser.parse_args()
+    report(args.elf, args.prefix + 'size', args.prefix + 'nm', args.top)
+
+
+try:
+    Import('env')  # noqa: F821 - PlatformIO (SCons) extra script
+except NameError:
+    env = None
+
+if env is not None:
+    env.Append(LINKFLAGS=['-Wl,-Map,${BUILD_DIR}/${PROGNAME}.map'])
+
+    def memory_target(target, source, env):
+        cc = env.subst('$CC')
+        report(str(source[0]), tool(cc, 'size'), tool(cc, 'nm'), 25)
+        print('\nLink map: ' + os.path.join(env.subst('$BUILD_DIR'), env.subst('$PROGNAME') + '.map'))
+
+    env.AddCustomTarget(
+        name='memory',
+        dependencies='$BUILD_DIR/${PROGNAME}.elf',
+        actions=[memory_target],
+        title='Memory report',
+        description='RAM and flash by section and the largest static symbols')
+elif __name__ == '__main__':
+    main()
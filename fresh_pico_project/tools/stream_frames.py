@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Stream frames to the display over the Pico's USB serial port.
+
+While frames keep arriving the Pico shows them instead of the automata,
+and goes back to the automata about a second after the last one (see
+src/FrameStream.h for the frame format). Needs pyserial.
+
+    stream_frames.py /dev/ttyACM0                  # Game of Life
+    stream_frames.py /dev/ttyACM0 --pattern plasma --indexed
+    stream_frames.py /dev/ttyACM0 --raw clip.rgb565 --loop
+
+A --raw file holds whole frames back to back, each WIDTH x HEIGHT RGB565
+pixels, little-endian (for instance from
+`ffmpeg -i clip.mp4 -vf scale=128:128 -f rawvideo -pix_fmt rgb565le clip.rgb565`).
+
+Frames after the first are sent as deltas, the rectangles that changed
+XORed against the frame before, whenever that is smaller than the whole
+frame; every --keyframe'th frame is sent whole, so a lost frame only
+shows until then. With --indexed, whole frames of up to 256 colors go as
+palette indices.
+"""
+
+import argparse
+import math
+import random
+import struct
+import sys
+import time
+
+import serial
+
+
+def header(kind, width, height):
+    return b'FS' + kind + struct.pack('<HH', width, height)
+
+
+def key_frame(pixels, width, height, indexed):
+    if indexed:
+        palette = sorted(set(pixels))
+        if len(palette) <= 256:
+            lookup = {c: i for i, c in enumerate(palette)}
+            return (header(b'P', width, height) + bytes([len(palette) & 0xFF]) +
+                    struct.pack('<%dH' % len(palette), *palette) +
+                    bytes(lookup[c] for c in pixels))
+    return header(b'R', width, height) + struct.pack('<%dH' % len(pixels), *pixels)
+
+
+def changed_rects(prev, cur, width, height):
+    """Bounding boxes of runs of changed rows, at most 255 of them."""
+    spans = []
+    for y in range(height):
+        row = range(y * width, (y + 1) * width)
+        changed = [i - y * width for i in row if prev[i] != cur[i]]
+        spans.append((changed[0], changed[-1] + 1) if changed else None)
+
+    # A few unchanged rows inside a box cost less than another box header
+    gap = 4
+    while True:
+        rects = []
+        y = 0
+        while y < height:
+            if spans[y] is None:
+                y += 1
+                continue
+            x0, x1 = spans[y]
+            top = bottom = y
+            y += 1
+            while y < height and y - bottom <= gap:
+                if spans[y] is not None:
+                    x0 = min(x0, spans[y][0])
+                    x1 = max(x1, spans[y][1])
+                    bottom = y
+                y += 1
+            y = bottom + 1
+            rects.append((x0, top, x1 - x0, bottom + 1 - top))
+        if len(rects) <= 255:
+            return rects
+        gap *= 2
+
+
+def encode_runs(xors):
+    out = bytearray()
+    i, n = 0, len(xors)
+    while i < n:
+        j = i
+        if xors[i] == 0:
+            while j < n and xors[j] == 0 and j - i < 128:
+                j += 1
+            out.append(j - i - 1)
+        else:
+            while j < n and xors[j] == xors[i] and j - i < 64:
+                j += 1
+            if j - i >= 2:
+                out.append(0xC0 | (j - i - 1))
+                out += struct.pack('<H', xors[i])
+            else:
+                # Up to the next unchanged pixel, or the next repeat
+                j = i + 1
+                while (j < n and j - i < 64 and xors[j] != 0 and
+                       not (j + 1 < n and xors[j + 1] == xors[j])):
+                    j += 1
+                out.append(0x80 | (j - i - 1))
+                out += struct.pack('<%dH' % (j - i), *xors[i:j])
+        i = j
+    return out
+
+
+def delta_frame(prev, cur, width, height):
+    rects = changed_rects(prev, cur, width, height)
+    out = bytearray(header(b'D', width, height))
+    out.append(len(rects))
+    for x0, y0, w, h in rects:
+        out += struct.pack('<HHHH', x0, y0, w, h)
+        xors = [prev[y * width + x] ^ cur[y * width + x]
+                for y in range(y0, y0 + h) for x in range(x0, x0 + w)]
+        out += encode_runs(xors)
+    return bytes(out)
+
+
+def encode(frames, width, height, keyframe, indexed):
+    """Each frame as the smaller of a key frame and a delta."""
+    prev = None
+    since_key = 0
+    for pixels in frames:
+        data = None
+        if prev is not None and since_key + 1 < keyframe:
+            delta = delta_frame(prev, pixels, width, height)
+            if len(delta) < width * height * (1 if indexed else 2):
+                data = delta
+                since_key += 1
+        if data is None:
+            data = key_frame(pixels, width, height, indexed)
+            since_key = 0
+        prev = pixels
+        yield data
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+# A 256-entry rainbow for the plasma
+RAINBOW = [rgb565(*[int(127.5 + 127.5 * math.sin(2 * math.pi * (i / 256.0 + p / 3.0)))
+                   for p in (0, 1, 2)])
+           for i in range(256)]
+
+
+def plasma(width, height):
+    t = 0.0
+    while True:
+        pixels = []
+        for y in range(height):
+            for x in range(width):
+                v = (math.sin(x / 9.0 + t) + math.sin(y / 7.0 - t * 0.7) +
+                     math.sin((x + y) / 13.0 + t * 0.4))
+                pixels.append(RAINBOW[int((v + 3) * 42.5) & 0xFF])
+        yield pixels
+        t += 0.1
+
+
+def life(width, height):
+    """Game of Life on a torus, one row per int, reseeded when it settles."""
+    full = (1 << width) - 1
+    alive, born = rgb565(255, 255, 255), rgb565(0, 160, 255)
+
+    def rotate(row, n):
+        n %= width
+        return ((row << n) | (row >> (width - n))) & full
+
+    rows, history = [], []
+    while True:
+        if not rows or rows in history:
+            rows = [random.getrandbits(width) & random.getrandbits(width) for _ in range(height)]
+            history = []
+        history = (history + [rows])[-8:]
+
+        pixels = []
+        new = []
+        for y in range(height):
+            neighbors = []
+            for r in (rows[y - 1], rows[y], rows[(y + 1) % height]):
+                neighbors += [rotate(r, 1), rotate(r, -1)]
+            neighbors += [rows[y - 1], rows[(y + 1) % height]]
+            # Bit-sliced count of the eight neighbors, to 3 or more
+            ones = twos = fours = 0
+            for n in neighbors:
+                carry = ones & n
+                ones ^= n
+                carry2 = twos & carry
+                twos ^= carry
+                fours |= carry2
+            row = ~fours & twos & (ones | rows[y]) & full
+            new.append(row)
+            for x in range(width):
+                bit = 1 << (width - 1 - x)
+                pixels.append(0 if not row & bit else alive if rows[y] & bit else born)
+        rows = new
+        yield pixels
+
+
+def file_frames(path, width, height, loop):
+    size = width * height * 2
+    while True:
+        with open(path, 'rb') as f:
+            while True:
+                data = f.read(size)
+                if len(data) < size:
+                    break
+                yield list(struct.unpack('<%dH' % (width * height), data))
+        if not loop:
+            return
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('port', help='the Pico\'s USB serial port')
+    parser.add_argument('--size', default='128x128', help='WxH of the frames (default 128x128)')
+    parser.add_argument('--pattern', choices=('life', 'plasma'), default='life',
+                        help='test pattern to send (default life)')
+    parser.add_argument('--raw', help='file of RGB565 frames to send instead of a test pattern')
+    parser.add_argument('--loop', action='store_true', help='repeat the --raw file')
+    parser.add_argument('--indexed', action='store_true',
+                        help='send whole frames of up to 256 colors as palette indices')
+    parser.add_argument('--keyframe', type=int, default=60,
+                        help='send every Nth frame whole (default 60, 1 = no deltas)')
+    parser.add_argument('--fps', type=float, default=0, help='frame rate cap (default: as fast as it goes)')
+    args = parser.parse_args()
+
+    width, height = (int(v) for v in args.size.lower().split('x'))
+    if args.raw:
+        frames = file_frames(args.raw, width, height, args.loop)
+    elif args.pattern == 'plasma':
+        frames = plasma(width, height)
+    else:
+        frames = life(width, height)
+
+    port = serial.Serial(args.port)
+    sent = total = 0
+    start = report = time.monotonic()
+    try:
+        for frame in encode(frames, width, height, max(args.keyframe, 1), args.indexed):
+            port.write(frame)
+            sent += 1
+            total += len(frame)
+            now = time.monotonic()
+            if args.fps > 0:
+                wait = start + sent / args.fps - now
+                if wait > 0:
+                    time.sleep(wait)
+            if now - report >= 5:
+                print('%d frames, %.1f frames/s, %d bytes/frame' %
+                      (sent, sent / (now - start), total // sent))
+                report = now
+    except KeyboardInterrupt:
+        pass
+    port.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
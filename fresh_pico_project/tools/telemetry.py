@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Decode the Pico's telemetry records from its Serial1 log.
+
+The Pico sends a binary record of the running automaton's population and
+activity every TELEMETRY_INTERVAL ms (see src/Telemetry.h for the format)
+between the text lines of its log. This prints the records, one line each,
+or as CSV for a dashboard, and passes the log text through to stderr.
+Needs pyserial.
+
+    telemetry.py /dev/ttyUSB0
+    telemetry.py /dev/ttyUSB0 --csv > run.csv
+
+Send `<ms>m` (for instance with --interval) to change how often records
+come, `0m` to stop them.
+"""
+
+import argparse
+import struct
+import sys
+
+import serial
+
+SYNC = 0xA5
+PAYLOAD = 29
+FIELDS = ('sequence', 'type', 'flags', 'generation', 'generations', 'population',
+          'births', 'deaths', 'changed_rows', 'active_tiles', 'tiles', 'quiet')
+LAYOUT = '<BBBIHIIIHHHH'
+
+POPULATION, ACTIVITY, TILES = 1, 2, 4
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def split(buf):
+    """Records and log text from the bytes so far, and what is left over."""
+    records, text = [], bytearray()
+    i = 0
+    while i < len(buf):
+        if buf[i] != SYNC:
+            text.append(buf[i])
+            i += 1
+            continue
+        if len(buf) - i < PAYLOAD + 3:
+            break  # Wait for the rest of it
+        payload = buf[i + 2:i + 2 + PAYLOAD]
+        if buf[i + 1] == PAYLOAD and crc8(payload) == buf[i + 2 + PAYLOAD]:
+            records.append(dict(zip(FIELDS, struct.unpack(LAYOUT, payload))))
+            i += PAYLOAD + 3
+        else:
+            i += 1  # Not a record after all
+    return records, bytes(text), buf[i:]
+
+
+def describe(r):
+    parts = ['#%-3d type %d gen %-7d' % (r['sequence'], r['type'], r['generation'])]
+    if r['flags'] & POPULATION:
+        parts.append('pop %-6d +%-5d -%-5d' % (r['population'], r['births'], r['deaths']))
+    if r['flags'] & ACTIVITY:
+        parts.append('rows %-4d quiet %-5d' % (r['changed_rows'], r['quiet']))
+    if r['flags'] & TILES:
+        parts.append('tiles %d/%d' % (r['active_tiles'], r['tiles']))
+    return '  '.join(parts)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('port', help='serial port wired to the Pico\'s Serial1')
+    parser.add_argument('--baud', type=int, default=115200, help='baud rate (default 115200)')
+    parser.add_argument('--csv', action='store_true', help='print the records as CSV')
+    parser.add_argument('--interval', type=int, help='ask for a record every this many ms first')
+    args = parser.parse_args()
+
+    port = serial.Serial(args.port, args.baud, timeout=0.1)
+    if args.interval is not None:
+        port.write(b'%dm' % args.interval)
+    if args.csv:
+        print(','.join(FIELDS))
+
+    buf = b''
+    last = None
+    try:
+        while True:
+            buf += port.read(256)
+            records, text, buf = split(buf)
+            if text:
+                sys.stderr.write(text.decode('ascii', 'replace'))
+            for r in records:
+                if last is not None and (r['sequence'] - last - 1) & 0xFF:
+                    sys.stderr.write('(%d records lost)\n' % ((r['sequence'] - last - 1) & 0xFF))
+                last = r['sequence']
+                if args.csv:
+                    print(','.join(str(r[f]) for f in FIELDS))
+                else:
+                    print(describe(r))
+                sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    port.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())